@@ -50,6 +50,10 @@ namespace htd
      *  decomposition algorithm for the given instance. Then the algorithm performing best is called repeatedly in order to
      *  find decompositions of lower width.
      *
+     *  Both the decision rounds and the repeated calls are cut short once a decomposition whose maximum bag size meets
+     *  the lower bound of htd::TreeWidthLowerBoundAlgorithm is found. The progress callback receives the negated maximum
+     *  bag size as first fitness level and the negated distance to this lower bound as second level.
+     *
      *  @note The algorithm always returns a valid tree decomposition according to the provided base
      *  decomposition algorithms and the given manipulations (or nullptr) also if it was interrupted
      *  by a call to htd::LibraryInstance::terminate().
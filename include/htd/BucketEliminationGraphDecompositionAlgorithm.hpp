@@ -176,6 +176,31 @@ namespace htd
              */
             HTD_API std::pair<htd::IGraphDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const;
 
+            /**
+             *  Compute the maximum bag size of the decomposition of the given graph without constructing the decomposition.
+             *
+             *  @param[in] graph    The input graph.
+             *
+             *  @note The result is the maximum bag size of the decomposition BEFORE the manipulation operations are applied. The bags
+             *  are not materialized, the maximum bag size is determined directly from the vertex elimination ordering.
+             *
+             *  @return The maximum bag size of the decomposition of the given graph or (std::size_t)-1 in case that no vertex elimination ordering could be computed or the computation was terminated.
+             */
+            HTD_API std::size_t computeMaximumBagSize(const htd::IMultiHypergraph & graph) const;
+
+            /**
+             *  Compute the maximum bag size of the decomposition of the given graph without constructing the decomposition.
+             *
+             *  @param[in] graph                The input graph.
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *
+             *  @note The result is the maximum bag size of the decomposition BEFORE the manipulation operations are applied. The bags
+             *  are not materialized, the maximum bag size is determined directly from the vertex elimination ordering.
+             *
+             *  @return The maximum bag size of the decomposition of the given graph or (std::size_t)-1 in case that no vertex elimination ordering could be computed or the computation was terminated.
+             */
+            HTD_API std::size_t computeMaximumBagSize(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const;
+
             /**
              *  Set the ordering algorithm which shall be used to compute the vertex elimination ordering.
              *
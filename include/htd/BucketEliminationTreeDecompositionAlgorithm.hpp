@@ -26,7 +26,7 @@
 #define HTD_HTD_BUCKETELIMINATIONTREEDECOMPOSITIONALGORITHM_HPP
 
 #include <htd/Globals.hpp>
-#include <htd/ITreeDecompositionAlgorithm.hpp>
+#include <htd/IWidthEvaluatingTreeDecompositionAlgorithm.hpp>
 #include <htd/IOrderingAlgorithm.hpp>
 #include <htd/IPreprocessedGraph.hpp>
 
@@ -35,9 +35,9 @@
 namespace htd
 {
     /**
-     *  Default implementation of the ITreeDecompositionAlgorithm interface based on bucket elimination.
+     *  Default implementation of the IWidthEvaluatingTreeDecompositionAlgorithm interface based on bucket elimination.
      */
-    class BucketEliminationTreeDecompositionAlgorithm : public htd::ITreeDecompositionAlgorithm
+    class BucketEliminationTreeDecompositionAlgorithm : public htd::IWidthEvaluatingTreeDecompositionAlgorithm
     {
         public:
             /**
@@ -181,6 +181,10 @@ namespace htd
              */
             HTD_API std::pair<htd::ITreeDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const;
 
+            HTD_API std::size_t computeMaximumBagSize(const htd::IMultiHypergraph & graph) const HTD_OVERRIDE;
+
+            HTD_API std::size_t computeMaximumBagSize(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_OVERRIDE;
+
             /**
              *  Set the ordering algorithm which shall be used to compute the vertex elimination ordering.
              *
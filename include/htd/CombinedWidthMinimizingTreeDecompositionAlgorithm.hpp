@@ -45,6 +45,10 @@ namespace htd
      *  the decomposition with lowest width that was found so far. In case that this algorithm is interrupted before
      *  the first iteration is finished, the return value of computeDecomposition() will be nullptr.
      *
+     *  The remaining base algorithms are skipped when a decomposition already reaches the lower bound determined by
+     *  htd::TreeWidthLowerBoundAlgorithm. Fitness evaluations reported by this class contain the negated maximum bag
+     *  size followed by the negated gap to the lower bound.
+     *
      *  @note The algorithm always returns a valid tree decomposition according to the provided base
      *  decomposition algorithms and the given manipulations (or nullptr) also if it was interrupted
      *  by a call to htd::LibraryInstance::terminate().
@@ -219,6 +223,24 @@ namespace htd
 
             HTD_API void setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled) HTD_OVERRIDE;
 
+            /**
+             *  Getter for the number of threads which shall be used by the base algorithms (0=number of hardware threads).
+             *
+             *  @return The number of threads which shall be used by the base algorithms.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used by the base algorithms (0=number of hardware threads).
+             *
+             *  @note The thread count is passed to all base algorithms of type htd::WidthMinimizingTreeDecompositionAlgorithm,
+             *  including the ones which are added after calling this method. The base algorithms themselves are still run
+             *  one after another.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used by the base algorithms.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
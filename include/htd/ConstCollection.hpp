@@ -31,6 +31,7 @@
 #include <htd/Algorithm.hpp>
 
 #include <iterator>
+#include <vector>
 
 namespace htd
 {
@@ -133,6 +134,31 @@ namespace htd
                 return end_;
             }
 
+            /**
+             *  Check whether the elements of the collection are stored contiguously in memory.
+             *
+             *  If this is the case, the elements can be accessed directly via the pointer range [data(), data() + size()).
+             *  Range-based for loops over such a collection do not perform any virtual calls.
+             *
+             *  @return True if the elements of the collection are stored contiguously in memory, false otherwise.
+             */
+            bool isContiguous(void) const HTD_NOEXCEPT
+            {
+                return begin_.isContiguous() && end_.isContiguous();
+            }
+
+            /**
+             *  Getter for a pointer to the first element of a contiguous collection.
+             *
+             *  @note The result is only meaningful if isContiguous() returns true.
+             *
+             *  @return A pointer to the first element of a contiguous collection.
+             */
+            const T * data(void) const HTD_NOEXCEPT
+            {
+                return begin_.position();
+            }
+
             /**
              *  Access the element at the specific position within the collection.
              *
@@ -142,6 +168,11 @@ namespace htd
              */
             const T & operator[](htd::index_t index) const
             {
+                if (isContiguous())
+                {
+                    return begin_.position()[index];
+                }
+
                 htd::ConstIterator<T> position = begin_;
 
                 std::advance(position, index);
@@ -158,6 +189,7 @@ namespace htd
             {
                 begin_ = original.begin_;
                 end_ = original.end_;
+                size_ = original.size_;
 
                 return *this;
             }
@@ -171,6 +203,7 @@ namespace htd
             {
                 begin_ = std::move(original.begin_);
                 end_ = std::move(original.end_);
+                size_ = original.size_;
 
                 return *this;
             }
@@ -185,6 +218,7 @@ namespace htd
             {
                 begin_ = original.begin();
                 end_ = original.end();
+                size_ = original.size();
 
                 return *this;
             }
@@ -224,6 +258,18 @@ namespace htd
                 return ConstCollection<T>(std::begin(collection), std::end(collection), collection.size());
             }
 
+            /**
+             *  Create a new ConstCollection object wrapping the provided vector.
+             *
+             *  The iterators of the resulting collection point directly into the storage of the vector.
+             *
+             *  @param[in] collection   The vector which shall be wrapped.
+             */
+            static ConstCollection<T> getInstance(const std::vector<T> & collection)
+            {
+                return ConstCollection<T>(htd::ConstIterator<T>(collection.data()), htd::ConstIterator<T>(collection.data() + collection.size()), collection.size());
+            }
+
         private:
             /**
              *  An iterator to the first element of the collection.
@@ -79,7 +79,7 @@ namespace htd
             /**
              *  Constructor for an iterator pointing nowhere.
              */
-            ConstIterator(void) HTD_NOEXCEPT : baseIterator_(nullptr)
+            ConstIterator(void) HTD_NOEXCEPT : baseIterator_(nullptr), position_(nullptr), owner_()
             {
 
             }
@@ -90,7 +90,34 @@ namespace htd
              *  @param[in] iterator The underlying iterator.
              */
             template <class Iter>
-            ConstIterator(Iter iterator) : baseIterator_(new htd::ConstIteratorWrapper<Iter, T>(iterator))
+            ConstIterator(Iter iterator) : baseIterator_(new htd::ConstIteratorWrapper<Iter, T>(iterator)), position_(nullptr), owner_()
+            {
+
+            }
+
+            /**
+             *  Constructor for an iterator over contiguous storage.
+             *
+             *  Iterators constructed this way do not allocate a base iterator, they are advanced, dereferenced and
+             *  compared directly via the given pointer.
+             *
+             *  @param[in] position The position of the element in the contiguous storage.
+             */
+            ConstIterator(const T * position) HTD_NOEXCEPT : baseIterator_(nullptr), position_(position), owner_()
+            {
+
+            }
+
+            /**
+             *  Constructor for an iterator over contiguous storage.
+             *
+             *  Iterators constructed this way do not allocate a base iterator, they are advanced, dereferenced and
+             *  compared directly via the given pointer.
+             *
+             *  @param[in] position The position of the element in the contiguous storage.
+             *  @param[in] owner    The owner of the contiguous storage which shall be kept alive as long as the iterator exists.
+             */
+            ConstIterator(const T * position, const std::shared_ptr<const void> & owner) HTD_NOEXCEPT : baseIterator_(nullptr), position_(position), owner_(owner)
             {
 
             }
@@ -104,7 +131,7 @@ namespace htd
              *  the new iterator wrapper. Deleting the base iterator outside the iterator wrapper or using the same base iterator in
              *  different iterator wrappers will lead to undefined behavior.
              */
-            ConstIterator(htd::ConstIteratorBase<T> * iterator) HTD_NOEXCEPT : baseIterator_(iterator)
+            ConstIterator(htd::ConstIteratorBase<T> * iterator) HTD_NOEXCEPT : baseIterator_(iterator), position_(nullptr), owner_()
             {
 
             }
@@ -114,7 +141,7 @@ namespace htd
              *
              *  @param[in] original  The original iterator.
              */
-            ConstIterator<T>(const ConstIterator<T> & original) HTD_NOEXCEPT : baseIterator_(nullptr)
+            ConstIterator<T>(const ConstIterator<T> & original) HTD_NOEXCEPT : baseIterator_(nullptr), position_(original.position_), owner_(original.owner_)
             {
                 if (original.baseIterator_ != nullptr)
                 {
@@ -127,7 +154,7 @@ namespace htd
              *
              *  @param[in] original  The original iterator.
              */
-            ConstIterator<T>(ConstIterator<T> && original) HTD_NOEXCEPT : baseIterator_(nullptr)
+            ConstIterator<T>(ConstIterator<T> && original) HTD_NOEXCEPT : baseIterator_(nullptr), position_(original.position_), owner_(std::move(original.owner_))
             {
                 if (original.baseIterator_ != nullptr)
                 {
@@ -152,10 +179,14 @@ namespace htd
 
             ConstIterator<T> & operator++(void) HTD_NOEXCEPT HTD_OVERRIDE
             {
-                if (baseIterator_!= nullptr)
+                if (baseIterator_ != nullptr)
                 {
                     ++(*baseIterator_);
                 }
+                else
+                {
+                    ++position_;
+                }
 
                 return *this;
             }
@@ -167,7 +198,7 @@ namespace htd
              */
             ConstIterator<T> operator++(int) HTD_NOEXCEPT
             {
-                ConstIterator<T> ret(*baseIterator_);
+                ConstIterator<T> ret(*this);
 
                 operator++();
 
@@ -193,6 +224,10 @@ namespace htd
                     baseIterator_ = original.baseIterator_->clone();
                 }
 
+                position_ = original.position_;
+
+                owner_ = original.owner_;
+
                 return *this;
             }
 
@@ -217,6 +252,10 @@ namespace htd
                     original.baseIterator_ = nullptr;
                 }
 
+                position_ = original.position_;
+
+                owner_ = std::move(original.owner_);
+
                 return *this;
             }
 
@@ -228,7 +267,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    ret = o->baseIterator_ == nullptr;
+                    ret = o->baseIterator_ == nullptr && position_ == o->position_;
                 }
                 else if (o->baseIterator_ != nullptr)
                 {
@@ -251,7 +290,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    ret = rhs.baseIterator_ == nullptr;
+                    ret = rhs.baseIterator_ == nullptr && position_ == rhs.position_;
                 }
                 else if (rhs.baseIterator_ != nullptr)
                 {
@@ -269,7 +308,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    ret = o->baseIterator_ != nullptr;
+                    ret = o->baseIterator_ != nullptr || position_ != o->position_;
                 }
                 else if (o->baseIterator_ != nullptr)
                 {
@@ -292,7 +331,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    ret = rhs.baseIterator_ != nullptr;
+                    ret = rhs.baseIterator_ != nullptr || position_ != rhs.position_;
                 }
                 else if (rhs.baseIterator_ != nullptr)
                 {
@@ -304,12 +343,34 @@ namespace htd
 
             const T * operator->(void) const HTD_OVERRIDE
             {
-                return baseIterator_->operator->();
+                return baseIterator_ != nullptr ? baseIterator_->operator->() : position_;
             }
 
             const T & operator*(void) const HTD_OVERRIDE
             {
-                return baseIterator_->operator*();
+                return baseIterator_ != nullptr ? baseIterator_->operator*() : *position_;
+            }
+
+            /**
+             *  Check whether the iterator directly points into contiguous storage.
+             *
+             *  @return True if the iterator directly points into contiguous storage, false if it relies on a base iterator.
+             */
+            bool isContiguous(void) const HTD_NOEXCEPT
+            {
+                return baseIterator_ == nullptr;
+            }
+
+            /**
+             *  Getter for the position of the iterator within the contiguous storage.
+             *
+             *  @note The result is only meaningful if isContiguous() returns true.
+             *
+             *  @return The position of the iterator within the contiguous storage.
+             */
+            const T * position(void) const HTD_NOEXCEPT
+            {
+                return position_;
             }
 
             ConstIterator<T> * clone(void) const HTD_NOEXCEPT HTD_OVERRIDE
@@ -318,7 +379,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    return new ConstIterator<T>();
+                    return new ConstIterator<T>(*this);
                 }
                 else
                 {
@@ -331,10 +392,15 @@ namespace htd
         private:
             htd::ConstIteratorBase<T> * baseIterator_;
 
-            ConstIterator<T>(const htd::ConstIteratorBase<T> & original) : baseIterator_(original.clone())
-            {
+            /**
+             *  The position within the contiguous storage. This member is only used if no base iterator is present.
+             */
+            const T * position_;
 
-            }
+            /**
+             *  The owner of the contiguous storage, if the storage must be kept alive by the iterator.
+             */
+            std::shared_ptr<const void> owner_;
     };
 }
 
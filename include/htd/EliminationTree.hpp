@@ -0,0 +1,332 @@
+/* 
+ * File:   EliminationTree.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_ELIMINATIONTREE_HPP
+#define HTD_HTD_ELIMINATIONTREE_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IMultiHypergraph.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Elimination tree of a graph with respect to a vertex elimination ordering.
+     *
+     *  Positions refer to the indices of the vertices within the ordering. Each hyperedge is represented by a
+     *  star centered at its element which is eliminated first, i.e., every other element stores the position
+     *  of the center as lower neighbor. The elimination tree is computed via Liu's algorithm with
+     *  path-compressed ancestor links and the bag of the position p induced by the ordering then consists of
+     *  p itself and all positions whose row subtree contains p.
+     */
+    class EliminationTree
+    {
+        public:
+            /**
+             *  Constructor of a new elimination tree.
+             *
+             *  The constructor only stores the lower neighbors of all positions, the tree structure itself is
+             *  computed by the first call of the method build().
+             *
+             *  @param[in] graph    The graph from which the elimination tree shall be computed.
+             *  @param[in] ordering The vertex elimination ordering. The ordering must contain each vertex of the graph exactly once.
+             */
+            EliminationTree(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering) : ordering_(ordering), positions_(), offsets_(ordering.size() + 1, 0), lowerNeighbors_(), parents_(), ancestors_(), marks_()
+            {
+                std::size_t size = ordering.size();
+
+                HTD_ASSERT(graph.vertexCount() == size)
+
+                if (size > 0)
+                {
+                    positions_.resize(graph.vertexAtPosition(size - 1) + 1, (htd::index_t)-1);
+                }
+
+                for (htd::index_t index = 0; index < size; ++index)
+                {
+                    positions_[ordering[index]] = index;
+                }
+
+                for (int pass = 0; pass < 2; ++pass)
+                {
+                    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+                    {
+                        const std::vector<htd::vertex_t> & elements = hyperedge.sortedElements();
+
+                        if (elements.size() > 1)
+                        {
+                            htd::index_t root = center(elements);
+
+                            for (htd::vertex_t element : elements)
+                            {
+                                htd::index_t position = positions_[element];
+
+                                if (position != root)
+                                {
+                                    if (pass == 0)
+                                    {
+                                        ++offsets_[position + 1];
+                                    }
+                                    else
+                                    {
+                                        lowerNeighbors_[offsets_[position]++] = root;
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    if (pass == 0)
+                    {
+                        for (htd::index_t index = 0; index < size; ++index)
+                        {
+                            offsets_[index + 1] += offsets_[index];
+                        }
+
+                        lowerNeighbors_.resize(offsets_[size]);
+                    }
+                    else
+                    {
+                        /* The second pass advanced each offset to the start of the following position. */
+                        for (htd::index_t index = size; index > 0; --index)
+                        {
+                            offsets_[index] = offsets_[index - 1];
+                        }
+
+                        offsets_[0] = 0;
+                    }
+                }
+            }
+
+            /**
+             *  Destructor of an elimination tree.
+             */
+            ~EliminationTree(void)
+            {
+
+            }
+
+            /**
+             *  Getter for the number of positions of the underlying ordering.
+             *
+             *  @return The number of positions of the underlying ordering.
+             */
+            std::size_t size(void) const
+            {
+                return ordering_.size();
+            }
+
+            /**
+             *  Getter for the position of a vertex within the underlying ordering.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The position of the vertex within the underlying ordering.
+             */
+            htd::index_t position(htd::vertex_t vertex) const
+            {
+                return positions_[vertex];
+            }
+
+            /**
+             *  Getter for the position of the element of a hyperedge which is eliminated first.
+             *
+             *  @param[in] elements The elements of the hyperedge.
+             *
+             *  @return The position of the element of the hyperedge which is eliminated first.
+             */
+            htd::index_t center(const std::vector<htd::vertex_t> & elements) const
+            {
+                htd::index_t ret = (htd::index_t)-1;
+
+                for (htd::vertex_t element : elements)
+                {
+                    ret = std::min(ret, positions_[element]);
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Getter for the parent of a position within the elimination tree.
+             *
+             *  @note The method may only be called after the elimination tree was built completely.
+             *
+             *  @param[in] position The position.
+             *
+             *  @return The parent of the position or (htd::index_t)-1 if the position is a root of the elimination tree.
+             */
+            htd::index_t parent(htd::index_t position) const
+            {
+                return parents_[position];
+            }
+
+            /**
+             *  Compute the elimination tree and traverse the row subtree of each position.
+             *
+             *  The rows are processed in ascending order of their positions. For each row r and each position p
+             *  within the row subtree of r, i.e., for each position p < r whose bag contains r, the visitor is
+             *  called with the arguments r and p. The traversal stops as soon as the visitor returns false.
+             *
+             *  @param[in] visitor  The function which shall be called for each position within a row subtree.
+             *
+             *  @return True if all row subtrees were traversed and the elimination tree is complete, false otherwise.
+             */
+            template <typename Visitor>
+            bool build(Visitor && visitor)
+            {
+                const htd::index_t none = (htd::index_t)-1;
+
+                std::size_t size = ordering_.size();
+
+                parents_.assign(size, none);
+
+                ancestors_.assign(size, none);
+
+                marks_.assign(size, none);
+
+                for (htd::index_t row = 0; row < size; ++row)
+                {
+                    marks_[row] = row;
+
+                    for (std::size_t offset = offsets_[row]; offset < offsets_[row + 1]; ++offset)
+                    {
+                        htd::index_t column = lowerNeighbors_[offset];
+
+                        /* Link the root of the subtree containing the column to the current row. */
+                        for (htd::index_t current = column; current != none && current < row;)
+                        {
+                            htd::index_t next = ancestors_[current];
+
+                            ancestors_[current] = row;
+
+                            if (next == none)
+                            {
+                                parents_[current] = row;
+                            }
+
+                            current = next;
+                        }
+
+                        if (!visitSubtree(row, column, visitor))
+                        {
+                            return false;
+                        }
+                    }
+                }
+
+                std::fill(marks_.begin(), marks_.end(), none);
+
+                return true;
+            }
+
+            /**
+             *  Traverse the row subtree of a single position.
+             *
+             *  For each position p within the row subtree of the given row, the visitor is called with the
+             *  arguments row and p. In contrast to build(), rows may be visited in arbitrary order, but each
+             *  row must be visited at most once.
+             *
+             *  @note The method may only be called after the elimination tree was built completely.
+             *
+             *  @param[in] row      The position whose row subtree shall be traversed.
+             *  @param[in] visitor  The function which shall be called for each position within the row subtree.
+             */
+            template <typename Visitor>
+            void traverseRowSubtree(htd::index_t row, Visitor && visitor)
+            {
+                marks_[row] = row;
+
+                for (std::size_t offset = offsets_[row]; offset < offsets_[row + 1]; ++offset)
+                {
+                    visitSubtree(row, lowerNeighbors_[offset], visitor);
+                }
+            }
+
+        private:
+            /**
+             *  The vertex elimination ordering.
+             */
+            const std::vector<htd::vertex_t> & ordering_;
+
+            /**
+             *  The position of each vertex within the ordering.
+             */
+            std::vector<htd::index_t> positions_;
+
+            /**
+             *  The offsets of the lower neighbors of each position within the vector lowerNeighbors_.
+             */
+            std::vector<std::size_t> offsets_;
+
+            /**
+             *  The lower neighbors of all positions in compressed form.
+             */
+            std::vector<htd::index_t> lowerNeighbors_;
+
+            /**
+             *  The parent of each position within the elimination tree.
+             */
+            std::vector<htd::index_t> parents_;
+
+            /**
+             *  The path-compressed ancestor links used by Liu's algorithm.
+             */
+            std::vector<htd::index_t> ancestors_;
+
+            /**
+             *  The row during whose traversal a position was visited last.
+             */
+            std::vector<htd::index_t> marks_;
+
+            /**
+             *  Visit all positions on the path from the given column to the current row which were not visited for the current row yet.
+             *
+             *  @param[in] row      The current row.
+             *  @param[in] column   The lower neighbor of the current row from which the traversal starts.
+             *  @param[in] visitor  The function which shall be called for each position on the path.
+             *
+             *  @return True if the visitor accepted all positions, false otherwise.
+             */
+            template <typename Visitor>
+            bool visitSubtree(htd::index_t row, htd::index_t column, Visitor & visitor)
+            {
+                for (htd::index_t current = column; marks_[current] != row; current = parents_[current])
+                {
+                    marks_[current] = row;
+
+                    if (!visitor(row, current))
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+    };
+}
+
+#endif /* HTD_HTD_ELIMINATIONTREE_HPP */
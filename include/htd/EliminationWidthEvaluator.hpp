@@ -0,0 +1,129 @@
+/* 
+ * File:   EliminationWidthEvaluator.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef HTD_HTD_ELIMINATIONWIDTHEVALUATOR_HPP
+#define HTD_HTD_ELIMINATIONWIDTHEVALUATOR_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/LibraryInstance.hpp>
+
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Class for the computation of the maximum bag size of the decomposition induced by a vertex elimination ordering
+     *  without constructing the decomposition itself.
+     *
+     *  The bag of a vertex consists of the vertex itself and its neighbors which are eliminated later, i.e., the maximum
+     *  bag size is one plus the largest column count of the symbolic Cholesky factor. The evaluator computes the elimination
+     *  tree via path-compressed ancestor links and counts each column by walking the row subtrees of the elimination tree.
+     *  Each hyperedge is represented by a star centered at its earliest eliminated vertex, which induces the same fill as
+     *  the clique on its elements.
+     *
+     *  @note The maximum bag size computed by this class equals the maximum bag size of the decomposition which bucket
+     *  elimination constructs from the same ordering before any manipulation operations are applied.
+     */
+    class EliminationWidthEvaluator
+    {
+        public:
+            /**
+             *  Constructor for a new width evaluator of type EliminationWidthEvaluator.
+             *
+             *  @param[in] manager   The management instance to which the new evaluator belongs.
+             */
+            HTD_API EliminationWidthEvaluator(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Copy constructor for a width evaluator of type EliminationWidthEvaluator.
+             *
+             *  @param[in] original  The original width evaluator.
+             */
+            HTD_API EliminationWidthEvaluator(const htd::EliminationWidthEvaluator & original);
+
+            HTD_API virtual ~EliminationWidthEvaluator();
+
+            /**
+             *  Compute the maximum bag size of the decomposition induced by the given vertex elimination ordering.
+             *
+             *  @param[in] graph    The input graph.
+             *  @param[in] ordering The vertex elimination ordering which contains each vertex of the graph exactly once.
+             *
+             *  @return The maximum bag size of the decomposition induced by the given vertex elimination ordering.
+             */
+            HTD_API std::size_t computeMaximumBagSize(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering) const;
+
+            /**
+             *  Compute the maximum bag size of the decomposition induced by the given vertex elimination ordering.
+             *
+             *  The computation stops as soon as the first bag larger than maxBagSize is detected, hence the effort for
+             *  orderings which exceed the bound is proportional to the size of the graph plus the number of vertices times
+             *  maxBagSize.
+             *
+             *  @param[in] graph        The input graph.
+             *  @param[in] ordering     The vertex elimination ordering which contains each vertex of the graph exactly once.
+             *  @param[in] maxBagSize   The upper bound for the maximum bag size.
+             *
+             *  @return The maximum bag size of the decomposition induced by the given vertex elimination ordering or maxBagSize + 1
+             *  in case that the maximum bag size exceeds the given upper bound.
+             */
+            HTD_API std::size_t computeMaximumBagSize(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering, std::size_t maxBagSize) const;
+
+            /**
+             *  Getter for the associated management class.
+             *
+             *  @return The associated management class.
+             */
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Set a new management class for the library object.
+             *
+             *  @param[in] manager   The new management class for the library object.
+             */
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Create a deep copy of the current width evaluator.
+             *
+             *  @return A new EliminationWidthEvaluator object identical to the current width evaluator.
+             */
+            HTD_API EliminationWidthEvaluator * clone(void) const;
+
+        protected:
+            /**
+             *  Copy assignment operator for a width evaluator.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized evaluator.
+             */
+            EliminationWidthEvaluator & operator=(const EliminationWidthEvaluator &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_ELIMINATIONWIDTHEVALUATOR_HPP */
@@ -51,7 +51,11 @@ namespace htd
             /**
              *  Set the preprocessing strategy which shall be used.
              *
-             *  @param[in] level    The level of preprocessing which shall be applied. (0: none, 1: simple, 2: advanced, 3: full, 4 or more: full + retain only largest biconnected component)
+             *  At the full preprocessing level, the remaining graph is additionally split at its articulation points
+             *  and at its clique minimal separators. Only the largest part is retained and all other parts are
+             *  eliminated independently of each other using the ordering algorithm of the preprocessor.
+             *
+             *  @param[in] level    The level of preprocessing which shall be applied. (0: none, 1: simple, 2: advanced, 3 or more: full)
              */
             HTD_API void setPreprocessingStrategy(std::size_t level);
 
@@ -91,10 +95,26 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the number of threads which shall be used to eliminate the separated parts of the graph (0=number of hardware threads).
+             *
+             *  @return The number of threads which shall be used to eliminate the separated parts of the graph.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to eliminate the separated parts of the graph (0=number of hardware threads).
+             *
+             *  @note The resulting elimination sequence does not depend on the number of threads.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to eliminate the separated parts of the graph.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             /**
              *  Set the ordering algorithm which shall be used to compute the vertex elimination
-             *  ordering of the remainder of the input graph when only the largest biconnected
-             *  component is retained.
+             *  orderings of the parts of the input graph which are split off from the largest
+             *  part at the full preprocessing level.
              *
              *  @param[in] algorithm    The ordering algorithm which shall be used to compute the vertex elimination ordering.
              *
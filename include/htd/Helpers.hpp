@@ -34,6 +34,7 @@
 #include <htd/FilteredHyperedgeCollection.hpp>
 #include <htd/LibraryInstance.hpp>
 #include <htd/ITreeDecomposition.hpp>
+#include <htd/RandomNumberGenerator.hpp>
 
 #include <algorithm>
 #include <cassert>
@@ -325,18 +326,37 @@ namespace htd
         }
     }
 
+    /**
+     *  Select a random element of a non-empty collection.
+     *
+     *  @param[in] collection   The collection from which an element shall be selected.
+     *  @param[in] generator    The random number generator which shall be used.
+     *
+     *  @return A reference to the selected element.
+     */
     template < typename T, typename Collection >
-    const T & selectRandomElement(const Collection & collection)
+    const T & selectRandomElement(const Collection & collection, htd::RandomNumberGenerator & generator)
     {
         auto position = collection.begin();
 
-        /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-        // coverity[dont_call]
-        std::advance(position, std::rand() % collection.size());
+        std::advance(position, generator.nextIndex(collection.size()));
 
         return *position;
     }
 
+    /**
+     *  Select a random element of a non-empty collection using the random number generator of the calling thread.
+     *
+     *  @param[in] collection   The collection from which an element shall be selected.
+     *
+     *  @return A reference to the selected element.
+     */
+    template < typename T, typename Collection >
+    const T & selectRandomElement(const Collection & collection)
+    {
+        return htd::selectRandomElement<T>(collection, htd::randomNumberGenerator());
+    }
+
     /**
      *  Check whether a collection is sorted in ascending order and free of duplicates.
      *
@@ -313,15 +313,25 @@ namespace htd
              */
             HTD_API bool operator!=(const std::vector<htd::vertex_t> & rhs) const;
 
+        private:
+            htd::id_t id_;
+
             /**
-             *  Forward declaration of internal class for storing the element information of a hyperedge.
+             *  The endpoints of the hyperedge in the order in which they were provided.
              */
-            class IElementInformation;
+            std::vector<htd::vertex_t> elements_;
 
-        private:
-            htd::id_t id_;
+            /**
+             *  The endpoints of the hyperedge sorted in ascending order without duplicates. The collection is
+             *  left empty whenever the elements are already sorted and duplicate-free, in which case the
+             *  elements themselves serve as the sorted collection.
+             */
+            std::vector<htd::vertex_t> sortedElements_;
 
-            std::unique_ptr<IElementInformation> content_;
+            /**
+             *  Recompute the sorted endpoints after the elements of the hyperedge were replaced.
+             */
+            void updateSortedElements(void);
     };
 }
 
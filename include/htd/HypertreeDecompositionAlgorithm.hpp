@@ -116,6 +116,22 @@ namespace htd
 
             HTD_API void setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled) HTD_OVERRIDE;
 
+            /**
+             *  Getter for the number of threads which shall be used to compute the covers of the bags (0=number of hardware threads).
+             *
+             *  @return The number of threads which shall be used to compute the covers of the bags.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to compute the covers of the bags (0=number of hardware threads).
+             *
+             *  @note The resulting decomposition does not depend on the number of threads.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to compute the covers of the bags.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
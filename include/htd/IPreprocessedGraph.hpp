@@ -28,6 +28,7 @@
 #include <htd/Globals.hpp>
 
 #include <htd/IGraphStructure.hpp>
+#include <htd/NeighborhoodSnapshot.hpp>
 
 namespace htd
 {
@@ -96,6 +97,17 @@ namespace htd
              */
             virtual const std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex) const = 0;
 
+            /**
+             *  Getter for the immutable snapshot of the preprocessed neighborhoods in compressed sparse row format.
+             *
+             *  The snapshot contains the same neighborhoods as the function neighborhood(), but it stores them in
+             *  two flat arrays. Ordering algorithms can therefore initialize their working copies from it without
+             *  allocating one vector per vertex.
+             *
+             *  @return The immutable snapshot of the preprocessed neighborhoods.
+             */
+            virtual const htd::NeighborhoodSnapshot & neighborhoodSnapshot(void) const HTD_NOEXCEPT = 0;
+
             /**
              *  Getter for the partial vertex elimination ordering computed during the preprocessing phase.
              *
@@ -116,6 +128,17 @@ namespace htd
              *  @return The lower bound of the treewidth of the input graph.
              */
             virtual std::size_t minTreeWidth(void) const HTD_NOEXCEPT = 0;
+
+            /**
+             *  Getter for the width of the partial vertex elimination ordering computed during the preprocessing phase.
+             *
+             *  The value is at least minTreeWidth(). In contrast to minTreeWidth(), it is not a lower bound for the
+             *  treewidth of the input graph, but the size of the largest bag (minus one) created by eliminating the
+             *  vertices of the partial ordering, e.g., when separated parts of the graph are eliminated heuristically.
+             *
+             *  @return The width of the partial vertex elimination ordering computed during the preprocessing phase.
+             */
+            virtual std::size_t prefixWidth(void) const HTD_NOEXCEPT = 0;
     };
 
     inline htd::IPreprocessedGraph::~IPreprocessedGraph() { }
@@ -0,0 +1,97 @@
+/*
+ * File:   IRerootableTreeDecompositionFitnessFunction.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_IREROOTABLETREEDECOMPOSITIONFITNESSFUNCTION_HPP
+#define HTD_HTD_IREROOTABLETREEDECOMPOSITIONFITNESSFUNCTION_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITreeDecompositionFitnessFunction.hpp>
+
+#include <vector>
+
+namespace htd
+{
+    /**
+     * Interface for fitness functions which can be evaluated for all possible roots of a tree decomposition at once.
+     *
+     * The fitness of a rooted decomposition must be expressible bottom-up: The summary of a subtree is computed from
+     * the bag of its root and the combined summaries of its child subtrees. Given this decomposition, the fitness for
+     * every possible root is obtained via the classic two-pass rerooting scheme in time linear in the size of the tree,
+     * instead of re-evaluating the whole decomposition once per candidate root.
+     *
+     * For each vertex of the decomposition, rootedFitness() with the summary of the decomposition rooted at the vertex
+     * must be equivalent to fitness() after making the vertex the root of the decomposition.
+     */
+    class IRerootableTreeDecompositionFitnessFunction : public htd::ITreeDecompositionFitnessFunction
+    {
+        public:
+            virtual ~IRerootableTreeDecompositionFitnessFunction() = 0;
+
+            /**
+             *  Initialize an aggregate with the neutral element of the operation combine().
+             *
+             *  @param[out] aggregate   The aggregate which shall be initialized.
+             */
+            virtual void initializeAggregate(std::vector<double> & aggregate) const = 0;
+
+            /**
+             *  Combine an aggregate with a subtree summary or with another aggregate.
+             *
+             *  @note The operation must be associative and commutative.
+             *
+             *  @param[in,out] aggregate    The aggregate which shall be updated.
+             *  @param[in] value            The subtree summary or aggregate which shall be combined into the aggregate.
+             */
+            virtual void combine(std::vector<double> & aggregate, const std::vector<double> & value) const = 0;
+
+            /**
+             *  Compute the summary of the subtree rooted at a given vertex.
+             *
+             *  @note The orientation of the given decomposition is arbitrary, so implementations must not access the parent or the children of the vertex.
+             *
+             *  @param[in] graph            The graph from which the decomposition was computed.
+             *  @param[in] decomposition    The tree decomposition.
+             *  @param[in] vertex           The root of the subtree.
+             *  @param[in] childAggregate   The combination of the summaries of all child subtrees of the vertex.
+             *  @param[out] summary         The summary of the subtree rooted at the vertex.
+             */
+            virtual void computeSubtreeSummary(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition, htd::vertex_t vertex, const std::vector<double> & childAggregate, std::vector<double> & summary) const = 0;
+
+            /**
+             *  Compute the fitness evaluation of the decomposition rooted at a given vertex.
+             *
+             *  @param[in] graph            The graph from which the decomposition was computed.
+             *  @param[in] decomposition    The tree decomposition.
+             *  @param[in] root             The root of the decomposition.
+             *  @param[in] summary          The summary of the decomposition rooted at the given vertex.
+             *
+             *  @return The fitness evaluation of the decomposition rooted at the given vertex.
+             */
+            virtual htd::FitnessEvaluation * rootedFitness(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition, htd::vertex_t root, const std::vector<double> & summary) const = 0;
+    };
+
+    inline htd::IRerootableTreeDecompositionFitnessFunction::~IRerootableTreeDecompositionFitnessFunction() { }
+}
+
+#endif /* HTD_HTD_IREROOTABLETREEDECOMPOSITIONFITNESSFUNCTION_HPP */
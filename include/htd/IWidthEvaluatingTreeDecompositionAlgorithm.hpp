@@ -0,0 +1,71 @@
+/* 
+ * File:   IWidthEvaluatingTreeDecompositionAlgorithm.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_IWIDTHEVALUATINGTREEDECOMPOSITIONALGORITHM_HPP
+#define HTD_HTD_IWIDTHEVALUATINGTREEDECOMPOSITIONALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITreeDecompositionAlgorithm.hpp>
+
+namespace htd
+{
+    /**
+     *  Interface for tree decomposition algorithms which are able to determine the maximum bag size of the decomposition
+     *  they would compute without actually constructing it.
+     */
+    class IWidthEvaluatingTreeDecompositionAlgorithm : public htd::ITreeDecompositionAlgorithm
+    {
+        public:
+            virtual ~IWidthEvaluatingTreeDecompositionAlgorithm() = 0;
+
+            /**
+             *  Compute the maximum bag size of the decomposition of the given graph without constructing the decomposition.
+             *
+             *  @param[in] graph    The input graph.
+             *
+             *  @note The result is the maximum bag size of the decomposition BEFORE the manipulation operations are applied.
+             *
+             *  @return The maximum bag size of the decomposition of the given graph or (std::size_t)-1 in case that the maximum bag size could not be determined, e.g. because the computation was terminated.
+             */
+            virtual std::size_t computeMaximumBagSize(const htd::IMultiHypergraph & graph) const = 0;
+
+            /**
+             *  Compute the maximum bag size of the decomposition of the given graph without constructing the decomposition.
+             *
+             *  @param[in] graph                The input graph.
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *
+             *  @note The result is the maximum bag size of the decomposition BEFORE the manipulation operations are applied.
+             *
+             *  @return The maximum bag size of the decomposition of the given graph or (std::size_t)-1 in case that the maximum bag size could not be determined, e.g. because the computation was terminated.
+             */
+            virtual std::size_t computeMaximumBagSize(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const = 0;
+
+            virtual IWidthEvaluatingTreeDecompositionAlgorithm * clone(void) const HTD_OVERRIDE = 0;
+    };
+
+    inline htd::IWidthEvaluatingTreeDecompositionAlgorithm::~IWidthEvaluatingTreeDecompositionAlgorithm() { }
+}
+
+#endif /* HTD_HTD_IWIDTHEVALUATINGTREEDECOMPOSITIONALGORITHM_HPP */
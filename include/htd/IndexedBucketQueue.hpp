@@ -0,0 +1,584 @@
+/* 
+ * File:   IndexedBucketQueue.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_INDEXEDBUCKETQUEUE_HPP
+#define HTD_HTD_INDEXEDBUCKETQUEUE_HPP
+
+#include <htd/Globals.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Priority queue for dense, 0-based identifiers which groups all identifiers of identical priority in one bucket.
+     *
+     *  The buckets are organized in a 4-ary heap and every identifier knows its bucket and its slot within
+     *  the bucket, so that changing the priority of an identifier takes constant time apart from the heap
+     *  operations required when a bucket is created or becomes empty. The buckets of small priorities are
+     *  found via a direct lookup table, larger priorities are resolved via a hash map.
+     *
+     *  Like for std::priority_queue, the top bucket contains the identifiers of the highest priority with
+     *  respect to the given comparison function, e.g. std::greater leads to a queue of minimum priority.
+     *
+     *  @note The order of the identifiers within a bucket is not specified, but it only depends on the
+     *  sequence of operations performed on the queue.
+     */
+    template < typename Compare = std::less<std::size_t> >
+    class IndexedBucketQueue
+    {
+        public:
+            /**
+             *  Constructor of a new priority queue.
+             *
+             *  @param[in] capacity The capacity of the queue. All identifiers which are stored in the queue must be smaller than the capacity.
+             */
+            IndexedBucketQueue(std::size_t capacity) : compare_(), buckets_(), freeBuckets_(), heap_(), denseLookup_(), sparseLookup_(), bucketIndex_(capacity, (htd::index_t)-1), slot_(capacity, 0), size_(0), denseLimit_(4 * capacity + 64)
+            {
+
+            }
+
+            /**
+             *  Destructor of a priority queue.
+             */
+            ~IndexedBucketQueue(void)
+            {
+
+            }
+
+            /**
+             *  Check whether the priority queue is empty.
+             *
+             *  @return True if the priority queue is empty, false otherwise.
+             */
+            bool empty(void) const
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Getter for the number of identifiers stored in the priority queue.
+             *
+             *  @return The number of identifiers stored in the priority queue.
+             */
+            std::size_t size(void) const
+            {
+                return size_;
+            }
+
+            /**
+             *  Check whether an identifier is stored in the priority queue.
+             *
+             *  @param[in] value    The identifier.
+             *
+             *  @return True if the identifier is stored in the priority queue, false otherwise.
+             */
+            bool contains(htd::id_t value) const
+            {
+                return bucketIndex_[value] != (htd::index_t)-1;
+            }
+
+            /**
+             *  Getter for the current priority of an identifier stored in the priority queue.
+             *
+             *  @param[in] value    The identifier.
+             *
+             *  @return The current priority of the identifier.
+             */
+            std::size_t priority(htd::id_t value) const
+            {
+                HTD_ASSERT(contains(value))
+
+                return buckets_[bucketIndex_[value]].priority;
+            }
+
+            /**
+             *  Getter for the highest priority currently stored in the priority queue.
+             *
+             *  @return The highest priority currently stored in the priority queue.
+             */
+            std::size_t topPriority(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return buckets_[heap_[0]].priority;
+            }
+
+            /**
+             *  Access the identifiers of the highest priority.
+             *
+             *  @return The identifiers of the highest priority.
+             */
+            const std::vector<htd::id_t> & topCollection(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return buckets_[heap_[0]].members;
+            }
+
+            /**
+             *  Insert a new identifier into the priority queue.
+             *
+             *  @param[in] value    The identifier. The identifier must not be stored in the priority queue already.
+             *  @param[in] priority The priority of the identifier.
+             */
+            void push(htd::id_t value, std::size_t priority)
+            {
+                HTD_ASSERT(!contains(value))
+
+                htd::index_t bucket = findBucket(priority);
+
+                if (bucket == (htd::index_t)-1)
+                {
+                    bucket = createBucket(priority);
+                }
+
+                insertIntoBucket(bucket, value);
+
+                ++size_;
+            }
+
+            /**
+             *  Remove an identifier from the priority queue.
+             *
+             *  @param[in] value    The identifier.
+             *
+             *  @return True if the identifier was stored in the priority queue, false otherwise.
+             */
+            bool erase(htd::id_t value)
+            {
+                bool ret = contains(value);
+
+                if (ret)
+                {
+                    removeFromBucket(value);
+
+                    bucketIndex_[value] = (htd::index_t)-1;
+
+                    --size_;
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Update the priority of an identifier stored in the priority queue.
+             *
+             *  @param[in] value        The identifier.
+             *  @param[in] newPriority  The new priority of the identifier.
+             */
+            void updatePriority(htd::id_t value, std::size_t newPriority)
+            {
+                HTD_ASSERT(contains(value))
+
+                htd::index_t oldBucket = bucketIndex_[value];
+
+                std::size_t oldPriority = buckets_[oldBucket].priority;
+
+                if (oldPriority != newPriority)
+                {
+                    htd::index_t newBucket = findBucket(newPriority);
+
+                    if (newBucket == (htd::index_t)-1 && buckets_[oldBucket].members.size() == 1)
+                    {
+                        unregisterBucket(oldPriority);
+
+                        buckets_[oldBucket].priority = newPriority;
+
+                        registerBucket(newPriority, oldBucket);
+
+                        restoreHeap(buckets_[oldBucket].heapPosition);
+                    }
+                    else
+                    {
+                        removeFromBucket(value);
+
+                        if (newBucket == (htd::index_t)-1)
+                        {
+                            newBucket = createBucket(newPriority);
+                        }
+
+                        insertIntoBucket(newBucket, value);
+                    }
+                }
+            }
+
+        private:
+            /**
+             *  Structure representing the identifiers of a specific priority.
+             */
+            struct Bucket
+            {
+                /**
+                 *  The priority of the identifiers within the bucket.
+                 */
+                std::size_t priority;
+
+                /**
+                 *  The position of the bucket within the heap.
+                 */
+                htd::index_t heapPosition;
+
+                /**
+                 *  The identifiers within the bucket.
+                 */
+                std::vector<htd::id_t> members;
+            };
+
+            /**
+             *  The arity of the heap.
+             */
+            static const std::size_t ARITY = 4;
+
+            /**
+             *  The function used to compare the priorities.
+             */
+            Compare compare_;
+
+            /**
+             *  The storage of all buckets, including the unused ones.
+             */
+            std::vector<Bucket> buckets_;
+
+            /**
+             *  The indices of the unused buckets.
+             */
+            std::vector<htd::index_t> freeBuckets_;
+
+            /**
+             *  The heap of the indices of the non-empty buckets.
+             */
+            std::vector<htd::index_t> heap_;
+
+            /**
+             *  The lookup table from small priorities to the indices of the corresponding buckets.
+             */
+            std::vector<htd::index_t> denseLookup_;
+
+            /**
+             *  The lookup table from large priorities to the indices of the corresponding buckets.
+             */
+            std::unordered_map<std::size_t, htd::index_t> sparseLookup_;
+
+            /**
+             *  The index of the bucket of each identifier.
+             */
+            std::vector<htd::index_t> bucketIndex_;
+
+            /**
+             *  The position of each identifier within its bucket.
+             */
+            std::vector<htd::index_t> slot_;
+
+            /**
+             *  The number of identifiers stored in the priority queue.
+             */
+            std::size_t size_;
+
+            /**
+             *  The smallest priority which is resolved via the hash map.
+             */
+            std::size_t denseLimit_;
+
+            /**
+             *  Find the bucket of a given priority.
+             *
+             *  @param[in] priority The priority.
+             *
+             *  @return The index of the bucket of the given priority or (htd::index_t)-1 if no such bucket exists.
+             */
+            htd::index_t findBucket(std::size_t priority) const
+            {
+                htd::index_t ret = (htd::index_t)-1;
+
+                if (priority < denseLimit_)
+                {
+                    if (priority < denseLookup_.size())
+                    {
+                        ret = denseLookup_[priority];
+                    }
+                }
+                else
+                {
+                    auto position = sparseLookup_.find(priority);
+
+                    if (position != sparseLookup_.end())
+                    {
+                        ret = position->second;
+                    }
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Register the bucket of a given priority in the lookup tables.
+             *
+             *  @param[in] priority The priority.
+             *  @param[in] bucket   The index of the bucket.
+             */
+            void registerBucket(std::size_t priority, htd::index_t bucket)
+            {
+                if (priority < denseLimit_)
+                {
+                    if (priority >= denseLookup_.size())
+                    {
+                        denseLookup_.resize(std::min(std::max(2 * denseLookup_.size(), priority + 1), denseLimit_), (htd::index_t)-1);
+                    }
+
+                    denseLookup_[priority] = bucket;
+                }
+                else
+                {
+                    sparseLookup_[priority] = bucket;
+                }
+            }
+
+            /**
+             *  Remove the bucket of a given priority from the lookup tables.
+             *
+             *  @param[in] priority The priority.
+             */
+            void unregisterBucket(std::size_t priority)
+            {
+                if (priority < denseLimit_)
+                {
+                    denseLookup_[priority] = (htd::index_t)-1;
+                }
+                else
+                {
+                    sparseLookup_.erase(priority);
+                }
+            }
+
+            /**
+             *  Create a new, empty bucket for a given priority and insert it into the heap.
+             *
+             *  @param[in] priority The priority.
+             *
+             *  @return The index of the new bucket.
+             */
+            htd::index_t createBucket(std::size_t priority)
+            {
+                htd::index_t ret = buckets_.size();
+
+                if (freeBuckets_.empty())
+                {
+                    buckets_.push_back(Bucket());
+                }
+                else
+                {
+                    ret = freeBuckets_.back();
+
+                    freeBuckets_.pop_back();
+                }
+
+                Bucket & bucket = buckets_[ret];
+
+                bucket.priority = priority;
+                bucket.heapPosition = heap_.size();
+
+                heap_.push_back(ret);
+
+                registerBucket(priority, ret);
+
+                siftUp(bucket.heapPosition);
+
+                return ret;
+            }
+
+            /**
+             *  Insert an identifier into a bucket.
+             *
+             *  @param[in] bucket   The index of the bucket.
+             *  @param[in] value    The identifier.
+             */
+            void insertIntoBucket(htd::index_t bucket, htd::id_t value)
+            {
+                std::vector<htd::id_t> & members = buckets_[bucket].members;
+
+                bucketIndex_[value] = bucket;
+
+                slot_[value] = members.size();
+
+                members.push_back(value);
+            }
+
+            /**
+             *  Remove an identifier from its bucket and release the bucket if it becomes empty.
+             *
+             *  @param[in] value    The identifier.
+             */
+            void removeFromBucket(htd::id_t value)
+            {
+                htd::index_t bucket = bucketIndex_[value];
+
+                Bucket & currentBucket = buckets_[bucket];
+
+                std::vector<htd::id_t> & members = currentBucket.members;
+
+                htd::id_t lastValue = members.back();
+
+                members[slot_[value]] = lastValue;
+
+                slot_[lastValue] = slot_[value];
+
+                members.pop_back();
+
+                if (members.empty())
+                {
+                    unregisterBucket(currentBucket.priority);
+
+                    htd::index_t position = currentBucket.heapPosition;
+
+                    htd::index_t lastBucket = heap_.back();
+
+                    heap_.pop_back();
+
+                    if (position < heap_.size())
+                    {
+                        heap_[position] = lastBucket;
+
+                        buckets_[lastBucket].heapPosition = position;
+
+                        restoreHeap(position);
+                    }
+
+                    freeBuckets_.push_back(bucket);
+                }
+            }
+
+            /**
+             *  Check whether the bucket at the first position must be placed above the bucket at the second position of the heap.
+             *
+             *  @param[in] position1    The first position.
+             *  @param[in] position2    The second position.
+             *
+             *  @return True if the bucket at the first position must be placed above the bucket at the second position, false otherwise.
+             */
+            bool precedes(htd::index_t position1, htd::index_t position2) const
+            {
+                return compare_(buckets_[heap_[position2]].priority, buckets_[heap_[position1]].priority);
+            }
+
+            /**
+             *  Swap the buckets at two positions of the heap.
+             *
+             *  @param[in] position1    The first position.
+             *  @param[in] position2    The second position.
+             */
+            void swapBuckets(htd::index_t position1, htd::index_t position2)
+            {
+                std::swap(heap_[position1], heap_[position2]);
+
+                buckets_[heap_[position1]].heapPosition = position1;
+                buckets_[heap_[position2]].heapPosition = position2;
+            }
+
+            /**
+             *  Restore the heap invariant after the priority of the bucket at the given position changed.
+             *
+             *  @param[in] position The position of the bucket.
+             */
+            void restoreHeap(htd::index_t position)
+            {
+                if (position > 0 && precedes(position, (position - 1) / ARITY))
+                {
+                    siftUp(position);
+                }
+                else
+                {
+                    siftDown(position);
+                }
+            }
+
+            /**
+             *  Move the bucket at the given position towards the root of the heap until the heap invariant holds.
+             *
+             *  @param[in] position The position of the bucket.
+             */
+            void siftUp(htd::index_t position)
+            {
+                while (position > 0)
+                {
+                    htd::index_t parent = (position - 1) / ARITY;
+
+                    if (!precedes(position, parent))
+                    {
+                        break;
+                    }
+
+                    swapBuckets(position, parent);
+
+                    position = parent;
+                }
+            }
+
+            /**
+             *  Move the bucket at the given position towards the leaves of the heap until the heap invariant holds.
+             *
+             *  @param[in] position The position of the bucket.
+             */
+            void siftDown(htd::index_t position)
+            {
+                std::size_t heapSize = heap_.size();
+
+                while (true)
+                {
+                    htd::index_t firstChild = position * ARITY + 1;
+
+                    if (firstChild >= heapSize)
+                    {
+                        break;
+                    }
+
+                    htd::index_t bestChild = firstChild;
+
+                    htd::index_t lastChild = std::min(firstChild + ARITY, heapSize);
+
+                    for (htd::index_t child = firstChild + 1; child < lastChild; ++child)
+                    {
+                        if (precedes(child, bestChild))
+                        {
+                            bestChild = child;
+                        }
+                    }
+
+                    if (!precedes(bestChild, position))
+                    {
+                        break;
+                    }
+
+                    swapBuckets(position, bestChild);
+
+                    position = bestChild;
+                }
+            }
+    };
+}
+
+#endif /* HTD_HTD_INDEXEDBUCKETQUEUE_HPP */
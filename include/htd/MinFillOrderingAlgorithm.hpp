@@ -57,6 +57,44 @@ namespace htd
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
 
+            /**
+             *  Getter for the neighborhood size from which on the algorithm switches to its dense elimination engine.
+             *
+             *  @return The neighborhood size from which on the algorithm switches to its dense elimination engine.
+             */
+            HTD_API std::size_t denseNeighborhoodThreshold(void) const;
+
+            /**
+             *  Set the neighborhood size from which on the algorithm switches to its dense elimination engine.
+             *
+             *  The dense engine stores the remaining elimination graph as one bitset per vertex and it computes
+             *  the fill updates via word-parallel intersections. The algorithm switches to the dense engine as
+             *  soon as the closed neighborhood of the next eliminated vertex contains at least the given number
+             *  of vertices and at least 1/16 of the remaining vertices, provided that the bitsets fit into the
+             *  limit given by denseMemoryLimit(). Both engines compute the same ordering.
+             *
+             *  @param[in] threshold    The neighborhood size from which on the algorithm shall switch to its dense elimination engine (0=always use the dense engine, (std::size_t)-1=never use the dense engine).
+             */
+            HTD_API void setDenseNeighborhoodThreshold(std::size_t threshold);
+
+            /**
+             *  Getter for the maximum number of bytes which the dense elimination engine may allocate for its bitsets.
+             *
+             *  @return The maximum number of bytes which the dense elimination engine may allocate for its bitsets.
+             */
+            HTD_API std::size_t denseMemoryLimit(void) const;
+
+            /**
+             *  Set the maximum number of bytes which the dense elimination engine may allocate for its bitsets.
+             *
+             *  The bitsets of the dense engine require space quadratic in the number of remaining vertices. If
+             *  they would exceed the given limit, the algorithm keeps using its sparse elimination engine, even
+             *  if the dense engine is requested via setDenseNeighborhoodThreshold(). (Default: 256 MiB)
+             *
+             *  @param[in] limit    The maximum number of bytes which the dense elimination engine may allocate for its bitsets.
+             */
+            HTD_API void setDenseMemoryLimit(std::size_t limit);
+
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             HTD_API MinFillOrderingAlgorithm * clone(void) const HTD_OVERRIDE;
 #else
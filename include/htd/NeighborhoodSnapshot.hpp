@@ -0,0 +1,216 @@
+/* 
+ * File:   NeighborhoodSnapshot.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_NEIGHBORHOODSNAPSHOT_HPP
+#define HTD_HTD_NEIGHBORHOODSNAPSHOT_HPP
+
+#include <htd/Globals.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Immutable snapshot of the neighborhoods of a preprocessed graph in compressed sparse row format.
+     *
+     *  The neighborhoods of all vertices are stored back to back in a single adjacency array and the
+     *  neighborhood of vertex v occupies the range [offsets[v], offsets[v + 1]) of this array. Hence,
+     *  the complete snapshot consists of exactly two allocations, it can be copied via two block copies
+     *  and it can be shared between concurrent threads without any synchronization.
+     *
+     *  @note Like the neighborhoods of htd::IPreprocessedGraph, the neighborhoods stored in the snapshot
+     *  are sorted in ascending order and they do not include the respective vertex itself.
+     */
+    class NeighborhoodSnapshot
+    {
+        public:
+            /**
+             *  Constructor for an empty neighborhood snapshot.
+             */
+            NeighborhoodSnapshot(void) : offsets_(1, 0), neighbors_()
+            {
+
+            }
+
+            /**
+             *  Constructor for a new neighborhood snapshot.
+             *
+             *  @param[in] neighborhood The neighborhood of each of the vertices.
+             */
+            explicit NeighborhoodSnapshot(const std::vector<std::vector<htd::vertex_t>> & neighborhood) : offsets_(), neighbors_()
+            {
+                assign(neighborhood);
+            }
+
+            /**
+             *  Replace the content of the snapshot by the given neighborhoods.
+             *
+             *  @param[in] neighborhood The neighborhood of each of the vertices.
+             */
+            void assign(const std::vector<std::vector<htd::vertex_t>> & neighborhood)
+            {
+                std::vector<htd::index_t> offsets;
+                std::vector<htd::vertex_t> neighbors;
+
+                offsets.reserve(neighborhood.size() + 1);
+
+                offsets.push_back(0);
+
+                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood)
+                {
+                    offsets.push_back(offsets.back() + currentNeighborhood.size());
+                }
+
+                neighbors.reserve(offsets.back());
+
+                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood)
+                {
+                    neighbors.insert(neighbors.end(), currentNeighborhood.begin(), currentNeighborhood.end());
+                }
+
+                offsets_.swap(offsets);
+                neighbors_.swap(neighbors);
+            }
+
+            /**
+             *  Getter for the number of vertices covered by the snapshot.
+             *
+             *  @return The number of vertices covered by the snapshot.
+             */
+            std::size_t vertexCount(void) const HTD_NOEXCEPT
+            {
+                return offsets_.size() - 1;
+            }
+
+            /**
+             *  Getter for the total number of entries in the adjacency array, i.e., twice the number of edges.
+             *
+             *  @return The total number of entries in the adjacency array.
+             */
+            std::size_t entryCount(void) const HTD_NOEXCEPT
+            {
+                return neighbors_.size();
+            }
+
+            /**
+             *  Getter for the number of neighbors of the given vertex.
+             *
+             *  @param[in] vertex   The vertex whose neighbor count shall be returned.
+             *
+             *  @return The number of neighbors of the given vertex.
+             */
+            std::size_t neighborCount(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount())
+
+                return offsets_[vertex + 1] - offsets_[vertex];
+            }
+
+            /**
+             *  Getter for the begin of the neighborhood of the given vertex.
+             *
+             *  @param[in] vertex   The vertex whose neighborhood shall be accessed.
+             *
+             *  @return A pointer to the first neighbor of the given vertex.
+             */
+            const htd::vertex_t * begin(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount())
+
+                return neighbors_.data() + offsets_[vertex];
+            }
+
+            /**
+             *  Getter for the end of the neighborhood of the given vertex.
+             *
+             *  @param[in] vertex   The vertex whose neighborhood shall be accessed.
+             *
+             *  @return A pointer past the last neighbor of the given vertex.
+             */
+            const htd::vertex_t * end(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount())
+
+                return neighbors_.data() + offsets_[vertex + 1];
+            }
+
+            /**
+             *  Copy the neighborhood of the given vertex to the end of the target vector.
+             *
+             *  @param[in] vertex   The vertex whose neighborhood shall be copied.
+             *  @param[out] target  The target vector to which the neighborhood shall be appended.
+             */
+            void copyNeighborhoodTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
+            {
+                target.insert(target.end(), begin(vertex), end(vertex));
+            }
+
+            /**
+             *  Copy the closed neighborhood of the given vertex, i.e., its neighborhood including the vertex
+             *  itself at its sorted position, to the end of the target vector.
+             *
+             *  @param[in] vertex   The vertex whose closed neighborhood shall be copied.
+             *  @param[out] target  The target vector to which the closed neighborhood shall be appended.
+             */
+            void copyClosedNeighborhoodTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
+            {
+                const htd::vertex_t * first = begin(vertex);
+                const htd::vertex_t * last = end(vertex);
+
+                const htd::vertex_t * position = std::lower_bound(first, last, vertex);
+
+                target.reserve(target.size() + (last - first) + 1);
+
+                target.insert(target.end(), first, position);
+                target.push_back(vertex);
+                target.insert(target.end(), position, last);
+            }
+
+            /**
+             *  Equality operator for neighborhood snapshots.
+             *
+             *  @param[in] rhs  The neighborhood snapshot at the right-hand side of the operator.
+             *
+             *  @return True if the neighborhood snapshot is equal to the neighborhood snapshot at the right-hand side of the operator, false otherwise.
+             */
+            bool operator==(const NeighborhoodSnapshot & rhs) const
+            {
+                return offsets_ == rhs.offsets_ && neighbors_ == rhs.neighbors_;
+            }
+
+        private:
+            /**
+             *  The offsets of the neighborhoods within the adjacency array (one entry per vertex plus a terminating entry).
+             */
+            std::vector<htd::index_t> offsets_;
+
+            /**
+             *  The concatenated neighborhoods of all vertices.
+             */
+            std::vector<htd::vertex_t> neighbors_;
+    };
+}
+
+#endif /* HTD_HTD_NEIGHBORHOODSNAPSHOT_HPP */
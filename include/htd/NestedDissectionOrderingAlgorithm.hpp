@@ -0,0 +1,117 @@
+/* 
+ * File:   NestedDissectionOrderingAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_NESTEDDISSECTIONORDERINGALGORITHM_HPP
+#define HTD_HTD_NESTEDDISSECTIONORDERINGALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IOrderingAlgorithm.hpp>
+
+namespace htd
+{
+    /**
+     *  Implementation of the IOrderingAlgorithm interface based on multilevel nested dissection.
+     *
+     *  The algorithm recursively splits the graph by small vertex separators and orders the vertices of each separator after
+     *  the vertices of the two parts it separates. Each bisection coarsens the graph via heavy-edge matching, partitions the
+     *  coarsest graph by greedy graph growing, refines the edge cut via Fiduccia-Mattheyses passes while projecting the
+     *  partition back to the original graph and finally turns the cut into a vertex separator by computing a minimum vertex
+     *  cover of the cut edges. Parts which contain at most leafSize() vertices are ordered via the minimum-fill heuristic.
+     */
+    class NestedDissectionOrderingAlgorithm : public virtual htd::IOrderingAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new ordering algorithm of type NestedDissectionOrderingAlgorithm.
+             *
+             *  @param[in] manager   The management instance to which the new algorithm belongs.
+             */
+            HTD_API NestedDissectionOrderingAlgorithm(const htd::LibraryInstance * const manager);
+            
+            HTD_API virtual ~NestedDissectionOrderingAlgorithm();
+            
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+            /**
+             *  Getter for the maximum number of vertices of a part which is ordered via the minimum-fill heuristic instead of being dissected further.
+             *
+             *  @return The maximum number of vertices of a part which is ordered via the minimum-fill heuristic instead of being dissected further.
+             */
+            HTD_API std::size_t leafSize(void) const;
+
+            /**
+             *  Set the maximum number of vertices of a part which is ordered via the minimum-fill heuristic instead of being dissected further.
+             *
+             *  @note The minimum-fill heuristic stores the adjacency matrix of each leaf part, hence the leaf size should stay in the order of a few hundred vertices.
+             *
+             *  @param[in] leafSize The maximum number of vertices of a part which is ordered via the minimum-fill heuristic instead of being dissected further (at least 1).
+             */
+            HTD_API void setLeafSize(std::size_t leafSize);
+
+            /**
+             *  Getter for the number of threads which shall be used to dissect independent parts of the graph.
+             *
+             *  @return The number of threads which shall be used to dissect independent parts of the graph.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to dissect independent parts of the graph (0=number of hardware threads).
+             *
+             *  @note Every part is dissected based on its own seed derived from the position of the part in the recursion, hence the computed ordering does not depend on the number of threads.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to dissect independent parts of the graph.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API NestedDissectionOrderingAlgorithm * clone(void) const HTD_OVERRIDE;
+#else
+            HTD_API NestedDissectionOrderingAlgorithm * clone(void) const;
+
+            HTD_API htd::IOrderingAlgorithm * cloneOrderingAlgorithm(void) const HTD_OVERRIDE;
+#endif
+
+        protected:
+            /**
+             *  Copy assignment operator for an ordering algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            NestedDissectionOrderingAlgorithm & operator=(const NestedDissectionOrderingAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_NESTEDDISSECTIONORDERINGALGORITHM_HPP */
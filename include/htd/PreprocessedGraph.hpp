@@ -148,6 +148,9 @@ namespace htd
             /**
              *  Remove a vertex from the graph.
              *
+             *  @note This function does not update the result of the function neighborhoodSnapshot(). After
+             *  modifying the graph, the snapshot has to be refreshed by calling updateNeighborhoodSnapshot().
+             *
              *  @param[in] vertex   The ID of the vertex which shall be removed.
              */
             HTD_API void removeVertex(htd::vertex_t vertex);
@@ -157,6 +160,15 @@ namespace htd
              */
             HTD_API void updateEdgeCount(void);
 
+            HTD_API const htd::NeighborhoodSnapshot & neighborhoodSnapshot(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            /**
+             *  Rebuild the immutable neighborhood snapshot from the current neighborhoods to update the result of the function neighborhoodSnapshot().
+             *
+             *  @note The snapshot is not updated automatically when the neighborhoods are modified via the updatable getters or via removeVertex().
+             */
+            HTD_API void updateNeighborhoodSnapshot(void);
+
             /**
              *  Updatable getter for the partial vertex elimination ordering computed during the preprocessing phase.
              *
@@ -191,6 +203,15 @@ namespace htd
 
             HTD_API std::size_t minTreeWidth(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
+            /**
+             *  Updatable getter for the width of the partial vertex elimination ordering computed during the preprocessing phase.
+             *
+             *  @return The updatable width of the partial vertex elimination ordering computed during the preprocessing phase.
+             */
+            HTD_API std::size_t & prefixWidth(void) HTD_NOEXCEPT;
+
+            HTD_API std::size_t prefixWidth(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             HTD_API PreprocessedGraph * clone(void) const HTD_OVERRIDE;
 #else
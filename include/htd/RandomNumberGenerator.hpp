@@ -0,0 +1,199 @@
+/* 
+ * File:   RandomNumberGenerator.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_RANDOMNUMBERGENERATOR_HPP
+#define HTD_HTD_RANDOMNUMBERGENERATOR_HPP
+
+#include <htd/Globals.hpp>
+
+#include <cstdint>
+
+namespace htd
+{
+    /**
+     *  Fast pseudo-random number generator based on the xoshiro256** algorithm.
+     *
+     *  The generator satisfies the requirements of a uniform random bit generator and
+     *  can therefore be used in combination with the facilities of the header <random>
+     *  and algorithms like std::shuffle. It is not suitable for security related purposes.
+     */
+    class RandomNumberGenerator
+    {
+        public:
+            /**
+             *  The type of the generated numbers.
+             */
+            typedef std::uint64_t result_type;
+
+            /**
+             *  The seed used by default-constructed generators.
+             */
+            static constexpr result_type DEFAULT_SEED = 1;
+
+            /**
+             *  Constructor for a new random number generator.
+             *
+             *  @param[in] seed The seed of the new random number generator.
+             */
+            explicit RandomNumberGenerator(result_type seed = DEFAULT_SEED) HTD_NOEXCEPT : state_()
+            {
+                this->seed(seed);
+            }
+
+            /**
+             *  Re-initialize the state of the random number generator.
+             *
+             *  The state is derived from the given seed via the SplitMix64 algorithm, so
+             *  that similar seeds (e.g. consecutive integers) lead to unrelated sequences.
+             *
+             *  @param[in] seed The new seed of the random number generator.
+             */
+            void seed(result_type seed) HTD_NOEXCEPT
+            {
+                for (result_type & value : state_)
+                {
+                    value = mix(seed);
+                }
+            }
+
+            /**
+             *  Generate the next pseudo-random number.
+             *
+             *  @return The next pseudo-random number.
+             */
+            result_type operator()(void) HTD_NOEXCEPT
+            {
+                const result_type ret = rotateLeft(state_[1] * 5, 7) * 9;
+
+                const result_type t = state_[1] << 17;
+
+                state_[2] ^= state_[0];
+                state_[3] ^= state_[1];
+                state_[1] ^= state_[2];
+                state_[0] ^= state_[3];
+
+                state_[2] ^= t;
+
+                state_[3] = rotateLeft(state_[3], 45);
+
+                return ret;
+            }
+
+            /**
+             *  Generate a pseudo-random number in the interval [0, bound).
+             *
+             *  @param[in] bound    The exclusive upper bound of the generated number. The bound must be greater than 0.
+             *
+             *  @return A pseudo-random number in the interval [0, bound).
+             */
+            std::size_t nextIndex(std::size_t bound) HTD_NOEXCEPT
+            {
+                return static_cast<std::size_t>((*this)() % bound);
+            }
+
+            /**
+             *  Getter for the smallest value which can be generated.
+             *
+             *  @return The smallest value which can be generated.
+             */
+            static constexpr result_type min(void)
+            {
+                return 0;
+            }
+
+            /**
+             *  Getter for the largest value which can be generated.
+             *
+             *  @return The largest value which can be generated.
+             */
+            static constexpr result_type max(void)
+            {
+                return ~static_cast<result_type>(0);
+            }
+
+            /**
+             *  Derive a new seed from a base seed and an index, e.g. the number of an iteration.
+             *
+             *  @param[in] seed     The base seed.
+             *  @param[in] index    The index for which a seed shall be derived.
+             *
+             *  @return The seed which was derived from the given base seed and index.
+             */
+            static result_type deriveSeed(result_type seed, result_type index) HTD_NOEXCEPT
+            {
+                result_type state = seed ^ mix(index);
+
+                return mix(state);
+            }
+
+        private:
+            /**
+             *  The internal state of the random number generator.
+             */
+            result_type state_[4];
+
+            /**
+             *  Rotate the bits of the given value to the left.
+             *
+             *  @param[in] value    The value which shall be rotated.
+             *  @param[in] count    The number of positions by which the value shall be rotated.
+             *
+             *  @return The rotated value.
+             */
+            static result_type rotateLeft(result_type value, int count) HTD_NOEXCEPT
+            {
+                return (value << count) | (value >> (64 - count));
+            }
+
+            /**
+             *  Advance the given SplitMix64 state and return the next output of the SplitMix64 algorithm.
+             *
+             *  @param[in,out] state    The SplitMix64 state.
+             *
+             *  @return The next output of the SplitMix64 algorithm.
+             */
+            static result_type mix(result_type & state) HTD_NOEXCEPT
+            {
+                result_type ret = (state += 0x9E3779B97F4A7C15ULL);
+
+                ret = (ret ^ (ret >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                ret = (ret ^ (ret >> 27)) * 0x94D049BB133111EBULL;
+
+                return ret ^ (ret >> 31);
+            }
+    };
+
+    /**
+     *  Access the random number generator of the calling thread.
+     *
+     *  Every thread owns its own generator, so that concurrent decompositions do not share any
+     *  hidden state. Each generator is initialized with htd::RandomNumberGenerator::DEFAULT_SEED
+     *  and it can be re-seeded via htd::RandomNumberGenerator::seed().
+     *
+     *  @return A reference to the random number generator of the calling thread.
+     */
+    HTD_API htd::RandomNumberGenerator & randomNumberGenerator(void);
+}
+
+#endif /* HTD_HTD_RANDOMNUMBERGENERATOR_HPP */
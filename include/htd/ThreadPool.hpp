@@ -0,0 +1,108 @@
+/* 
+ * File:   ThreadPool.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_THREADPOOL_HPP
+#define HTD_HTD_THREADPOOL_HPP
+
+#include <htd/Globals.hpp>
+
+#include <functional>
+#include <memory>
+
+namespace htd
+{
+    /**
+     *  Fixed-size pool of worker threads processing tasks in first-in-first-out order.
+     *
+     *  The worker threads are started when the pool is constructed and they are joined
+     *  when the pool is destroyed. Tasks are executed by exactly one of the workers and
+     *  no assumption about the order in which concurrently running tasks finish is made.
+     */
+    class ThreadPool
+    {
+        public:
+            /**
+             *  Constructor for a new thread pool.
+             *
+             *  @param[in] threadCount  The number of worker threads of the new pool. If the given number is 0, the number of hardware threads reported by the system is used.
+             */
+            HTD_API ThreadPool(std::size_t threadCount);
+
+            /**
+             *  Copy constructor for a thread pool.
+             *
+             *  @param[in] original The original thread pool which shall be copied.
+             */
+            HTD_API ThreadPool(const ThreadPool & original) = delete;
+
+            /**
+             *  Copy assignment operator for a thread pool.
+             *
+             *  @param[in] original The original thread pool which shall be copied.
+             */
+            HTD_API ThreadPool & operator=(const ThreadPool & original) = delete;
+
+            /**
+             *  Destructor of a thread pool.
+             *
+             *  @note The destructor waits until all submitted tasks are finished.
+             */
+            HTD_API virtual ~ThreadPool();
+
+            /**
+             *  Getter for the number of worker threads of the pool.
+             *
+             *  @return The number of worker threads of the pool.
+             */
+            HTD_API std::size_t threadCount(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Submit a new task to the pool.
+             *
+             *  @param[in] task The task which shall be executed by one of the worker threads.
+             */
+            HTD_API void submit(const std::function<void(void)> & task);
+
+            /**
+             *  Block the calling thread until all tasks submitted so far are finished.
+             */
+            HTD_API void wait(void);
+
+            /**
+             *  Get the number of worker threads which shall be used when the caller requests the given number of threads.
+             *
+             *  @param[in] threadCount  The requested number of threads (0 = number of hardware threads).
+             *
+             *  @return The effective number of threads, which is always at least one.
+             */
+            HTD_API static std::size_t effectiveThreadCount(std::size_t threadCount);
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_THREADPOOL_HPP */
@@ -30,7 +30,7 @@
 #include <htd/IMutableTreeDecomposition.hpp>
 #include <htd/LabeledTree.hpp>
 
-#include <unordered_map>
+#include <deque>
 
 MSVC_PRAGMA_WARNING_PUSH
 MSVC_PRAGMA_DISABLE_WARNING_C4250
@@ -294,9 +294,38 @@ namespace htd
             void getChildBagSetUnion(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const;
 
         private:
-            std::unordered_map<htd::vertex_t, std::vector<htd::vertex_t>> bagContent_;
+            /**
+             *  The bag contents of all nodes, indexed by vertex ID. Slots of vertices which are not part of the decomposition are empty.
+             *
+             *  @note A deque is used so that references returned by mutableBagContent(htd::vertex_t) remain valid when nodes are added.
+             */
+            std::deque<std::vector<htd::vertex_t>> bagContent_;
 
-            std::unordered_map<htd::vertex_t, htd::FilteredHyperedgeCollection> inducedEdges_;
+            /**
+             *  The induced hyperedges of all nodes, indexed by vertex ID. Slots of vertices which are not part of the decomposition are empty.
+             */
+            std::deque<htd::FilteredHyperedgeCollection> inducedEdges_;
+
+            /**
+             *  Ensure that the bag content and the induced hyperedges of the given vertex can be stored.
+             *
+             *  @param[in] vertex   The vertex whose slot shall be available.
+             */
+            void reserveNodeInformation(htd::vertex_t vertex);
+
+            /**
+             *  Release the bag content and the induced hyperedges of a vertex which is no longer part of the decomposition.
+             *
+             *  @param[in] vertex   The vertex whose information shall be released.
+             */
+            void clearNodeInformation(htd::vertex_t vertex);
+
+            /**
+             *  Remove the bag contents and induced hyperedges of all nodes which are no longer part of the decomposition.
+             *
+             *  @note This is needed after the tree structure was replaced by an assignment, because nodes created later on must not see stale information.
+             */
+            void removeObsoleteNodeInformation(void);
     };
 }
 
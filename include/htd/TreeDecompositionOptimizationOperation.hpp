@@ -61,6 +61,10 @@ namespace htd
              *  to the manipulation operation. Deleting the fitness function provided to this constructor outside the
              *  manipulation operation will lead to undefined behavior.
              *
+             *  @note If no manipulation operations are involved and the fitness function implements the interface
+             *  htd::IRerootableTreeDecompositionFitnessFunction, the fitness values of all candidate roots are
+             *  computed in a single rerooting pass instead of evaluating the fitness function once per candidate.
+             *
              *  @param[in] manager                  The management instance to which the new manipulation operation belongs.
              *  @param[in] fitnessFunction          The fitness function which is used to determine the quality of tree decompositions.
              *  @param[in] enforceNaiveOptimization A boolean flag to enforce that each iteration of the optimization algorithm starts from scratch with a copy of the given decomposition.
@@ -133,6 +137,24 @@ namespace htd
              */
             HTD_API void setVertexSelectionStrategy(htd::IVertexSelectionStrategy * strategy);
 
+            /**
+             *  Getter for the number of threads which shall be used to evaluate the candidate roots when the manipulation operations must be re-applied from scratch.
+             *
+             *  @return The number of threads which shall be used to evaluate the candidate roots.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to evaluate the candidate roots when the manipulation operations must be re-applied from scratch (0=number of hardware threads).
+             *
+             *  @note Each thread works on its own copies of the fitness function, the manipulation operations and the decomposition, while
+             *  the labeling functions given to apply() are shared and must therefore support concurrent calls. The selected root does not
+             *  depend on the number of threads.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to evaluate the candidate roots.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
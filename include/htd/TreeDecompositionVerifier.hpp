@@ -57,6 +57,22 @@ namespace htd
             
             HTD_API htd::ConstCollection<htd::vertex_t> violationsConnectednessCriterion(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition) const HTD_OVERRIDE;
 
+            /**
+             *  Getter for the number of threads which shall be used to check the hyperedge coverage and the connectedness criterion.
+             *
+             *  @return The number of threads which shall be used to check the hyperedge coverage and the connectedness criterion.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to check the hyperedge coverage and the connectedness criterion (0=number of hardware threads).
+             *
+             *  @note The detected violations do not depend on the number of threads.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to check the hyperedge coverage and the connectedness criterion.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
         protected:
             /**
              *  Copy assignment operator for a tree decomposition verifier.
@@ -64,6 +80,11 @@ namespace htd
              *  @note This operator is protected to prevent assignments to an already initialized tree decomposition verifier.
              */
             TreeDecompositionVerifier & operator=(const TreeDecompositionVerifier &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
     };
 }
 
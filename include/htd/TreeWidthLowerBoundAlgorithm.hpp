@@ -0,0 +1,136 @@
+/* 
+ * File:   TreeWidthLowerBoundAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_HPP
+#define HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IPreprocessedGraph.hpp>
+#include <htd/LibraryInstance.hpp>
+
+namespace htd
+{
+    /**
+     *  Algorithm for the computation of lower bounds for the treewidth of a preprocessed graph.
+     *
+     *  The bounds are based on the minor-min-width heuristic (MMD+): The algorithm repeatedly selects a vertex of minimum
+     *  degree and contracts it into one of its neighbors. As the treewidth of a minor never exceeds the treewidth of the
+     *  graph itself and every graph has a treewidth of at least its minimum degree, the largest minimum degree observed
+     *  during the contractions is a lower bound for the treewidth. The strategy for selecting the neighbor into which
+     *  the vertex is contracted determines the quality of the bound.
+     *
+     *  @note The bounds refer to the remaining graph of the preprocessed graph, i.e., they are lower bounds for the width
+     *  of every decomposition based on a vertex elimination ordering which starts with the elimination sequence computed
+     *  during the preprocessing phase.
+     */
+    class TreeWidthLowerBoundAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new lower bound algorithm of type TreeWidthLowerBoundAlgorithm.
+             *
+             *  @param[in] manager   The management instance to which the new algorithm belongs.
+             */
+            HTD_API TreeWidthLowerBoundAlgorithm(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Copy constructor for a lower bound algorithm of type TreeWidthLowerBoundAlgorithm.
+             *
+             *  @param[in] original  The original lower bound algorithm.
+             */
+            HTD_API TreeWidthLowerBoundAlgorithm(const htd::TreeWidthLowerBoundAlgorithm & original);
+
+            HTD_API virtual ~TreeWidthLowerBoundAlgorithm();
+
+            /**
+             *  Compute the best lower bound for the treewidth of the given preprocessed graph which is available.
+             *
+             *  The result is the maximum of the lower bound htd::IPreprocessedGraph::minTreeWidth() derived during the
+             *  preprocessing phase, the minor-min-width and the contraction degeneracy bound of the remaining graph.
+             *
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *
+             *  @return A lower bound for the treewidth of the given preprocessed graph.
+             */
+            HTD_API std::size_t computeLowerBound(const htd::IPreprocessedGraph & preprocessedGraph) const;
+
+            /**
+             *  Compute the minor-min-width of the remaining graph, i.e., the MMD+ bound which contracts each selected vertex into its neighbor of minimum degree.
+             *
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *
+             *  @return The minor-min-width of the remaining graph of the given preprocessed graph.
+             */
+            HTD_API std::size_t computeMinorMinWidth(const htd::IPreprocessedGraph & preprocessedGraph) const;
+
+            /**
+             *  Compute a lower bound for the contraction degeneracy of the remaining graph.
+             *
+             *  The contraction degeneracy is the maximum minimum degree over all minors of a graph. The bound is computed via
+             *  the MMD+ heuristic which contracts each selected vertex into the neighbor sharing the least common neighbors with
+             *  it, so that as few edges as possible vanish during the contraction.
+             *
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *
+             *  @return A lower bound for the contraction degeneracy of the remaining graph of the given preprocessed graph.
+             */
+            HTD_API std::size_t computeContractionDegeneracyBound(const htd::IPreprocessedGraph & preprocessedGraph) const;
+
+            /**
+             *  Getter for the associated management class.
+             *
+             *  @return The associated management class.
+             */
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Set a new management class for the library object.
+             *
+             *  @param[in] manager   The new management class for the library object.
+             */
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Create a deep copy of the current lower bound algorithm.
+             *
+             *  @return A new TreeWidthLowerBoundAlgorithm object identical to the current lower bound algorithm.
+             */
+            HTD_API TreeWidthLowerBoundAlgorithm * clone(void) const;
+
+        protected:
+            /**
+             *  Copy assignment operator for a lower bound algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            TreeWidthLowerBoundAlgorithm & operator=(const TreeWidthLowerBoundAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_HPP */
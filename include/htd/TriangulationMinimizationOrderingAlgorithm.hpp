@@ -73,6 +73,22 @@ namespace htd
              */
             HTD_API void setOrderingAlgorithm(htd::IOrderingAlgorithm * algorithm);
 
+            /**
+             *  Getter for the number of threads which shall be used to check the fill edges for redundancy.
+             *
+             *  @return The number of threads which shall be used to check the fill edges for redundancy.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to check the fill edges for redundancy (0=number of hardware threads).
+             *
+             *  @note Only the fill edges of vertices whose neighborhoods do not interact are checked concurrently, hence the computed ordering does not depend on the number of threads.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to check the fill edges for redundancy.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             HTD_API TriangulationMinimizationOrderingAlgorithm * clone(void) const HTD_OVERRIDE;
 #else
@@ -46,6 +46,11 @@ namespace htd
      *
      *  Per default, the first decomposition is returned, i.e. only a single iteration is performed.
      *
+     *  The iterations stop early as soon as the maximum bag size of the best decomposition equals the lower bound
+     *  computed by htd::TreeWidthLowerBoundAlgorithm, because no further iteration can improve it. The fitness passed
+     *  to the progress callback consists of two levels: The negated maximum bag size and the negated gap between the
+     *  maximum bag size and the lower bound.
+     *
      *  @note The algorithm always returns a valid tree decomposition according to the provided base
      *  decomposition algorithm and the given manipulations (or nullptr) also if it was interrupted
      *  by a call to htd::LibraryInstance::terminate().
@@ -251,6 +256,26 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the number of threads which shall be used to perform the iterations (0=number of hardware threads).
+             *
+             *  @return The number of threads which shall be used to perform the iterations.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to perform the iterations (0=number of hardware threads).
+             *
+             *  @note When more than one thread is used, the iterations are run concurrently and their results are committed
+             *  in the order of their iteration index. Each iteration only uses the maximum bag size of the best decomposition
+             *  committed so far as upper bound and each iteration draws its random numbers from a generator seeded via its
+             *  iteration index, so the returned decomposition only depends on the state of htd::randomNumberGenerator() of
+             *  the calling thread and not on the scheduling of the threads.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to perform the iterations.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             /**
              *  Check whether the computed decompositions shall contain only subset-maximal bags.
              *
@@ -30,6 +30,7 @@
 #include <htd/AddEmptyRootOperation.hpp>
 #include <htd/AddIdenticalJoinNodeParentOperation.hpp>
 #include <htd/Algorithm.hpp>
+#include <htd/ApproximateMinimumDegreeOrderingAlgorithm.hpp>
 #include <htd/AssemblyInfo.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
 #include <htd/BidirectionalGraphNaming.hpp>
@@ -53,6 +54,8 @@
 #include <htd/DirectedGraph.hpp>
 #include <htd/DirectedMultiGraphFactory.hpp>
 #include <htd/DirectedMultiGraph.hpp>
+#include <htd/EliminationTree.hpp>
+#include <htd/EliminationWidthEvaluator.hpp>
 #include <htd/EnhancedMaximumCardinalitySearchOrderingAlgorithm.hpp>
 #include <htd/ExchangeNodeReplacementOperation.hpp>
 #include <htd/ExhaustiveVertexSelectionStrategy.hpp>
@@ -146,6 +149,7 @@
 #include <htd/IPathDecompositionManipulationOperation.hpp>
 #include <htd/IPath.hpp>
 #include <htd/IPreprocessedGraph.hpp>
+#include <htd/IRerootableTreeDecompositionFitnessFunction.hpp>
 #include <htd/ISetCoverAlgorithm.hpp>
 #include <htd/IStronglyConnectedComponentAlgorithm.hpp>
 #include <htd/IterativeImprovementTreeDecompositionAlgorithm.hpp>
@@ -161,9 +165,11 @@
 #include <htd/ITreeTraversal.hpp>
 #include <htd/IVertexOrdering.hpp>
 #include <htd/IVertexSelectionStrategy.hpp>
+#include <htd/IWidthEvaluatingTreeDecompositionAlgorithm.hpp>
 #include <htd/IWidthLimitableOrderingAlgorithm.hpp>
 #include <htd/IWidthLimitedVertexOrdering.hpp>
 #include <htd/IWidthMinimizingTreeDecompositionAlgorithm.hpp>
+#include <htd/IndexedBucketQueue.hpp>
 #include <htd/JoinNodeComplexityReductionOperation.hpp>
 #include <htd/JoinNodeNormalizationOperation.hpp>
 #include <htd/JoinNodeReplacementOperation.hpp>
@@ -209,6 +215,8 @@
 #include <htd/NamedTree.hpp>
 #include <htd/NamedVertexHyperedge.hpp>
 #include <htd/NaturalOrderingAlgorithm.hpp>
+#include <htd/NeighborhoodSnapshot.hpp>
+#include <htd/NestedDissectionOrderingAlgorithm.hpp>
 #include <htd/NormalizationOperation.hpp>
 #include <htd/OrderingAlgorithmFactory.hpp>
 #include <htd/PathDecompositionAlgorithmFactory.hpp>
@@ -221,6 +229,7 @@
 #include <htd/PreprocessedGraph.hpp>
 #include <htd/PreprocessorDefinitions.hpp>
 #include <htd/PriorityQueue.hpp>
+#include <htd/RandomNumberGenerator.hpp>
 #include <htd/RandomOrderingAlgorithm.hpp>
 #include <htd/RandomVertexSelectionStrategy.hpp>
 #include <htd/SemiNormalizationOperation.hpp>
@@ -231,12 +240,14 @@
 #include <htd/State.hpp>
 #include <htd/StronglyConnectedComponentAlgorithmFactory.hpp>
 #include <htd/TarjanStronglyConnectedComponentAlgorithm.hpp>
+#include <htd/ThreadPool.hpp>
 #include <htd/TreeDecompositionAlgorithmFactory.hpp>
 #include <htd/TreeDecompositionFactory.hpp>
 #include <htd/TreeDecomposition.hpp>
 #include <htd/TreeDecompositionOptimizationOperation.hpp>
 #include <htd/TreeDecompositionVerifier.hpp>
 #include <htd/Tree.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
 #include <htd/TriangulationMinimizationOrderingAlgorithm.hpp>
 #include <htd/TrivialTreeDecompositionAlgorithm.hpp>
 #include <htd/VectorAdapterConstIteratorWrapper.hpp>
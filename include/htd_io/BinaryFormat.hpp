@@ -0,0 +1,92 @@
+/*
+ * File:   BinaryFormat.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINARYFORMAT_HPP
+#define HTD_IO_BINARYFORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace htd_io
+{
+    /**
+     *  Constants describing the layout of the binary graph and decomposition format 'binary'.
+     *
+     *  Both file types start with a header of HEADER_SIZE bytes consisting of the magic number, the format
+     *  version, the byte order mark, a reserved field (all 32-bit) and three 64-bit counts. All values are
+     *  stored in the byte order of the machine which wrote the file, files written on a machine with a
+     *  different byte order are rejected by the importer.
+     *
+     *  Graph files (magic number GRAPH_MAGIC) store the vertex count, the hyperedge count m and the total
+     *  number of hyperedge endpoints k in the header. The header is followed by m + 1 64-bit offsets and
+     *  k 32-bit vertex identifiers, the endpoints of hyperedge i are located at the positions offset[i]
+     *  to offset[i + 1] - 1. Vertices are identified by the numbers 1 to vertex count.
+     *
+     *  Decomposition files (magic number TREE_DECOMPOSITION_MAGIC) store the node count n, the vertex
+     *  count of the decomposed graph and the total size k of all bags in the header. The header is followed
+     *  by n + 1 64-bit bag offsets, n 32-bit parent indices and k 32-bit vertex identifiers. The nodes are
+     *  stored in pre-order, i.e., the root is located at index 0 and has the parent index NO_PARENT and
+     *  the parent of every other node is located at a smaller index.
+     *
+     *  (See https://github.com/mabseher/htd/FORMATS.md for information about the available formats.)
+     */
+    struct BinaryFormat
+    {
+        public:
+            /**
+             *  The magic number identifying graph files.
+             */
+            static const std::uint32_t GRAPH_MAGIC = 0x47445448;
+
+            /**
+             *  The magic number identifying tree decomposition files.
+             */
+            static const std::uint32_t TREE_DECOMPOSITION_MAGIC = 0x54445448;
+
+            /**
+             *  The version of the format written by the current implementation.
+             */
+            static const std::uint32_t VERSION = 1;
+
+            /**
+             *  The byte order mark which allows to detect files written on a machine with a different byte order.
+             */
+            static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+            /**
+             *  The size of the header in bytes.
+             */
+            static const std::size_t HEADER_SIZE = 40;
+
+            /**
+             *  The parent index of the root node of a tree decomposition.
+             */
+            static const std::uint32_t NO_PARENT = 0xFFFFFFFF;
+
+        private:
+            BinaryFormat(void);
+    };
+}
+
+#endif /* HTD_IO_BINARYFORMAT_HPP */
@@ -0,0 +1,67 @@
+/*
+ * File:   BinaryFormatExporter.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINARYFORMATEXPORTER_HPP
+#define HTD_IO_BINARYFORMATEXPORTER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd_io/ITreeDecompositionExporter.hpp>
+
+#include <iostream>
+
+namespace htd_io
+{
+    /**
+     *  Exporter which allows to export graphs and tree decompositions in the binary format 'binary'.
+     *
+     *  (See https://github.com/mabseher/htd/FORMATS.md for information about the available output formats.)
+     */
+    class BinaryFormatExporter : public htd_io::ITreeDecompositionExporter
+    {
+        public:
+            HTD_IO_API BinaryFormatExporter(void);
+
+            HTD_IO_API virtual ~BinaryFormatExporter();
+
+            HTD_IO_API void write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const HTD_OVERRIDE;
+
+            HTD_IO_API void write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const HTD_OVERRIDE;
+
+            /**
+             *  Write a graph to a given stream.
+             *
+             *  The vertices of the graph are renumbered to the identifiers 1 to vertex count in ascending order,
+             *  hence graphs imported from the formats 'gr' and 'hgr' keep their vertex identifiers.
+             *
+             *  @param[in] graph            The graph which shall be exported.
+             *  @param[out] outputStream    The output stream to which the information shall be written.
+             *
+             *  @note The failbit of the output stream is set if the graph cannot be represented in the format.
+             */
+            HTD_IO_API void write(const htd::IMultiHypergraph & graph, std::ostream & outputStream) const;
+    };
+}
+
+#endif /* HTD_IO_BINARYFORMATEXPORTER_HPP */
@@ -70,6 +70,23 @@ namespace htd_io
              */
             HTD_IO_API htd::IMultiGraph * import(std::istream & stream) const;
 
+            /**
+             *  Getter for the number of threads which are used to parse the edges of an instance.
+             *
+             *  @return The number of threads which are used to parse the edges of an instance.
+             */
+            HTD_IO_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to parse the edges of an instance.
+             *
+             *  Large instances are split into chunks of complete lines which are parsed concurrently. The resulting
+             *  graph does not depend on the number of threads.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to parse the edges of an instance (0 = number of cores).
+             */
+            HTD_IO_API void setThreadCount(std::size_t threadCount);
+
         private:
             struct Implementation;
 
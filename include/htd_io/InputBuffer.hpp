@@ -0,0 +1,199 @@
+/*
+ * File:   InputBuffer.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_INPUTBUFFER_HPP
+#define HTD_IO_INPUTBUFFER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/Globals.hpp>
+
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace htd_io
+{
+    /**
+     *  Read-only buffer holding the complete content of an input file or an input stream.
+     *
+     *  Files are mapped into memory on platforms which support it, all other inputs are copied into an internal
+     *  buffer. The class additionally provides the basic scanning primitives shared by the importers.
+     */
+    class InputBuffer
+    {
+        public:
+            /**
+             *  Constructor for a new, empty input buffer.
+             */
+            HTD_IO_API InputBuffer(void);
+
+            /**
+             *  Copy constructor for an input buffer.
+             *
+             *  @param[in] original The original input buffer which shall be copied.
+             */
+            HTD_IO_API InputBuffer(const InputBuffer & original) = delete;
+
+            /**
+             *  Copy assignment operator for an input buffer.
+             *
+             *  @param[in] original The original input buffer which shall be copied.
+             */
+            HTD_IO_API InputBuffer & operator=(const InputBuffer & original) = delete;
+
+            /**
+             *  Destructor of an input buffer.
+             */
+            HTD_IO_API virtual ~InputBuffer();
+
+            /**
+             *  Load the content of the given file into the buffer.
+             *
+             *  @param[in] path The path to the file which shall be loaded.
+             *
+             *  @return True if the file could be loaded, false otherwise.
+             */
+            HTD_IO_API bool load(const std::string & path);
+
+            /**
+             *  Load the remaining content of the given stream into the buffer.
+             *
+             *  @param[in] stream   The input stream which shall be loaded.
+             *
+             *  @return True if the stream could be loaded, false otherwise.
+             */
+            HTD_IO_API bool load(std::istream & stream);
+
+            /**
+             *  Getter for the first character of the buffer.
+             *
+             *  @return A pointer to the first character of the buffer.
+             */
+            HTD_IO_API const char * begin(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Getter for the position after the last character of the buffer.
+             *
+             *  @return A pointer to the position after the last character of the buffer.
+             */
+            HTD_IO_API const char * end(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Getter for the size of the buffer.
+             *
+             *  @return The number of characters stored in the buffer.
+             */
+            HTD_IO_API std::size_t size(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Split the given range into consecutive chunks which consist of complete lines.
+             *
+             *  @param[in] begin        The first character of the range.
+             *  @param[in] end          The position after the last character of the range.
+             *  @param[in] chunkCount   The maximum number of chunks.
+             *
+             *  @return The chunks in the order in which they occur in the range. The chunks cover the complete range.
+             */
+            HTD_IO_API static std::vector<std::pair<const char *, const char *>> split(const char * begin, const char * end, std::size_t chunkCount);
+
+            /**
+             *  Determine the end of the line starting at the given position.
+             *
+             *  @param[in] position The position at which the line starts.
+             *  @param[in] end      The end of the buffer.
+             *
+             *  @return The position of the line break terminating the line or the end of the buffer if there is no line break.
+             */
+            static const char * lineEnd(const char * position, const char * end)
+            {
+                while (position != end && *position != '\n')
+                {
+                    ++position;
+                }
+
+                return position;
+            }
+
+            /**
+             *  Advance the given position over all spaces and tabs.
+             *
+             *  @param[in,out] position The position which shall be advanced.
+             *  @param[in] end          The end of the current line.
+             */
+            static void skipBlanks(const char * & position, const char * end)
+            {
+                while (position != end && (*position == ' ' || *position == '\t'))
+                {
+                    ++position;
+                }
+            }
+
+            /**
+             *  Read the unsigned decimal number starting at the given position.
+             *
+             *  @param[in,out] position The position at which the number starts. After the call, it points to the first character after the number.
+             *  @param[in] end          The end of the current line.
+             *  @param[out] value       The number which was read.
+             *
+             *  @return True if there is a number starting at the given position and if it fits into std::size_t, false otherwise.
+             */
+            static bool readNumber(const char * & position, const char * end, std::size_t & value)
+            {
+                if (position == end || *position < '0' || *position > '9')
+                {
+                    return false;
+                }
+
+                value = 0;
+
+                do
+                {
+                    std::size_t digit = static_cast<std::size_t>(*position - '0');
+
+                    if (value > (std::numeric_limits<std::size_t>::max() - digit) / 10)
+                    {
+                        return false;
+                    }
+
+                    value = value * 10 + digit;
+
+                    ++position;
+                }
+                while (position != end && *position >= '0' && *position <= '9');
+
+                return true;
+            }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_IO_INPUTBUFFER_HPP */
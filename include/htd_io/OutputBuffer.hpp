@@ -0,0 +1,226 @@
+/*
+ * File:   OutputBuffer.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_OUTPUTBUFFER_HPP
+#define HTD_IO_OUTPUTBUFFER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/Globals.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace htd_io
+{
+    /**
+     *  Write buffer which collects the output of the exporters and forwards it in large blocks.
+     *
+     *  The target of the buffer is either an output stream or a C file handle. The content of the buffer
+     *  is written to the target whenever the buffer is full, when flush() is called and when the buffer
+     *  is destroyed. The class additionally provides a fast conversion of unsigned integers to text.
+     */
+    class OutputBuffer
+    {
+        public:
+            /**
+             *  The default capacity of an output buffer in bytes.
+             */
+            static const std::size_t DEFAULT_CAPACITY = 1 << 20;
+
+            /**
+             *  Constructor for a new output buffer writing to the given output stream.
+             *
+             *  @param[in] stream   The output stream to which the content of the buffer shall be written.
+             *  @param[in] capacity The capacity of the buffer in bytes.
+             */
+            HTD_IO_API OutputBuffer(std::ostream & stream, std::size_t capacity = DEFAULT_CAPACITY);
+
+            /**
+             *  Constructor for a new output buffer writing directly to the given C file handle via fwrite.
+             *
+             *  @param[in] file     The file handle to which the content of the buffer shall be written.
+             *  @param[in] capacity The capacity of the buffer in bytes.
+             */
+            HTD_IO_API OutputBuffer(std::FILE * file, std::size_t capacity = DEFAULT_CAPACITY);
+
+            /**
+             *  Copy constructor for an output buffer.
+             *
+             *  @param[in] original The original output buffer which shall be copied.
+             */
+            HTD_IO_API OutputBuffer(const OutputBuffer & original) = delete;
+
+            /**
+             *  Copy assignment operator for an output buffer.
+             *
+             *  @param[in] original The original output buffer which shall be copied.
+             */
+            HTD_IO_API OutputBuffer & operator=(const OutputBuffer & original) = delete;
+
+            /**
+             *  Destructor of an output buffer. The remaining content of the buffer is written to the target.
+             */
+            HTD_IO_API virtual ~OutputBuffer();
+
+            /**
+             *  Write the content of the buffer to the target and flush the target.
+             */
+            HTD_IO_API void flush(void);
+
+            /**
+             *  Append a single character to the buffer.
+             *
+             *  @param[in] character    The character which shall be appended.
+             */
+            void append(char character)
+            {
+                if (size_ == buffer_.size())
+                {
+                    drain();
+                }
+
+                buffer_[size_] = character;
+
+                ++size_;
+            }
+
+            /**
+             *  Append a sequence of characters to the buffer.
+             *
+             *  @param[in] data     The first character of the sequence.
+             *  @param[in] length   The number of characters in the sequence.
+             */
+            void append(const char * data, std::size_t length)
+            {
+                if (length > buffer_.size() - size_)
+                {
+                    drain();
+
+                    if (length > buffer_.size())
+                    {
+                        write(data, length);
+
+                        return;
+                    }
+                }
+
+                std::memcpy(buffer_.data() + size_, data, length);
+
+                size_ += length;
+            }
+
+            /**
+             *  Append a string to the buffer.
+             *
+             *  @param[in] text The string which shall be appended.
+             */
+            void append(const std::string & text)
+            {
+                append(text.data(), text.size());
+            }
+
+            /**
+             *  Append the decimal representation of an unsigned integer to the buffer.
+             *
+             *  @param[in] value    The number which shall be appended.
+             */
+            void appendNumber(std::size_t value)
+            {
+                static const char digitPairs[] =
+                    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                    "8081828384858687888990919293949596979899";
+
+                char digits[24];
+
+                char * position = digits + sizeof(digits);
+
+                while (value >= 100)
+                {
+                    std::size_t pair = (value % 100) * 2;
+
+                    value /= 100;
+
+                    position -= 2;
+
+                    position[0] = digitPairs[pair];
+                    position[1] = digitPairs[pair + 1];
+                }
+
+                if (value >= 10)
+                {
+                    position -= 2;
+
+                    position[0] = digitPairs[value * 2];
+                    position[1] = digitPairs[value * 2 + 1];
+                }
+                else
+                {
+                    *(--position) = static_cast<char>('0' + value);
+                }
+
+                append(position, static_cast<std::size_t>(digits + sizeof(digits) - position));
+            }
+
+        private:
+            /**
+             *  The content of the buffer which was not yet written to the target.
+             */
+            std::vector<char> buffer_;
+
+            /**
+             *  The number of characters stored in the buffer.
+             */
+            std::size_t size_;
+
+            /**
+             *  The output stream to which the content of the buffer is written or nullptr if the target is a file handle.
+             */
+            std::ostream * stream_;
+
+            /**
+             *  The file handle to which the content of the buffer is written or nullptr if the target is an output stream.
+             */
+            std::FILE * file_;
+
+            /**
+             *  Write the content of the buffer to the target without flushing the target.
+             */
+            HTD_IO_API void drain(void);
+
+            /**
+             *  Write the given sequence of characters directly to the target.
+             *
+             *  @param[in] data     The first character of the sequence.
+             *  @param[in] length   The number of characters in the sequence.
+             */
+            HTD_IO_API void write(const char * data, std::size_t length);
+    };
+}
+
+#endif /* HTD_IO_OUTPUTBUFFER_HPP */
@@ -57,6 +57,14 @@ namespace htd_io
             HTD_IO_API void write(const htd::IGraphDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const HTD_OVERRIDE;
 
             HTD_IO_API void write(const htd::IHypertreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const HTD_OVERRIDE;
+
+            /**
+             *  Write the given maximum bag size to the given stream in the same format as the maximum bag size of a tree decomposition.
+             *
+             *  @param[in] maximumBagSize   The maximum bag size of the decomposition.
+             *  @param[in] outputStream     The output stream to which the maximum bag size shall be written.
+             */
+            HTD_IO_API void write(std::size_t maximumBagSize, std::ostream & outputStream) const;
     };
 }
 
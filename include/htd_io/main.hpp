@@ -25,12 +25,17 @@
 #ifndef HTD_IO_MAIN_HPP
 #define HTD_IO_MAIN_HPP
 
+#include <htd_io/BinaryFormat.hpp>
+#include <htd_io/BinaryFormatExporter.hpp>
+#include <htd_io/BinaryFormatGraphToTreeDecompositionProcessor.hpp>
+#include <htd_io/BinaryFormatImporter.hpp>
 #include <htd_io/GrFormatGraphProcessor.hpp>
 #include <htd_io/GrFormatGraphToTreeDecompositionProcessor.hpp>
 #include <htd_io/GrFormatImporter.hpp>
 #include <htd_io/HgrFormatGraphToTreeDecompositionProcessor.hpp>
 #include <htd_io/HgrFormatImporter.hpp>
 #include <htd_io/HumanReadableExporter.hpp>
+#include <htd_io/InputBuffer.hpp>
 #include <htd_io/IGraphDecompositionExporter.hpp>
 #include <htd_io/IGraphProcessor.hpp>
 #include <htd_io/IGraphToTreeDecompositionProcessor.hpp>
@@ -38,6 +43,7 @@
 #include <htd_io/ITreeDecompositionExporter.hpp>
 #include <htd_io/LpFormatGraphToTreeDecompositionProcessor.hpp>
 #include <htd_io/LpFormatImporter.hpp>
+#include <htd_io/OutputBuffer.hpp>
 #include <htd_io/ParsingResult.hpp>
 #include <htd_io/TdFormatExporter.hpp>
 #include <htd_io/WidthExporter.hpp>
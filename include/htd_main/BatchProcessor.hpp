@@ -0,0 +1,142 @@
+/*
+ * File:   BatchProcessor.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_MAIN_BATCHPROCESSOR_HPP
+#define HTD_MAIN_BATCHPROCESSOR_HPP
+
+#include <htd_io/IGraphToTreeDecompositionProcessor.hpp>
+#include <htd_io/ITreeDecompositionExporter.hpp>
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace htd_main
+{
+    /**
+     *  Processor which decomposes a list of instances with a bounded pool of workers.
+     *
+     *  Every worker owns its own management instance and its own graph processor, the instances are
+     *  assigned to the workers in the order in which they are given. The decomposition of each instance
+     *  is written to its own output file and a summary of all results is written in CSV format.
+     */
+    class BatchProcessor
+    {
+        public:
+            /**
+             *  Constructor for a new batch processor.
+             *
+             *  @param[in] processorFactory A function which configures the given management instance of a worker and which returns a new graph processor for it. The processor must not have an exporter assigned yet.
+             *  @param[in] exporterFactory  A function which returns a new exporter which shall be used to write the decompositions.
+             */
+            BatchProcessor(const std::function<htd_io::IGraphToTreeDecompositionProcessor *(htd::LibraryInstance * manager)> & processorFactory,
+                           const std::function<htd_io::ITreeDecompositionExporter *(void)> & exporterFactory);
+
+            /**
+             *  Destructor of a batch processor.
+             */
+            virtual ~BatchProcessor();
+
+            /**
+             *  Getter for the number of workers which decompose instances concurrently.
+             *
+             *  @return The number of workers which decompose instances concurrently.
+             */
+            std::size_t workerCount(void) const;
+
+            /**
+             *  Set the number of workers which shall decompose instances concurrently.
+             *
+             *  @param[in] workerCount  The number of workers which shall decompose instances concurrently (0 = number of cores).
+             */
+            void setWorkerCount(std::size_t workerCount);
+
+            /**
+             *  Set the directory to which the decompositions shall be written.
+             *
+             *  The decomposition of an instance is written to the file named like the instance with the output
+             *  extension appended. If no output directory is set, the file is placed next to the instance. If
+             *  several instances share the same name, the index of the instance within the batch is inserted
+             *  before the extension.
+             *
+             *  @param[in] directory    The directory to which the decompositions shall be written.
+             */
+            void setOutputDirectory(const std::string & directory);
+
+            /**
+             *  Set the extension which is appended to the file names of the instances to obtain the names of the output files.
+             *
+             *  @param[in] extension    The extension of the output files (without leading dot).
+             */
+            void setOutputExtension(const std::string & extension);
+
+            /**
+             *  Decompose the given instances and write a summary of the results to the given stream.
+             *
+             *  The summary consists of a header line and one line per instance in the order of the given
+             *  instances. Each line is written as soon as the instance and all its predecessors are finished.
+             *  The decomposition of every instance starts from the state of the random number generator of
+             *  the calling thread, hence the results do not depend on the number of workers.
+             *
+             *  @param[in] instances        The paths of the instances which shall be decomposed.
+             *  @param[out] summaryStream   The output stream to which the summary shall be written.
+             *
+             *  @return The number of instances for which no decomposition was written.
+             */
+            std::size_t process(const std::vector<std::string> & instances, std::ostream & summaryStream) const;
+
+            /**
+             *  Terminate the current batch.
+             *
+             *  The computations of all workers are terminated via their management instances and no further
+             *  instances are started. This function may be called from a signal handler.
+             */
+            void terminate(void);
+
+            /**
+             *  Collect the instances of a batch.
+             *
+             *  If the given path refers to a directory, all regular files in the directory whose name does
+             *  not start with a dot are collected in lexicographical order. Files ending with the extension of
+             *  the decompositions are skipped, they are the output of a previous batch. Otherwise, the given
+             *  path is read as a list file containing one instance path per line, empty lines are ignored.
+             *
+             *  @param[in] path             The path of the directory or list file.
+             *  @param[in] outputExtension  The file extension of the decompositions written by the batch.
+             *  @param[out] instances       The vector to which the paths of the instances shall be appended.
+             *
+             *  @return True if the given path could be read, false otherwise.
+             */
+            static bool collectInstances(const std::string & path, const std::string & outputExtension, std::vector<std::string> & instances);
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_MAIN_BATCHPROCESSOR_HPP */
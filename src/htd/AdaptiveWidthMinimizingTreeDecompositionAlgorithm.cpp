@@ -30,6 +30,7 @@
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
 
 #include <cstdarg>
 
@@ -114,6 +115,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
      *  @param[in] progressCallback         A callback function which is invoked for each new decomposition.
      *  @param[in] maxBagSize               The upper bound for the maximum bag size of the computed decomposition.
+     *  @param[in] lowerBound               The lower bound for the maximum bag size of every decomposition of the given graph.
      *
      *  @note The maximum bag size of the computed decomposition must be less than or equal to the provided upper bound.
      *
@@ -129,7 +131,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
                                                            const htd::IMultiHypergraph & graph,
                                                            const htd::IPreprocessedGraph & preprocessedGraph,
                                                            const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const;
+                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t lowerBound) const;
 
     /**
      *  Compute a decomposition of the given graph and apply the given manipulation operations to it.
@@ -140,6 +142,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
      *  @param[in] progressCallback         A callback function which is invoked for each new decomposition.
      *  @param[in] maxBagSize               The upper bound for the maximum bag size of the computed decomposition.
+     *  @param[in] lowerBound               The lower bound for the maximum bag size of every decomposition of the given graph.
      *
      *  @note The maximum bag size of the computed decomposition must be less than or equal to the provided upper bound.
      *
@@ -155,7 +158,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
                                                            const htd::IMultiHypergraph & graph,
                                                            const htd::IPreprocessedGraph & preprocessedGraph,
                                                            const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const;
+                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t lowerBound) const;
 };
 
 htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::AdaptiveWidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -317,6 +320,14 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
         ++bestMaxBagSize;
     }
 
+    /* The search is stopped as soon as the best decomposition found so far reaches the lower bound. */
+    std::size_t lowerBound = htd::TreeWidthLowerBoundAlgorithm(implementation_->managementInstance_).computeLowerBound(preprocessedGraph) + 1;
+
+    if (preprocessedGraph.vertexCount() == 0)
+    {
+        lowerBound = 0;
+    }
+
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
     htd::ITreeDecomposition * ret = nullptr;
@@ -334,11 +345,11 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
         }
     }
 
-    for (htd::index_t round = 0; round < implementation_->decisionRounds_ && !managementInstance.isTerminated(); ++round)
+    for (htd::index_t round = 0; round < implementation_->decisionRounds_ && bestMaxBagSize > lowerBound && !managementInstance.isTerminated(); ++round)
     {
         htd::index_t algorithmIndex = 0;
 
-        for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && !managementInstance.isTerminated(); ++it)
+        for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && bestMaxBagSize > lowerBound && !managementInstance.isTerminated(); ++it)
         {
             if (disqualifiedAlgorithms.count(algorithmIndex) == 0)
             {
@@ -370,7 +381,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
                         if (currentMaxBagSize < bestMaxBagSize)
                         {
-                            progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(1, -(static_cast<double>(currentMaxBagSize))));
+                            progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(2, -(static_cast<double>(currentMaxBagSize)), -(static_cast<double>(currentMaxBagSize - std::min(currentMaxBagSize, lowerBound)))));
 
                             delete ret;
 
@@ -446,13 +457,23 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
         }
     }
 
+    if (bestMaxBagSize <= lowerBound || pool.empty())
+    {
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            delete operation;
+        }
+
+        return ret;
+    }
+
     htd::ITreeDecompositionAlgorithm * selectedAlgorithm = implementation_->algorithms_[htd::selectRandomElement<htd::index_t>(pool)];
 
     htd::BucketEliminationTreeDecompositionAlgorithm * bucketEliminationTreeDecompositionAlgorithm = dynamic_cast<htd::BucketEliminationTreeDecompositionAlgorithm *>(selectedAlgorithm);
 
     if (bucketEliminationTreeDecompositionAlgorithm != nullptr)
     {
-        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*bucketEliminationTreeDecompositionAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1);
+        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*bucketEliminationTreeDecompositionAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1, lowerBound);
 
         if (currentDecomposition != nullptr)
         {
@@ -467,7 +488,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
     }
     else
     {
-        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*selectedAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1);
+        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*selectedAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1, lowerBound);
 
         if (currentDecomposition != nullptr)
         {
@@ -659,7 +680,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                                const htd::IMultiHypergraph & graph,
                                                                                                                                const htd::IPreprocessedGraph & preprocessedGraph,
                                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
+                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t lowerBound) const
 {
     std::size_t bestMaxBagSize = maxBagSize + 1;
 
@@ -669,7 +690,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     std::size_t nonImprovementCount = 0;
 
-    while (remainingIterations > 0 && !managementInstance_->isTerminated())
+    while (remainingIterations > 0 && bestMaxBagSize > lowerBound && !managementInstance_->isTerminated())
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -694,7 +715,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                 {
                     if (currentMaxBagSize < bestMaxBagSize)
                     {
-                        progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(1, -(static_cast<double>(currentMaxBagSize))));
+                        progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(2, -(static_cast<double>(currentMaxBagSize)), -(static_cast<double>(currentMaxBagSize - std::min(currentMaxBagSize, lowerBound)))));
 
                         if (ret != nullptr)
                         {
@@ -751,7 +772,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                                const htd::IMultiHypergraph & graph,
                                                                                                                                const htd::IPreprocessedGraph & preprocessedGraph,
                                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
+                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t lowerBound) const
 {
     std::size_t bestMaxBagSize = maxBagSize + 1;
 
@@ -759,7 +780,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     std::size_t remainingIterations = iterationCount_;
 
-    while (remainingIterations > 0 && !managementInstance_->isTerminated())
+    while (remainingIterations > 0 && bestMaxBagSize > lowerBound && !managementInstance_->isTerminated())
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -795,7 +816,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                 {
                     if (currentMaxBagSize < bestMaxBagSize)
                     {
-                        progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(1, -(static_cast<double>(currentMaxBagSize))));
+                        progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(2, -(static_cast<double>(currentMaxBagSize)), -(static_cast<double>(currentMaxBagSize - std::min(currentMaxBagSize, lowerBound)))));
 
                         if (ret != nullptr)
                         {
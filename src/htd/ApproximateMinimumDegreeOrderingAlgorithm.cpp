@@ -0,0 +1,904 @@
+/* 
+ * File:   ApproximateMinimumDegreeOrderingAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_APPROXIMATEMINIMUMDEGREEORDERINGALGORITHM_CPP
+#define HTD_HTD_APPROXIMATEMINIMUMDEGREEORDERINGALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/ApproximateMinimumDegreeOrderingAlgorithm.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+#include <htd/VertexOrdering.hpp>
+
+#include <algorithm>
+
+/**
+ *  Private implementation details of class htd::ApproximateMinimumDegreeOrderingAlgorithm.
+ */
+struct htd::ApproximateMinimumDegreeOrderingAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  Constant for an empty entry of the linked lists within the workspace.
+     */
+    static const htd::index_t NONE = static_cast<htd::index_t>(-1);
+
+    /**
+     *  The possible states of a node of the quotient graph.
+     */
+    enum NodeStatus
+    {
+        /**
+         *  The node is a principal variable, i.e., a (super)vertex which is not yet eliminated.
+         */
+        VARIABLE,
+
+        /**
+         *  The node is an element, i.e., an eliminated vertex representing the clique formed by its remaining neighbors.
+         */
+        ELEMENT,
+
+        /**
+         *  The node is either an element absorbed by another element or a variable merged into another one.
+         */
+        INACTIVE
+    };
+
+    /**
+     *  The data structures used by the algorithm.
+     *
+     *  All arrays are indexed by the local indices 0, ..., n-1 of the remaining vertices of the preprocessed graph. The
+     *  workspace is allocated once per call of computeOrdering() and it is reused for all iterations.
+     */
+    struct Workspace
+    {
+        /**
+         *  The storage of all adjacency lists. The list of a variable starts with the adjacent elements, followed by the adjacent variables.
+         */
+        std::vector<htd::index_t> adjacency;
+
+        /**
+         *  The first unused position within the adjacency storage.
+         */
+        htd::index_t freePosition;
+
+        /**
+         *  The start of the adjacency list of each node within the adjacency storage.
+         */
+        std::vector<htd::index_t> listStart;
+
+        /**
+         *  The length of the adjacency list of each node.
+         */
+        std::vector<std::size_t> listLength;
+
+        /**
+         *  The number of elements at the front of the adjacency list of each variable.
+         */
+        std::vector<std::size_t> elementCount;
+
+        /**
+         *  The number of vertices represented by each principal variable. The value is negated while the variable is part of the current element.
+         */
+        std::vector<std::ptrdiff_t> weight;
+
+        /**
+         *  The approximate external degree of each variable and the exact weighted size of each element.
+         */
+        std::vector<std::size_t> degree;
+
+        /**
+         *  Scratch values: |Le \ Lme| (offset by the current flag) for elements and comparison marks for all nodes (0=absorbed element).
+         */
+        std::vector<std::size_t> marks;
+
+        /**
+         *  The state of each node.
+         */
+        std::vector<NodeStatus> status;
+
+        /**
+         *  The first variable in the degree list of each degree.
+         */
+        std::vector<htd::index_t> degreeHead;
+
+        /**
+         *  The successor of each variable within its degree list.
+         */
+        std::vector<htd::index_t> degreeNext;
+
+        /**
+         *  The predecessor of each variable within its degree list.
+         */
+        std::vector<htd::index_t> degreePrevious;
+
+        /**
+         *  The first variable in each bucket of the supervariable detection.
+         */
+        std::vector<htd::index_t> hashHead;
+
+        /**
+         *  The successor of each variable within its bucket of the supervariable detection.
+         */
+        std::vector<htd::index_t> hashNext;
+
+        /**
+         *  The bucket of each variable of the current element.
+         */
+        std::vector<std::size_t> hashBucket;
+
+        /**
+         *  The successor of each vertex within the list of vertices represented by its supervariable.
+         */
+        std::vector<htd::index_t> memberNext;
+
+        /**
+         *  The last vertex in the list of vertices represented by each supervariable.
+         */
+        std::vector<htd::index_t> memberTail;
+
+        /**
+         *  The vertex of the preprocessed graph corresponding to each local index.
+         */
+        std::vector<htd::vertex_t> vertices;
+
+        /**
+         *  The local index of each vertex of the preprocessed graph.
+         */
+        std::vector<htd::index_t> localIndices;
+
+        /**
+         *  Scratch vector used for compacting the adjacency storage.
+         */
+        std::vector<htd::index_t> compactionOrder;
+
+        /**
+         *  Insert a variable into the degree list of the given degree.
+         *
+         *  @param[in] variable The variable.
+         *  @param[in] value    The degree of the variable.
+         */
+        void insertIntoDegreeList(htd::index_t variable, std::size_t value)
+        {
+            htd::index_t successor = degreeHead[value];
+
+            degreeNext[variable] = successor;
+            degreePrevious[variable] = NONE;
+
+            if (successor != NONE)
+            {
+                degreePrevious[successor] = variable;
+            }
+
+            degreeHead[value] = variable;
+
+            degree[variable] = value;
+        }
+
+        /**
+         *  Remove a variable from its degree list.
+         *
+         *  @param[in] variable The variable.
+         */
+        void removeFromDegreeList(htd::index_t variable)
+        {
+            htd::index_t successor = degreeNext[variable];
+            htd::index_t predecessor = degreePrevious[variable];
+
+            if (successor != NONE)
+            {
+                degreePrevious[successor] = predecessor;
+            }
+
+            if (predecessor != NONE)
+            {
+                degreeNext[predecessor] = successor;
+            }
+            else
+            {
+                degreeHead[degree[variable]] = successor;
+            }
+        }
+
+        /**
+         *  Append the vertices represented by the second node to the vertices represented by the first one.
+         *
+         *  @param[in] target   The node which shall represent the vertices afterwards.
+         *  @param[in] source   The node whose vertices shall be moved.
+         */
+        void appendMembers(htd::index_t target, htd::index_t source)
+        {
+            memberNext[memberTail[target]] = source;
+
+            memberTail[target] = memberTail[source];
+        }
+
+        /**
+         *  Move all adjacency lists which are still in use to the front of the adjacency storage.
+         */
+        void compact(void)
+        {
+            compactionOrder.clear();
+
+            for (htd::index_t node = 0; node < listStart.size(); ++node)
+            {
+                if (status[node] != INACTIVE && listLength[node] > 0)
+                {
+                    compactionOrder.push_back(node);
+                }
+            }
+
+            std::sort(compactionOrder.begin(), compactionOrder.end(), [&](htd::index_t node1, htd::index_t node2)
+            {
+                return listStart[node1] < listStart[node2];
+            });
+
+            htd::index_t position = 0;
+
+            for (htd::index_t node : compactionOrder)
+            {
+                if (listStart[node] != position)
+                {
+                    std::copy(adjacency.begin() + listStart[node], adjacency.begin() + listStart[node] + listLength[node], adjacency.begin() + position);
+
+                    listStart[node] = position;
+                }
+
+                position += listLength[node];
+            }
+
+            freePosition = position;
+        }
+    };
+
+    /**
+     *  Initialize the workspace for the remaining vertices of the given preprocessed graph.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in,out] workspace        The workspace which shall be initialized.
+     */
+    void initialize(const htd::IPreprocessedGraph & preprocessedGraph, Workspace & workspace) const;
+
+    /**
+     *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[out] target              The target vector to which the computed ordering shall be appended.
+     *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *  @param[in,out] workspace        The workspace used by the algorithm.
+     *
+     *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
+     */
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize, Workspace & workspace) const HTD_NOEXCEPT;
+};
+
+htd::ApproximateMinimumDegreeOrderingAlgorithm::ApproximateMinimumDegreeOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+    
+}
+            
+htd::ApproximateMinimumDegreeOrderingAlgorithm::~ApproximateMinimumDegreeOrderingAlgorithm()
+{
+    
+}
+
+htd::IVertexOrdering * htd::ApproximateMinimumDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, (std::size_t)-1, 1);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::ApproximateMinimumDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::IWidthLimitedVertexOrdering * ret = computeOrdering(graph, *preprocessedGraph, maxBagSize, maxIterationCount);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+htd::IVertexOrdering * htd::ApproximateMinimumDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, preprocessedGraph, (std::size_t)-1, 1);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::ApproximateMinimumDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    HTD_UNUSED(graph)
+
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    std::vector<htd::vertex_t> ordering;
+    ordering.reserve(preprocessedGraph.eliminationSequence().size() + preprocessedGraph.vertexCount());
+
+    htd::ApproximateMinimumDegreeOrderingAlgorithm::Implementation::Workspace workspace;
+
+    std::size_t iterations = 0;
+
+    std::size_t currentMaxBagSize = (std::size_t)-1;
+
+    do
+    {
+        ordering.clear();
+
+        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, ordering, maxBagSize, workspace);
+
+        ++iterations;
+    }
+    while (currentMaxBagSize > maxBagSize && iterations < maxIterationCount && !managementInstance.isTerminated());
+
+    if (maxIterationCount == 0 && currentMaxBagSize > maxBagSize)
+    {
+        ordering.clear();
+
+        currentMaxBagSize = 0;
+    }
+
+    return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
+}
+
+void htd::ApproximateMinimumDegreeOrderingAlgorithm::Implementation::initialize(const htd::IPreprocessedGraph & preprocessedGraph, Workspace & workspace) const
+{
+    const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
+
+    const htd::NeighborhoodSnapshot & neighborhood = preprocessedGraph.neighborhoodSnapshot();
+
+    std::size_t size = remainingVertices.size();
+
+    /* The local indices are assigned in random order, this way the order of the degree lists breaks ties randomly. */
+    std::vector<htd::vertex_t> & vertices = workspace.vertices;
+
+    vertices.assign(remainingVertices.begin(), remainingVertices.end());
+
+    htd::RandomNumberGenerator & generator = htd::randomNumberGenerator();
+
+    for (std::size_t index = size; index > 1; --index)
+    {
+        std::swap(vertices[index - 1], vertices[generator.nextIndex(index)]);
+    }
+
+    workspace.localIndices.assign(preprocessedGraph.inputGraphVertexCount(), static_cast<htd::index_t>(NONE));
+
+    std::size_t entryCount = 0;
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        workspace.localIndices[vertices[index]] = index;
+
+        entryCount += neighborhood.neighborCount(vertices[index]);
+    }
+
+    /* Like in the reference implementation of AMD, 20% elbow room avoids frequent compactions. */
+    std::size_t capacity = entryCount + entryCount / 5 + 2 * size;
+
+    if (workspace.adjacency.size() < capacity)
+    {
+        workspace.adjacency.resize(capacity);
+    }
+
+    workspace.listStart.resize(size);
+    workspace.listLength.resize(size);
+    workspace.elementCount.assign(size, 0);
+    workspace.weight.assign(size, 1);
+    workspace.degree.resize(size);
+    workspace.marks.assign(size, 1);
+    workspace.status.assign(size, VARIABLE);
+    workspace.degreeHead.assign(size, static_cast<htd::index_t>(NONE));
+    workspace.degreeNext.resize(size);
+    workspace.degreePrevious.resize(size);
+    workspace.hashHead.assign(size, static_cast<htd::index_t>(NONE));
+    workspace.hashNext.resize(size);
+    workspace.hashBucket.resize(size);
+    workspace.memberNext.assign(size, static_cast<htd::index_t>(NONE));
+    workspace.memberTail.resize(size);
+
+    htd::index_t position = 0;
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        workspace.listStart[index] = position;
+
+        for (const htd::vertex_t * it = neighborhood.begin(vertices[index]); it != neighborhood.end(vertices[index]); ++it)
+        {
+            htd::index_t neighbor = workspace.localIndices[*it];
+
+            if (neighbor != NONE)
+            {
+                workspace.adjacency[position] = neighbor;
+
+                ++position;
+            }
+        }
+
+        workspace.listLength[index] = position - workspace.listStart[index];
+
+        workspace.memberTail[index] = index;
+
+        workspace.insertIntoDegreeList(index, workspace.listLength[index]);
+    }
+
+    workspace.freePosition = position;
+}
+
+std::size_t htd::ApproximateMinimumDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize, Workspace & workspace) const HTD_NOEXCEPT
+{
+    target.insert(target.end(),
+                  preprocessedGraph.eliminationSequence().begin(),
+                  preprocessedGraph.eliminationSequence().end());
+
+    std::size_t ret = preprocessedGraph.prefixWidth() + 1;
+
+    initialize(preprocessedGraph, workspace);
+
+    const std::size_t size = workspace.vertices.size();
+
+    std::vector<htd::index_t> & adjacency = workspace.adjacency;
+    std::vector<htd::index_t> & listStart = workspace.listStart;
+    std::vector<std::size_t> & listLength = workspace.listLength;
+    std::vector<std::size_t> & elementCount = workspace.elementCount;
+    std::vector<std::ptrdiff_t> & weight = workspace.weight;
+    std::vector<std::size_t> & degree = workspace.degree;
+    std::vector<std::size_t> & marks = workspace.marks;
+    std::vector<NodeStatus> & status = workspace.status;
+
+    std::size_t eliminatedCount = 0;
+
+    std::size_t minDegree = 0;
+
+    /* All marks are always smaller than the current flag. */
+    std::size_t flag = 2;
+
+    while (eliminatedCount < size && ret <= maxBagSize && !managementInstance_->isTerminated())
+    {
+        /* Select the variable of minimum approximate degree. */
+        while (workspace.degreeHead[minDegree] == NONE)
+        {
+            ++minDegree;
+        }
+
+        htd::index_t pivot = workspace.degreeHead[minDegree];
+
+        workspace.removeFromDegreeList(pivot);
+
+        std::size_t pivotElementCount = elementCount[pivot];
+
+        std::size_t pivotWeight = static_cast<std::size_t>(weight[pivot]);
+
+        eliminatedCount += pivotWeight;
+
+        /*
+         *  Construct the new element Lme, i.e., the set of variables adjacent to the pivot in the elimination graph.
+         *  The variables of Lme are flagged by negating their weight and they are removed from the degree lists.
+         */
+        weight[pivot] = -weight[pivot];
+
+        std::size_t pivotDegree = 0;
+
+        htd::index_t elementStart = 0;
+        htd::index_t elementEnd = 0;
+
+        auto collect = [&](htd::index_t variable)
+        {
+            if (weight[variable] > 0)
+            {
+                pivotDegree += static_cast<std::size_t>(weight[variable]);
+
+                weight[variable] = -weight[variable];
+
+                adjacency[elementEnd] = variable;
+
+                ++elementEnd;
+
+                workspace.removeFromDegreeList(variable);
+            }
+        };
+
+        if (pivotElementCount == 0)
+        {
+            /* Without adjacent elements, Lme is a subset of the adjacency list of the pivot and it is built in place. */
+            elementStart = listStart[pivot];
+            elementEnd = elementStart;
+
+            for (htd::index_t position = listStart[pivot]; position < listStart[pivot] + listLength[pivot]; ++position)
+            {
+                collect(adjacency[position]);
+            }
+        }
+        else
+        {
+            std::size_t requiredSpace = listLength[pivot];
+
+            for (htd::index_t position = listStart[pivot]; position < listStart[pivot] + pivotElementCount; ++position)
+            {
+                requiredSpace += listLength[adjacency[position]];
+            }
+
+            if (workspace.freePosition + requiredSpace > adjacency.size())
+            {
+                workspace.compact();
+
+                if (workspace.freePosition + requiredSpace > adjacency.size())
+                {
+                    adjacency.resize(workspace.freePosition + requiredSpace + size);
+                }
+            }
+
+            elementStart = workspace.freePosition;
+            elementEnd = elementStart;
+
+            for (htd::index_t position = listStart[pivot]; position < listStart[pivot] + pivotElementCount; ++position)
+            {
+                htd::index_t element = adjacency[position];
+
+                if (marks[element] != 0)
+                {
+                    for (htd::index_t position2 = listStart[element]; position2 < listStart[element] + listLength[element]; ++position2)
+                    {
+                        collect(adjacency[position2]);
+                    }
+
+                    /* The element is absorbed by the new element. */
+                    status[element] = INACTIVE;
+                    marks[element] = 0;
+                    listLength[element] = 0;
+                }
+            }
+
+            for (htd::index_t position = listStart[pivot] + pivotElementCount; position < listStart[pivot] + listLength[pivot]; ++position)
+            {
+                collect(adjacency[position]);
+            }
+
+            workspace.freePosition = elementEnd;
+        }
+
+        if (pivotWeight + pivotDegree > ret)
+        {
+            ret = pivotWeight + pivotDegree;
+        }
+
+        status[pivot] = ELEMENT;
+        listStart[pivot] = elementStart;
+        listLength[pivot] = elementEnd - elementStart;
+        elementCount[pivot] = 0;
+
+        /* For each element e adjacent to a variable of Lme, compute marks[e] = flag + |Le \ Lme|. */
+        for (htd::index_t position = elementStart; position < elementEnd; ++position)
+        {
+            htd::index_t variable = adjacency[position];
+
+            std::size_t variableWeight = static_cast<std::size_t>(-weight[variable]);
+
+            for (htd::index_t position2 = listStart[variable]; position2 < listStart[variable] + elementCount[variable]; ++position2)
+            {
+                htd::index_t element = adjacency[position2];
+
+                if (marks[element] >= flag)
+                {
+                    marks[element] -= variableWeight;
+                }
+                else if (marks[element] != 0)
+                {
+                    marks[element] = flag + degree[element] - variableWeight;
+                }
+            }
+        }
+
+        /*
+         *  Update the adjacency list and the approximate degree of each variable of Lme. Elements e with Le \ Lme = {} are
+         *  absorbed (aggressive absorption) and variables without any further neighbors are eliminated together with the
+         *  pivot (mass elimination). The remaining variables are hashed for the supervariable detection.
+         */
+        std::size_t maximumExternalDegree = 0;
+
+        for (htd::index_t position = elementStart; position < elementEnd; ++position)
+        {
+            htd::index_t variable = adjacency[position];
+
+            htd::index_t first = listStart[variable];
+            htd::index_t last = first + listLength[variable];
+            htd::index_t variablesStart = first + elementCount[variable];
+
+            htd::index_t next = first;
+
+            std::size_t externalDegree = 0;
+
+            std::size_t hash = 0;
+
+            for (htd::index_t position2 = first; position2 < variablesStart; ++position2)
+            {
+                htd::index_t element = adjacency[position2];
+
+                if (marks[element] != 0)
+                {
+                    std::size_t difference = marks[element] - flag;
+
+                    if (difference > 0)
+                    {
+                        externalDegree += difference;
+
+                        adjacency[next] = element;
+
+                        ++next;
+
+                        hash += element;
+                    }
+                    else
+                    {
+                        status[element] = INACTIVE;
+                        marks[element] = 0;
+                        listLength[element] = 0;
+                    }
+                }
+            }
+
+            htd::index_t remainingVariablesStart = next;
+
+            elementCount[variable] = next - first + 1;
+
+            for (htd::index_t position2 = variablesStart; position2 < last; ++position2)
+            {
+                htd::index_t neighbor = adjacency[position2];
+
+                if (weight[neighbor] > 0)
+                {
+                    externalDegree += static_cast<std::size_t>(weight[neighbor]);
+
+                    adjacency[next] = neighbor;
+
+                    ++next;
+
+                    hash += neighbor;
+                }
+            }
+
+            if (elementCount[variable] == 1 && remainingVariablesStart == next)
+            {
+                /* The variable is adjacent to Lme and the pivot only, hence it can be eliminated directly after the pivot. */
+                std::size_t variableWeight = static_cast<std::size_t>(-weight[variable]);
+
+                pivotDegree -= variableWeight;
+
+                eliminatedCount += variableWeight;
+
+                weight[variable] = 0;
+
+                status[variable] = INACTIVE;
+
+                listLength[variable] = 0;
+
+                workspace.appendMembers(pivot, variable);
+            }
+            else
+            {
+                degree[variable] = std::min(degree[variable], externalDegree);
+
+                if (externalDegree > maximumExternalDegree)
+                {
+                    maximumExternalDegree = externalDegree;
+                }
+
+                /* Make the new element the first entry of the list. At least one entry (the pivot or an absorbed element) was removed, so there is room for it. */
+                adjacency[next] = adjacency[remainingVariablesStart];
+                adjacency[remainingVariablesStart] = adjacency[first];
+                adjacency[first] = pivot;
+
+                listLength[variable] = next - first + 1;
+
+                std::size_t bucket = hash % size;
+
+                workspace.hashBucket[variable] = bucket;
+                workspace.hashNext[variable] = workspace.hashHead[bucket];
+                workspace.hashHead[bucket] = variable;
+            }
+        }
+
+        degree[pivot] = pivotDegree;
+
+        flag += maximumExternalDegree + 1;
+
+        /*
+         *  Supervariable detection: Two variables of Lme with identical adjacency lists are indistinguishable, hence the
+         *  second one is merged into the first one. Only variables within the same hash bucket are compared.
+         */
+        for (htd::index_t position = elementStart; position < elementEnd; ++position)
+        {
+            htd::index_t variable = adjacency[position];
+
+            if (weight[variable] >= 0)
+            {
+                continue;
+            }
+
+            std::size_t bucket = workspace.hashBucket[variable];
+
+            htd::index_t current = workspace.hashHead[bucket];
+
+            workspace.hashHead[bucket] = NONE;
+
+            while (current != NONE)
+            {
+                htd::index_t currentStart = listStart[current];
+                htd::index_t currentEnd = currentStart + listLength[current];
+
+                /* The first entry of each list is the pivot. */
+                for (htd::index_t position2 = currentStart + 1; position2 < currentEnd; ++position2)
+                {
+                    marks[adjacency[position2]] = flag;
+                }
+
+                htd::index_t predecessor = current;
+
+                htd::index_t candidate = workspace.hashNext[current];
+
+                while (candidate != NONE)
+                {
+                    bool identical = listLength[candidate] == listLength[current] && elementCount[candidate] == elementCount[current];
+
+                    htd::index_t candidateStart = listStart[candidate];
+                    htd::index_t candidateEnd = candidateStart + listLength[candidate];
+
+                    for (htd::index_t position2 = candidateStart + 1; identical && position2 < candidateEnd; ++position2)
+                    {
+                        identical = marks[adjacency[position2]] == flag;
+                    }
+
+                    htd::index_t nextCandidate = workspace.hashNext[candidate];
+
+                    if (identical)
+                    {
+                        weight[current] += weight[candidate];
+
+                        weight[candidate] = 0;
+
+                        degree[current] = std::min(degree[current], degree[candidate]);
+
+                        status[candidate] = INACTIVE;
+
+                        listLength[candidate] = 0;
+
+                        workspace.appendMembers(current, candidate);
+
+                        workspace.hashNext[predecessor] = nextCandidate;
+                    }
+                    else
+                    {
+                        predecessor = candidate;
+                    }
+
+                    candidate = nextCandidate;
+                }
+
+                ++flag;
+
+                current = workspace.hashNext[current];
+            }
+        }
+
+        /* Finalize the approximate degrees, re-insert the variables of Lme into the degree lists and drop merged variables from Lme. */
+        std::size_t remainingCount = size - eliminatedCount;
+
+        htd::index_t next = elementStart;
+
+        for (htd::index_t position = elementStart; position < elementEnd; ++position)
+        {
+            htd::index_t variable = adjacency[position];
+
+            if (weight[variable] < 0)
+            {
+                std::size_t variableWeight = static_cast<std::size_t>(-weight[variable]);
+
+                weight[variable] = static_cast<std::ptrdiff_t>(variableWeight);
+
+                std::size_t approximateDegree = std::min(degree[variable] + pivotDegree - variableWeight, remainingCount - variableWeight);
+
+                workspace.insertIntoDegreeList(variable, approximateDegree);
+
+                if (approximateDegree < minDegree)
+                {
+                    minDegree = approximateDegree;
+                }
+
+                adjacency[next] = variable;
+
+                ++next;
+            }
+        }
+
+        listLength[pivot] = next - elementStart;
+
+        if (listLength[pivot] == 0)
+        {
+            status[pivot] = INACTIVE;
+            marks[pivot] = 0;
+        }
+
+        weight[pivot] = static_cast<std::ptrdiff_t>(pivotWeight);
+
+        ++flag;
+
+        for (htd::index_t member = pivot; member != NONE; member = workspace.memberNext[member])
+        {
+            target.push_back(preprocessedGraph.vertexName(workspace.vertices[member]));
+        }
+    }
+
+    return ret;
+}
+
+const htd::LibraryInstance * htd::ApproximateMinimumDegreeOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::ApproximateMinimumDegreeOrderingAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::ApproximateMinimumDegreeOrderingAlgorithm * htd::ApproximateMinimumDegreeOrderingAlgorithm::clone(void) const
+{
+    return new htd::ApproximateMinimumDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IOrderingAlgorithm * htd::ApproximateMinimumDegreeOrderingAlgorithm::cloneOrderingAlgorithm(void) const
+{
+    return new htd::ApproximateMinimumDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+
+htd::IWidthLimitableOrderingAlgorithm * htd::ApproximateMinimumDegreeOrderingAlgorithm::cloneWidthLimitableOrderingAlgorithm(void) const
+{
+    return new htd::ApproximateMinimumDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+#endif
+
+#endif /* HTD_HTD_APPROXIMATEMINIMUMDEGREEORDERINGALGORITHM_CPP */
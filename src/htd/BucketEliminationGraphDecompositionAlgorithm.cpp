@@ -28,6 +28,8 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/BucketEliminationGraphDecompositionAlgorithm.hpp>
+#include <htd/EliminationTree.hpp>
+#include <htd/EliminationWidthEvaluator.hpp>
 #include <htd/ILabelingFunction.hpp>
 #include <htd/OrderingAlgorithmFactory.hpp>
 #include <htd/GraphDecompositionFactory.hpp>
@@ -129,27 +131,102 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
     std::pair<htd::IMutableGraphDecomposition *, std::size_t> computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const;
 
     /**
-     *  Get the vertex which is ranked first in the vertex elimination ordering.
+     *  Pooled storage for the bag contents of all buckets.
      *
-     *  @param[in] vertices         The set of vertices which shall be investigated.
-     *  @param[in] ordering         The vertex elimination ordering.
-     *  @param[in] vertexIndices    The indices of the vertices in the vertex elimination ordering.
-     *
-     *  @return The vertex which is ranked first in the vertex elimination ordering.
+     *  The contents of all bags are stored consecutively in a single vector and each bag is identified by its
+     *  offset and its size. The sizes of all bags are known before the first element is written, hence the
+     *  pool is allocated exactly once.
      */
-    htd::vertex_t getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices) const;
+    struct BagPool
+    {
+        /**
+         *  The contents of all bags.
+         */
+        std::vector<htd::vertex_t> contents;
+
+        /**
+         *  The offset of the bag of each vertex within the contents.
+         */
+        std::vector<std::size_t> offsets;
+
+        /**
+         *  The size of the bag of each vertex.
+         */
+        std::vector<std::size_t> sizes;
+
+        /**
+         *  Get a pointer to the first element of the bag of a vertex.
+         *
+         *  @param[in] vertex   The vertex.
+         *
+         *  @return A pointer to the first element of the bag of the vertex.
+         */
+        const htd::vertex_t * begin(htd::vertex_t vertex) const
+        {
+            return contents.data() + offsets[vertex];
+        }
+
+        /**
+         *  Get a pointer past the last element of the bag of a vertex.
+         *
+         *  @param[in] vertex   The vertex.
+         *
+         *  @return A pointer past the last element of the bag of the vertex.
+         */
+        const htd::vertex_t * end(htd::vertex_t vertex) const
+        {
+            return contents.data() + offsets[vertex] + sizes[vertex];
+        }
+
+        /**
+         *  Append an element to the bag of a vertex.
+         *
+         *  @param[in] vertex   The vertex.
+         *  @param[in] element  The element which shall be appended.
+         */
+        void append(htd::vertex_t vertex, htd::vertex_t element)
+        {
+            contents[offsets[vertex] + sizes[vertex]] = element;
+
+            ++sizes[vertex];
+        }
+
+        /**
+         *  Swap the bags of two vertices.
+         *
+         *  @param[in] vertex1  The first vertex.
+         *  @param[in] vertex2  The second vertex.
+         */
+        void swap(htd::vertex_t vertex1, htd::vertex_t vertex2)
+        {
+            std::swap(offsets[vertex1], offsets[vertex2]);
+            std::swap(sizes[vertex1], sizes[vertex2]);
+        }
+    };
 
     /**
-     *  Get the vertex which is ranked first in the vertex elimination ordering.
+     *  Compute the buckets of the given graph and the tree structure connecting them.
      *
-     *  @param[in] vertices         The set of vertices which shall be investigated.
-     *  @param[in] ordering         The vertex elimination ordering.
-     *  @param[in] vertexIndices    The indices of the vertices in the vertex elimination ordering.
-     *  @param[in] excludedVertex   The vertex which shall be ignored during the determination of the first vertex in the ordering.
+     *  The elimination tree of the ordering is computed via Liu's algorithm with path-compressed ancestor links
+     *  where each hyperedge is represented by a star rooted at its element which is eliminated first. The bag of
+     *  a vertex then consists of the vertex itself and all vertices whose row subtree contains it. The row
+     *  subtrees are traversed twice, first to count the bag sizes and then to write the bag contents into the
+     *  pool. Because the rows are visited in ascending order of the vertex identifiers, each bag is sorted
+     *  without any merging and the whole construction runs in time linear in the total size of all bags.
      *
-     *  @return The vertex which is ranked first in the vertex elimination ordering.
+     *  @param[in] graph        The graph which shall be decomposed.
+     *  @param[in] ordering     The vertex elimination ordering.
+     *  @param[out] buckets     The pool which shall hold the bag contents of all vertices.
+     *  @param[out] neighbors   The neighborhood relation of the buckets, i.e., each vertex is connected to its parent in the elimination tree.
+     *  @param[out] inducedEdges    A vector holding the indices of the edges which are assigned to the bucket of a vertex.
+     *  @param[out] edgeTarget      A vector holding the first target node for each edge.
      */
-    htd::vertex_t getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices, htd::vertex_t excludedVertex) const;
+    void computeBuckets(const htd::IMultiHypergraph & graph,
+                        const std::vector<htd::vertex_t> & ordering,
+                        BagPool & buckets,
+                        std::vector<std::vector<htd::vertex_t>> & neighbors,
+                        std::vector<std::vector<htd::index_t>> & inducedEdges,
+                        std::vector<htd::index_t> & edgeTarget) const;
 
     /**
      *  Compress the given decomposition by retaining only subset-maximal bags.
@@ -164,7 +241,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      */
     void compressDecomposition(htd::vertex_t startingVertex,
                                std::vector<std::vector<htd::vertex_t>> & neighbors,
-                               std::vector<std::vector<htd::vertex_t>> & bagContent,
+                               BagPool & bagContent,
                                std::unordered_set<htd::vertex_t> & unvisitedVertices,
                                std::vector<htd::vertex_t> & relevantVertices,
                                std::vector<std::vector<htd::index_t>> & inducedEdges,
@@ -187,7 +264,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      */
     void compressDecomposition(htd::vertex_t vertex, htd::vertex_t parent,
                                std::vector<std::vector<htd::vertex_t>> & neighbors,
-                               std::vector<std::vector<htd::vertex_t>> & bagContent,
+                               BagPool & bagContent,
                                std::vector<htd::vertex_t> & relevantVertices,
                                std::vector<std::vector<htd::index_t>> & inducedEdges,
                                std::vector<htd::index_t> & edgeTarget) const;
@@ -204,28 +281,29 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *  @param[in] inducedEdges             A vector holding the indices of the edges which are induced by the bag content associated with a vertex.
      *  @param[in] decompositionVertices    A mapping between the vertices and their counterparts in the decomposition.
      *
-     *  @note The bag contents and the induced edges are moved into the decomposition during this operation.
+     *  @note The induced edges are moved into the decomposition during this operation.
      */
     void updateDecomposition(const htd::IMultiHypergraph & graph,
                              htd::IMutableGraphDecomposition & decomposition,
                              htd::vertex_t startingVertex,
                              const std::vector<std::vector<htd::vertex_t>> & neighbors,
-                             std::vector<std::vector<htd::vertex_t>> & bagContent,
+                             const BagPool & bagContent,
                              std::vector<std::vector<htd::index_t>> & inducedEdges,
                              std::unordered_set<htd::vertex_t> & unvisitedVertices,
                              std::unordered_map<htd::vertex_t, htd::vertex_t> & decompositionVertices) const;
 
     /**
-     *  Check whether two sets are subset-maximal with respect to the other set.
+     *  Check whether the bags of two vertices are subset-maximal with respect to the other bag.
      *
-     *  @param[in] set1 The first set.
-     *  @param[in] set2 The second set.
+     *  @param[in] bagContent   The bag contents.
+     *  @param[in] vertex1      The vertex associated with the first bag.
+     *  @param[in] vertex2      The vertex associated with the second bag.
      *
-     *  @return This function returns -1 if the first set is a superset of or identical to the second set.
-     *  If the second set is a proper superset of the first set, the return value is 1. Otherwise, the
+     *  @return This function returns -1 if the first bag is a superset of or identical to the second bag.
+     *  If the second bag is a proper superset of the first bag, the return value is 1. Otherwise, the
      *  return value is 0.
      */
-    int is_maximal(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2) const;
+    int is_maximal(const BagPool & bagContent, htd::vertex_t vertex1, htd::vertex_t vertex2) const;
 
     /**
      *  Distribute a given edge, identified by its index, in the decomposition so that the information about induced edges is updated.
@@ -242,7 +320,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
     void distributeEdge(htd::index_t edgeIndex,
                         const std::vector<htd::vertex_t> & edge,
                         htd::vertex_t startBucket,
-                        const std::vector<std::vector<htd::vertex_t>> & buckets,
+                        const BagPool & buckets,
                         const std::vector<std::vector<htd::vertex_t>> & neighbors,
                         std::vector<std::vector<htd::index_t>> & inducedEdges,
                         std::vector<htd::id_t> & lastAssignedEdge,
@@ -265,63 +343,11 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
                         htd::vertex_t vertex1,
                         htd::vertex_t vertex2,
                         htd::vertex_t startBucket,
-                        const std::vector<std::vector<htd::vertex_t>> & buckets,
+                        const BagPool & buckets,
                         const std::vector<std::vector<htd::vertex_t>> & neighbors,
                         std::vector<std::vector<htd::index_t>> & inducedEdges,
                         std::vector<htd::id_t> & lastAssignedEdge,
                         std::stack<htd::vertex_t> & originStack) const;
-
-    /**
-     *  Compute the set union of two sets and store the result in the first set.
-     *
-     *  @param[in,out] set1         The first set
-     *  @param[in] set2             The second set.
-     *  @param[in] ignoredVertex    The vertex which shall be ignored if it occurs in the second set.
-     */
-    void set_union(std::vector<htd::vertex_t> & set1,
-                   const std::vector<htd::vertex_t> & set2,
-                   htd::vertex_t ignoredVertex) const
-    {
-        std::vector<htd::vertex_t> tmp;
-        tmp.reserve(set2.size());
-
-        auto first1 = set1.begin();
-        auto first2 = set2.begin();
-
-        auto last1 = set1.end();
-        auto last2 = set2.end();
-
-        while (first1 != last1 && first2 != last2)
-        {
-            if (*first1 < *first2)
-            {
-                ++first1;
-            }
-            else if (*first2 < *first1)
-            {
-                if (*first2 != ignoredVertex)
-                {
-                    tmp.push_back(*first2);
-                }
-
-                ++first2;
-            }
-            else
-            {
-                ++first1;
-
-                //Skip common value in set 2.
-                ++first2;
-            }
-        }
-
-        std::copy_if(first2, last2, std::back_inserter(tmp), [&](const htd::vertex_t vertex) { return vertex != ignoredVertex; });
-
-        if (!tmp.empty())
-        {
-            htd::inplace_merge(set1, tmp);
-        }
-    }
 };
 
 htd::BucketEliminationGraphDecompositionAlgorithm::BucketEliminationGraphDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -472,6 +498,49 @@ std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDe
     return ret;
 }
 
+std::size_t htd::BucketEliminationGraphDecompositionAlgorithm::computeMaximumBagSize(const htd::IMultiHypergraph & graph) const
+{
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    std::size_t ret = computeMaximumBagSize(graph, *preprocessedGraph);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+std::size_t htd::BucketEliminationGraphDecompositionAlgorithm::computeMaximumBagSize(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    if (graph.vertexCount() == 0)
+    {
+        return 0;
+    }
+
+    std::size_t ret = (std::size_t)-1;
+
+    htd::IVertexOrdering * ordering = implementation_->orderingAlgorithm_->computeOrdering(graph, preprocessedGraph);
+
+    if (ordering != nullptr)
+    {
+        if (ordering->sequence().size() == graph.vertexCount())
+        {
+            ret = htd::EliminationWidthEvaluator(implementation_->managementInstance_).computeMaximumBagSize(graph, ordering->sequence());
+        }
+
+        delete ordering;
+    }
+
+    if (implementation_->managementInstance_->isTerminated())
+    {
+        ret = (std::size_t)-1;
+    }
+
+    return ret;
+}
+
 htd::IGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const
 {
     va_list arguments;
@@ -661,7 +730,9 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
 
             if (ordering != nullptr)
             {
-                if (ordering->sequence().size() == graph.vertexCount())
+                /* Orderings exceeding the bound are rejected before any bucket is built, so only accepted orderings are materialized. */
+                if (ordering->sequence().size() == graph.vertexCount() &&
+                    (maxBagSize == (std::size_t)-1 || htd::EliminationWidthEvaluator(managementInstance_).computeMaximumBagSize(graph, ordering->sequence(), maxBagSize) <= maxBagSize))
                 {
                     ret = computeMutableDecomposition(graph, ordering->sequence());
 
@@ -718,9 +789,7 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
         {
             htd::vertex_t lastVertex = graph.vertexAtPosition(size - 1);
 
-            std::vector<htd::index_t> indices(lastVertex + 1);
-
-            std::vector<std::vector<htd::vertex_t>> buckets(lastVertex + 1);
+            BagPool buckets;
 
             std::vector<std::vector<htd::vertex_t>> neighbors(lastVertex + 1);
 
@@ -730,132 +799,12 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
             std::vector<htd::vertex_t> relevantVertices;
 
-            std::size_t index = 0;
-
-            for (htd::vertex_t vertex : ordering)
-            {
-                indices[vertex] = index++;
-
-                buckets[vertex].push_back(vertex);
-            }
+            computeBuckets(graph, ordering, buckets, neighbors, inducedEdges, edgeTarget);
 
             std::size_t edgeCount = graph.edgeCount();
 
             const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
 
-            auto hyperedgePosition = hyperedges.begin();
-
-            for (htd::index_t index = 0; index < edgeCount && !managementInstance.isTerminated(); ++index)
-            {
-                const std::vector<htd::vertex_t> & elements = hyperedgePosition->sortedElements();
-
-                switch (elements.size())
-                {
-                    case 1:
-                    {
-                        htd::vertex_t vertex = elements[0];
-
-                        edgeTarget[index] = vertex;
-
-                        inducedEdges[vertex].push_back(index);
-
-                        break;
-                    }
-                    case 2:
-                    {
-                        htd::vertex_t vertex1 = elements[0];
-                        htd::vertex_t vertex2 = elements[1];
-
-                        if (indices[vertex1] < indices[vertex2])
-                        {
-                            std::vector<htd::vertex_t> & selectedBucket = buckets[vertex1];
-
-                            auto position = std::lower_bound(selectedBucket.begin(), selectedBucket.end(), vertex2);
-
-                            if (position == selectedBucket.end() || *position != vertex2)
-                            {
-                                selectedBucket.insert(position, vertex2);
-                            }
-
-                            edgeTarget[index] = vertex1;
-
-                            inducedEdges[vertex1].push_back(index);
-                        }
-                        else
-                        {
-                            std::vector<htd::vertex_t> & selectedBucket = buckets[vertex2];
-
-                            auto position = std::lower_bound(selectedBucket.begin(), selectedBucket.end(), vertex1);
-
-                            if (position == selectedBucket.end() || *position != vertex1)
-                            {
-                                selectedBucket.insert(position, vertex1);
-                            }
-
-                            edgeTarget[index] = vertex2;
-
-                            inducedEdges[vertex2].push_back(index);
-                        }
-
-                        break;
-                    }
-                    default:
-                    {
-                        htd::vertex_t minimumVertex = getMinimumVertex(elements, ordering, indices);
-
-                        htd::inplace_set_union(buckets[minimumVertex], elements);
-
-                        edgeTarget[index] = minimumVertex;
-
-                        inducedEdges[minimumVertex].push_back(index);
-
-                        break;
-                    }
-                }
-
-                ++hyperedgePosition;
-            }
-
-            for (auto it = ordering.begin(); it != ordering.end() && !managementInstance.isTerminated(); ++it)
-            {
-                htd::vertex_t selection = *it;
-
-                DEBUGGING_CODE(std::cout << std::endl << "   Processing bucket " << selection << " ..." << std::endl;)
-
-                const std::vector<htd::vertex_t> & bucket = buckets[selection];
-
-                if (bucket.size() > 1)
-                {
-                    DEBUGGING_CODE(
-                        std::cout << "      Bucket " << selection << ": ";
-                        htd::print(bucket, false);
-                        std::cout << std::endl;
-                    )
-
-                    htd::vertex_t minimumVertex = getMinimumVertex(bucket, ordering, indices, selection);
-
-                    DEBUGGING_CODE(
-                        std::cout << "      Minimum Vertex: " << minimumVertex << std::endl;
-
-                        if (minimumVertex < selection)
-                        {
-                            std::cout << "      Connection: " << minimumVertex << " - " << selection << std::endl;
-                        }
-                        else
-                        {
-                            std::cout << "      Connection: " << selection << " - " << minimumVertex << std::endl;
-                        }
-                    )
-
-                    std::vector<htd::vertex_t> & selectedBucket = buckets[minimumVertex];
-
-                    this->set_union(selectedBucket, bucket, selection);
-
-                    neighbors[selection].push_back(minimumVertex);
-                    neighbors[minimumVertex].push_back(selection);
-                }
-            }
-
             std::unordered_set<htd::vertex_t> unvisitedVertices;
 
             if (compressionEnabled_)
@@ -881,13 +830,13 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
             if (computeInducedEdges_)
             {
-                hyperedgePosition = hyperedges.begin();
+                auto hyperedgePosition = hyperedges.begin();
 
-                std::vector<htd::id_t> lastAssignedEdge(buckets.size() + 1, (htd::id_t)-1);
+                std::vector<htd::id_t> lastAssignedEdge(lastVertex + 2, (htd::id_t)-1);
 
                 std::stack<htd::vertex_t> originStack;
 
-                for (index = 0; index < edgeCount && !managementInstance.isTerminated(); ++index)
+                for (htd::index_t index = 0; index < edgeCount && !managementInstance.isTerminated(); ++index)
                 {
                     const std::vector<htd::vertex_t> & edgeElements = hyperedgePosition->sortedElements();
 
@@ -951,40 +900,96 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
     return ret;
 }
 
-htd::vertex_t htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices) const
+void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::computeBuckets(const htd::IMultiHypergraph & graph,
+                                                                                       const std::vector<htd::vertex_t> & ordering,
+                                                                                       BagPool & buckets,
+                                                                                       std::vector<std::vector<htd::vertex_t>> & neighbors,
+                                                                                       std::vector<std::vector<htd::index_t>> & inducedEdges,
+                                                                                       std::vector<htd::index_t> & edgeTarget) const
 {
-    std::size_t minimum = (std::size_t)-1;
+    std::size_t size = ordering.size();
+
+    htd::EliminationTree eliminationTree(graph, ordering);
 
-    for (htd::vertex_t vertex : vertices)
+    /* Each hyperedge is assigned to its element which is eliminated first. */
+    htd::index_t edgeIndex = 0;
+
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
     {
-        minimum = std::min(minimum, vertexIndices[vertex]);
+        htd::index_t center = eliminationTree.center(hyperedge.sortedElements());
+
+        HTD_ASSERT(center < size)
+
+        htd::vertex_t target = ordering[center];
+
+        edgeTarget[edgeIndex] = target;
+
+        inducedEdges[target].push_back(edgeIndex);
+
+        ++edgeIndex;
     }
 
-    HTD_ASSERT(minimum < ordering.size())
+    std::vector<std::size_t> bagSizes(size, 1);
 
-    return ordering[minimum];
-}
+    /* Build the elimination tree and count the bag sizes by traversing the row subtree of each position. */
+    eliminationTree.build([&](htd::index_t row, htd::index_t column)
+    {
+        HTD_UNUSED(row)
 
-htd::vertex_t htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices, htd::vertex_t excludedVertex) const
-{
-    std::size_t minimum = (std::size_t)-1;
+        ++bagSizes[column];
+
+        return true;
+    });
+
+    buckets.offsets.resize(neighbors.size(), 0);
+
+    buckets.sizes.resize(neighbors.size(), 0);
 
-    for (htd::vertex_t vertex : vertices)
+    std::size_t totalSize = 0;
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        buckets.offsets[ordering[index]] = totalSize;
+
+        totalSize += bagSizes[index];
+    }
+
+    buckets.contents.resize(totalSize);
+
+    /* Traversing the rows in ascending order of the vertex identifiers keeps the contents of each bag sorted. */
+    for (htd::vertex_t vertex : graph.vertices())
     {
-        if (vertex != excludedVertex)
+        buckets.append(vertex, vertex);
+
+        eliminationTree.traverseRowSubtree(eliminationTree.position(vertex), [&](htd::index_t row, htd::index_t column)
         {
-            minimum = std::min(minimum, vertexIndices[vertex]);
-        }
+            HTD_UNUSED(row)
+
+            buckets.append(ordering[column], vertex);
+
+            return true;
+        });
     }
 
-    HTD_ASSERT(minimum < ordering.size())
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        htd::index_t parent = eliminationTree.parent(index);
+
+        if (parent != (htd::index_t)-1)
+        {
+            htd::vertex_t vertex = ordering[index];
 
-    return ordering[minimum];
+            htd::vertex_t parentVertex = ordering[parent];
+
+            neighbors[vertex].push_back(parentVertex);
+            neighbors[parentVertex].push_back(vertex);
+        }
+    }
 }
 
 void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::compressDecomposition(htd::vertex_t startingVertex, 
                                                                                               std::vector<std::vector<htd::vertex_t>> & neighbors,
-                                                                                              std::vector<std::vector<htd::vertex_t>> & bagContent,
+                                                                                              BagPool & bagContent,
                                                                                               std::unordered_set<htd::vertex_t> & unvisitedVertices,
                                                                                               std::vector<htd::vertex_t> & relevantVertices,
                                                                                               std::vector<std::vector<htd::index_t>> & inducedEdges,
@@ -1129,18 +1134,18 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::compress
 
 void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::compressDecomposition(htd::vertex_t vertex, htd::vertex_t parent,
                                                                                               std::vector<std::vector<htd::vertex_t>> & neighbors,
-                                                                                              std::vector<std::vector<htd::vertex_t>> & bagContent,
+                                                                                              BagPool & bagContent,
                                                                                               std::vector<htd::vertex_t> & relevantVertices,
                                                                                               std::vector<std::vector<htd::index_t>> & inducedEdges,
                                                                                               std::vector<htd::index_t> & edgeTarget) const
 {
-    int result = is_maximal(bagContent[vertex], bagContent[parent]);
+    int result = is_maximal(bagContent, vertex, parent);
 
     if (result != 0)
     {
         if (result < 0)
         {
-            bagContent[vertex].swap(bagContent[parent]);
+            bagContent.swap(vertex, parent);
         }
 
         std::vector<htd::vertex_t> & currentNeighborhood = neighbors[vertex];
@@ -1180,20 +1185,20 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::compress
     }
 }
 
-int htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::is_maximal(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2) const
+int htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::is_maximal(const BagPool & bagContent, htd::vertex_t vertex1, htd::vertex_t vertex2) const
 {
     int ret = 0;
 
-    if (set1.size() >= set2.size())
+    if (bagContent.sizes[vertex1] >= bagContent.sizes[vertex2])
     {
-        if (std::includes(set1.begin(), set1.end(), set2.begin(), set2.end()))
+        if (std::includes(bagContent.begin(vertex1), bagContent.end(vertex1), bagContent.begin(vertex2), bagContent.end(vertex2)))
         {
             ret = -1;
         }
     }
     else
     {
-        if (std::includes(set2.begin(), set2.end(), set1.begin(), set1.end()))
+        if (std::includes(bagContent.begin(vertex2), bagContent.end(vertex2), bagContent.begin(vertex1), bagContent.end(vertex1)))
         {
             ret = 1;
         }
@@ -1202,7 +1207,7 @@ int htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::is_maxima
     return ret;
 }
 
-void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, const std::vector<htd::vertex_t> & edge, htd::vertex_t startBucket, const std::vector<std::vector<htd::vertex_t>> & buckets, const std::vector<std::vector<htd::vertex_t>> & neighbors, std::vector<std::vector<htd::index_t>> & inducedEdges, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
+void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, const std::vector<htd::vertex_t> & edge, htd::vertex_t startBucket, const BagPool & buckets, const std::vector<std::vector<htd::vertex_t>> & neighbors, std::vector<std::vector<htd::index_t>> & inducedEdges, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
 {
     long size = static_cast<long>(edge.size());
 
@@ -1219,11 +1224,9 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
 
     for (htd::vertex_t neighbor : neighbors[currentBucket])
     {
-        const std::vector<htd::vertex_t> & neighborBucketContent = buckets[neighbor];
-
-        auto end = neighborBucketContent.end();
+        const htd::vertex_t * end = buckets.end(neighbor);
 
-        auto position = std::lower_bound(neighborBucketContent.begin(), end, firstVertex);
+        const htd::vertex_t * position = std::lower_bound(buckets.begin(neighbor), end, firstVertex);
 
         if (end - position >= size && std::includes(position, end, edgeBegin, edgeEnd))
         {
@@ -1247,11 +1250,9 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
         {
             if (neighbor != lastBucket && lastAssignedEdge[neighbor] != edgeIndex)
             {
-                const std::vector<htd::vertex_t> & neighborBucketContent = buckets[neighbor];
-
-                auto end = neighborBucketContent.end();
+                const htd::vertex_t * end = buckets.end(neighbor);
 
-                auto position = std::lower_bound(neighborBucketContent.begin(), end, firstVertex);
+                const htd::vertex_t * position = std::lower_bound(buckets.begin(neighbor), end, firstVertex);
 
                 if (end - position >= size && std::includes(position, end, edgeBegin, edgeEnd))
                 {
@@ -1262,7 +1263,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
     }
 }
 
-void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, htd::vertex_t vertex1, htd::vertex_t vertex2, htd::vertex_t startBucket, const std::vector<std::vector<htd::vertex_t>> & buckets, const std::vector<std::vector<htd::vertex_t>> & neighbors, std::vector<std::vector<htd::index_t>> & inducedEdges, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
+void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, htd::vertex_t vertex1, htd::vertex_t vertex2, htd::vertex_t startBucket, const BagPool & buckets, const std::vector<std::vector<htd::vertex_t>> & neighbors, std::vector<std::vector<htd::index_t>> & inducedEdges, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
 {
     htd::vertex_t currentBucket = startBucket;
 
@@ -1272,15 +1273,13 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
 
     for (htd::vertex_t neighbor : neighbors[currentBucket])
     {
-        const std::vector<htd::vertex_t> & neighborBucketContent = buckets[neighbor];
+        const htd::vertex_t * end = buckets.end(neighbor);
 
-        auto end = neighborBucketContent.end();
-
-        auto position1 = std::lower_bound(neighborBucketContent.begin(), end, vertex1);
+        const htd::vertex_t * position1 = std::lower_bound(buckets.begin(neighbor), end, vertex1);
 
         if (position1 != end && *position1 == vertex1)
         {
-            auto position2 = std::lower_bound(position1, end, vertex2);
+            const htd::vertex_t * position2 = std::lower_bound(position1, end, vertex2);
 
             if (position2 != end && *position2 == vertex2)
             {
@@ -1305,15 +1304,13 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
         {
             if (neighbor != lastBucket && lastAssignedEdge[neighbor] != edgeIndex)
             {
-                const std::vector<htd::vertex_t> & neighborBucketContent = buckets[neighbor];
-
-                auto end = neighborBucketContent.end();
+                const htd::vertex_t * end = buckets.end(neighbor);
 
-                auto position1 = std::lower_bound(neighborBucketContent.begin(), end, vertex1);
+                const htd::vertex_t * position1 = std::lower_bound(buckets.begin(neighbor), end, vertex1);
 
                 if (position1 != end && *position1 == vertex1)
                 {
-                    auto position2 = std::lower_bound(position1, end, vertex2);
+                    const htd::vertex_t * position2 = std::lower_bound(position1, end, vertex2);
 
                     if (position2 != end && *position2 == vertex2)
                     {
@@ -1329,7 +1326,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::updateDe
                                                                                             htd::IMutableGraphDecomposition & decomposition,
                                                                                             htd::vertex_t startingVertex,
                                                                                             const std::vector<std::vector<htd::vertex_t>> & neighbors,
-                                                                                            std::vector<std::vector<htd::vertex_t>> & bagContent,
+                                                                                            const BagPool & bagContent,
                                                                                             std::vector<std::vector<htd::index_t>> & inducedEdges,
                                                                                             std::unordered_set<htd::vertex_t> & unvisitedVertices,
                                                                                             std::unordered_map<htd::vertex_t, htd::vertex_t> & decompositionVertices) const
@@ -1346,7 +1343,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::updateDe
         {
             if (currentIndex == 0)
             {
-                htd::vertex_t decompositionVertex = decomposition.addVertex(std::vector<htd::vertex_t>(bagContent[currentNode]), graph.hyperedgesAtPositions(inducedEdges[currentNode]));
+                htd::vertex_t decompositionVertex = decomposition.addVertex(std::vector<htd::vertex_t>(bagContent.begin(currentNode), bagContent.end(currentNode)), graph.hyperedgesAtPositions(inducedEdges[currentNode]));
 
                 decompositionVertices.emplace(currentNode, decompositionVertex);
 
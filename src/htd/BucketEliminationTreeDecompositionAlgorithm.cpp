@@ -278,6 +278,16 @@ std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDeco
     return ret;
 }
 
+std::size_t htd::BucketEliminationTreeDecompositionAlgorithm::computeMaximumBagSize(const htd::IMultiHypergraph & graph) const
+{
+    return implementation_->baseAlgorithm_->computeMaximumBagSize(graph);
+}
+
+std::size_t htd::BucketEliminationTreeDecompositionAlgorithm::computeMaximumBagSize(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    return implementation_->baseAlgorithm_->computeMaximumBagSize(graph, preprocessedGraph);
+}
+
 htd::ITreeDecomposition * htd::BucketEliminationTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const
 {
     va_list arguments;
@@ -453,13 +463,8 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
                             const std::vector<htd::vertex_t> & component1 = components[index];
                             const std::vector<htd::vertex_t> & component2 = components[index + 1];
 
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex1 = component1[std::rand() % component1.size()];
-
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex2 = component2[std::rand() % component2.size()];
+                            htd::vertex_t vertex1 = htd::selectRandomElement<htd::vertex_t>(component1);
+                            htd::vertex_t vertex2 = htd::selectRandomElement<htd::vertex_t>(component2);
 
                             mutableGraphDecomposition.addEdge(vertex1, vertex2);
                         }
@@ -472,9 +477,7 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
 
                 htd::BreadthFirstGraphTraversal graphTraversal(managementInstance_);
 
-                /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                // coverity[dont_call]
-                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(std::rand() % graphDecomposition.first->vertexCount()), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
+                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(htd::randomNumberGenerator().nextIndex(graphDecomposition.first->vertexCount())), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
                 {
                     HTD_UNUSED(distanceFromStartingVertex)
 
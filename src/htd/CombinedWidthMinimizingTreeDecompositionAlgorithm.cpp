@@ -27,9 +27,11 @@
 
 #include <htd/CombinedWidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/IWidthMinimizingTreeDecompositionAlgorithm.hpp>
+#include <htd/WidthMinimizingTreeDecompositionAlgorithm.hpp>
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
 
 #include <cstdarg>
 
@@ -44,7 +46,7 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithms_(), computeInducedEdges_(true)
+        : managementInstance_(manager), algorithms_(), computeInducedEdges_(true), threadCount_(1)
     {
 
     }
@@ -54,7 +56,7 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), computeInducedEdges_(original.computeInducedEdges_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), computeInducedEdges_(original.computeInducedEdges_), threadCount_(original.threadCount_)
     {
         for (const htd::ITreeDecompositionAlgorithm * algorithm : original.algorithms_)
         {
@@ -84,6 +86,26 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  A boolean flag indicating whether the hyperedges induced by a respective bag shall be computed.
      */
     bool computeInducedEdges_;
+
+    /**
+     *  The number of threads which shall be used by the base algorithms.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  Pass the number of threads to the given base algorithm if it supports parallel iterations.
+     *
+     *  @param[in] algorithm    The base algorithm which shall be updated.
+     */
+    void updateThreadCount(htd::ITreeDecompositionAlgorithm * algorithm) const
+    {
+        htd::WidthMinimizingTreeDecompositionAlgorithm * widthMinimizingAlgorithm = dynamic_cast<htd::WidthMinimizingTreeDecompositionAlgorithm *>(algorithm);
+
+        if (widthMinimizingAlgorithm != nullptr)
+        {
+            widthMinimizingAlgorithm->setThreadCount(threadCount_);
+        }
+    }
 };
 
 htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::CombinedWidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -107,6 +129,8 @@ void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::addDecompositionAlg
 
     algorithm->setComputeInducedEdgesEnabled(implementation_->computeInducedEdges_);
 
+    implementation_->updateThreadCount(algorithm);
+
     implementation_->algorithms_.push_back(algorithm);
 }
 
@@ -229,11 +253,14 @@ htd::ITreeDecomposition * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm
 {
     std::size_t bestMaxBagSize = maxBagSize;
 
+    /* The remaining algorithms are skipped once the best decomposition found so far reaches the lower bound. */
+    std::size_t lowerBound = htd::TreeWidthLowerBoundAlgorithm(implementation_->managementInstance_).computeLowerBound(preprocessedGraph) + 1;
+
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
     htd::ITreeDecomposition * ret = nullptr;
 
-    for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && !managementInstance.isTerminated(); ++it)
+    for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && (ret == nullptr || bestMaxBagSize > lowerBound) && !managementInstance.isTerminated(); ++it)
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -284,7 +311,7 @@ htd::ITreeDecomposition * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm
                 {
                     std::size_t currentMaxBagSize = currentDecomposition->maximumBagSize();
 
-                    progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(1, -(static_cast<double>(currentMaxBagSize))));
+                    progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(2, -(static_cast<double>(currentMaxBagSize)), -(static_cast<double>(currentMaxBagSize - std::min(currentMaxBagSize, lowerBound)))));
 
                     if (currentMaxBagSize < bestMaxBagSize)
                     {
@@ -439,6 +466,21 @@ void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::setComputeInducedEd
     }
 }
 
+std::size_t htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+
+    for (htd::ITreeDecompositionAlgorithm * algorithm : implementation_->algorithms_)
+    {
+        implementation_->updateThreadCount(algorithm);
+    }
+}
+
 const htd::LibraryInstance * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
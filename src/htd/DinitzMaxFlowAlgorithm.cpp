@@ -31,10 +31,8 @@
 #include <htd/IFlow.hpp>
 
 #include <algorithm>
-#include <deque>
-#include <stack>
-#include <stdexcept>
-#include <unordered_map>
+#include <limits>
+#include <utility>
 
 namespace htd
 {
@@ -51,7 +49,7 @@ namespace htd
              *  @param[in] source       The source vertex.
              *  @param[in] target       The target vertex.
              */
-            Flow(std::size_t vertexCount, htd::vertex_t source, htd::vertex_t target) : flow_(vertexCount, std::vector<long long>(vertexCount)), source_(source), target_(target)
+            Flow(std::size_t vertexCount, htd::vertex_t source, htd::vertex_t target) : flow_(vertexCount), value_(0), source_(source), target_(target)
             {
 
             }
@@ -61,7 +59,7 @@ namespace htd
              *
              *  @param[in] original The original flow data structure.
              */
-            Flow(const Flow & original) : flow_(original.flow_), source_(original.source_), target_(original.target_)
+            Flow(const Flow & original) : flow_(original.flow_), value_(original.value_), source_(original.source_), target_(original.target_)
             {
 
             }
@@ -83,21 +81,18 @@ namespace htd
 
             std::size_t value(void) const HTD_OVERRIDE
             {
-                std::size_t ret = 0;
-
-                for (const std::vector<long long> & current : flow_)
-                {
-                    ret = ret + static_cast<std::size_t>(current[target_]);
-                }
-
-                return ret;
+                return value_;
             }
 
             virtual long long flow(htd::vertex_t source, htd::vertex_t target) const HTD_OVERRIDE
             {
                 HTD_ASSERT(source < vertexCount() && target < vertexCount())
 
-                return flow_[source][target];
+                const std::vector<std::pair<htd::vertex_t, long long>> & currentFlow = flow_[source];
+
+                auto position = std::lower_bound(currentFlow.begin(), currentFlow.end(), std::make_pair(target, std::numeric_limits<long long>::min()));
+
+                return position != currentFlow.end() && position->first == target ? position->second : 0;
             }
 
             Flow * clone(void) const HTD_OVERRIDE
@@ -106,9 +101,14 @@ namespace htd
             }
 
             /**
-             *  The flow.
+             *  The net flow from each vertex to its neighbors in the flow network, sorted by neighbor. Pairs of vertices without flow may be omitted.
+             */
+            std::vector<std::vector<std::pair<htd::vertex_t, long long>>> flow_;
+
+            /**
+             *  The value of the flow.
              */
-            std::vector<std::vector<long long>> flow_;
+            std::size_t value_;
 
             /**
              *  The source vertex.
@@ -148,47 +148,88 @@ struct htd::DinitzMaxFlowAlgorithm::Implementation
     const htd::LibraryInstance * managementInstance_;
 
     /**
-     *  Try to improve an existing flow.
-     *
-     *  @param[in] flowNetwork  The network for which the improved flow shall be computed.
-     *  @param[in] flow         The (currently) best known flow within the given flow network.
+     *  Constant for the level of vertices which are not part of the current level graph.
+     */
+    static constexpr std::size_t UNREACHED = (std::size_t)-1;
+
+    /**
+     *  Constant for the level of vertices which were removed from the current level graph.
+     */
+    static constexpr std::size_t REMOVED = (std::size_t)-2;
+
+    /**
+     *  Internal data structure for the residual network of a flow network.
      *
-     *  @return A matrix containing the updated residual capacities or nullptr if the provided flow is already maximal.
+     *  The arcs are stored in compressed sparse row format and every arc of the flow network
+     *  is paired with a reverse arc of capacity zero.
      */
-    std::vector<std::vector<std::size_t>> * improveFlow(const htd::IFlowNetworkStructure & flowNetwork, const htd::Flow & flow) const;
+    struct ResidualNetwork
+    {
+        /**
+         *  The offsets of the outgoing arcs of each vertex within the arc arrays.
+         */
+        std::vector<std::size_t> arcOffsets;
+
+        /**
+         *  The target vertex of each arc.
+         */
+        std::vector<htd::vertex_t> arcTargets;
+
+        /**
+         *  The position of the reverse arc of each arc.
+         */
+        std::vector<htd::index_t> reverseArcs;
+
+        /**
+         *  The capacity of each arc.
+         */
+        std::vector<std::size_t> capacities;
+
+        /**
+         *  The residual capacity of each arc.
+         */
+        std::vector<std::size_t> residuals;
+
+        /**
+         *  The level of each vertex in the current level graph.
+         */
+        std::vector<std::size_t> levels;
+
+        /**
+         *  The next arc to investigate for each vertex during the computation of a blocking flow.
+         */
+        std::vector<std::size_t> currentArcs;
+    };
 
     /**
-     *  Perform an improvement step for the flow between the source and the target vertex.
+     *  Create the residual network of the given flow network for the empty flow.
      *
      *  @param[in] flowNetwork  The flow network.
-     *  @param[in] capacities   The residual capacities which will be updated.
-     *  @param[in] distances    The distances from each vertex to the target vertex of the flow network.
-     *  @param[in] source       The source vertex.
-     *  @param[in] target       The target vertex.
+     *  @param[out] network     The residual network.
      */
-    void performImprovementStep(const htd::IFlowNetworkStructure & flowNetwork, std::vector<std::vector<std::size_t>> & capacities, const std::vector<std::size_t> & distances, htd::vertex_t source, htd::vertex_t target) const;
+    void createResidualNetwork(const htd::IFlowNetworkStructure & flowNetwork, ResidualNetwork & network) const;
 
     /**
-     *  Compute the minimum distances between the vertices of the given flow network to the selected target vertex.
+     *  Compute the level graph of the residual network via breadth-first search.
      *
-     *  @param[in] flowNetwork  The flow network.
-     *  @param[in] capacities   The current residual capacities of the flow network.
+     *  @param[in,out] network  The residual network.
+     *  @param[in] source       The source vertex.
      *  @param[in] target       The target vertex.
      *
-     *  @return A vector containing the distances from each vertex to the target vertex.
+     *  @return True if the target vertex is reachable from the source vertex in the residual network, false otherwise.
      */
-    std::vector<std::size_t> * computeMinimumDistances(const htd::IFlowNetworkStructure & flowNetwork, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const;
+    bool computeLevels(ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target) const;
 
     /**
-     *  Compute the minimum capacity within the given path starting from the given target vertex.
+     *  Augment the flow by a blocking flow of the current level graph.
      *
-     *  @param[in] path         A sequence of vertices which defines the path to investigate.
-     *  @param[in] capacities   The current residual capacities of the flow network.
+     *  @param[in,out] network  The residual network.
+     *  @param[in] source       The source vertex.
      *  @param[in] target       The target vertex.
      *
-     *  @return The minimum capacity within the given path.
+     *  @return The value by which the flow was augmented.
      */
-    std::size_t computeMinimumCapacity(const std::vector<htd::vertex_t> & path, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const;
+    std::size_t augmentBlockingFlow(ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target) const;
 };
 
 htd::DinitzMaxFlowAlgorithm::DinitzMaxFlowAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -207,21 +248,58 @@ htd::IFlow * htd::DinitzMaxFlowAlgorithm::determineMaximumFlow(const htd::IFlowN
 
     htd::Flow * ret = new htd::Flow(vertexCount, source, target);
 
-    std::vector<std::vector<std::size_t>> * capacities = implementation_->improveFlow(flowNetwork, *ret);
-
-    while (capacities != nullptr)
+    if (source != target)
     {
-        for (htd::index_t i = 0; i < vertexCount; ++i)
+        Implementation::ResidualNetwork network;
+
+        implementation_->createResidualNetwork(flowNetwork, network);
+
+        while (!implementation_->managementInstance_->isTerminated() && implementation_->computeLevels(network, source, target))
+        {
+            ret->value_ += implementation_->augmentBlockingFlow(network, source, target);
+        }
+
+        for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
         {
-            for (htd::index_t j = 0; j < vertexCount; ++j)
+            for (std::size_t arc = network.arcOffsets[vertex]; arc < network.arcOffsets[vertex + 1]; ++arc)
             {
-                ret->flow_[i][j] = flowNetwork.capacity(i, j) - (*capacities)[i][j];
+                std::size_t capacity = network.capacities[arc];
+
+                if (capacity > 0 && network.residuals[arc] < capacity)
+                {
+                    std::size_t flow = capacity - network.residuals[arc];
+
+                    htd::vertex_t neighbor = network.arcTargets[arc];
+
+                    ret->flow_[vertex].emplace_back(neighbor, static_cast<long long>(flow));
+                    ret->flow_[neighbor].emplace_back(vertex, -static_cast<long long>(flow));
+                }
             }
         }
 
-        delete capacities;
+        std::vector<std::pair<htd::vertex_t, long long>> mergedFlow;
 
-        capacities = implementation_->improveFlow(flowNetwork, *ret);
+        for (std::vector<std::pair<htd::vertex_t, long long>> & currentFlow : ret->flow_)
+        {
+            std::sort(currentFlow.begin(), currentFlow.end());
+
+            /* Merge the entries of anti-parallel arcs into the net flow between the two vertices. */
+            mergedFlow.clear();
+
+            for (const std::pair<htd::vertex_t, long long> & entry : currentFlow)
+            {
+                if (!mergedFlow.empty() && mergedFlow.back().first == entry.first)
+                {
+                    mergedFlow.back().second += entry.second;
+                }
+                else
+                {
+                    mergedFlow.push_back(entry);
+                }
+            }
+
+            currentFlow.assign(mergedFlow.begin(), mergedFlow.end());
+        }
     }
 
     return ret;
@@ -244,162 +322,167 @@ htd::DinitzMaxFlowAlgorithm * htd::DinitzMaxFlowAlgorithm::clone(void) const
     return new htd::DinitzMaxFlowAlgorithm(managementInstance());
 }
 
-std::vector<std::vector<std::size_t>> * htd::DinitzMaxFlowAlgorithm::Implementation::improveFlow(const htd::IFlowNetworkStructure & flowNetwork, const htd::Flow & flow) const
+void htd::DinitzMaxFlowAlgorithm::Implementation::createResidualNetwork(const htd::IFlowNetworkStructure & flowNetwork, ResidualNetwork & network) const
 {
     std::size_t vertexCount = flowNetwork.vertexCount();
 
-    std::vector<std::vector<std::size_t>> * ret = new std::vector<std::vector<std::size_t>>(vertexCount, std::vector<std::size_t>(vertexCount));
+    network.arcOffsets.assign(vertexCount + 1, 0);
 
-    std::vector<std::vector<std::size_t>> & capacities = *ret;
-
-    for (htd::index_t i = 0; i < vertexCount; i++)
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
     {
-        for (htd::index_t j = 0; j < vertexCount; j++)
+        for (htd::vertex_t neighbor : flowNetwork.neighbors(vertex))
         {
-            capacities[i][j] = flowNetwork.capacity(i, j) - static_cast<std::size_t>(flow.flow_[i][j]);
+            if (flowNetwork.capacity(vertex, neighbor) > 0)
+            {
+                ++network.arcOffsets[vertex + 1];
+                ++network.arcOffsets[neighbor + 1];
+            }
         }
     }
 
-    std::vector<std::size_t> * distances = computeMinimumDistances(flowNetwork, capacities, flow.target_);
-
-    if ((*distances)[flow.source_] == (std::size_t)-1)
-    {
-        delete ret;
-
-        ret = nullptr;
-    }
-    else
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
     {
-        performImprovementStep(flowNetwork, capacities, *distances, flow.source_, flow.target_);
+        network.arcOffsets[vertex + 1] += network.arcOffsets[vertex];
     }
 
-    delete distances;
+    std::size_t arcCount = network.arcOffsets[vertexCount];
 
-    return ret;
-}
+    network.arcTargets.resize(arcCount);
+    network.reverseArcs.resize(arcCount);
+    network.capacities.assign(arcCount, 0);
 
-void htd::DinitzMaxFlowAlgorithm::Implementation::performImprovementStep(const htd::IFlowNetworkStructure & flowNetwork, std::vector<std::vector<std::size_t>> & capacities, const std::vector<std::size_t> & distances, htd::vertex_t source, htd::vertex_t target) const
-{
-    std::deque<htd::vertex_t> originDeque;
+    std::vector<std::size_t> positions(network.arcOffsets.begin(), network.arcOffsets.end() - 1);
 
-    std::unordered_set<htd::vertex_t> visitedVertices;
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        for (htd::vertex_t neighbor : flowNetwork.neighbors(vertex))
+        {
+            std::size_t capacity = flowNetwork.capacity(vertex, neighbor);
 
-    htd::vertex_t currentVertex = source;
+            if (capacity > 0)
+            {
+                htd::index_t arc = positions[vertex]++;
+                htd::index_t reverseArc = positions[neighbor]++;
 
-    originDeque.emplace_back(currentVertex);
+                network.arcTargets[arc] = neighbor;
+                network.arcTargets[reverseArc] = vertex;
 
-    std::vector<htd::vertex_t> predecessors(flowNetwork.vertexCount(), (htd::vertex_t)-1);
+                network.reverseArcs[arc] = reverseArc;
+                network.reverseArcs[reverseArc] = arc;
 
-    while (!originDeque.empty() && !managementInstance_->isTerminated())
-    {
-        currentVertex = originDeque.front();
+                network.capacities[arc] = capacity;
+            }
+        }
+    }
 
-        if (visitedVertices.count(currentVertex) == 0)
-        {
-            visitedVertices.insert(currentVertex);
+    network.residuals = network.capacities;
 
-            if (currentVertex == target)
-            {
-                std::size_t delta = computeMinimumCapacity(predecessors, capacities, target);
+    network.levels.assign(vertexCount, static_cast<std::size_t>(UNREACHED));
+    network.currentArcs.assign(vertexCount, 0);
+}
 
-                htd::vertex_t current = currentVertex;
+bool htd::DinitzMaxFlowAlgorithm::Implementation::computeLevels(ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target) const
+{
+    std::fill(network.levels.begin(), network.levels.end(), static_cast<std::size_t>(UNREACHED));
 
-                htd::vertex_t predecessor = predecessors[currentVertex];
+    std::vector<htd::vertex_t> queue;
 
-                while (predecessor != (htd::vertex_t)-1)
-                {
-                    capacities[predecessor][current] = capacities[predecessor][current] - delta;
-                    capacities[current][predecessor] = capacities[current][predecessor] + delta;
+    network.levels[source] = 0;
 
-                    if (capacities[predecessor][current] == 0)
-                    {
-                        currentVertex = predecessor;
-                    }
+    network.currentArcs[source] = network.arcOffsets[source];
 
-                    current = predecessor;
+    queue.push_back(source);
 
-                    predecessor = predecessors[predecessor];
-                }
-            }
+    /* Vertices on the level of the target vertex or beyond cannot be part of a shortest augmenting path. */
+    for (htd::index_t index = 0; index < queue.size() && network.levels[queue[index]] < network.levels[target]; ++index)
+    {
+        htd::vertex_t vertex = queue[index];
 
-            originDeque.pop_front();
+        for (std::size_t arc = network.arcOffsets[vertex]; arc < network.arcOffsets[vertex + 1]; ++arc)
+        {
+            htd::vertex_t neighbor = network.arcTargets[arc];
 
-            for (htd::vertex_t otherVertex = 0; otherVertex < flowNetwork.vertexCount(); ++otherVertex)
+            if (network.residuals[arc] > 0 && network.levels[neighbor] == UNREACHED)
             {
-                if (visitedVertices.count(otherVertex) == 0 && flowNetwork.capacity(currentVertex, otherVertex) > 0 && capacities[currentVertex][otherVertex] > 0 && distances[currentVertex] == distances[otherVertex] + 1)
-                {
-                    predecessors[otherVertex] = currentVertex;
+                network.levels[neighbor] = network.levels[vertex] + 1;
 
-                    originDeque.emplace_back(otherVertex);
-                }
+                network.currentArcs[neighbor] = network.arcOffsets[neighbor];
+
+                queue.push_back(neighbor);
             }
         }
-        else
-        {
-            originDeque.pop_front();
-        }
     }
+
+    return network.levels[target] != UNREACHED;
 }
 
-std::vector<std::size_t> * htd::DinitzMaxFlowAlgorithm::Implementation::computeMinimumDistances(const htd::IFlowNetworkStructure & flowNetwork, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const
+std::size_t htd::DinitzMaxFlowAlgorithm::Implementation::augmentBlockingFlow(ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target) const
 {
-    std::size_t vertexCount = flowNetwork.vertexCount();
+    std::size_t ret = 0;
 
-    std::vector<std::size_t> * ret = new std::vector<std::size_t>(vertexCount, (std::size_t)-1);
+    std::vector<htd::index_t> path;
 
-    std::vector<std::size_t> & distances = *ret;
+    htd::vertex_t vertex = source;
 
-    distances[target]=0;
+    while (!managementInstance_->isTerminated())
+    {
+        if (vertex == target)
+        {
+            std::size_t delta = (std::size_t)-1;
 
-    std::stack<htd::vertex_t> stack;
+            for (htd::index_t arc : path)
+            {
+                delta = std::min(delta, network.residuals[arc]);
+            }
 
-    stack.push(target);
+            for (htd::index_t arc : path)
+            {
+                network.residuals[arc] -= delta;
+                network.residuals[network.reverseArcs[arc]] += delta;
+            }
 
-    while(!stack.empty())
-    {
-        htd::vertex_t vertex = stack.top();
+            ret += delta;
 
-        stack.pop();
+            path.clear();
 
-        for (htd::index_t index = 0; index < vertexCount; ++index)
+            vertex = source;
+        }
+        else
         {
-            if (flowNetwork.capacity(index, vertex) > 0 && capacities[index][vertex] > 0)
-            {
-                std::size_t distance = distances[vertex] + 1;
+            std::size_t & currentArc = network.currentArcs[vertex];
 
-                if (distance < distances[index])
-                {
-                    distances[index] = distance;
+            std::size_t nextLevel = network.levels[vertex] + 1;
 
-                    stack.push(index);
-                }
+            while (currentArc < network.arcOffsets[vertex + 1] && (network.residuals[currentArc] == 0 || network.levels[network.arcTargets[currentArc]] != nextLevel))
+            {
+                ++currentArc;
             }
-        }
-    }
 
-    return ret;
-}
-
-std::size_t htd::DinitzMaxFlowAlgorithm::Implementation::computeMinimumCapacity(const std::vector<htd::vertex_t> & path, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const
-{
-    std::size_t ret = (std::size_t)-1;
+            if (currentArc < network.arcOffsets[vertex + 1])
+            {
+                path.push_back(currentArc);
 
-    htd::vertex_t current = target;
+                vertex = network.arcTargets[currentArc];
+            }
+            else
+            {
+                if (path.empty())
+                {
+                    break;
+                }
 
-    htd::vertex_t predecessor = path[current];
+                /* The vertex is a dead end, hence it is removed from the level graph. */
+                network.levels[vertex] = REMOVED;
 
-    while (predecessor != (htd::vertex_t)-1)
-    {
-        std::size_t capacity = capacities[predecessor][current];
+                htd::index_t arc = path.back();
 
-        if (ret > capacity)
-        {
-            ret = capacity;
-        }
+                path.pop_back();
 
-        current = predecessor;
+                vertex = network.arcTargets[network.reverseArcs[arc]];
 
-        predecessor = path[predecessor];
+                ++network.currentArcs[vertex];
+            }
+        }
     }
 
     return ret;
@@ -0,0 +1,150 @@
+/* 
+ * File:   EliminationWidthEvaluator.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef HTD_HTD_ELIMINATIONWIDTHEVALUATOR_CPP
+#define HTD_HTD_ELIMINATIONWIDTHEVALUATOR_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/EliminationTree.hpp>
+#include <htd/EliminationWidthEvaluator.hpp>
+
+#include <algorithm>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::EliminationWidthEvaluator.
+ */
+struct htd::EliminationWidthEvaluator::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+};
+
+htd::EliminationWidthEvaluator::EliminationWidthEvaluator(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::EliminationWidthEvaluator::EliminationWidthEvaluator(const htd::EliminationWidthEvaluator & original) : implementation_(new Implementation(original.implementation_->managementInstance_))
+{
+
+}
+
+htd::EliminationWidthEvaluator::~EliminationWidthEvaluator()
+{
+
+}
+
+std::size_t htd::EliminationWidthEvaluator::computeMaximumBagSize(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering) const
+{
+    return computeMaximumBagSize(graph, ordering, (std::size_t)-1);
+}
+
+std::size_t htd::EliminationWidthEvaluator::computeMaximumBagSize(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering, std::size_t maxBagSize) const
+{
+    std::size_t size = graph.vertexCount();
+
+    HTD_ASSERT(ordering.size() == size)
+
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    if (maxBagSize == 0)
+    {
+        return 1;
+    }
+
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    htd::EliminationTree eliminationTree(graph, ordering);
+
+    std::vector<std::size_t> columnCounts(size, 1);
+
+    std::size_t ret = 1;
+
+    htd::index_t currentRow = (htd::index_t)-1;
+
+    /* Each position within the row subtree of a row gains the row in its bag. */
+    eliminationTree.build([&](htd::index_t row, htd::index_t column)
+    {
+        if (row != currentRow)
+        {
+            currentRow = row;
+
+            if (managementInstance.isTerminated())
+            {
+                return false;
+            }
+        }
+
+        std::size_t count = ++columnCounts[column];
+
+        if (count > ret)
+        {
+            ret = count;
+        }
+
+        return ret <= maxBagSize;
+    });
+
+    return ret;
+}
+
+const htd::LibraryInstance * htd::EliminationWidthEvaluator::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::EliminationWidthEvaluator::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::EliminationWidthEvaluator * htd::EliminationWidthEvaluator::clone(void) const
+{
+    return new htd::EliminationWidthEvaluator(*this);
+}
+
+#endif /* HTD_HTD_ELIMINATIONWIDTHEVALUATOR_CPP */
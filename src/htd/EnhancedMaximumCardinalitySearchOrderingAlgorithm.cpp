@@ -30,11 +30,12 @@
 #include <htd/EnhancedMaximumCardinalitySearchOrderingAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/IndexedBucketQueue.hpp>
+#include <htd/NeighborhoodSnapshot.hpp>
 #include <htd/VertexOrdering.hpp>
 
 #include <algorithm>
-#include <deque>
-#include <unordered_set>
+#include <functional>
 
 /**
  *  Private implementation details of class htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm.
@@ -62,94 +63,190 @@ struct htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::Implementation
     const htd::LibraryInstance * managementInstance_;
 
     /**
-     *  Fill the pool of vertices having maximum weight.
-     *
-     *  @param[in] vertices The set of vertices which shall be considered.
-     *  @param[in] weights  A vector containing the weights associated with each of the vertices.
-     *  @param[out] pool    The vertex pool which shall be filled with all vertices of maximum weight.
+     *  Structure holding the state of MCS-M which is maintained across the individual elimination steps.
      */
-    void fillMaxCardinalityPool(const std::unordered_set<htd::vertex_t> & vertices, const std::vector<std::size_t> & weights, std::vector<htd::vertex_t> & pool) const HTD_NOEXCEPT
+    struct SearchState
     {
-        std::size_t max = 0;
-
-        pool.clear();
-
-        for (htd::vertex_t vertex : vertices)
+        /**
+         *  Constructor for the search state.
+         *
+         *  @param[in] vertexCount  The number of vertices of the input graph.
+         */
+        SearchState(std::size_t vertexCount) : unnumbered(vertexCount), weights(vertexCount, 0), weightCounts(1, 0), visited(vertexCount, 0), visitedCounts(1, 0), buckets(), epoch(0)
         {
-            std::size_t tmp = weights[vertex];
-
-            if (tmp >= max)
-            {
-                if (tmp > max)
-                {
-                    max = tmp;
-
-                    pool.clear();
-                }
 
-                pool.push_back(vertex);
-            }
         }
-    }
+
+        /**
+         *  The priority queue holding all unnumbered vertices, prioritized by their weight.
+         */
+        htd::IndexedBucketQueue<std::less<std::size_t>> unnumbered;
+
+        /**
+         *  The weight associated with each of the vertices.
+         */
+        std::vector<std::size_t> weights;
+
+        /**
+         *  The number of unnumbered vertices having a given weight.
+         */
+        std::vector<std::size_t> weightCounts;
+
+        /**
+         *  The stamp of the latest search which visited each of the vertices.
+         */
+        std::vector<std::size_t> visited;
+
+        /**
+         *  The number of vertices having a given weight which were visited during the current search.
+         */
+        std::vector<std::size_t> visitedCounts;
+
+        /**
+         *  The buckets of vertices pending for expansion, indexed by weight.
+         */
+        std::vector<std::vector<htd::vertex_t>> buckets;
+
+        /**
+         *  The stamp marking the vertices visited during the current search.
+         */
+        std::size_t epoch;
+    };
 
     /**
-     *  Check whether there exists a path between two vertices consisting of only
-     *  unnumbered vertices in the graph whose weight is strictly less than the
-     *  weight of the source vertex.
+     *  Collect all unnumbered vertices which are reachable from the given vertex via a path whose
+     *  intermediate vertices are unnumbered and have a weight strictly less than the weight of the
+     *  reached vertex. These are exactly the vertices whose weight MCS-M increases after the given
+     *  vertex was numbered.
      *
-     *  @param[in] graph    The graph.
-     *  @param[in] weights  A vector containing the weights associated with each of the vertices.
-     *  @param[in] vertices The set of vertices which shall be considered.
-     *  @param[in] source   The source vertex.
-     *  @param[in] target   The target vertex.
+     *  The search processes the intermediate vertices in buckets of ascending weight, so that each
+     *  vertex is reached via a path whose maximum intermediate weight is as small as possible. Hence,
+     *  every vertex is visited at most once. The search stops as soon as no unvisited vertex is left
+     *  whose weight exceeds the current bucket, because no further vertex can be collected then.
      *
-     *  @return True if a valid path between the two vertices exists, false otherwise.
+     *  @param[in] neighborhood The neighborhoods of the vertices of the preprocessed graph.
+     *  @param[in] source       The vertex which was numbered last. It must already be removed from the unnumbered vertices.
+     *  @param[in,out] state    The search state. All buckets are empty after the search.
+     *  @param[out] target      The vector to which the reachable vertices shall be appended.
      */
-    bool hasValidPath(const htd::IPreprocessedGraph & graph, const std::vector<std::size_t> & weights, const std::unordered_set<htd::vertex_t> & vertices, htd::vertex_t source, htd::vertex_t target)
+    void collectReachableVertices(const htd::NeighborhoodSnapshot & neighborhood, htd::vertex_t source, SearchState & state, std::vector<htd::vertex_t> & target) const
     {
-        bool ret = false;
+        const htd::IndexedBucketQueue<std::less<std::size_t>> & unnumbered = state.unnumbered;
+
+        const std::vector<std::size_t> & weights = state.weights;
+
+        std::vector<std::size_t> & visited = state.visited;
+
+        std::vector<std::size_t> & visitedCounts = state.visitedCounts;
+
+        std::vector<std::vector<htd::vertex_t>> & buckets = state.buckets;
+
+        std::size_t maximumWeight = unnumbered.topPriority();
 
-        std::size_t currentWeight = weights[source];
+        std::size_t epoch = ++state.epoch;
 
-        std::deque<htd::vertex_t> originDeque;
+        std::size_t pending = 0;
 
-        std::unordered_set<htd::vertex_t> visitedVertices;
+        /* The number of unvisited, unnumbered vertices whose weight exceeds the current level. */
+        std::size_t candidates = unnumbered.size() - state.weightCounts[0];
 
-        htd::vertex_t currentVertex = source;
+        std::fill(visitedCounts.begin(), visitedCounts.begin() + maximumWeight + 1, 0);
 
-        originDeque.push_back(currentVertex);
+        visited[source] = epoch;
 
-        while (!ret && !originDeque.empty() && !managementInstance_->isTerminated())
+        for (auto it = neighborhood.begin(source), last = neighborhood.end(source); it != last; ++it)
         {
-            currentVertex = originDeque.front();
+            htd::vertex_t neighbor = *it;
 
-            visitedVertices.insert(currentVertex);
+            if (unnumbered.contains(neighbor))
+            {
+                std::size_t neighborWeight = weights[neighbor];
+
+                visited[neighbor] = epoch;
+
+                ++(visitedCounts[neighborWeight]);
+
+                if (neighborWeight > 0)
+                {
+                    --candidates;
+                }
 
-            ret = currentVertex == target;
+                target.push_back(neighbor);
+
+                /* Vertices of maximum weight are never used as intermediate vertices, no vertex can have a larger weight. */
+                if (neighborWeight < maximumWeight)
+                {
+                    buckets[neighborWeight].push_back(neighbor);
+
+                    ++pending;
+                }
+            }
+        }
+
+        std::size_t level = 0;
+
+        while (pending > 0 && candidates > 0 && level < maximumWeight)
+        {
+            std::vector<htd::vertex_t> & currentBucket = buckets[level];
 
-            if (!ret)
+            while (candidates > 0 && !currentBucket.empty())
             {
-                const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(currentVertex);
+                htd::vertex_t currentVertex = currentBucket.back();
 
-                auto it = neighborCollection.begin();
+                currentBucket.pop_back();
 
-                for (std::size_t remainder = neighborCollection.size(); remainder > 0; --remainder)
+                --pending;
+
+                for (auto it = neighborhood.begin(currentVertex), last = neighborhood.end(currentVertex); it != last; ++it)
                 {
                     htd::vertex_t neighbor = *it;
 
-                    if (visitedVertices.count(neighbor) == 0 && ((vertices.count(neighbor) == 1 && weights[neighbor] < currentWeight) || neighbor == target))
+                    if (visited[neighbor] != epoch && unnumbered.contains(neighbor))
                     {
-                        originDeque.push_back(neighbor);
-                    }
+                        std::size_t neighborWeight = weights[neighbor];
+
+                        visited[neighbor] = epoch;
+
+                        ++(visitedCounts[neighborWeight]);
+
+                        if (neighborWeight > level)
+                        {
+                            --candidates;
+
+                            target.push_back(neighbor);
+
+                            if (neighborWeight < maximumWeight)
+                            {
+                                buckets[neighborWeight].push_back(neighbor);
+
+                                ++pending;
+                            }
+                        }
+                        else
+                        {
+                            currentBucket.push_back(neighbor);
 
-                    ++it;
+                            ++pending;
+                        }
+                    }
                 }
             }
 
-            originDeque.pop_front();
+            if (currentBucket.empty())
+            {
+                ++level;
+
+                /* Unvisited vertices whose weight equals the new level cannot be collected anymore. */
+                candidates -= state.weightCounts[level] - visitedCounts[level];
+            }
         }
 
-        return ret;
+        for (; pending > 0 && level < maximumWeight; ++level)
+        {
+            pending -= buckets[level].size();
+
+            buckets[level].clear();
+        }
     }
 };
 
@@ -183,16 +280,16 @@ htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::c
 
     std::size_t size = preprocessedGraph.remainingVertices().size();
 
-    std::unordered_set<htd::vertex_t> vertices(size);
-
-    htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
+    const htd::NeighborhoodSnapshot & neighborhood = preprocessedGraph.neighborhoodSnapshot();
 
-    std::vector<htd::vertex_t> pool;
+    Implementation::SearchState state(preprocessedGraph.inputGraphVertexCount());
 
-    std::vector<std::size_t> weights(preprocessedGraph.inputGraphVertexCount());
+    std::vector<htd::vertex_t> reachableVertices;
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
+    htd::RandomNumberGenerator & generator = htd::randomNumberGenerator();
+
     std::vector<htd::vertex_t> ordering;
     ordering.reserve(preprocessedGraph.vertexCount());
 
@@ -200,23 +297,48 @@ htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::c
                     preprocessedGraph.eliminationSequence().begin(),
                     preprocessedGraph.eliminationSequence().end());
 
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        state.unnumbered.push(vertex, 0);
+    }
+
+    state.weightCounts[0] = size;
+
     while (size > 0 && !managementInstance.isTerminated())
     {
-        implementation_->fillMaxCardinalityPool(vertices, weights, pool);
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(state.unnumbered.topCollection(), generator);
 
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(pool);
+        state.unnumbered.erase(selectedVertex);
 
-        vertices.erase(selectedVertex);
+        --(state.weightCounts[state.weights[selectedVertex]]);
 
-        for (htd::vertex_t vertex : vertices)
+        if (!state.unnumbered.empty())
         {
-            if (implementation_->hasValidPath(preprocessedGraph, weights, vertices, vertex, selectedVertex))
+            implementation_->collectReachableVertices(neighborhood, selectedVertex, state, reachableVertices);
+
+            /* The weights are increased only after the search, because MCS-M compares against the weights before the current step. */
+            for (htd::vertex_t vertex : reachableVertices)
             {
-                weights[vertex]++;
+                std::size_t & currentWeight = state.weights[vertex];
+
+                --(state.weightCounts[currentWeight]);
+
+                ++currentWeight;
+
+                if (currentWeight == state.weightCounts.size())
+                {
+                    state.weightCounts.push_back(0);
+                    state.visitedCounts.push_back(0);
+                    state.buckets.emplace_back();
+                }
+
+                ++(state.weightCounts[currentWeight]);
+
+                state.unnumbered.updatePriority(vertex, currentWeight);
             }
-        }
 
-        pool.clear();
+            reachableVertices.clear();
+        }
 
         --size;
 
@@ -33,12 +33,14 @@
 #include <htd/PreprocessedGraph.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
 #include <htd/MinFillOrderingAlgorithm.hpp>
-#include <htd/ConnectedComponentAlgorithmFactory.hpp>
-#include <htd/IConnectedComponentAlgorithm.hpp>
 #include <htd/VectorAdapter.hpp>
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
+#include <htd/ThreadPool.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
 #include <numeric>
 #include <unordered_map>
 #include <unordered_set>
@@ -258,6 +260,11 @@ namespace htd
                 return baseGraph_.neighborhood(vertex);
             }
 
+            const htd::NeighborhoodSnapshot & neighborhoodSnapshot(void) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return baseGraph_.neighborhoodSnapshot();
+            }
+
             const std::vector<htd::vertex_t> & eliminationSequence(void) const HTD_NOEXCEPT HTD_OVERRIDE
             {
                 return eliminationSequence_;
@@ -273,6 +280,11 @@ namespace htd
                 return minTreeWidth_;
             }
 
+            std::size_t prefixWidth(void) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return minTreeWidth_;
+            }
+
     #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             PreprocessedGraphComponent * clone(void) const HTD_OVERRIDE
             {
@@ -355,6 +367,8 @@ struct htd::GraphPreprocessor::Implementation
                                                                  applyPreprocessing4_(false),
                                                                  iterationCount_(1),
                                                                  nonImprovementLimit_(0),
+                                                                 threadCount_(1),
+                                                                 cliqueSeparatorVertexLimit_(4096),
                                                                  orderingAlgorithm_(new htd::MinFillOrderingAlgorithm(manager))
     {
 
@@ -410,7 +424,18 @@ struct htd::GraphPreprocessor::Implementation
     std::size_t nonImprovementLimit_;
 
     /**
-     *  The base ordering algorithm which shall be used to eliminate all but the largest biconnected component.
+     *  The number of threads which shall be used to compute the vertex elimination orderings of the separated parts of the graph.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The maximum number of remaining vertices for which clique minimal separators are searched. The
+     *  search for clique minimal separators needs quadratic time, so it is skipped for larger graphs.
+     */
+    std::size_t cliqueSeparatorVertexLimit_;
+
+    /**
+     *  The base ordering algorithm which shall be used to eliminate all separated parts of the graph.
      */
     htd::IWidthLimitableOrderingAlgorithm * orderingAlgorithm_;
 
@@ -474,7 +499,7 @@ struct htd::GraphPreprocessor::Implementation
 
                         auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
 
-                        if (position != currentNeighborhood.end() && *position == mappedVertex)
+                        if (position != currentNeighborhood.end() && *position == vertex)
                         {
                             currentNeighborhood.erase(position);
                         }
@@ -490,7 +515,16 @@ struct htd::GraphPreprocessor::Implementation
 
                         vertexNames.push_back(vertex);
 
-                        graph.copyNeighborsTo(vertex, neighborhood[vertex]);
+                        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+                        graph.copyNeighborsTo(vertex, currentNeighborhood);
+
+                        auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
+
+                        if (position != currentNeighborhood.end() && *position == vertex)
+                        {
+                            currentNeighborhood.erase(position);
+                        }
                     }
                 }
                 else
@@ -572,6 +606,41 @@ struct htd::GraphPreprocessor::Implementation
         std::vector<std::vector<htd::vertex_t>> neighborhood;
     };
 
+    /**
+     *  Structure representing a part of the preprocessed graph which was split off at a clique separator.
+     *
+     *  The vertices of a part which are not contained in the separator are only adjacent to vertices of the
+     *  part. Because the separator is a clique, eliminating these vertices does not add any fill edge to the
+     *  remainder of the graph and hence, all parts can be decomposed independently of each other.
+     */
+    struct SeparatedPart
+    {
+        /**
+         *  Constructor for a new part of the preprocessed graph.
+         *
+         *  @param[in] preprocessedGraph    The preprocessed graph containing the part.
+         *  @param[in] vertices             The vertices (with 0-based IDs) of the part, sorted in ascending order.
+         *  @param[in] separator            The vertices (with 0-based IDs) of the part which separate it from the remainder of the graph, sorted in ascending order.
+         */
+        SeparatedPart(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> && vertices, std::vector<htd::vertex_t> && separator);
+
+        /**
+         *  The vertices (with 0-based IDs) of the part, sorted in ascending order.
+         */
+        std::vector<htd::vertex_t> vertices;
+
+        /**
+         *  The positions of the separator vertices within the vector vertices.
+         */
+        std::vector<htd::vertex_t> separator;
+
+        /**
+         *  The subgraph induced by the part. The vertex with index i of the subgraph corresponds to the
+         *  i-th entry of the vector vertices and its name is the actual identifier of this vertex.
+         */
+        std::shared_ptr<htd::PreprocessedGraph> graph;
+    };
+
     /**
      *  Eliminate all vertices of degree less than 2 from the graph.
      *
@@ -699,50 +768,86 @@ struct htd::GraphPreprocessor::Implementation
                                     std::size_t newDegree);
 
     /**
-     *  Decompose two sets of vertices into vertices only in the first set and vertices in both sets.
+     *  Split the remaining graph at its articulation points. The largest biconnected component
+     *  remains in the preprocessed graph and all other biconnected components are split off.
+     *
+     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
+     *  @param[in,out] parts            The separated parts of the graph in the order in which they shall be eliminated. The new parts are appended to this vector.
+     */
+    void applyBiconnectedComponentPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
+                                                std::vector<SeparatedPart> & parts) const;
+
+    /**
+     *  Iteratively split the remaining graph at clique minimal separators. The largest component
+     *  (together with the separator) remains in the preprocessed graph and all other components
+     *  are split off.
      *
-     *  @param[in] set1                 The first set of vertices, sorted in ascending order.
-     *  @param[in] set2                 The second set of vertices, sorted in ascending order.
-     *  @param[out] resultOnlySet1      The set of vertices which are found only in the first set, sorted in ascending order.
-     *  @param[out] resultIntersection  The set of vertices which are found in both sets, sorted in ascending order.
+     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
+     *  @param[in,out] parts            The separated parts of the graph in the order in which they shall be eliminated. The new parts are appended to this vector.
      */
-    void splitSets(const std::vector<htd::vertex_t> & set1,
-                   const std::vector<htd::vertex_t> & set2,
-                   std::vector<htd::vertex_t> & resultOnlySet1,
-                   std::vector<htd::vertex_t> & resultIntersection) const HTD_NOEXCEPT;
+    void applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
+                                           std::vector<SeparatedPart> & parts) const;
 
     /**
-     *  Compute largest biconnected component of the given graph and eliminate all vertices contained in the remainder.
+     *  Restrict the remaining vertices of the preprocessed graph to the given set of vertices and remove all edges leaving this set.
      *
-     *  @param[in] graph                The graph which shall be preprocessed.
      *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
-     *  @param[in] vertices             The set of all available vertices.
+     *  @param[in] remainingVertices    The new set of remaining vertices, sorted in ascending order.
+     *  @param[in] boundary             The vertices of the new set of remaining vertices which may have neighbors outside of this set.
      */
-    void applyBiconnectedComponentPreprocessing(const htd::IMultiHypergraph & graph,
-                                                htd::PreprocessedGraph & preprocessedGraph,
-                                                std::unordered_set<htd::vertex_t> & vertices) const;
+    void restrictRemainingVertices(htd::PreprocessedGraph & preprocessedGraph,
+                                   std::vector<htd::vertex_t> && remainingVertices,
+                                   const std::vector<htd::vertex_t> & boundary) const;
 
     /**
-     *  Eliminate a connected component from the given preprocessed graph and update the preprocessed graph's elimination sequence.
+     *  Compute the vertex elimination orderings of all separated parts and append them to the elimination sequence of the preprocessed graph.
+     *
+     *  The orderings of the parts are computed concurrently if more than one thread is available.
      *
      *  @param[in] graph                The graph underlying the operation.
-     *  @param[in] vertices             The vertices which shall be eliminated.
      *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
-     *  @param[in,out] minTreeWidth     The lower bound for the treewidth of the given graph component.
+     *  @param[in] parts                The separated parts of the graph in the order in which they shall be eliminated.
      */
-    void eliminateVertices(const htd::IMultiHypergraph & graph,
-                           const std::unordered_set<htd::vertex_t> & vertices,
-                           htd::PreprocessedGraph & preprocessedGraph,
-                           std::size_t & minTreeWidth) const;
+    void eliminateParts(const htd::IMultiHypergraph & graph,
+                        htd::PreprocessedGraph & preprocessedGraph,
+                        const std::vector<SeparatedPart> & parts) const;
 
     /**
-     *  Iteratively compute the clique minimal separators of the given graph and remove them from the graph.
+     *  Compute the vertex elimination ordering of a separated part.
      *
-     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
-     *  @param[in] vertices             The set of all available vertices.
+     *  The returned ordering contains the actual identifiers of all vertices of the part except the
+     *  separator vertices. It is derived from the best ordering of the part's subgraph found by the
+     *  given algorithm, rearranged such that the separator vertices would be eliminated last, which
+     *  does not increase the maximum bag size because the separator forms a clique.
+     *
+     *  @param[in] graph            The graph underlying the operation.
+     *  @param[in] part             The separated part.
+     *  @param[in] algorithm        The ordering algorithm which shall be used.
+     *  @param[out] maxBagSize      The maximum bag size induced by the computed ordering.
+     *
+     *  @return The vertex elimination ordering of the separated part.
      */
-    void applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
-                                           std::unordered_set<htd::vertex_t> & vertices) const;
+    std::vector<htd::vertex_t> computePartOrdering(const htd::IMultiHypergraph & graph,
+                                                   const SeparatedPart & part,
+                                                   const htd::IWidthLimitableOrderingAlgorithm & algorithm,
+                                                   std::size_t & maxBagSize) const;
+
+    /**
+     *  Rearrange a vertex elimination ordering such that the given clique is eliminated last.
+     *
+     *  The function computes the tree decomposition induced by the ordering, re-roots it at a bag
+     *  containing the clique and eliminates the vertices in the order of decreasing depth of the
+     *  topmost bag containing them. The resulting ordering induces no larger bags than the original one.
+     *
+     *  @param[in] neighborhood The neighborhoods of the vertices (with 0-based IDs) of the graph.
+     *  @param[in] ordering     The vertex elimination ordering (with 0-based IDs) which shall be rearranged.
+     *  @param[in] clique       The clique (with 0-based IDs) which shall be eliminated last. It must not be empty.
+     *
+     *  @return The rearranged vertex elimination ordering without the vertices of the clique.
+     */
+    static std::vector<htd::vertex_t> eliminateCliqueLast(const htd::NeighborhoodSnapshot & neighborhood,
+                                                          const std::vector<htd::vertex_t> & ordering,
+                                                          const std::vector<htd::vertex_t> & clique);
 };
 
 htd::GraphPreprocessor::GraphPreprocessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -893,11 +998,13 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
 
         if (implementation_->applyPreprocessing4_)
         {
-            //TODO
-            //implementation_->applyBiconnectedComponentPreprocessing(graph, *ret, vertices);
+            std::vector<htd::GraphPreprocessor::Implementation::SeparatedPart> parts;
 
-            //TODO
-            //implementation_->applyCliqueSeparatorPreprocessing(*ret, vertices);
+            implementation_->applyBiconnectedComponentPreprocessing(*ret, parts);
+
+            implementation_->applyCliqueSeparatorPreprocessing(*ret, parts);
+
+            implementation_->eliminateParts(graph, *ret, parts);
         }
     }
     else
@@ -976,6 +1083,16 @@ void htd::GraphPreprocessor::setNonImprovementLimit(std::size_t nonImprovementLi
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::size_t htd::GraphPreprocessor::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::GraphPreprocessor::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 void htd::GraphPreprocessor::setOrderingAlgorithm(htd::IWidthLimitableOrderingAlgorithm * algorithm)
 {
     HTD_ASSERT(algorithm != nullptr)
@@ -1576,49 +1693,54 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
     return ordering.size() > oldOrderingSize;
 }
 
-void htd::GraphPreprocessor::Implementation::splitSets(const std::vector<htd::vertex_t> & set1,
-                                                       const std::vector<htd::vertex_t> & set2,
-                                                       std::vector<htd::vertex_t> & resultOnlySet1,
-                                                       std::vector<htd::vertex_t> & resultIntersection) const HTD_NOEXCEPT
+htd::GraphPreprocessor::Implementation::SeparatedPart::SeparatedPart(const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                    std::vector<htd::vertex_t> && vertices,
+                                                                    std::vector<htd::vertex_t> && separator) : vertices(std::move(vertices)), separator(), graph()
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
+    std::size_t size = this->vertices.size();
+
+    std::vector<htd::vertex_t> vertexNames;
+    vertexNames.reserve(size);
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood(size);
 
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    std::size_t edgeCount = 0;
 
-    while (first1 != last1 && first2 != last2)
+    for (htd::index_t index = 0; index < size; ++index)
     {
-        if (*first1 < *first2)
-        {
-            resultOnlySet1.push_back(*first1);
+        htd::vertex_t vertex = this->vertices[index];
 
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            ++first2;
-        }
-        else
-        {
-            resultIntersection.push_back(*first1);
+        vertexNames.push_back(preprocessedGraph.vertexName(vertex));
+
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[index];
 
-            ++first1;
+        for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(vertex))
+        {
+            auto position = std::lower_bound(this->vertices.begin(), this->vertices.end(), neighbor);
 
-            //Skip common value in set 2.
-            ++first2;
+            if (position != this->vertices.end() && *position == neighbor)
+            {
+                currentNeighborhood.push_back(static_cast<htd::vertex_t>(std::distance(this->vertices.begin(), position)));
+            }
         }
+
+        edgeCount += currentNeighborhood.size();
     }
 
-    if (first1 != last1)
+    for (htd::vertex_t vertex : separator)
     {
-        resultOnlySet1.insert(resultOnlySet1.end(), first1, last1);
+        this->separator.push_back(static_cast<htd::vertex_t>(std::distance(this->vertices.begin(), std::lower_bound(this->vertices.begin(), this->vertices.end(), vertex))));
     }
+
+    std::vector<htd::vertex_t> remainingVertices(size);
+
+    std::iota(remainingVertices.begin(), remainingVertices.end(), 0);
+
+    graph = std::make_shared<htd::PreprocessedGraph>(std::move(vertexNames), std::move(neighborhood), std::vector<htd::vertex_t>(), std::move(remainingVertices), edgeCount / 2, 0);
 }
 
-void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocessing(const htd::IMultiHypergraph & graph,
-                                                                                    htd::PreprocessedGraph & preprocessedGraph,
-                                                                                    std::unordered_set<htd::vertex_t> & vertices) const
+void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
+                                                                                    std::vector<SeparatedPart> & parts) const
 {
     htd::BiconnectedComponentAlgorithm biconnectedComponentAlgorithm(managementInstance_);
 
@@ -1626,243 +1748,340 @@ void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocess
 
     std::vector<std::vector<htd::vertex_t>> components;
 
+    if (preprocessedGraph.remainingVertices().empty())
+    {
+        return;
+    }
+
     biconnectedComponentAlgorithm.determineComponents(preprocessedGraph, components, articulationPoints);
 
-    if (components.size() > 1)
+    if (managementInstance_->isTerminated() || components.empty())
     {
-        std::vector<htd::index_t> pool;
-        htd::index_t index = 0;
-        std::size_t max = 0;
-        for (const std::vector<htd::vertex_t> & component : components)
-        {
-            std::size_t size = component.size();
+        return;
+    }
 
-            if (size >= max)
-            {
-                if (size > max)
-                {
-                    max = size;
+    std::size_t vertexCount = preprocessedGraph.inputGraphVertexCount();
 
-                    pool.clear();
-                }
+    /* The biconnected components containing each vertex. A vertex contained in more than one component is an articulation point. */
+    std::vector<std::vector<htd::index_t>> containingComponents(vertexCount);
 
-                pool.push_back(index);
-            }
+    htd::index_t rootComponent = 0;
 
-            ++index;
+    for (htd::index_t index = 0; index < components.size(); ++index)
+    {
+        for (htd::vertex_t vertex : components[index])
+        {
+            containingComponents[vertex].push_back(index);
         }
 
-        const std::vector<htd::vertex_t> & selectedComponent = components[htd::selectRandomElement<htd::index_t>(pool)];
-
-        std::vector<htd::vertex_t> relevantArticulationPoints;
-
-        std::set_intersection(selectedComponent.begin(), selectedComponent.end(),
-                              articulationPoints.begin(), articulationPoints.end(),
-                              std::back_inserter(relevantArticulationPoints));
+        if (components[index].size() > components[rootComponent].size())
+        {
+            rootComponent = index;
+        }
+    }
 
-        for (htd::vertex_t vertex : relevantArticulationPoints)
+    /* Isolated vertices are not contained in any biconnected component, hence they are split off on their own. */
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        if (containingComponents[vertex].empty())
         {
-            std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
+            parts.emplace_back(preprocessedGraph, std::vector<htd::vertex_t> { vertex }, std::vector<htd::vertex_t>());
+        }
+    }
 
-            std::vector<htd::vertex_t> newNeighborhood;
-            std::vector<htd::vertex_t> otherNeighbors;
+    if (components.size() == 1 && parts.empty())
+    {
+        return;
+    }
 
-            splitSets(currentNeighborhood, selectedComponent, otherNeighbors, newNeighborhood);
+    /*
+     *  Traverse the block-cut tree in breadth-first order starting at the largest biconnected component. Each
+     *  component is separated from its parent by the articulation point via which it was reached. Components
+     *  of other connected components of the graph are reached from the root of their connected component,
+     *  which is not separated from the remainder of the graph by any vertex.
+     */
+    std::vector<htd::index_t> traversalOrder;
+    traversalOrder.reserve(components.size());
 
-            currentNeighborhood.swap(newNeighborhood);
+    std::vector<htd::vertex_t> parentSeparator(components.size(), htd::Vertex::UNKNOWN);
 
-            for (htd::vertex_t neighbor : otherNeighbors)
-            {
-                std::vector<htd::vertex_t> & otherNeighborhood = preprocessedGraph.neighborhood(neighbor);
+    std::vector<bool> visited(components.size(), false);
 
-                /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood'. */
-                // coverity[use_iterator]
-                otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
-            }
+    std::size_t nextComponent = 0;
+
+    for (htd::index_t start = rootComponent; traversalOrder.size() < components.size(); start = nextComponent++)
+    {
+        if (visited[start])
+        {
+            continue;
         }
 
-        preprocessedGraph.updateEdgeCount();
+        visited[start] = true;
+
+        std::size_t position = traversalOrder.size();
 
-        htd::IConnectedComponentAlgorithm * connectedComponentAlgorithm = managementInstance_->connectedComponentAlgorithmFactory().createInstance();
+        traversalOrder.push_back(start);
 
-        std::vector<std::vector<htd::vertex_t>> connectedComponents;
+        for (; position < traversalOrder.size(); ++position)
+        {
+            htd::index_t component = traversalOrder[position];
+
+            for (htd::vertex_t vertex : components[component])
+            {
+                if (containingComponents[vertex].size() > 1 && vertex != parentSeparator[component])
+                {
+                    for (htd::index_t neighborComponent : containingComponents[vertex])
+                    {
+                        if (!visited[neighborComponent])
+                        {
+                            visited[neighborComponent] = true;
 
-        connectedComponentAlgorithm->determineComponents(preprocessedGraph, connectedComponents);
+                            parentSeparator[neighborComponent] = vertex;
 
-        delete connectedComponentAlgorithm;
+                            traversalOrder.push_back(neighborComponent);
+                        }
+                    }
+                }
+            }
+        }
+    }
 
-        auto position = std::find_if(connectedComponents.begin(), connectedComponents.end(),
-                                     [&](const std::vector<htd::vertex_t> & component)
+    /* The parts are eliminated in reverse breadth-first order, i.e., every component is eliminated before its parent. */
+    for (auto it = traversalOrder.rbegin(); it != traversalOrder.rend(); ++it)
+    {
+        if (*it != rootComponent)
         {
-            return std::binary_search(component.begin(), component.end(), selectedComponent[0]);
-        });
+            std::vector<htd::vertex_t> separator;
 
-        HTD_ASSERT(position != connectedComponents.end())
+            if (parentSeparator[*it] != htd::Vertex::UNKNOWN)
+            {
+                separator.push_back(parentSeparator[*it]);
+            }
 
-        /*
-         * After separating the largest biconnected component from the remainder of the graph,
-         * it forms a connected component of the graph, i.e., the iterator 'position' always
-         * points to a valid position within the set of connected components.
-         */
-        // coverity[deref_iterator]
-        position->swap(*(connectedComponents.rbegin()));
+            parts.emplace_back(preprocessedGraph, std::vector<htd::vertex_t>(components[*it]), std::move(separator));
+        }
+    }
 
-        std::sort(connectedComponents.begin(), connectedComponents.end() - 1,
-                  [](const std::vector<htd::vertex_t> & component1, const std::vector<htd::vertex_t> & component2)
-        {
-           return component1.size() < component2.size();
-        });
+    std::vector<htd::vertex_t> boundary;
 
-        for (const std::vector<htd::vertex_t> & component : connectedComponents)
+    for (htd::vertex_t vertex : components[rootComponent])
+    {
+        if (containingComponents[vertex].size() > 1)
         {
-            std::vector<std::unordered_set<htd::vertex_t>> verticesByDegree(4);
+            boundary.push_back(vertex);
+        }
+    }
 
-            std::size_t oldOrderingSize = preprocessedGraph.eliminationSequence().size();
+    restrictRemainingVertices(preprocessedGraph, std::move(components[rootComponent]), boundary);
+}
 
-            std::unordered_set<htd::vertex_t> componentVertices(component.begin(), component.end());
+void htd::GraphPreprocessor::Implementation::applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
+                                                                               std::vector<SeparatedPart> & parts) const
+{
+    htd::CliqueMinimalSeparatorAlgorithm algorithm(managementInstance_);
 
-            std::size_t minTreeWidth = 0;
+    std::vector<htd::state_t> status(preprocessedGraph.inputGraphVertexCount(), 0);
 
-            for (htd::vertex_t vertex : component)
-            {
-                assignVertexToGroup(vertex, verticesByDegree, preprocessedGraph.neighborhood(vertex).size());
-            }
+    while (preprocessedGraph.vertexCount() > 2 && preprocessedGraph.vertexCount() <= cliqueSeparatorVertexLimit_ && !managementInstance_->isTerminated())
+    {
+        std::unique_ptr<std::vector<htd::vertex_t>> separator(algorithm.computeSeparator(preprocessedGraph));
 
-            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-            {
+        if (separator == nullptr || separator->empty() || managementInstance_->isTerminated())
+        {
+            break;
+        }
 
-            }
+        std::sort(separator->begin(), separator->end());
 
-            bool ok = false;
+        /* Status 1 marks the vertices of the separator, status 2 marks the vertices already assigned to a component. */
+        for (htd::vertex_t vertex : *separator)
+        {
+            status[vertex] = 1;
+        }
+
+        std::vector<std::vector<htd::vertex_t>> separatedComponents;
+
+        htd::index_t largestComponent = 0;
 
-            if (!componentVertices.empty())
+        for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+        {
+            if (status[vertex] == 0)
             {
-                minTreeWidth = 2;
+                std::vector<htd::vertex_t> component { vertex };
 
-                while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                {
-                    ok = true;
-                }
+                status[vertex] = 2;
 
-                if (ok)
+                for (htd::index_t index = 0; index < component.size(); ++index)
                 {
-                    while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                    for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(component[index]))
                     {
+                        if (status[neighbor] == 0)
+                        {
+                            status[neighbor] = 2;
 
+                            component.push_back(neighbor);
+                        }
                     }
                 }
+
+                std::sort(component.begin(), component.end());
+
+                if (separatedComponents.empty() || component.size() > separatedComponents[largestComponent].size())
+                {
+                    largestComponent = separatedComponents.size();
+                }
+
+                separatedComponents.push_back(std::move(component));
             }
+        }
+
+        for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+        {
+            status[vertex] = 0;
+        }
+
+        if (separatedComponents.size() < 2)
+        {
+            break;
+        }
 
-            if (!componentVertices.empty())
+        for (htd::index_t index = 0; index < separatedComponents.size(); ++index)
+        {
+            if (index != largestComponent)
             {
-                minTreeWidth = 3;
+                std::vector<htd::vertex_t> & component = separatedComponents[index];
+
+                /* Only the separator vertices adjacent to the component are part of the component's subgraph. */
+                std::vector<htd::vertex_t> attachedSeparator;
 
-                while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                for (htd::vertex_t vertex : *separator)
                 {
-                    ok = false;
+                    const std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
 
-                    while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                    if (htd::set_intersection_size(currentNeighborhood.begin(), currentNeighborhood.end(), component.begin(), component.end()) > 0)
                     {
-                        ok = true;
+                        attachedSeparator.push_back(vertex);
                     }
+                }
 
-                    if (ok)
-                    {
-                        while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
+                std::vector<htd::vertex_t> partVertices;
 
-                        }
-                    }
-                }
+                std::merge(component.begin(), component.end(), attachedSeparator.begin(), attachedSeparator.end(), std::back_inserter(partVertices));
+
+                parts.emplace_back(preprocessedGraph, std::move(partVertices), std::move(attachedSeparator));
             }
+        }
 
-            if (!componentVertices.empty())
-            {
-                if (eliminateSimplicialVertices(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), 64, minTreeWidth))
-                {
-                    while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                    {
-                        ok = false;
+        std::vector<htd::vertex_t> remainingVertices;
 
-                        while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
-                            ok = true;
-                        }
+        std::merge(separatedComponents[largestComponent].begin(), separatedComponents[largestComponent].end(), separator->begin(), separator->end(), std::back_inserter(remainingVertices));
 
-                        if (ok)
-                        {
-                            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                            {
+        restrictRemainingVertices(preprocessedGraph, std::move(remainingVertices), *separator);
+    }
+}
 
-                            }
-                        }
-                    }
+void htd::GraphPreprocessor::Implementation::restrictRemainingVertices(htd::PreprocessedGraph & preprocessedGraph,
+                                                                       std::vector<htd::vertex_t> && remainingVertices,
+                                                                       const std::vector<htd::vertex_t> & boundary) const
+{
+    for (htd::vertex_t vertex : boundary)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
 
-                    while (eliminateAlmostSimplicialVertices(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), minTreeWidth))
-                    {
-                        while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
-                            ok = false;
+        std::vector<htd::vertex_t> newNeighborhood;
 
-                            while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                            {
-                                ok = true;
-                            }
+        std::set_intersection(currentNeighborhood.begin(), currentNeighborhood.end(),
+                              remainingVertices.begin(), remainingVertices.end(),
+                              std::back_inserter(newNeighborhood));
 
-                            if (ok)
-                            {
-                                while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                                {
+        currentNeighborhood.swap(newNeighborhood);
+    }
 
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+    preprocessedGraph.setRemainingVertices(std::move(remainingVertices));
 
-            for (auto it = preprocessedGraph.eliminationSequence().begin() + oldOrderingSize; it != preprocessedGraph.eliminationSequence().end(); ++it)
-            {
-                vertices.erase(*it);
+    preprocessedGraph.updateNeighborhoodSnapshot();
+}
 
-                *it = preprocessedGraph.vertexName(*it);
-            }
+void htd::GraphPreprocessor::Implementation::eliminateParts(const htd::IMultiHypergraph & graph,
+                                                            htd::PreprocessedGraph & preprocessedGraph,
+                                                            const std::vector<SeparatedPart> & parts) const
+{
+    std::vector<std::vector<htd::vertex_t>> orderings(parts.size());
 
-            if (!std::binary_search(component.begin(), component.end(), selectedComponent[0]))
-            {
-                oldOrderingSize = preprocessedGraph.eliminationSequence().size();
+    std::vector<std::size_t> maxBagSizes(parts.size(), 0);
 
-                eliminateVertices(graph, componentVertices, preprocessedGraph, minTreeWidth);
+    std::vector<std::size_t> lowerBounds(parts.size(), 0);
 
-                for (auto it = componentVertices.begin(); it != componentVertices.end(); ++it)
-                {
-                    vertices.erase(*it);
-                }
-            }
-            else
+    /* Every part uses its own seed so that the result does not depend on the number of threads. */
+    const htd::RandomNumberGenerator::result_type baseSeed = htd::randomNumberGenerator()();
+
+    std::atomic<std::size_t> nextPart(0);
+
+    auto worker = [&](const htd::IWidthLimitableOrderingAlgorithm & algorithm)
+    {
+        for (htd::index_t index = nextPart++; index < parts.size() && !managementInstance_->isTerminated(); index = nextPart++)
+        {
+            htd::randomNumberGenerator().seed(htd::RandomNumberGenerator::deriveSeed(baseSeed, index));
+
+            orderings[index] = computePartOrdering(graph, parts[index], algorithm, maxBagSizes[index]);
+
+            lowerBounds[index] = htd::TreeWidthLowerBoundAlgorithm(managementInstance_).computeMinorMinWidth(*(parts[index].graph));
+        }
+    };
+
+    if (htd::ThreadPool::effectiveThreadCount(threadCount_) > 1 && parts.size() > 1)
+    {
+        htd::ThreadPool threadPool(std::min(htd::ThreadPool::effectiveThreadCount(threadCount_), parts.size()));
+
+        for (std::size_t thread = 0; thread < threadPool.threadCount(); ++thread)
+        {
+            threadPool.submit([&]()
             {
-                std::vector<htd::vertex_t> remainingVertices(componentVertices.begin(), componentVertices.end());
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                std::unique_ptr<htd::IWidthLimitableOrderingAlgorithm> algorithm(orderingAlgorithm_->clone());
+#else
+                std::unique_ptr<htd::IWidthLimitableOrderingAlgorithm> algorithm(orderingAlgorithm_->cloneWidthLimitableOrderingAlgorithm());
+#endif
 
-                std::sort(remainingVertices.begin(), remainingVertices.end());
+                worker(*algorithm);
+            });
+        }
 
-                preprocessedGraph.setRemainingVertices(std::move(remainingVertices));
-            }
+        threadPool.wait();
+    }
+    else
+    {
+        htd::RandomNumberGenerator generator = htd::randomNumberGenerator();
+
+        worker(*orderingAlgorithm_);
+
+        htd::randomNumberGenerator() = generator;
+    }
+
+    for (htd::index_t index = 0; index < parts.size(); ++index)
+    {
+        preprocessedGraph.eliminationSequence().insert(preprocessedGraph.eliminationSequence().end(), orderings[index].begin(), orderings[index].end());
+
+        /* Each part is a subgraph of the remaining graph, hence its lower bound also bounds the treewidth of the input graph. */
+        preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), lowerBounds[index]);
 
-            preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), minTreeWidth);
+        if (maxBagSizes[index] > 0)
+        {
+            preprocessedGraph.prefixWidth() = std::max(preprocessedGraph.prefixWidth(), maxBagSizes[index] - 1);
         }
     }
+
+    preprocessedGraph.prefixWidth() = std::max(preprocessedGraph.prefixWidth(), preprocessedGraph.minTreeWidth());
 }
 
-void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMultiHypergraph & graph,
-                                                               const std::unordered_set<htd::vertex_t> & vertices,
-                                                               htd::PreprocessedGraph & preprocessedGraph,
-                                                               std::size_t & minTreeWidth) const
+std::vector<htd::vertex_t> htd::GraphPreprocessor::Implementation::computePartOrdering(const htd::IMultiHypergraph & graph,
+                                                                                       const SeparatedPart & part,
+                                                                                       const htd::IWidthLimitableOrderingAlgorithm & algorithm,
+                                                                                       std::size_t & maxBagSize) const
 {
-    std::vector<htd::vertex_t> remainingComponentVertices(vertices.begin(), vertices.end());
-
-    std::sort(remainingComponentVertices.begin(), remainingComponentVertices.end());
+    std::vector<htd::vertex_t> ret;
 
-    htd::PreprocessedGraphComponent component(preprocessedGraph, std::move(remainingComponentVertices), minTreeWidth);
+    const htd::PreprocessedGraph & partGraph = *(part.graph);
 
     htd::IWidthLimitedVertexOrdering * optimalOrdering = nullptr;
 
@@ -1879,7 +2098,7 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
             remainingIterations = std::min(remainingIterations, nonImprovementLimit_);
         }
 
-        htd::IWidthLimitedVertexOrdering * currentOrdering = orderingAlgorithm_->computeOrdering(graph, component, bestMaxBagSize - 1, remainingIterations);
+        htd::IWidthLimitedVertexOrdering * currentOrdering = algorithm.computeOrdering(graph, partGraph, bestMaxBagSize - 1, remainingIterations);
 
         if (currentOrdering->requiredIterations() < nonImprovementLimit_)
         {
@@ -1890,25 +2109,13 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
             iteration = (std::size_t)-1;
         }
 
-        std::size_t currentMaxBagSize = currentOrdering->maximumBagSize();
-
-        if (!managementInstance_->isTerminated())
+        if (!managementInstance_->isTerminated() && (optimalOrdering == nullptr || currentOrdering->maximumBagSize() < bestMaxBagSize))
         {
-            if ((iteration == 1 && bestMaxBagSize == 0) || currentMaxBagSize < bestMaxBagSize)
-            {
-                if (iteration > 1)
-                {
-                    delete optimalOrdering;
-                }
+            delete optimalOrdering;
 
-                optimalOrdering = currentOrdering;
+            optimalOrdering = currentOrdering;
 
-                bestMaxBagSize = currentMaxBagSize;
-            }
-            else
-            {
-                delete currentOrdering;
-            }
+            bestMaxBagSize = currentOrdering->maximumBagSize();
         }
         else
         {
@@ -1918,39 +2125,171 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
 
     if (optimalOrdering != nullptr)
     {
-        preprocessedGraph.eliminationSequence().insert(preprocessedGraph.eliminationSequence().end(), optimalOrdering->sequence().begin(), optimalOrdering->sequence().end());
+        const std::vector<htd::vertex_t> & sequence = optimalOrdering->sequence();
 
-        preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), optimalOrdering->maximumBagSize() - 1);
+        if (part.separator.empty())
+        {
+            ret.assign(sequence.begin(), sequence.end());
+        }
+        else
+        {
+            /* The ordering refers to the actual vertex identifiers, so it is mapped back to the indices of the part's subgraph. */
+            std::vector<std::pair<htd::vertex_t, htd::vertex_t>> indices;
+            indices.reserve(part.vertices.size());
+
+            for (htd::index_t index = 0; index < part.vertices.size(); ++index)
+            {
+                indices.emplace_back(partGraph.vertexName(static_cast<htd::vertex_t>(index)), static_cast<htd::vertex_t>(index));
+            }
+
+            std::sort(indices.begin(), indices.end());
+
+            std::vector<htd::vertex_t> ordering;
+            ordering.reserve(sequence.size());
+
+            for (htd::vertex_t vertex : sequence)
+            {
+                ordering.push_back(std::lower_bound(indices.begin(), indices.end(), std::make_pair(vertex, (htd::vertex_t)0))->second);
+            }
+
+            for (htd::vertex_t vertex : eliminateCliqueLast(partGraph.neighborhoodSnapshot(), ordering, part.separator))
+            {
+                ret.push_back(partGraph.vertexName(vertex));
+            }
+        }
+
+        maxBagSize = bestMaxBagSize;
 
         delete optimalOrdering;
     }
+
+    return ret;
 }
 
-void htd::GraphPreprocessor::Implementation::applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
-                                                                               std::unordered_set<htd::vertex_t> & vertices) const
+std::vector<htd::vertex_t> htd::GraphPreprocessor::Implementation::eliminateCliqueLast(const htd::NeighborhoodSnapshot & neighborhood,
+                                                                                       const std::vector<htd::vertex_t> & ordering,
+                                                                                       const std::vector<htd::vertex_t> & clique)
 {
-    htd::CliqueMinimalSeparatorAlgorithm algorithm(managementInstance_);
+    HTD_ASSERT(!clique.empty())
 
-    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(preprocessedGraph);
+    std::size_t size = ordering.size();
 
-    while (separator != nullptr && !separator->empty())
+    std::vector<htd::index_t> position(size);
+
+    for (htd::index_t index = 0; index < size; ++index)
     {
-        for (htd::vertex_t vertex : *separator)
+        position[ordering[index]] = index;
+    }
+
+    /*
+     *  Compute the bag of each vertex, i.e., the vertex itself and its neighbors at the time of its elimination,
+     *  via symbolic elimination: The later neighbors of a vertex are inherited by the earliest of them, which
+     *  is the parent of the vertex within the induced tree decomposition.
+     */
+    std::vector<std::vector<htd::vertex_t>> bags(size);
+
+    std::vector<htd::vertex_t> parent(size, htd::Vertex::UNKNOWN);
+
+    std::vector<std::vector<htd::vertex_t>> adjacentBags(size);
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> & bag = bags[vertex];
+
+        for (auto it = neighborhood.begin(vertex), last = neighborhood.end(vertex); it != last; ++it)
         {
-            preprocessedGraph.removeVertex(vertex);
+            if (position[*it] > position[vertex])
+            {
+                bag.push_back(*it);
+            }
+        }
 
-            vertices.erase(vertex);
+        std::sort(bag.begin(), bag.end());
+
+        bag.erase(std::unique(bag.begin(), bag.end()), bag.end());
+
+        if (!bag.empty())
+        {
+            htd::vertex_t selectedParent = *std::min_element(bag.begin(), bag.end(), [&](htd::vertex_t vertex1, htd::vertex_t vertex2)
+            {
+                return position[vertex1] < position[vertex2];
+            });
+
+            parent[vertex] = selectedParent;
+
+            adjacentBags[vertex].push_back(selectedParent);
+            adjacentBags[selectedParent].push_back(vertex);
+
+            std::vector<htd::vertex_t> & parentBag = bags[selectedParent];
+
+            for (htd::vertex_t neighbor : bag)
+            {
+                if (neighbor != selectedParent)
+                {
+                    parentBag.push_back(neighbor);
+                }
+            }
+        }
+
+        bag.insert(std::lower_bound(bag.begin(), bag.end(), vertex), vertex);
+    }
+
+    /* Because the clique is complete, the bag of its earliest eliminated vertex contains the entire clique. */
+    htd::vertex_t root = *std::min_element(clique.begin(), clique.end(), [&](htd::vertex_t vertex1, htd::vertex_t vertex2)
+    {
+        return position[vertex1] < position[vertex2];
+    });
+
+    std::vector<std::size_t> depth(size, (std::size_t)-1);
+
+    std::vector<htd::vertex_t> topmostBag(size, htd::Vertex::UNKNOWN);
+
+    std::vector<htd::vertex_t> traversalOrder { root };
+    traversalOrder.reserve(size);
+
+    depth[root] = 0;
+
+    for (htd::index_t index = 0; index < traversalOrder.size(); ++index)
+    {
+        htd::vertex_t current = traversalOrder[index];
+
+        for (htd::vertex_t vertex : bags[current])
+        {
+            if (topmostBag[vertex] == htd::Vertex::UNKNOWN)
+            {
+                topmostBag[vertex] = current;
+            }
         }
 
-        delete separator;
+        for (htd::vertex_t adjacentBag : adjacentBags[current])
+        {
+            if (depth[adjacentBag] == (std::size_t)-1)
+            {
+                depth[adjacentBag] = depth[current] + 1;
 
-        separator = algorithm.computeSeparator(preprocessedGraph);
+                traversalOrder.push_back(adjacentBag);
+            }
+        }
     }
 
-    if (separator != nullptr)
+    std::vector<htd::vertex_t> ret;
+    ret.reserve(size - clique.size());
+
+    for (htd::vertex_t vertex : ordering)
     {
-        delete separator;
+        if (!std::binary_search(clique.begin(), clique.end(), vertex))
+        {
+            ret.push_back(vertex);
+        }
     }
+
+    /* Vertices whose topmost bag is deeper in the re-rooted tree decomposition are eliminated first. */
+    std::stable_sort(ret.begin(), ret.end(), [&](htd::vertex_t vertex1, htd::vertex_t vertex2)
+    {
+        return depth[topmostBag[vertex1]] > depth[topmostBag[vertex2]];
+    });
+
+    return ret;
 }
 
 #endif /* HTD_HTD_GRAPHPREPROCESSOR_CPP */
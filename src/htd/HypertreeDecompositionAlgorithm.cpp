@@ -33,11 +33,14 @@
 #include <htd/IMutableHypertreeDecomposition.hpp>
 #include <htd/HypertreeDecompositionFactory.hpp>
 #include <htd/SetCoverAlgorithmFactory.hpp>
-#include <htd/PostOrderTreeTraversal.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/ThreadPool.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdarg>
+#include <memory>
 #include <stdexcept>
 #include <unordered_set>
 #include <vector>
@@ -52,7 +55,7 @@ struct htd::HypertreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), labelingFunctions_(), postProcessingOperations_(), computeInducedEdges_(true)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), labelingFunctions_(), postProcessingOperations_(), computeInducedEdges_(true), threadCount_(1)
     {
 
     }
@@ -90,6 +93,11 @@ struct htd::HypertreeDecompositionAlgorithm::Implementation
      */
     bool computeInducedEdges_;
 
+    /**
+     *  The number of threads which shall be used to compute the covers of the bags.
+     */
+    std::size_t threadCount_;
+
     /**
      *  Set the hyperedges covering the bags of the hypertree decomposition.
      *
@@ -337,6 +345,16 @@ void htd::HypertreeDecompositionAlgorithm::setComputeInducedEdgesEnabled(bool co
     implementation_->computeInducedEdges_ = computeInducedEdgesEnabled;
 }
 
+std::size_t htd::HypertreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::HypertreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 const htd::LibraryInstance * htd::HypertreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -353,6 +371,8 @@ htd::HypertreeDecompositionAlgorithm * htd::HypertreeDecompositionAlgorithm::clo
 {
     htd::HypertreeDecompositionAlgorithm * ret = new htd::HypertreeDecompositionAlgorithm(managementInstance());
 
+    ret->setThreadCount(implementation_->threadCount_);
+
     for (htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
     {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
@@ -378,108 +398,180 @@ htd::HypertreeDecompositionAlgorithm * htd::HypertreeDecompositionAlgorithm::clo
 
 void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(const htd::IMultiHypergraph & graph, htd::IMutableHypertreeDecomposition & decomposition) const
 {
-    std::vector<htd::Hyperedge> relevantHyperedges;
+    const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = graph.hyperedges();
 
-    std::vector<htd::Hyperedge> newRelevantHyperedges;
+    std::vector<htd::Hyperedge> hyperedges(hyperedgeCollection.begin(), hyperedgeCollection.end());
 
-    std::vector<std::vector<htd::id_t>> relevantContainers;
+    htd::vertex_t maximumVertex = 0;
 
-    std::vector<std::vector<htd::id_t>> newRelevantContainers;
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        maximumVertex = std::max(maximumVertex, vertex);
+    }
 
-    const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
+    /* The indices of the hyperedges containing each of the vertices, in ascending order. */
+    std::vector<std::vector<htd::index_t>> incidentHyperedges(maximumVertex + 1);
 
-    std::size_t edgeCount = graph.edgeCount();
+    for (htd::index_t index = 0; index < hyperedges.size(); ++index)
+    {
+        for (htd::vertex_t vertex : hyperedges[index].sortedElements())
+        {
+            incidentHyperedges[vertex].push_back(index);
+        }
+    }
 
-    auto it1 = hyperedges.begin();
+    /*
+     *  A hyperedge is relevant if it is not contained in one of its successors. Each successor containing it
+     *  also contains the vertex of the hyperedge which occurs in the smallest number of hyperedges, hence only
+     *  the hyperedges incident to this vertex have to be investigated.
+     */
+    std::vector<htd::Hyperedge> relevantHyperedges;
 
-    for (htd::index_t index1 = 0; index1 < edgeCount; ++index1)
+    for (htd::index_t index = 0; index < hyperedges.size(); ++index)
     {
-        const std::vector<htd::vertex_t> & elements1 = it1->sortedElements();
+        const std::vector<htd::vertex_t> & elements = hyperedges[index].sortedElements();
 
         bool maximal = true;
 
-        auto it2 = it1;
-
-        ++it2;
-
-        for (htd::index_t index2 = index1 + 1; index2 < edgeCount; ++index2)
+        if (elements.empty())
+        {
+            maximal = index + 1 == hyperedges.size();
+        }
+        else
         {
-            const std::vector<htd::vertex_t> & elements2 = it2->sortedElements();
+            htd::vertex_t rarestVertex = elements[0];
 
-            if (std::includes(elements2.begin(), elements2.end(), elements1.begin(), elements1.end()))
+            for (htd::vertex_t vertex : elements)
             {
-                maximal = false;
+                if (incidentHyperedges[vertex].size() < incidentHyperedges[rarestVertex].size())
+                {
+                    rarestVertex = vertex;
+                }
             }
 
-            ++it2;
+            const std::vector<htd::index_t> & candidates = incidentHyperedges[rarestVertex];
+
+            for (auto it = std::upper_bound(candidates.begin(), candidates.end(), index); maximal && it != candidates.end(); ++it)
+            {
+                const std::vector<htd::vertex_t> & otherElements = hyperedges[*it].sortedElements();
+
+                maximal = otherElements.size() < elements.size() || !std::includes(otherElements.begin(), otherElements.end(), elements.begin(), elements.end());
+            }
         }
 
         if (maximal)
         {
-            relevantHyperedges.push_back(*it1);
-
-            relevantContainers.push_back(elements1);
+            relevantHyperedges.push_back(std::move(hyperedges[index]));
         }
+    }
+
+    hyperedges.clear();
 
-        ++it1;
+    for (std::vector<htd::index_t> & currentIncidentHyperedges : incidentHyperedges)
+    {
+        currentIncidentHyperedges.clear();
     }
 
-    htd::ISetCoverAlgorithm * setCoverAlgorithm = managementInstance_->setCoverAlgorithmFactory().createInstance();
+    for (htd::index_t index = 0; index < relevantHyperedges.size(); ++index)
+    {
+        for (htd::vertex_t vertex : relevantHyperedges[index].sortedElements())
+        {
+            incidentHyperedges[vertex].push_back(index);
+        }
+    }
 
-    htd::PostOrderTreeTraversal traversal;
+    /*
+     *  In a tree decomposition, no vertex of a bag is forgotten before the bag is visited in post-order.
+     *  Hence, the relevant hyperedges touching a bag are exactly the candidates of its cover and the
+     *  covers of all bags can be computed independently of each other.
+     */
+    std::vector<htd::vertex_t> nodes;
 
-    std::vector<htd::vertex_t> forgottenVertices;
+    decomposition.copyVerticesTo(nodes);
 
-    traversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t depth)
-    {
-        HTD_UNUSED(depth)
+    std::vector<std::vector<htd::Hyperedge>> coveringEdges(nodes.size());
 
-        std::vector<htd::index_t> selectedIndices;
+    std::atomic<std::size_t> nextNode(0);
 
-        setCoverAlgorithm->computeSetCover(decomposition.bagContent(vertex), relevantContainers, selectedIndices);
+    auto worker = [&](const htd::ISetCoverAlgorithm & setCoverAlgorithm)
+    {
+        std::vector<htd::index_t> candidates;
 
-        std::vector<htd::Hyperedge> selectedHyperedges;
+        std::vector<std::vector<htd::id_t>> containers;
 
-        for (htd::index_t selectedHyperedgeIndex : selectedIndices)
+        std::vector<htd::index_t> selectedIndices;
+
+        for (htd::index_t index = nextNode++; index < nodes.size() && !managementInstance_->isTerminated(); index = nextNode++)
         {
-            selectedHyperedges.push_back(relevantHyperedges.at(selectedHyperedgeIndex));
-        }
+            const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(nodes[index]);
 
-        decomposition.setCoveringEdges(vertex, selectedHyperedges);
+            candidates.clear();
 
-        if (parent != htd::Vertex::UNKNOWN)
-        {
-            std::size_t forgottenVertexCount = forgottenVertices.size();
+            for (htd::vertex_t vertex : bagContent)
+            {
+                candidates.insert(candidates.end(), incidentHyperedges[vertex].begin(), incidentHyperedges[vertex].end());
+            }
+
+            std::sort(candidates.begin(), candidates.end());
 
-            decomposition.copyForgottenVerticesTo(parent, forgottenVertices, vertex);
+            candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
 
-            std::inplace_merge(forgottenVertices.begin(), forgottenVertices.begin() + forgottenVertexCount, forgottenVertices.end());
+            containers.clear();
 
-            if (forgottenVertices.size() > 0)
+            for (htd::index_t candidate : candidates)
             {
-                htd::index_t index = 0;
+                const std::vector<htd::vertex_t> & elements = relevantHyperedges[candidate].sortedElements();
 
-                for (std::vector<htd::id_t> & container : relevantContainers)
-                {
-                    if (!std::includes(forgottenVertices.begin(), forgottenVertices.end(), container.begin(), container.end()))
-                    {
-                        newRelevantContainers.push_back(std::move(container));
-                        newRelevantHyperedges.push_back(std::move(relevantHyperedges.at(index)));
-                    }
+                containers.emplace_back(elements.begin(), elements.end());
+            }
 
-                    ++index;
-                }
+            selectedIndices.clear();
 
-                relevantContainers.swap(newRelevantContainers);
-                relevantHyperedges.swap(newRelevantHyperedges);
+            setCoverAlgorithm.computeSetCover(bagContent, containers, selectedIndices);
 
-                newRelevantContainers.clear();
-                newRelevantHyperedges.clear();
+            for (htd::index_t selectedIndex : selectedIndices)
+            {
+                coveringEdges[index].push_back(relevantHyperedges[candidates[selectedIndex]]);
             }
         }
-    });
+    };
 
-    delete setCoverAlgorithm;
+    std::size_t threadCount = std::min(htd::ThreadPool::effectiveThreadCount(threadCount_), nodes.size());
+
+    if (threadCount > 1)
+    {
+        std::vector<std::unique_ptr<htd::ISetCoverAlgorithm>> setCoverAlgorithms;
+
+        for (std::size_t thread = 0; thread < threadCount; ++thread)
+        {
+            setCoverAlgorithms.emplace_back(managementInstance_->setCoverAlgorithmFactory().createInstance());
+        }
+
+        htd::ThreadPool threadPool(threadCount);
+
+        for (std::size_t thread = 0; thread < threadCount; ++thread)
+        {
+            const htd::ISetCoverAlgorithm & setCoverAlgorithm = *(setCoverAlgorithms[thread]);
+
+            threadPool.submit([&]()
+            {
+                worker(setCoverAlgorithm);
+            });
+        }
+
+        threadPool.wait();
+    }
+    else
+    {
+        std::unique_ptr<htd::ISetCoverAlgorithm> setCoverAlgorithm(managementInstance_->setCoverAlgorithmFactory().createInstance());
+
+        worker(*setCoverAlgorithm);
+    }
+
+    for (htd::index_t index = 0; index < nodes.size(); ++index)
+    {
+        decomposition.setCoveringEdges(nodes[index], coveringEdges[index]);
+    }
 }
 
 #endif /* HTD_HTD_HYPERTREEDECOMPOSITIONALGORITHM_CPP */
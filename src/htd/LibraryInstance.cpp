@@ -56,6 +56,7 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/GraphSeparatorAlgorithmFactory.hpp>
 
+#include <atomic>
 #include <csignal>
 
 /**
@@ -131,7 +132,7 @@ struct htd::LibraryInstance::Implementation
     /**
      *  A boolean flag indicating whether the current management instance was terminated.
      */
-    bool terminated_;
+    std::atomic<bool> terminated_;
 
     /**
      *  The factory class for the default implementation of the htd::IConnectedComponentAlgorithm interface.
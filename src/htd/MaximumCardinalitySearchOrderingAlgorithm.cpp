@@ -31,10 +31,9 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
-#include <htd/PriorityQueue.hpp>
+#include <htd/IndexedBucketQueue.hpp>
 
 #include <algorithm>
-#include <unordered_set>
 
 /**
  *  Private implementation details of class htd::MaximumCardinalitySearchOrderingAlgorithm.
@@ -92,18 +91,16 @@ htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOr
 
     std::size_t size = preprocessedGraph.remainingVertices().size();
 
-    std::unordered_set<htd::vertex_t> vertices(size);
+    const htd::NeighborhoodSnapshot & neighborhood = preprocessedGraph.neighborhoodSnapshot();
 
-    htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
-
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
-
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::less<std::size_t>> priorityQueue;
+    htd::IndexedBucketQueue<std::less<std::size_t>> priorityQueue(preprocessedGraph.inputGraphVertexCount());
 
     std::vector<std::size_t> weights(preprocessedGraph.inputGraphVertexCount());
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
+    htd::RandomNumberGenerator & generator = htd::randomNumberGenerator();
+
     std::vector<htd::vertex_t> ordering;
     ordering.reserve(preprocessedGraph.vertexCount());
 
@@ -118,31 +115,25 @@ htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOr
 
     while (size > 0 && !managementInstance.isTerminated())
     {
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
-
-        priorityQueue.eraseFromTopCollection(selectedVertex);
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection(), generator);
 
-        std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedVertex];
+        priorityQueue.erase(selectedVertex);
 
-        for (htd::vertex_t neighbor : selectedNeighborhood)
+        /* The snapshot is never modified. Neighbors which were already selected are skipped because they are no longer part of the priority queue. */
+        for (auto it = neighborhood.begin(selectedVertex), last = neighborhood.end(selectedVertex); it != last; ++it)
         {
-            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
+            htd::vertex_t neighbor = *it;
 
-            /* Because 'vertex' is a neighbor of 'selectedVertex', std::lower_bound will always find 'selectedVertex' in 'currentNeighborhood'. */
-            // coverity[use_iterator]
-            currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex));
+            if (priorityQueue.contains(neighbor))
+            {
+                std::size_t & currentWeight = weights[neighbor];
 
-            std::size_t & currentWeight = weights[neighbor];
+                priorityQueue.updatePriority(neighbor, currentWeight + 1);
 
-            priorityQueue.updatePriority(neighbor, currentWeight, currentWeight + 1);
-
-            ++currentWeight;
+                ++currentWeight;
+            }
         }
 
-        std::vector<htd::vertex_t>().swap(selectedNeighborhood);
-
-        vertices.erase(selectedVertex);
-
         --size;
 
         ordering.push_back(preprocessedGraph.vertexName(selectedVertex));
@@ -31,7 +31,7 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
-#include <htd/PriorityQueue.hpp>
+#include <htd/IndexedBucketQueue.hpp>
 
 #include <algorithm>
 #include <unordered_set>
@@ -109,10 +109,12 @@ htd::IVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrdering(const ht
 
 htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
 {
+    HTD_UNUSED(graph)
+
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
     std::vector<htd::vertex_t> ordering;
-    ordering.reserve(graph.vertexCount());
+    ordering.reserve(preprocessedGraph.eliminationSequence().size() + preprocessedGraph.vertexCount());
 
     std::size_t iterations = 0;
 
@@ -148,34 +150,47 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
     htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    const htd::NeighborhoodSnapshot & initialNeighborhood = preprocessedGraph.neighborhoodSnapshot();
+
+    /* The working copy of the closed neighborhoods is materialized from the snapshot when a vertex is touched for the first time. */
+    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.inputGraphVertexCount());
+
+    auto closedNeighborhood = [&](htd::vertex_t vertex) -> std::vector<htd::vertex_t> &
+    {
+        std::vector<htd::vertex_t> & ret = neighborhood[vertex];
+
+        if (ret.empty())
+        {
+            initialNeighborhood.copyClosedNeighborhoodTo(vertex, ret);
+        }
+
+        return ret;
+    };
 
     std::vector<htd::vertex_t> difference;
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    htd::RandomNumberGenerator & generator = htd::randomNumberGenerator();
+
+    htd::IndexedBucketQueue<std::greater<std::size_t>> priorityQueue(preprocessedGraph.inputGraphVertexCount());
 
     target.insert(target.end(),
                   preprocessedGraph.eliminationSequence().begin(),
                   preprocessedGraph.eliminationSequence().end());
 
-    ret = preprocessedGraph.minTreeWidth() + 1;
+    ret = preprocessedGraph.prefixWidth() + 1;
 
     for (htd::vertex_t vertex : vertices)
     {
-        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
-
-        currentNeighborhood.insert(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex), vertex);
-
-        priorityQueue.push(vertex, currentNeighborhood.size());
+        priorityQueue.push(vertex, initialNeighborhood.neighborCount(vertex) + 1);
     }
 
     while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
     {
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection(), generator);
 
-        priorityQueue.eraseFromTopCollection(selectedVertex);
+        priorityQueue.erase(selectedVertex);
 
-        std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedVertex];
+        std::vector<htd::vertex_t> & selectedNeighborhood = closedNeighborhood(selectedVertex);
 
         if (selectedNeighborhood.size() > ret)
         {
@@ -188,9 +203,7 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
         for (htd::vertex_t neighbor : selectedNeighborhood)
         {
-            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
-
-            std::size_t oldNeighborhoodSize = currentNeighborhood.size();
+            std::vector<htd::vertex_t> & currentNeighborhood = closedNeighborhood(neighbor);
 
             /* Because 'vertex' is a neighbor of 'selectedVertex', std::lower_bound will always find 'selectedVertex' in 'currentNeighborhood'. */
             // coverity[use_iterator]
@@ -207,7 +220,7 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
                 difference.clear();
             }
 
-            priorityQueue.updatePriority(neighbor, oldNeighborhoodSize, currentNeighborhood.size());
+            priorityQueue.updatePriority(neighbor, currentNeighborhood.size());
         }
 
         std::vector<htd::vertex_t>().swap(selectedNeighborhood);
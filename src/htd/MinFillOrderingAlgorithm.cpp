@@ -31,11 +31,17 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
-#include <htd/PriorityQueue.hpp>
+#include <htd/IndexedBucketQueue.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <unordered_set>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HTD_MINFILL_POPCNT_DISPATCH
+#endif
+
 /**
  *  Private implementation details of class htd::AdvancedMinFillOrderingAlgorithm.
  */
@@ -46,7 +52,7 @@ struct htd::MinFillOrderingAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), denseNeighborhoodThreshold_(64), denseMemoryLimit_(static_cast<std::size_t>(1) << 28)
     {
 
     }
@@ -61,6 +67,16 @@ struct htd::MinFillOrderingAlgorithm::Implementation
      */
     const htd::LibraryInstance * managementInstance_;
 
+    /**
+     *  The neighborhood size from which on the algorithm switches to its dense elimination engine.
+     */
+    std::size_t denseNeighborhoodThreshold_;
+
+    /**
+     *  The maximum number of bytes which the dense elimination engine may allocate for its bitsets.
+     */
+    std::size_t denseMemoryLimit_;
+
     /**
      *  Structure representing the preprocessed input for the algorithm.
      *
@@ -74,25 +90,24 @@ struct htd::MinFillOrderingAlgorithm::Implementation
          *  Compute the number of edges between a set of vertices.
          *
          *  @param[in] availableNeighborhoods   The neighborhoods of the provided vertices.
-         *  @param[in] vertices                 The vertices for which the number of edges shall be returned.
+         *  @param[in] first                    The begin of the sorted range of vertices for which the number of edges shall be returned.
+         *  @param[in] last                     The end of the sorted range of vertices for which the number of edges shall be returned.
          *
          *  @return The number of edges between the provided vertices.
          */
-        std::size_t computeEdgeCount(const std::vector<std::vector<htd::vertex_t>> & availableNeighborhoods, const std::vector<htd::vertex_t> & vertices)
+        std::size_t computeEdgeCount(const htd::NeighborhoodSnapshot & availableNeighborhoods, const htd::vertex_t * first, const htd::vertex_t * last)
         {
             std::size_t ret = 0;
 
-            std::size_t remainder = vertices.size();
-
-            for (auto it = vertices.begin(); remainder > 0; --remainder)
+            for (const htd::vertex_t * it = first; it != last;)
             {
                 htd::vertex_t vertex = *it;
 
-                const std::vector<htd::vertex_t> & currentNeighborhood = availableNeighborhoods[vertex];
+                const htd::vertex_t * neighborhoodEnd = availableNeighborhoods.end(vertex);
 
                 ++it;
 
-                ret += htd::set_intersection_size(it, vertices.end(), std::upper_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex), currentNeighborhood.end());
+                ret += htd::set_intersection_size(it, last, std::upper_bound(availableNeighborhoods.begin(vertex), neighborhoodEnd, vertex), neighborhoodEnd);
             }
 
             return ret;
@@ -110,13 +125,15 @@ struct htd::MinFillOrderingAlgorithm::Implementation
 
             std::size_t size = preprocessedGraph.inputGraphVertexCount();
 
+            const htd::NeighborhoodSnapshot & neighborhood = preprocessedGraph.neighborhoodSnapshot();
+
             fillValue.resize(size, 0);
 
             for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
             {
-                const std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
+                std::size_t neighborCount = neighborhood.neighborCount(vertex);
 
-                std::size_t currentFillValue = ((currentNeighborhood.size() * (currentNeighborhood.size() - 1)) / 2) - computeEdgeCount(preprocessedGraph.neighborhood(), currentNeighborhood);
+                std::size_t currentFillValue = ((neighborCount * (neighborCount - 1)) / 2) - computeEdgeCount(neighborhood, neighborhood.begin(vertex), neighborhood.end(vertex));
 
                 fillValue[vertex] = currentFillValue;
 
@@ -145,6 +162,613 @@ struct htd::MinFillOrderingAlgorithm::Implementation
         std::vector<std::size_t> fillValue;
     };
 
+    /**
+     *  Elimination graph storing the neighborhood of each remaining vertex as a bitset.
+     *
+     *  The rows of the bitset matrix are assigned to the remaining vertices in ascending order of their
+     *  identifiers, so iterating over the bits of a row visits the neighbors in the same order as the
+     *  sorted neighborhood vectors of the sparse engine. The fill updates are performed in exactly the
+     *  same order as in the sparse engine, so both engines lead to the same state of the priority queue.
+     */
+    struct DenseEliminationGraph
+    {
+        /**
+         *  The type of the words storing the bits of a row.
+         */
+        typedef std::uint64_t word_t;
+
+        /**
+         *  The type of the kernels counting the set bits of the intersection or the difference of two rows.
+         */
+        typedef std::size_t (*CountingKernel)(const word_t *, const word_t *, std::size_t);
+
+        /**
+         *  Constructor for a new dense elimination graph.
+         *
+         *  @param[in] vertices         The remaining vertices of the elimination graph.
+         *  @param[in] neighborhood     The sorted closed neighborhoods of the vertices.
+         *  @param[in] vertexCount      The number of vertices of the input graph.
+         */
+        DenseEliminationGraph(const std::unordered_set<htd::vertex_t> & vertices, const std::vector<std::vector<htd::vertex_t>> & neighborhood, std::size_t vertexCount) : wordCount_(0), rows_(), rowIndex_(vertexCount, 0), vertexNames_(vertices.begin(), vertices.end()), members_(), affectedMembers_(), marked_(), existing_(), unaffected_(), intersectionSize_(&intersectionSizeGeneric), differenceSize_(&differenceSizeGeneric)
+        {
+#ifdef HTD_MINFILL_POPCNT_DISPATCH
+            if (__builtin_cpu_supports("popcnt"))
+            {
+                intersectionSize_ = &intersectionSizePopcnt;
+                differenceSize_ = &differenceSizePopcnt;
+            }
+#endif
+
+            std::sort(vertexNames_.begin(), vertexNames_.end());
+
+            std::size_t rowCount = vertexNames_.size();
+
+            wordCount_ = (rowCount + 63) / 64;
+
+            rows_.resize(rowCount * wordCount_, 0);
+
+            marked_.resize(wordCount_, 0);
+            existing_.resize(wordCount_, 0);
+            unaffected_.resize(wordCount_, 0);
+
+            for (htd::index_t index = 0; index < rowCount; ++index)
+            {
+                rowIndex_[vertexNames_[index]] = index;
+            }
+
+            for (htd::index_t index = 0; index < rowCount; ++index)
+            {
+                htd::vertex_t vertex = vertexNames_[index];
+
+                word_t * currentRow = row(index);
+
+                for (htd::vertex_t neighbor : neighborhood[vertex])
+                {
+                    if (neighbor != vertex)
+                    {
+                        setBit(currentRow, rowIndex_[neighbor]);
+                    }
+                }
+            }
+        }
+
+        ~DenseEliminationGraph()
+        {
+
+        }
+
+        /**
+         *  Get the number of bytes required for the bitsets of a dense elimination graph.
+         *
+         *  @param[in] rowCount The number of remaining vertices of the elimination graph.
+         *
+         *  @return The number of bytes required for the bitsets of a dense elimination graph with the given number of remaining vertices.
+         */
+        static std::size_t requiredMemory(std::size_t rowCount)
+        {
+            std::size_t wordCount = (rowCount + 63) / 64;
+
+            return (rowCount + 3) * wordCount * sizeof(word_t);
+        }
+
+        /**
+         *  Get the size of the closed neighborhood of a remaining vertex.
+         *
+         *  @param[in] vertex   The vertex.
+         *
+         *  @return The size of the closed neighborhood of the given vertex.
+         */
+        std::size_t neighborhoodSize(htd::vertex_t vertex) const
+        {
+            const word_t * currentRow = row(rowIndex_[vertex]);
+
+            return countBits(currentRow) + 1;
+        }
+
+        /**
+         *  Eliminate a vertex and update the fill values of all affected vertices.
+         *
+         *  @param[in] vertex           The vertex which shall be eliminated.
+         *  @param[in,out] fillValue        The fill values of the vertices.
+         *  @param[in,out] totalFill        The total sum of the fill values of the remaining vertices.
+         *  @param[in,out] priorityQueue    The priority queue of the remaining vertices.
+         */
+        void eliminate(htd::vertex_t vertex, std::vector<std::size_t> & fillValue, std::size_t & totalFill, htd::IndexedBucketQueue<std::greater<std::size_t>> & priorityQueue)
+        {
+            htd::index_t selectedIndex = rowIndex_[vertex];
+
+            word_t * selectedRow = row(selectedIndex);
+
+            collectMembers(selectedRow, members_);
+
+            for (htd::index_t member : members_)
+            {
+                clearBit(row(member), selectedIndex);
+            }
+
+            if (fillValue[vertex] == 0)
+            {
+                for (htd::index_t member : members_)
+                {
+                    htd::vertex_t neighbor = vertexNames_[member];
+
+                    std::size_t tmp = fillValue[neighbor];
+
+                    if (tmp > 0)
+                    {
+                        std::size_t fillReduction = differenceSize_(row(member), selectedRow, wordCount_);
+
+                        if (fillReduction > 0)
+                        {
+                            tmp -= fillReduction;
+
+                            totalFill -= fillReduction;
+
+                            priorityQueue.updatePriority(neighbor, tmp);
+
+                            fillValue[neighbor] = tmp;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                collectAffectedMembers(selectedIndex, selectedRow);
+
+                for (htd::index_t member : members_)
+                {
+                    htd::vertex_t neighbor = vertexNames_[member];
+
+                    const word_t * currentRow = row(member);
+
+                    for (htd::index_t index = 0; index < wordCount_; ++index)
+                    {
+                        unaffected_[index] = currentRow[index] & ~selectedRow[index];
+                    }
+
+                    std::size_t unaffectedNeighborCount = countBits(unaffected_.data());
+
+                    std::size_t tmp = fillValue[neighbor];
+
+                    if (unaffectedNeighborCount > 0)
+                    {
+                        long fillUpdate = -(static_cast<long>(unaffectedNeighborCount));
+
+                        for (htd::index_t additionalMember : members_)
+                        {
+                            if (additionalMember != member && !testBit(currentRow, additionalMember))
+                            {
+                                fillUpdate += static_cast<long>(unaffectedNeighborCount - intersectionSize_(row(additionalMember), unaffected_.data(), wordCount_));
+                            }
+                        }
+
+                        fillUpdate -= static_cast<long>(missingEdgeCount(currentRow, selectedRow));
+
+                        if (fillUpdate != 0)
+                        {
+                            tmp += fillUpdate;
+
+                            totalFill += fillUpdate;
+
+                            priorityQueue.updatePriority(neighbor, tmp);
+
+                            fillValue[neighbor] = tmp;
+                        }
+                    }
+                    else
+                    {
+                        totalFill -= tmp;
+
+                        priorityQueue.updatePriority(neighbor, 0);
+
+                        fillValue[neighbor] = 0;
+                    }
+                }
+
+                for (htd::index_t affectedMember : affectedMembers_)
+                {
+                    htd::vertex_t affectedVertex = vertexNames_[affectedMember];
+
+                    std::size_t fillReduction = missingEdgeCount(row(affectedMember), selectedRow);
+
+                    if (fillReduction > 0)
+                    {
+                        std::size_t tmp = fillValue[affectedVertex] - fillReduction;
+
+                        totalFill -= fillReduction;
+
+                        priorityQueue.updatePriority(affectedVertex, tmp);
+
+                        fillValue[affectedVertex] = tmp;
+                    }
+                }
+
+                for (htd::index_t member : members_)
+                {
+                    word_t * currentRow = row(member);
+
+                    for (htd::index_t index = 0; index < wordCount_; ++index)
+                    {
+                        currentRow[index] |= selectedRow[index];
+                    }
+
+                    clearBit(currentRow, member);
+                }
+            }
+
+            std::fill(selectedRow, selectedRow + wordCount_, 0);
+        }
+
+        private:
+            /**
+             *  The number of words per row.
+             */
+            std::size_t wordCount_;
+
+            /**
+             *  The bitset matrix storing the open neighborhoods of the remaining vertices.
+             */
+            std::vector<word_t> rows_;
+
+            /**
+             *  The mapping from the vertex identifiers to the row indices.
+             */
+            std::vector<htd::index_t> rowIndex_;
+
+            /**
+             *  The mapping from the row indices to the vertex identifiers.
+             */
+            std::vector<htd::vertex_t> vertexNames_;
+
+            /**
+             *  Scratch buffer for the neighbors of the eliminated vertex.
+             */
+            std::vector<htd::index_t> members_;
+
+            /**
+             *  Scratch buffer for the vertices at distance two from the eliminated vertex, in the order of their discovery.
+             */
+            std::vector<htd::index_t> affectedMembers_;
+
+            /**
+             *  Scratch row marking the vertices which were already visited.
+             */
+            std::vector<word_t> marked_;
+
+            /**
+             *  Scratch row for the common neighbors of the eliminated vertex and the currently updated vertex.
+             */
+            std::vector<word_t> existing_;
+
+            /**
+             *  Scratch row for the neighbors of the currently updated vertex which are not adjacent to the eliminated vertex.
+             */
+            std::vector<word_t> unaffected_;
+
+            /**
+             *  The kernel counting the set bits of the intersection of two rows.
+             */
+            CountingKernel intersectionSize_;
+
+            /**
+             *  The kernel counting the set bits of the difference of two rows.
+             */
+            CountingKernel differenceSize_;
+
+            /**
+             *  Access the row of a vertex.
+             *
+             *  @param[in] index    The row index of the vertex.
+             *
+             *  @return A pointer to the first word of the row.
+             */
+            word_t * row(htd::index_t index)
+            {
+                return rows_.data() + index * wordCount_;
+            }
+
+            /**
+             *  Access the row of a vertex.
+             *
+             *  @param[in] index    The row index of the vertex.
+             *
+             *  @return A pointer to the first word of the row.
+             */
+            const word_t * row(htd::index_t index) const
+            {
+                return rows_.data() + index * wordCount_;
+            }
+
+            /**
+             *  Set a bit of a row.
+             *
+             *  @param[in,out] bits The row.
+             *  @param[in] index    The index of the bit.
+             */
+            static void setBit(word_t * bits, htd::index_t index)
+            {
+                bits[index / 64] |= static_cast<word_t>(1) << (index % 64);
+            }
+
+            /**
+             *  Clear a bit of a row.
+             *
+             *  @param[in,out] bits The row.
+             *  @param[in] index    The index of the bit.
+             */
+            static void clearBit(word_t * bits, htd::index_t index)
+            {
+                bits[index / 64] &= ~(static_cast<word_t>(1) << (index % 64));
+            }
+
+            /**
+             *  Check whether a bit of a row is set.
+             *
+             *  @param[in] bits     The row.
+             *  @param[in] index    The index of the bit.
+             *
+             *  @return True if the bit is set, false otherwise.
+             */
+            static bool testBit(const word_t * bits, htd::index_t index)
+            {
+                return (bits[index / 64] >> (index % 64)) & 1;
+            }
+
+            /**
+             *  Count the set bits of a row.
+             *
+             *  @param[in] bits The row.
+             *
+             *  @return The number of set bits of the given row.
+             */
+            std::size_t countBits(const word_t * bits) const
+            {
+                return intersectionSize_(bits, bits, wordCount_);
+            }
+
+            /**
+             *  Append the indices of the set bits of a row to a vector in ascending order.
+             *
+             *  @param[in] bits     The row.
+             *  @param[out] target  The vector to which the indices shall be written. The vector is cleared before.
+             */
+            void collectMembers(const word_t * bits, std::vector<htd::index_t> & target) const
+            {
+                target.clear();
+
+                for (htd::index_t index = 0; index < wordCount_; ++index)
+                {
+                    appendMembers(bits[index], index, target);
+                }
+            }
+
+            /**
+             *  Determine the vertices at distance two from the eliminated vertex in the order in which the sparse
+             *  engine discovers them, i.e., by traversing the neighborhoods of the neighbors in ascending order.
+             *
+             *  @param[in] selectedIndex    The row index of the eliminated vertex.
+             *  @param[in] selectedRow      The row of the eliminated vertex.
+             */
+            void collectAffectedMembers(htd::index_t selectedIndex, const word_t * selectedRow)
+            {
+                affectedMembers_.clear();
+
+                std::copy(selectedRow, selectedRow + wordCount_, marked_.begin());
+
+                setBit(marked_.data(), selectedIndex);
+
+                for (htd::index_t member : members_)
+                {
+                    const word_t * currentRow = row(member);
+
+                    for (htd::index_t index = 0; index < wordCount_; ++index)
+                    {
+                        word_t bits = currentRow[index] & ~marked_[index];
+
+                        if (bits != 0)
+                        {
+                            marked_[index] |= bits;
+
+                            appendMembers(bits, index, affectedMembers_);
+                        }
+                    }
+                }
+
+                std::fill(marked_.begin(), marked_.end(), 0);
+            }
+
+            /**
+             *  Compute the number of missing edges between the common neighbors of a vertex and the eliminated vertex.
+             *
+             *  @param[in] currentRow   The row of the vertex.
+             *  @param[in] selectedRow  The row of the eliminated vertex.
+             *
+             *  @return The number of missing edges between the common neighbors of the vertex and the eliminated vertex.
+             */
+            std::size_t missingEdgeCount(const word_t * currentRow, const word_t * selectedRow)
+            {
+                std::size_t ret = 0;
+
+                std::size_t existingNeighborCount = 0;
+
+                for (htd::index_t index = 0; index < wordCount_; ++index)
+                {
+                    existing_[index] = currentRow[index] & selectedRow[index];
+                }
+
+                existingNeighborCount = countBits(existing_.data());
+
+                if (existingNeighborCount > 1)
+                {
+                    for (htd::index_t index = 0; index < wordCount_; ++index)
+                    {
+                        word_t bits = existing_[index];
+
+                        while (bits != 0)
+                        {
+                            htd::index_t member = index * 64 + trailingZeroCount(bits);
+
+                            bits &= bits - 1;
+
+                            ret += existingNeighborCount - 1 - intersectionSize_(row(member), existing_.data(), wordCount_);
+                        }
+                    }
+                }
+
+                return ret / 2;
+            }
+
+            /**
+             *  Append the indices of the set bits of a word to a vector in ascending order.
+             *
+             *  @param[in] bits         The word.
+             *  @param[in] wordIndex    The index of the word within its row.
+             *  @param[out] target      The vector to which the indices shall be appended.
+             */
+            static void appendMembers(word_t bits, htd::index_t wordIndex, std::vector<htd::index_t> & target)
+            {
+                while (bits != 0)
+                {
+                    target.push_back(wordIndex * 64 + trailingZeroCount(bits));
+
+                    bits &= bits - 1;
+                }
+            }
+
+            /**
+             *  Count the trailing zero bits of a non-zero word.
+             *
+             *  @param[in] bits The word.
+             *
+             *  @return The number of trailing zero bits of the word.
+             */
+            static std::size_t trailingZeroCount(word_t bits)
+            {
+#ifdef __GNUC__
+                return static_cast<std::size_t>(__builtin_ctzll(bits));
+#else
+                std::size_t ret = 0;
+
+                while ((bits & 1) == 0)
+                {
+                    bits >>= 1;
+
+                    ++ret;
+                }
+
+                return ret;
+#endif
+            }
+
+            /**
+             *  Count the set bits of a word.
+             *
+             *  @param[in] bits The word.
+             *
+             *  @return The number of set bits of the word.
+             */
+            static std::size_t populationCount(word_t bits)
+            {
+#ifdef __GNUC__
+                return static_cast<std::size_t>(__builtin_popcountll(bits));
+#else
+                bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+                bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+                bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+                return static_cast<std::size_t>((bits * 0x0101010101010101ULL) >> 56);
+#endif
+            }
+
+            /**
+             *  Count the set bits of the intersection of two rows (portable version).
+             *
+             *  @param[in] bits1        The first row.
+             *  @param[in] bits2        The second row.
+             *  @param[in] wordCount    The number of words per row.
+             *
+             *  @return The number of set bits of the intersection of both rows.
+             */
+            static std::size_t intersectionSizeGeneric(const word_t * bits1, const word_t * bits2, std::size_t wordCount)
+            {
+                std::size_t ret = 0;
+
+                for (htd::index_t index = 0; index < wordCount; ++index)
+                {
+                    ret += populationCount(bits1[index] & bits2[index]);
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Count the set bits of the first row which are not set in the second row (portable version).
+             *
+             *  @param[in] bits1        The first row.
+             *  @param[in] bits2        The second row.
+             *  @param[in] wordCount    The number of words per row.
+             *
+             *  @return The number of set bits of the difference of both rows.
+             */
+            static std::size_t differenceSizeGeneric(const word_t * bits1, const word_t * bits2, std::size_t wordCount)
+            {
+                std::size_t ret = 0;
+
+                for (htd::index_t index = 0; index < wordCount; ++index)
+                {
+                    ret += populationCount(bits1[index] & ~bits2[index]);
+                }
+
+                return ret;
+            }
+
+#ifdef HTD_MINFILL_POPCNT_DISPATCH
+            /**
+             *  Count the set bits of the intersection of two rows (version using the POPCNT instruction).
+             *
+             *  @param[in] bits1        The first row.
+             *  @param[in] bits2        The second row.
+             *  @param[in] wordCount    The number of words per row.
+             *
+             *  @return The number of set bits of the intersection of both rows.
+             */
+            __attribute__((target("popcnt")))
+            static std::size_t intersectionSizePopcnt(const word_t * bits1, const word_t * bits2, std::size_t wordCount)
+            {
+                std::size_t ret = 0;
+
+                for (htd::index_t index = 0; index < wordCount; ++index)
+                {
+                    ret += static_cast<std::size_t>(__builtin_popcountll(bits1[index] & bits2[index]));
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Count the set bits of the first row which are not set in the second row (version using the POPCNT instruction).
+             *
+             *  @param[in] bits1        The first row.
+             *  @param[in] bits2        The second row.
+             *  @param[in] wordCount    The number of words per row.
+             *
+             *  @return The number of set bits of the difference of both rows.
+             */
+            __attribute__((target("popcnt")))
+            static std::size_t differenceSizePopcnt(const word_t * bits1, const word_t * bits2, std::size_t wordCount)
+            {
+                std::size_t ret = 0;
+
+                for (htd::index_t index = 0; index < wordCount; ++index)
+                {
+                    ret += static_cast<std::size_t>(__builtin_popcountll(bits1[index] & ~bits2[index]));
+                }
+
+                return ret;
+            }
+#endif
+    };
+
     /**
      *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
      *
@@ -194,10 +818,12 @@ htd::IVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrdering(const htd:
 
 htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
 {
+    HTD_UNUSED(graph)
+
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
     std::vector<htd::vertex_t> ordering;
-    ordering.reserve(graph.vertexCount());
+    ordering.reserve(preprocessedGraph.eliminationSequence().size() + preprocessedGraph.vertexCount());
 
     htd::MinFillOrderingAlgorithm::Implementation::PreparedInput input(managementInstance, preprocessedGraph);
 
@@ -237,12 +863,35 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
     std::vector<std::size_t> fillValue(input.fillValue.begin(), input.fillValue.end());
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    htd::IndexedBucketQueue<std::greater<std::size_t>> priorityQueue(preprocessedGraph.inputGraphVertexCount());
+
+    const htd::NeighborhoodSnapshot & initialNeighborhood = preprocessedGraph.neighborhoodSnapshot();
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    /* The working copy of the closed neighborhoods is materialized from the snapshot when a vertex is touched for the first time. */
+    std::vector<std::vector<htd::vertex_t>> neighborhood(size);
+
+    auto closedNeighborhood = [&](htd::vertex_t vertex) -> std::vector<htd::vertex_t> &
+    {
+        std::vector<htd::vertex_t> & ret = neighborhood[vertex];
+
+        if (ret.empty())
+        {
+            initialNeighborhood.copyClosedNeighborhoodTo(vertex, ret);
+        }
+
+        return ret;
+    };
+
+    /* Vertices which were never touched still have their initial neighborhood because all neighbors of an eliminated vertex are touched. */
+    auto closedNeighborhoodSize = [&](htd::vertex_t vertex) -> std::size_t
+    {
+        return neighborhood[vertex].empty() ? initialNeighborhood.neighborCount(vertex) + 1 : neighborhood[vertex].size();
+    };
 
     std::size_t totalFill = input.totalFill;
 
+    htd::RandomNumberGenerator & generator = htd::randomNumberGenerator();
+
     std::vector<htd::state_t> updateStatus(size, 0);
 
     std::vector<std::vector<htd::vertex_t>> existingNeighbors(size);
@@ -252,30 +901,67 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
     std::vector<htd::vertex_t> affectedVertices;
     affectedVertices.reserve(size);
 
+    std::unique_ptr<DenseEliminationGraph> denseGraph;
+
     target.insert(target.end(),
                   preprocessedGraph.eliminationSequence().begin(),
                   preprocessedGraph.eliminationSequence().end());
 
-    ret = preprocessedGraph.minTreeWidth() + 1;
+    ret = preprocessedGraph.prefixWidth() + 1;
 
     size = preprocessedGraph.remainingVertices().size();
 
     for (htd::vertex_t vertex : vertices)
     {
-        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
-
-        currentNeighborhood.insert(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex), vertex);
-
         priorityQueue.push(vertex, fillValue[vertex]);
     }
 
     while (totalFill > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
     {
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection(), generator);
 
-        priorityQueue.eraseFromTopCollection(selectedVertex);
+        priorityQueue.erase(selectedVertex);
 
-        std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedVertex];
+        std::vector<htd::vertex_t> & selectedNeighborhood = closedNeighborhood(selectedVertex);
+
+        /* The bitsets need quadratic space in the number of remaining vertices, hence large graphs stay with the sparse engine. */
+        if (denseGraph == nullptr && (denseNeighborhoodThreshold_ == 0 || (selectedNeighborhood.size() >= denseNeighborhoodThreshold_ && selectedNeighborhood.size() * 16 >= size)) &&
+            DenseEliminationGraph::requiredMemory(vertices.size()) <= denseMemoryLimit_)
+        {
+            for (htd::vertex_t vertex : vertices)
+            {
+                closedNeighborhood(vertex);
+            }
+
+            denseGraph.reset(new DenseEliminationGraph(vertices, neighborhood, preprocessedGraph.inputGraphVertexCount()));
+
+            for (htd::vertex_t vertex : vertices)
+            {
+                std::vector<htd::vertex_t>().swap(neighborhood[vertex]);
+            }
+        }
+
+        if (denseGraph != nullptr)
+        {
+            std::size_t neighborhoodSize = denseGraph->neighborhoodSize(selectedVertex);
+
+            if (neighborhoodSize > ret)
+            {
+                ret = neighborhoodSize;
+            }
+
+            vertices.erase(selectedVertex);
+
+            totalFill -= fillValue[selectedVertex];
+
+            denseGraph->eliminate(selectedVertex, fillValue, totalFill, priorityQueue);
+
+            target.push_back(preprocessedGraph.vertexName(selectedVertex));
+
+            --size;
+
+            continue;
+        }
 
         if (selectedNeighborhood.size() > ret)
         {
@@ -294,7 +980,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
         {
             for (htd::vertex_t vertex : selectedNeighborhood)
             {
-                std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+                std::vector<htd::vertex_t> & currentNeighborhood = closedNeighborhood(vertex);
 
                 /* Because 'vertex' is a neighbor of 'selectedVertex', std::lower_bound will always find 'selectedVertex' in 'currentNeighborhood'. */
                 // coverity[use_iterator]
@@ -313,7 +999,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         totalFill -= fillReduction;
 
-                        priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
+                        priorityQueue.updatePriority(vertex, tmp);
 
                         fillValue[vertex] = tmp;
                     }
@@ -326,7 +1012,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
             {
                 if (updateStatus[neighbor] == 0)
                 {
-                    std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
+                    std::vector<htd::vertex_t> & currentNeighborhood = closedNeighborhood(neighbor);
 
                     currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex));
 
@@ -346,7 +1032,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
                     {
                         if (currentUpdateStatus == 0)
                         {
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[affectedVertex];
+                            std::vector<htd::vertex_t> & currentNeighborhood = closedNeighborhood(affectedVertex);
 
                             auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex);
 
@@ -452,7 +1138,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         totalFill += fillUpdate;
 
-                        priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
+                        priorityQueue.updatePriority(vertex, tmp);
 
                         fillValue[vertex] = tmp;
                     }
@@ -461,7 +1147,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
                 {
                     totalFill -= tmp;
 
-                    priorityQueue.updatePriority(vertex, fillValue[vertex], 0);
+                    priorityQueue.updatePriority(vertex, 0);
 
                     fillValue[vertex] = 0;
                 }
@@ -516,7 +1202,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         totalFill -= fillReduction;
 
-                        priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
+                        priorityQueue.updatePriority(vertex, tmp);
 
                         fillValue[vertex] = tmp;
                     }
@@ -641,7 +1327,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
     {
         htd::vertex_t vertex = htd::selectRandomElement<htd::vertex_t>(vertices);
 
-        std::size_t neighborhoodSize = neighborhood[vertex].size();
+        std::size_t neighborhoodSize = denseGraph != nullptr ? denseGraph->neighborhoodSize(vertex) : closedNeighborhoodSize(vertex);
 
         if (neighborhoodSize > ret)
         {
@@ -674,20 +1360,46 @@ void htd::MinFillOrderingAlgorithm::setManagementInstance(const htd::LibraryInst
     implementation_->managementInstance_ = manager;
 }
 
+std::size_t htd::MinFillOrderingAlgorithm::denseNeighborhoodThreshold(void) const
+{
+    return implementation_->denseNeighborhoodThreshold_;
+}
+
+void htd::MinFillOrderingAlgorithm::setDenseNeighborhoodThreshold(std::size_t threshold)
+{
+    implementation_->denseNeighborhoodThreshold_ = threshold;
+}
+
+std::size_t htd::MinFillOrderingAlgorithm::denseMemoryLimit(void) const
+{
+    return implementation_->denseMemoryLimit_;
+}
+
+void htd::MinFillOrderingAlgorithm::setDenseMemoryLimit(std::size_t limit)
+{
+    implementation_->denseMemoryLimit_ = limit;
+}
+
 htd::MinFillOrderingAlgorithm * htd::MinFillOrderingAlgorithm::clone(void) const
 {
-    return new htd::MinFillOrderingAlgorithm(implementation_->managementInstance_);
+    htd::MinFillOrderingAlgorithm * ret = new htd::MinFillOrderingAlgorithm(implementation_->managementInstance_);
+
+    ret->setDenseNeighborhoodThreshold(implementation_->denseNeighborhoodThreshold_);
+
+    ret->setDenseMemoryLimit(implementation_->denseMemoryLimit_);
+
+    return ret;
 }
 
 #ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
 htd::IOrderingAlgorithm * htd::MinFillOrderingAlgorithm::cloneOrderingAlgorithm(void) const
 {
-    return new htd::MinFillOrderingAlgorithm(implementation_->managementInstance_);
+    return clone();
 }
 
 htd::IWidthLimitableOrderingAlgorithm * htd::MinFillOrderingAlgorithm::cloneWidthLimitableOrderingAlgorithm(void) const
 {
-    return new htd::MinFillOrderingAlgorithm(implementation_->managementInstance_);
+    return clone();
 }
 #endif
 
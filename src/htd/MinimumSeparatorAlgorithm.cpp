@@ -27,12 +27,8 @@
 
 #include <htd/MinimumSeparatorAlgorithm.hpp>
 
-#include <htd/FlowNetworkStructure.hpp>
-#include <htd/DinitzMaxFlowAlgorithm.hpp>
-
 #include <algorithm>
 #include <unordered_map>
-#include <unordered_set>
 
 /**
  *  Private implementation details of class htd::MinimumSeparatorAlgorithm.
@@ -58,6 +54,356 @@ struct htd::MinimumSeparatorAlgorithm::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  Internal split-vertex flow network of a graph, stored as arrays of arcs in compressed sparse row format.
+     *
+     *  Each vertex u of the graph (given by its index) is represented by an in-node 2u and an out-node 2u+1
+     *  which are connected via an arc of capacity one. Each edge {u, v} of the graph is represented by
+     *  the arcs (2u+1, 2v) and (2v+1, 2u) of unbounded capacity. Every arc is paired with a reverse arc
+     *  of capacity zero, so the residual network lives in the same arrays as the flow network.
+     */
+    class FlowNetwork
+    {
+        public:
+            /**
+             *  Constructor for a new split-vertex flow network.
+             *
+             *  @param[in] neighborOffsets  The offsets of the neighborhoods of the vertices within the given neighbor array. The neighborhood of vertex u is given by the range [neighborOffsets[u], neighborOffsets[u + 1]).
+             *  @param[in] neighbors        The neighbors of all vertices, given by their indices.
+             */
+            FlowNetwork(const std::vector<std::size_t> & neighborOffsets, const std::vector<htd::index_t> & neighbors) : arcOffsets_(), arcTargets_(), reverseArcs_(), capacities_(), residuals_(), levels_(), currentArcs_(), queue_(), path_(), modifiedArcs_()
+            {
+                std::size_t vertexCount = neighborOffsets.size() - 1;
+
+                std::size_t nodeCount = vertexCount * 2;
+
+                std::size_t unbounded = vertexCount + 1;
+
+                arcOffsets_.resize(nodeCount + 1, 0);
+
+                for (htd::index_t vertex = 0; vertex < vertexCount; ++vertex)
+                {
+                    std::size_t degree = neighborOffsets[vertex + 1] - neighborOffsets[vertex];
+
+                    arcOffsets_[2 * vertex + 1] = degree + 1;
+                    arcOffsets_[2 * vertex + 2] = degree + 1;
+                }
+
+                for (htd::index_t node = 0; node < nodeCount; ++node)
+                {
+                    arcOffsets_[node + 1] += arcOffsets_[node];
+                }
+
+                std::size_t arcCount = arcOffsets_[nodeCount];
+
+                arcTargets_.resize(arcCount);
+                reverseArcs_.resize(arcCount);
+                capacities_.resize(arcCount, 0);
+
+                std::vector<std::size_t> positions(arcOffsets_.begin(), arcOffsets_.end() - 1);
+
+                for (htd::index_t vertex = 0; vertex < vertexCount; ++vertex)
+                {
+                    htd::index_t inNode = 2 * vertex;
+                    htd::index_t outNode = inNode + 1;
+
+                    addArc(inNode, outNode, 1, positions);
+
+                    for (std::size_t position = neighborOffsets[vertex]; position < neighborOffsets[vertex + 1]; ++position)
+                    {
+                        addArc(outNode, 2 * neighbors[position], unbounded, positions);
+                    }
+                }
+
+                residuals_ = capacities_;
+
+                levels_.resize(nodeCount, static_cast<std::size_t>(UNREACHED));
+                currentArcs_.resize(nodeCount, 0);
+            }
+
+            /**
+             *  Compute a minimum set of vertices separating two non-adjacent vertices.
+             *
+             *  The computation stops as soon as the flow between the two vertices reaches the given limit,
+             *  i.e., as soon as it is clear that no separator smaller than the limit exists.
+             *
+             *  @param[in] source       The index of the first vertex.
+             *  @param[in] target       The index of the second vertex.
+             *  @param[in] limit        The size of the smallest separator found so far.
+             *  @param[out] separator   The indices of the vertices of a minimum separator, in ascending order. The vector is only updated if the return value is smaller than the given limit.
+             *
+             *  @return The size of a minimum separator of the two vertices or a value which is at least the given limit if no separator smaller than the limit exists.
+             */
+            std::size_t computeSeparator(htd::index_t source, htd::index_t target, std::size_t limit, std::vector<htd::index_t> & separator)
+            {
+                htd::index_t sourceNode = 2 * source + 1;
+                htd::index_t targetNode = 2 * target;
+
+                std::size_t ret = 0;
+
+                while (ret < limit && computeLevels(sourceNode, targetNode))
+                {
+                    ret += computeBlockingFlow(sourceNode, targetNode, limit - ret);
+                }
+
+                if (ret < limit)
+                {
+                    /* The last breadth-first search did not reach the target, hence the labeled nodes form the source side of a minimum cut. */
+                    separator.clear();
+
+                    for (htd::index_t node : queue_)
+                    {
+                        if ((node & 1) == 0 && levels_[node + 1] == UNREACHED)
+                        {
+                            separator.push_back(node / 2);
+                        }
+                    }
+
+                    std::sort(separator.begin(), separator.end());
+                }
+
+                resetLevels();
+
+                for (htd::index_t arc : modifiedArcs_)
+                {
+                    residuals_[arc] = capacities_[arc];
+                }
+
+                modifiedArcs_.clear();
+
+                return ret;
+            }
+
+        private:
+            /**
+             *  Constant for the level of nodes which were not reached by the last breadth-first search.
+             */
+            static constexpr std::size_t UNREACHED = (std::size_t)-1;
+
+            /**
+             *  Constant for the level of nodes which were removed from the current level graph.
+             */
+            static constexpr std::size_t REMOVED = (std::size_t)-2;
+
+            /**
+             *  The offsets of the outgoing arcs of each node within the arc arrays.
+             */
+            std::vector<std::size_t> arcOffsets_;
+
+            /**
+             *  The target node of each arc.
+             */
+            std::vector<htd::index_t> arcTargets_;
+
+            /**
+             *  The position of the reverse arc of each arc.
+             */
+            std::vector<htd::index_t> reverseArcs_;
+
+            /**
+             *  The capacity of each arc.
+             */
+            std::vector<std::size_t> capacities_;
+
+            /**
+             *  The residual capacity of each arc.
+             */
+            std::vector<std::size_t> residuals_;
+
+            /**
+             *  The level of each node in the current level graph.
+             */
+            std::vector<std::size_t> levels_;
+
+            /**
+             *  The next arc to investigate for each node during the computation of a blocking flow.
+             */
+            std::vector<std::size_t> currentArcs_;
+
+            /**
+             *  The nodes reached by the last breadth-first search, in the order of their discovery.
+             */
+            std::vector<htd::index_t> queue_;
+
+            /**
+             *  The arcs of the current augmenting path.
+             */
+            std::vector<htd::index_t> path_;
+
+            /**
+             *  The arcs whose residual capacity differs from their capacity.
+             */
+            std::vector<htd::index_t> modifiedArcs_;
+
+            /**
+             *  Add an arc and its reverse arc to the flow network.
+             *
+             *  @param[in] source       The source node of the arc.
+             *  @param[in] target       The target node of the arc.
+             *  @param[in] capacity     The capacity of the arc.
+             *  @param[in,out] positions The next free position within the arc arrays for each node.
+             */
+            void addArc(htd::index_t source, htd::index_t target, std::size_t capacity, std::vector<std::size_t> & positions)
+            {
+                htd::index_t arc = positions[source]++;
+                htd::index_t reverseArc = positions[target]++;
+
+                arcTargets_[arc] = target;
+                arcTargets_[reverseArc] = source;
+
+                reverseArcs_[arc] = reverseArc;
+                reverseArcs_[reverseArc] = arc;
+
+                capacities_[arc] = capacity;
+            }
+
+            /**
+             *  Reset the levels of all nodes reached by the last breadth-first search.
+             */
+            void resetLevels(void)
+            {
+                for (htd::index_t node : queue_)
+                {
+                    levels_[node] = UNREACHED;
+                }
+
+                queue_.clear();
+            }
+
+            /**
+             *  Compute the level graph of the residual network via breadth-first search.
+             *
+             *  @param[in] sourceNode   The source node.
+             *  @param[in] targetNode   The target node.
+             *
+             *  @return True if the target node is reachable from the source node in the residual network, false otherwise.
+             */
+            bool computeLevels(htd::index_t sourceNode, htd::index_t targetNode)
+            {
+                resetLevels();
+
+                levels_[sourceNode] = 0;
+
+                currentArcs_[sourceNode] = arcOffsets_[sourceNode];
+
+                queue_.push_back(sourceNode);
+
+                for (htd::index_t index = 0; index < queue_.size(); ++index)
+                {
+                    htd::index_t node = queue_[index];
+
+                    std::size_t nextLevel = levels_[node] + 1;
+
+                    if (nextLevel > levels_[targetNode])
+                    {
+                        break;
+                    }
+
+                    for (std::size_t arc = arcOffsets_[node]; arc < arcOffsets_[node + 1]; ++arc)
+                    {
+                        htd::index_t neighbor = arcTargets_[arc];
+
+                        if (residuals_[arc] > 0 && levels_[neighbor] == UNREACHED)
+                        {
+                            levels_[neighbor] = nextLevel;
+
+                            currentArcs_[neighbor] = arcOffsets_[neighbor];
+
+                            queue_.push_back(neighbor);
+                        }
+                    }
+                }
+
+                return levels_[targetNode] != UNREACHED;
+            }
+
+            /**
+             *  Compute a blocking flow in the current level graph.
+             *
+             *  @param[in] sourceNode   The source node.
+             *  @param[in] targetNode   The target node.
+             *  @param[in] limit        The amount of flow after which the computation stops.
+             *
+             *  @return The value of the computed flow.
+             */
+            std::size_t computeBlockingFlow(htd::index_t sourceNode, htd::index_t targetNode, std::size_t limit)
+            {
+                std::size_t ret = 0;
+
+                htd::index_t node = sourceNode;
+
+                path_.clear();
+
+                while (ret < limit)
+                {
+                    if (node == targetNode)
+                    {
+                        std::size_t delta = limit - ret;
+
+                        for (htd::index_t arc : path_)
+                        {
+                            delta = std::min(delta, residuals_[arc]);
+                        }
+
+                        for (htd::index_t arc : path_)
+                        {
+                            htd::index_t reverseArc = reverseArcs_[arc];
+
+                            residuals_[arc] -= delta;
+                            residuals_[reverseArc] += delta;
+
+                            modifiedArcs_.push_back(arc);
+                            modifiedArcs_.push_back(reverseArc);
+                        }
+
+                        ret += delta;
+
+                        path_.clear();
+
+                        node = sourceNode;
+                    }
+                    else
+                    {
+                        std::size_t & currentArc = currentArcs_[node];
+
+                        std::size_t nextLevel = levels_[node] + 1;
+
+                        while (currentArc < arcOffsets_[node + 1] && (residuals_[currentArc] == 0 || levels_[arcTargets_[currentArc]] != nextLevel))
+                        {
+                            ++currentArc;
+                        }
+
+                        if (currentArc < arcOffsets_[node + 1])
+                        {
+                            path_.push_back(currentArc);
+
+                            node = arcTargets_[currentArc];
+                        }
+                        else
+                        {
+                            /* The node is a dead end, so it is removed from the level graph. The levels of the remaining nodes stay valid for the next breadth-first search. */
+                            if (path_.empty())
+                            {
+                                break;
+                            }
+
+                            levels_[node] = REMOVED;
+
+                            htd::index_t arc = path_.back();
+
+                            path_.pop_back();
+
+                            node = arcTargets_[reverseArcs_[arc]];
+
+                            ++currentArcs_[node];
+                        }
+                    }
+                }
+
+                return ret;
+            }
+    };
 };
 
 htd::MinimumSeparatorAlgorithm::MinimumSeparatorAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -76,6 +422,8 @@ std::vector<htd::vertex_t> * htd::MinimumSeparatorAlgorithm::computeSeparator(co
 
     std::size_t n = graph.vertexCount();
 
+    graph.copyVerticesTo(*ret);
+
     htd::index_t index = 0;
 
     std::unordered_map<htd::vertex_t, htd::index_t> indices;
@@ -87,64 +435,167 @@ std::vector<htd::vertex_t> * htd::MinimumSeparatorAlgorithm::computeSeparator(co
         ++index;
     }
 
-    htd::FlowNetworkStructure flowNetwork(n * 2);
+    std::vector<std::size_t> neighborOffsets(n + 1, 0);
 
-    for (htd::vertex_t vertex : graph.vertices())
+    std::vector<htd::index_t> neighbors;
+
+    std::vector<htd::vertex_t> currentNeighborhood;
+
+    for (index = 0; index < n; ++index)
     {
-        htd::index_t vertexIndex = indices.at(vertex);
+        htd::vertex_t vertex = graph.vertexAtPosition(index);
+
+        currentNeighborhood.clear();
+
+        graph.copyNeighborsTo(vertex, currentNeighborhood);
 
-        flowNetwork.updateCapacity(vertexIndex, vertexIndex + n, 1);
+        std::size_t start = neighbors.size();
 
-        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+        for (htd::vertex_t neighbor : currentNeighborhood)
         {
-            htd::index_t neighborIndex = indices.at(neighbor);
+            if (neighbor != vertex)
+            {
+                neighbors.push_back(indices.at(neighbor));
+            }
+        }
 
-            flowNetwork.updateCapacity(vertexIndex + n, neighborIndex, (std::size_t)-1);
-            flowNetwork.updateCapacity(neighborIndex + n, vertexIndex, (std::size_t)-1);
+        std::sort(neighbors.begin() + start, neighbors.end());
+
+        neighbors.erase(std::unique(neighbors.begin() + start, neighbors.end()), neighbors.end());
+
+        neighborOffsets[index + 1] = neighbors.size();
+    }
+
+    /* Two vertices in different connected components are separated by the empty set. */
+    std::vector<bool> reached(n, false);
+
+    std::vector<htd::index_t> stack;
+
+    if (n > 0)
+    {
+        reached[0] = true;
+
+        stack.push_back(0);
+    }
+
+    std::size_t reachedCount = stack.size();
+
+    while (!stack.empty())
+    {
+        htd::index_t current = stack.back();
+
+        stack.pop_back();
+
+        for (std::size_t position = neighborOffsets[current]; position < neighborOffsets[current + 1]; ++position)
+        {
+            htd::index_t neighbor = neighbors[position];
+
+            if (!reached[neighbor])
+            {
+                reached[neighbor] = true;
+
+                stack.push_back(neighbor);
+
+                ++reachedCount;
+            }
         }
     }
 
-    graph.copyVerticesTo(*ret);
+    if (reachedCount < n)
+    {
+        ret->clear();
+
+        return ret;
+    }
 
-    for (htd::index_t i = 0; i < n; ++i)
+    /*
+     *  Let v be a vertex of minimum degree and let S be a minimum separator. If v is not contained in S,
+     *  S separates v from some non-neighbor of v. Otherwise, S separates two non-adjacent neighbors of v,
+     *  because every vertex of a minimum separator has neighbors in at least two of the components which
+     *  it induces. Hence, only these pairs have to be investigated instead of all pairs of vertices.
+     */
+    htd::index_t minimumDegreeVertex = 0;
+
+    for (index = 1; index < n; ++index)
+    {
+        if (neighborOffsets[index + 1] - neighborOffsets[index] < neighborOffsets[minimumDegreeVertex + 1] - neighborOffsets[minimumDegreeVertex])
+        {
+            minimumDegreeVertex = index;
+        }
+    }
+
+    std::vector<htd::index_t> sources;
+    std::vector<htd::index_t> targets;
+
+    if (n > 0)
     {
-        htd::vertex_t vertex1 = graph.vertexAtPosition(i);
+        std::vector<bool> adjacent(n, false);
+
+        adjacent[minimumDegreeVertex] = true;
+
+        for (std::size_t position = neighborOffsets[minimumDegreeVertex]; position < neighborOffsets[minimumDegreeVertex + 1]; ++position)
+        {
+            adjacent[neighbors[position]] = true;
+        }
 
-        for (htd::index_t j = i + 1; j < n; ++j)
+        for (index = 0; index < n; ++index)
         {
-            htd::vertex_t vertex2 = graph.vertexAtPosition(j);
+            if (!adjacent[index])
+            {
+                sources.push_back(minimumDegreeVertex);
+                targets.push_back(index);
+            }
+        }
 
-            if (!graph.isNeighbor(vertex1, vertex2))
+        /* The neighborhood of v separates v from its non-neighbors, so it serves as initial separator. */
+        if (!sources.empty())
+        {
+            ret->clear();
+
+            for (std::size_t position = neighborOffsets[minimumDegreeVertex]; position < neighborOffsets[minimumDegreeVertex + 1]; ++position)
             {
-                htd::DinitzMaxFlowAlgorithm maxFlowAlgorithm(implementation_->managementInstance_);
+                ret->push_back(graph.vertexAtPosition(neighbors[position]));
+            }
 
-                htd::IFlow * flow = maxFlowAlgorithm.determineMaximumFlow(flowNetwork, i + n, j);
+            std::sort(ret->begin(), ret->end());
+        }
 
-                std::unordered_set<htd::vertex_t> candidate;
+        for (std::size_t position = neighborOffsets[minimumDegreeVertex]; position < neighborOffsets[minimumDegreeVertex + 1]; ++position)
+        {
+            htd::index_t neighbor = neighbors[position];
 
-                for(htd::index_t k = 0; k < n; ++k)
-                {
-                    if (k != i && k != j)
-                    {
-                        std::size_t capacity = flowNetwork.capacity(k, k + n);
+            for (std::size_t position2 = position + 1; position2 < neighborOffsets[minimumDegreeVertex + 1]; ++position2)
+            {
+                htd::index_t neighbor2 = neighbors[position2];
 
-                        if (static_cast<std::size_t>(flow->flow(k, k + n)) == capacity && capacity > 0 && capacity < (std::size_t)-1)
-                        {
-                            candidate.insert(graph.vertexAtPosition(k));
-                        }
-                    }
+                if (!std::binary_search(neighbors.begin() + neighborOffsets[neighbor], neighbors.begin() + neighborOffsets[neighbor + 1], neighbor2))
+                {
+                    sources.push_back(neighbor);
+                    targets.push_back(neighbor2);
                 }
+            }
+        }
+    }
 
-                if (candidate.size() < ret->size())
-                {
-                    ret->clear();
+    if (!sources.empty())
+    {
+        Implementation::FlowNetwork flowNetwork(neighborOffsets, neighbors);
+
+        std::vector<htd::index_t> separator;
 
-                    ret->insert(ret->end(), candidate.begin(), candidate.end());
+        /* The graph is connected, hence no separator is smaller than one. */
+        for (index = 0; index < sources.size() && ret->size() > 1 && !implementation_->managementInstance_->isTerminated(); ++index)
+        {
+            if (flowNetwork.computeSeparator(sources[index], targets[index], ret->size(), separator) < ret->size())
+            {
+                ret->clear();
 
-                    std::sort(ret->begin(), ret->end());
+                for (htd::index_t separatingVertex : separator)
+                {
+                    ret->push_back(graph.vertexAtPosition(separatingVertex));
                 }
 
-                delete flow;
+                std::sort(ret->begin(), ret->end());
             }
         }
     }
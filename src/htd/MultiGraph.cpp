@@ -313,6 +313,11 @@ htd::id_t htd::MultiGraph::addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2)
     return implementation_->base_->addEdge(vertex1, vertex2);
 }
 
+htd::id_t htd::MultiGraph::addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+{
+    return implementation_->base_->addEdges(edges);
+}
+
 void htd::MultiGraph::removeEdge(htd::id_t edgeId)
 {
     implementation_->base_->removeEdge(edgeId);
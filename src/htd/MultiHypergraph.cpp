@@ -111,6 +111,88 @@ struct htd::MultiHypergraph::Implementation
         neighborhood_.clear();
     }
 
+    /**
+     *  Add a self-loop to the neighborhood of the given vertex.
+     *
+     *  @param[in] vertex   The vertex which has a self-loop.
+     */
+    void addSelfLoop(htd::vertex_t vertex)
+    {
+        selfLoops_.insert(vertex);
+
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex - htd::Vertex::FIRST];
+
+        auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
+
+        if (position == currentNeighborhood.end() || *position != vertex)
+        {
+            currentNeighborhood.insert(position, vertex);
+        }
+    }
+
+    /**
+     *  Update the neighborhoods of all vertices contained in the edges which are stored at or after the given position.
+     *
+     *  The new neighbors are appended to the neighborhoods and each affected neighborhood is sorted only once afterwards.
+     *
+     *  @param[in] firstPosition    The position of the first new edge within the edge collection.
+     */
+    void updateNeighborhoods(std::size_t firstPosition)
+    {
+        std::vector<std::size_t> additionalNeighbors(neighborhood_.size(), 0);
+
+        for (auto it = edges_->begin() + firstPosition; it != edges_->end(); ++it)
+        {
+            const std::vector<htd::vertex_t> & elements = it->sortedElements();
+
+            for (htd::vertex_t vertex : elements)
+            {
+                additionalNeighbors[vertex - htd::Vertex::FIRST] += elements.size() - 1;
+            }
+        }
+
+        for (htd::index_t index = 0; index < additionalNeighbors.size(); ++index)
+        {
+            if (additionalNeighbors[index] > 0)
+            {
+                neighborhood_[index].reserve(neighborhood_[index].size() + additionalNeighbors[index]);
+            }
+        }
+
+        for (auto it = edges_->begin() + firstPosition; it != edges_->end(); ++it)
+        {
+            const std::vector<htd::vertex_t> & elements = it->sortedElements();
+
+            if (elements.size() > 1)
+            {
+                for (htd::vertex_t vertex : elements)
+                {
+                    std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex - htd::Vertex::FIRST];
+
+                    for (htd::vertex_t neighbor : elements)
+                    {
+                        if (neighbor != vertex)
+                        {
+                            currentNeighborhood.push_back(neighbor);
+                        }
+                    }
+                }
+            }
+        }
+
+        for (htd::index_t index = 0; index < additionalNeighbors.size(); ++index)
+        {
+            if (additionalNeighbors[index] > 0)
+            {
+                std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[index];
+
+                std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+
+                currentNeighborhood.erase(std::unique(currentNeighborhood.begin(), currentNeighborhood.end()), currentNeighborhood.end());
+            }
+        }
+    }
+
     /**
      *  The management instance to which the current object instance belongs.
      */
@@ -1007,6 +1089,110 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
     return implementation_->next_edge_++;
 }
 
+htd::id_t htd::MultiHypergraph::addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+{
+    htd::id_t ret = implementation_->next_edge_;
+
+    if (!edges.empty())
+    {
+        std::size_t firstPosition = implementation_->edges_->size();
+
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+        {
+            HTD_ASSERT(isVertex(edge.first) && isVertex(edge.second))
+
+            implementation_->edges_->emplace_back(implementation_->next_edge_, edge.first, edge.second);
+
+            if (edge.first == edge.second)
+            {
+                implementation_->addSelfLoop(edge.first);
+            }
+
+            ++(implementation_->next_edge_);
+        }
+
+        implementation_->updateNeighborhoods(firstPosition);
+    }
+    else
+    {
+        --ret;
+    }
+
+    return ret;
+}
+
+htd::id_t htd::MultiHypergraph::addEdges(std::vector<std::vector<htd::vertex_t>> && edges)
+{
+    htd::id_t ret = implementation_->next_edge_;
+
+    if (!edges.empty())
+    {
+        std::size_t firstPosition = implementation_->edges_->size();
+
+        for (std::vector<htd::vertex_t> & elements : edges)
+        {
+            HTD_ASSERT(!elements.empty())
+
+            #ifndef NDEBUG
+            for (htd::vertex_t vertex : elements)
+            {
+                HTD_ASSERT(isVertex(vertex))
+            }
+            #endif
+
+            switch (elements.size())
+            {
+                case 1:
+                {
+                    implementation_->edges_->emplace_back(implementation_->next_edge_, elements[0]);
+
+                    break;
+                }
+                case 2:
+                {
+                    implementation_->edges_->emplace_back(implementation_->next_edge_, elements[0], elements[1]);
+
+                    if (elements[0] == elements[1])
+                    {
+                        implementation_->addSelfLoop(elements[0]);
+                    }
+
+                    break;
+                }
+                default:
+                {
+                    std::vector<htd::vertex_t> sortedElements(elements);
+
+                    std::sort(sortedElements.begin(), sortedElements.end());
+
+                    auto position = std::unique(sortedElements.begin(), sortedElements.end());
+
+                    for (auto it = position; it != sortedElements.end(); ++it)
+                    {
+                        implementation_->addSelfLoop(*it);
+                    }
+
+                    sortedElements.erase(position, sortedElements.end());
+
+                    implementation_->edges_->emplace_back(implementation_->next_edge_, std::move(elements), std::move(sortedElements));
+
+                    break;
+                }
+            }
+
+            ++(implementation_->next_edge_);
+        }
+
+        implementation_->updateNeighborhoods(firstPosition);
+    }
+    else
+    {
+        --ret;
+    }
+
+    return ret;
+}
+
 void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
 {
     bool found = false;
@@ -0,0 +1,1448 @@
+/* 
+ * File:   NestedDissectionOrderingAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_NESTEDDISSECTIONORDERINGALGORITHM_CPP
+#define HTD_HTD_NESTEDDISSECTIONORDERINGALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/NestedDissectionOrderingAlgorithm.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+#include <htd/ThreadPool.hpp>
+#include <htd/VertexOrdering.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <numeric>
+#include <queue>
+
+/**
+ *  Private implementation details of class htd::NestedDissectionOrderingAlgorithm.
+ */
+struct htd::NestedDissectionOrderingAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), leafSize_(DEFAULT_LEAF_SIZE), threadCount_(1)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The maximum number of vertices of a part which is ordered via the minimum-fill heuristic.
+     */
+    std::size_t leafSize_;
+
+    /**
+     *  The number of threads which shall be used to dissect independent parts of the graph.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The default value for the maximum number of vertices of a part which is ordered via the minimum-fill heuristic.
+     */
+    static const std::size_t DEFAULT_LEAF_SIZE = 64;
+
+    /**
+     *  The number of vertices up to which a graph is not coarsened any further.
+     */
+    static const std::size_t COARSENING_LIMIT = 100;
+
+    /**
+     *  The number of attempts to compute a good initial partition of the coarsest graph.
+     */
+    static const std::size_t INITIAL_PARTITION_ATTEMPTS = 4;
+
+    /**
+     *  The maximum number of Fiduccia-Mattheyses passes per level.
+     */
+    static const std::size_t REFINEMENT_PASSES = 8;
+
+    /**
+     *  The number of consecutive moves without improvement after which a Fiduccia-Mattheyses pass stops.
+     */
+    static const std::size_t MAX_NON_IMPROVING_MOVES = 100;
+
+    /**
+     *  The permitted imbalance of a bisection in percent, i.e., the weight of each side may exceed half of the total weight by this percentage.
+     */
+    static const std::size_t MAX_IMBALANCE = 10;
+
+    /**
+     *  The number of vertices from which on a part is handed over to another thread when dissecting the graph concurrently.
+     */
+    static const std::size_t PARALLEL_THRESHOLD = 1024;
+
+    /**
+     *  Constant for an unset index.
+     */
+    static const htd::index_t NONE = static_cast<htd::index_t>(-1);
+
+    /**
+     *  The label of the separator vertices within a partition.
+     */
+    static const std::uint8_t SEPARATOR = 2;
+
+    /**
+     *  A graph with weighted vertices and edges in compressed sparse row format.
+     */
+    struct WeightedGraph
+    {
+        /**
+         *  Constructor for an empty weighted graph.
+         */
+        WeightedGraph(void) : offsets(1, 0), neighbors(), edgeWeights(), vertexWeights(), totalWeight(0)
+        {
+
+        }
+
+        /**
+         *  The neighborhood of vertex v occupies the range [offsets[v], offsets[v + 1]) of the adjacency array.
+         */
+        std::vector<htd::index_t> offsets;
+
+        /**
+         *  The adjacency array.
+         */
+        std::vector<htd::index_t> neighbors;
+
+        /**
+         *  The weight of each entry of the adjacency array.
+         */
+        std::vector<std::size_t> edgeWeights;
+
+        /**
+         *  The weight of each vertex.
+         */
+        std::vector<std::size_t> vertexWeights;
+
+        /**
+         *  The sum of the weights of all vertices.
+         */
+        std::size_t totalWeight;
+
+        /**
+         *  Getter for the number of vertices of the graph.
+         *
+         *  @return The number of vertices of the graph.
+         */
+        std::size_t vertexCount(void) const
+        {
+            return vertexWeights.size();
+        }
+    };
+
+    /**
+     *  A part of the graph which still needs to be ordered.
+     */
+    struct Part
+    {
+        /**
+         *  The vertices of the part, given by their identifiers in the preprocessed graph.
+         */
+        std::vector<htd::vertex_t> vertices;
+
+        /**
+         *  The subgraph induced by the vertices of the part, using the positions within the vertex vector as identifiers.
+         */
+        WeightedGraph graph;
+
+        /**
+         *  The position of the first vertex of the part within the resulting ordering.
+         */
+        std::size_t position;
+
+        /**
+         *  The seed of the random number generator used to dissect the part.
+         */
+        htd::RandomNumberGenerator::result_type seed;
+    };
+
+    /**
+     *  The information shared by all tasks which dissect parts of the same graph.
+     */
+    struct DissectionContext
+    {
+        /**
+         *  Constructor for a new dissection context.
+         *
+         *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+         *  @param[in] ordering             The resulting ordering.
+         *  @param[in] threadPool           The thread pool to which large parts are handed over or nullptr if all parts shall be dissected sequentially.
+         */
+        DissectionContext(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & ordering, htd::ThreadPool * threadPool) : preprocessedGraph(preprocessedGraph), ordering(ordering), threadPool(threadPool)
+        {
+
+        }
+
+        /**
+         *  The input graph in preprocessed format.
+         */
+        const htd::IPreprocessedGraph & preprocessedGraph;
+
+        /**
+         *  The resulting ordering. Each part writes exclusively to its own range of positions.
+         */
+        std::vector<htd::vertex_t> & ordering;
+
+        /**
+         *  The thread pool to which large parts are handed over or nullptr if all parts shall be dissected sequentially.
+         */
+        htd::ThreadPool * threadPool;
+    };
+
+    /**
+     *  Order a part of the graph and write the result to the positions reserved for the part.
+     *
+     *  @param[in] part     The part which shall be ordered.
+     *  @param[in] context  The information shared by all tasks which dissect parts of the same graph.
+     */
+    void dissect(std::shared_ptr<Part> part, DissectionContext & context) const;
+
+    /**
+     *  Order a small part of the graph via the minimum-fill heuristic.
+     *
+     *  @param[in] part         The part which shall be ordered.
+     *  @param[in] generator    The random number generator used to break ties.
+     *  @param[in] context      The information shared by all tasks which dissect parts of the same graph.
+     */
+    void orderLeaf(const Part & part, htd::RandomNumberGenerator & generator, DissectionContext & context) const;
+
+    /**
+     *  Compute a balanced bisection with a small edge cut via multilevel partitioning.
+     *
+     *  @param[in] graph        The graph which shall be bisected.
+     *  @param[in] generator    The random number generator used by the algorithm.
+     *  @param[out] partition   The side (0 or 1) of each vertex.
+     */
+    void bisect(const WeightedGraph & graph, htd::RandomNumberGenerator & generator, std::vector<std::uint8_t> & partition) const;
+
+    /**
+     *  Coarsen a graph by contracting the edges of a heavy-edge matching.
+     *
+     *  @param[in] graph            The graph which shall be coarsened.
+     *  @param[in] generator        The random number generator determining the order in which the vertices are matched.
+     *  @param[out] coarseGraph     The coarsened graph.
+     *  @param[out] coarseVertex    The vertex of the coarsened graph into which each vertex of the given graph is contracted.
+     *
+     *  @return True if the coarsened graph is considerably smaller than the given graph, false otherwise.
+     */
+    bool coarsen(const WeightedGraph & graph, htd::RandomNumberGenerator & generator, WeightedGraph & coarseGraph, std::vector<htd::index_t> & coarseVertex) const;
+
+    /**
+     *  Compute the initial partition of the coarsest graph via greedy graph growing.
+     *
+     *  @param[in] graph            The coarsest graph.
+     *  @param[in] generator        The random number generator determining the start vertices.
+     *  @param[in] maxPartWeight    The maximum weight of each side of the partition.
+     *  @param[out] partition       The side (0 or 1) of each vertex.
+     */
+    void computeInitialPartition(const WeightedGraph & graph, htd::RandomNumberGenerator & generator, std::size_t maxPartWeight, std::vector<std::uint8_t> & partition) const;
+
+    /**
+     *  Refine a bisection via Fiduccia-Mattheyses passes.
+     *
+     *  @param[in] graph            The partitioned graph.
+     *  @param[in] maxPartWeight    The maximum weight of each side of the partition.
+     *  @param[in,out] partition    The side (0 or 1) of each vertex.
+     *
+     *  @return The weight of the edge cut of the refined partition.
+     */
+    std::size_t refine(const WeightedGraph & graph, std::size_t maxPartWeight, std::vector<std::uint8_t> & partition) const;
+
+    /**
+     *  Turn the edge cut of a bisection into a vertex separator.
+     *
+     *  The separator is a minimum vertex cover of the bipartite graph formed by the cut edges, computed via the
+     *  Hopcroft-Karp algorithm and Koenig's theorem. The separator vertices are labeled with SEPARATOR.
+     *
+     *  @param[in] graph            The partitioned graph.
+     *  @param[in,out] partition    The side (0 or 1) of each vertex.
+     */
+    void extractSeparator(const WeightedGraph & graph, std::vector<std::uint8_t> & partition) const;
+
+    /**
+     *  Compute the amount by which the heavier side of a partition exceeds the maximum weight.
+     *
+     *  @param[in] partWeights      The weights of both sides of the partition.
+     *  @param[in] maxPartWeight    The maximum weight of each side of the partition.
+     *
+     *  @return The amount by which the heavier side of the partition exceeds the maximum weight.
+     */
+    static std::size_t overweight(const std::size_t * partWeights, std::size_t maxPartWeight)
+    {
+        std::size_t heavierPartWeight = std::max(partWeights[0], partWeights[1]);
+
+        return heavierPartWeight > maxPartWeight ? heavierPartWeight - maxPartWeight : 0;
+    }
+
+    /**
+     *  Count the trailing zero bits of a non-zero word.
+     *
+     *  @param[in] bits The word.
+     *
+     *  @return The number of trailing zero bits of the word.
+     */
+    static std::size_t trailingZeroCount(std::uint64_t bits)
+    {
+#ifdef __GNUC__
+        return static_cast<std::size_t>(__builtin_ctzll(bits));
+#else
+        std::size_t ret = 0;
+
+        while ((bits & 1) == 0)
+        {
+            bits >>= 1;
+
+            ++ret;
+        }
+
+        return ret;
+#endif
+    }
+
+    /**
+     *  Count the set bits of a word.
+     *
+     *  @param[in] bits The word.
+     *
+     *  @return The number of set bits of the word.
+     */
+    static std::size_t populationCount(std::uint64_t bits)
+    {
+#ifdef __GNUC__
+        return static_cast<std::size_t>(__builtin_popcountll(bits));
+#else
+        bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+        bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+        bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+        return static_cast<std::size_t>((bits * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+};
+
+htd::NestedDissectionOrderingAlgorithm::NestedDissectionOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::NestedDissectionOrderingAlgorithm::~NestedDissectionOrderingAlgorithm()
+{
+
+}
+
+htd::IVertexOrdering * htd::NestedDissectionOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
+{
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::IVertexOrdering * ret = computeOrdering(graph, *preprocessedGraph);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+htd::IVertexOrdering * htd::NestedDissectionOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
+{
+    HTD_UNUSED(graph)
+
+    const std::vector<htd::vertex_t> & eliminationSequence = preprocessedGraph.eliminationSequence();
+
+    const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
+
+    std::vector<htd::vertex_t> ordering;
+    ordering.reserve(eliminationSequence.size() + remainingVertices.size());
+
+    ordering.insert(ordering.end(), eliminationSequence.begin(), eliminationSequence.end());
+
+    ordering.resize(eliminationSequence.size() + remainingVertices.size(), htd::Vertex::UNKNOWN);
+
+    if (!remainingVertices.empty())
+    {
+        const htd::NeighborhoodSnapshot & neighborhood = preprocessedGraph.neighborhoodSnapshot();
+
+        std::shared_ptr<Implementation::Part> root = std::make_shared<Implementation::Part>();
+
+        root->vertices = remainingVertices;
+        root->position = eliminationSequence.size();
+        root->seed = htd::randomNumberGenerator()();
+
+        std::vector<htd::index_t> localIndex(neighborhood.vertexCount(), static_cast<htd::index_t>(Implementation::NONE));
+
+        for (htd::index_t index = 0; index < remainingVertices.size(); ++index)
+        {
+            localIndex[remainingVertices[index]] = index;
+        }
+
+        Implementation::WeightedGraph & rootGraph = root->graph;
+
+        rootGraph.offsets.reserve(remainingVertices.size() + 1);
+        rootGraph.neighbors.reserve(neighborhood.entryCount());
+
+        for (htd::vertex_t vertex : remainingVertices)
+        {
+            for (auto it = neighborhood.begin(vertex), last = neighborhood.end(vertex); it != last; ++it)
+            {
+                if (localIndex[*it] != Implementation::NONE)
+                {
+                    rootGraph.neighbors.push_back(localIndex[*it]);
+                }
+            }
+
+            rootGraph.offsets.push_back(rootGraph.neighbors.size());
+        }
+
+        rootGraph.edgeWeights.assign(rootGraph.neighbors.size(), 1);
+        rootGraph.vertexWeights.assign(remainingVertices.size(), 1);
+        rootGraph.totalWeight = remainingVertices.size();
+
+        std::size_t threadCount = htd::ThreadPool::effectiveThreadCount(implementation_->threadCount_);
+
+        if (threadCount > 1 && remainingVertices.size() >= Implementation::PARALLEL_THRESHOLD)
+        {
+            htd::ThreadPool threadPool(threadCount);
+
+            Implementation::DissectionContext context(preprocessedGraph, ordering, &threadPool);
+
+            const Implementation & implementation = *implementation_;
+
+            threadPool.submit([&]()
+            {
+                implementation.dissect(std::move(root), context);
+            });
+
+            threadPool.wait();
+        }
+        else
+        {
+            Implementation::DissectionContext context(preprocessedGraph, ordering, nullptr);
+
+            implementation_->dissect(std::move(root), context);
+        }
+    }
+
+    return new htd::VertexOrdering(std::move(ordering), 1);
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::dissect(std::shared_ptr<Part> part, DissectionContext & context) const
+{
+    const htd::IPreprocessedGraph & preprocessedGraph = context.preprocessedGraph;
+
+    std::size_t size = part->vertices.size();
+
+    if (managementInstance_->isTerminated())
+    {
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            context.ordering[part->position + index] = preprocessedGraph.vertexName(part->vertices[index]);
+        }
+
+        return;
+    }
+
+    htd::RandomNumberGenerator generator(part->seed);
+
+    if (size <= leafSize_)
+    {
+        orderLeaf(*part, generator, context);
+
+        return;
+    }
+
+    std::vector<std::uint8_t> partition;
+
+    bisect(part->graph, generator, partition);
+
+    extractSeparator(part->graph, partition);
+
+    std::shared_ptr<Part> children[2] = { std::make_shared<Part>(), std::make_shared<Part>() };
+
+    std::vector<htd::index_t> childIndex(size, static_cast<htd::index_t>(NONE));
+
+    std::vector<htd::index_t> separator;
+
+    for (htd::index_t vertex = 0; vertex < size; ++vertex)
+    {
+        std::uint8_t side = partition[vertex];
+
+        if (side == SEPARATOR)
+        {
+            separator.push_back(vertex);
+        }
+        else
+        {
+            childIndex[vertex] = children[side]->vertices.size();
+
+            children[side]->vertices.push_back(part->vertices[vertex]);
+        }
+    }
+
+    /* Both sides are ordered before the separator, the vertices of the separator are ordered last. */
+    std::size_t separatorPosition = part->position + children[0]->vertices.size() + children[1]->vertices.size();
+
+    for (htd::index_t index = 0; index < separator.size(); ++index)
+    {
+        context.ordering[separatorPosition + index] = preprocessedGraph.vertexName(part->vertices[separator[index]]);
+    }
+
+    for (std::uint8_t side = 0; side < 2; ++side)
+    {
+        Part & child = *(children[side]);
+
+        WeightedGraph & childGraph = child.graph;
+
+        childGraph.offsets.reserve(child.vertices.size() + 1);
+
+        for (htd::index_t vertex = 0; vertex < size; ++vertex)
+        {
+            if (partition[vertex] == side)
+            {
+                for (htd::index_t index = part->graph.offsets[vertex]; index < part->graph.offsets[vertex + 1]; ++index)
+                {
+                    htd::index_t neighbor = part->graph.neighbors[index];
+
+                    if (partition[neighbor] == side)
+                    {
+                        childGraph.neighbors.push_back(childIndex[neighbor]);
+                    }
+                }
+
+                childGraph.offsets.push_back(childGraph.neighbors.size());
+            }
+        }
+
+        childGraph.edgeWeights.assign(childGraph.neighbors.size(), 1);
+        childGraph.vertexWeights.assign(child.vertices.size(), 1);
+        childGraph.totalWeight = child.vertices.size();
+
+        child.position = side == 0 ? part->position : part->position + children[0]->vertices.size();
+        child.seed = htd::RandomNumberGenerator::deriveSeed(part->seed, side);
+    }
+
+    /* Release the memory of the current part before descending into the recursion. */
+    part.reset();
+
+    for (std::uint8_t side = 0; side < 2; ++side)
+    {
+        if (!children[side]->vertices.empty())
+        {
+            if (context.threadPool != nullptr && side == 0 && children[0]->vertices.size() >= PARALLEL_THRESHOLD)
+            {
+                std::shared_ptr<Part> child = std::move(children[0]);
+
+                context.threadPool->submit([this, child, &context]() mutable
+                {
+                    dissect(std::move(child), context);
+                });
+            }
+            else
+            {
+                dissect(std::move(children[side]), context);
+            }
+        }
+    }
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::orderLeaf(const Part & part, htd::RandomNumberGenerator & generator, DissectionContext & context) const
+{
+    const WeightedGraph & graph = part.graph;
+
+    std::size_t size = graph.vertexCount();
+
+    std::size_t wordCount = (size + 63) / 64;
+
+    /* The remaining elimination graph is stored as adjacency matrix with one bitset per row. */
+    std::vector<std::uint64_t> rows(size * wordCount, 0);
+
+    for (htd::index_t vertex = 0; vertex < size; ++vertex)
+    {
+        for (htd::index_t index = graph.offsets[vertex]; index < graph.offsets[vertex + 1]; ++index)
+        {
+            htd::index_t neighbor = graph.neighbors[index];
+
+            rows[vertex * wordCount + neighbor / 64] |= static_cast<std::uint64_t>(1) << (neighbor % 64);
+        }
+    }
+
+    std::vector<std::size_t> fill(size, 0);
+
+    std::vector<std::size_t> degree(size, 0);
+
+    std::vector<bool> eliminated(size, false);
+
+    std::vector<bool> affected(size, true);
+
+    std::vector<htd::index_t> members;
+
+    auto collectMembers = [&](htd::index_t vertex)
+    {
+        members.clear();
+
+        const std::uint64_t * row = rows.data() + vertex * wordCount;
+
+        for (htd::index_t word = 0; word < wordCount; ++word)
+        {
+            for (std::uint64_t bits = row[word]; bits != 0; bits &= bits - 1)
+            {
+                members.push_back(word * 64 + trailingZeroCount(bits));
+            }
+        }
+    };
+
+    for (std::size_t step = 0; step < size; ++step)
+    {
+        for (htd::index_t vertex = 0; vertex < size; ++vertex)
+        {
+            if (affected[vertex] && !eliminated[vertex])
+            {
+                collectMembers(vertex);
+
+                const std::uint64_t * row = rows.data() + vertex * wordCount;
+
+                std::size_t missingEdges = 0;
+
+                for (htd::index_t neighbor : members)
+                {
+                    const std::uint64_t * neighborRow = rows.data() + neighbor * wordCount;
+
+                    for (htd::index_t word = 0; word < wordCount; ++word)
+                    {
+                        missingEdges += populationCount(row[word] & ~neighborRow[word]);
+                    }
+
+                    /* The neighbor itself is part of the row but not of its own row. */
+                    --missingEdges;
+                }
+
+                fill[vertex] = missingEdges / 2;
+
+                degree[vertex] = members.size();
+
+                affected[vertex] = false;
+            }
+        }
+
+        htd::index_t selectedVertex = NONE;
+
+        std::size_t tieCount = 0;
+
+        for (htd::index_t vertex = 0; vertex < size; ++vertex)
+        {
+            if (!eliminated[vertex])
+            {
+                if (selectedVertex == NONE || fill[vertex] < fill[selectedVertex] || (fill[vertex] == fill[selectedVertex] && degree[vertex] < degree[selectedVertex]))
+                {
+                    selectedVertex = vertex;
+
+                    tieCount = 1;
+                }
+                else if (fill[vertex] == fill[selectedVertex] && degree[vertex] == degree[selectedVertex])
+                {
+                    ++tieCount;
+
+                    if (generator.nextIndex(tieCount) == 0)
+                    {
+                        selectedVertex = vertex;
+                    }
+                }
+            }
+        }
+
+        context.ordering[part.position + step] = context.preprocessedGraph.vertexName(part.vertices[selectedVertex]);
+
+        eliminated[selectedVertex] = true;
+
+        collectMembers(selectedVertex);
+
+        const std::uint64_t * selectedRow = rows.data() + selectedVertex * wordCount;
+
+        for (htd::index_t neighbor : members)
+        {
+            std::uint64_t * neighborRow = rows.data() + neighbor * wordCount;
+
+            for (htd::index_t word = 0; word < wordCount; ++word)
+            {
+                neighborRow[word] |= selectedRow[word];
+            }
+
+            neighborRow[neighbor / 64] &= ~(static_cast<std::uint64_t>(1) << (neighbor % 64));
+            neighborRow[selectedVertex / 64] &= ~(static_cast<std::uint64_t>(1) << (selectedVertex % 64));
+        }
+
+        /* The fill values of the neighbors and of their neighbors may have changed. */
+        std::vector<htd::index_t> neighbors(members);
+
+        for (htd::index_t neighbor : neighbors)
+        {
+            affected[neighbor] = true;
+
+            collectMembers(neighbor);
+
+            for (htd::index_t vertex : members)
+            {
+                affected[vertex] = true;
+            }
+        }
+    }
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::bisect(const WeightedGraph & graph, htd::RandomNumberGenerator & generator, std::vector<std::uint8_t> & partition) const
+{
+    std::deque<WeightedGraph> coarseGraphs;
+
+    std::deque<std::vector<htd::index_t>> coarseVertices;
+
+    const WeightedGraph * currentGraph = &graph;
+
+    while (currentGraph->vertexCount() > COARSENING_LIMIT)
+    {
+        coarseGraphs.emplace_back();
+        coarseVertices.emplace_back();
+
+        if (!coarsen(*currentGraph, generator, coarseGraphs.back(), coarseVertices.back()))
+        {
+            coarseGraphs.pop_back();
+            coarseVertices.pop_back();
+
+            break;
+        }
+
+        currentGraph = &(coarseGraphs.back());
+    }
+
+    std::size_t maxPartWeight = std::max((graph.totalWeight * (100 + MAX_IMBALANCE) + 199) / 200, (graph.totalWeight + 1) / 2);
+
+    computeInitialPartition(*currentGraph, generator, maxPartWeight, partition);
+
+    std::vector<std::uint8_t> finePartition;
+
+    for (std::size_t level = coarseGraphs.size(); level > 0; --level)
+    {
+        const WeightedGraph & fineGraph = level > 1 ? coarseGraphs[level - 2] : graph;
+
+        const std::vector<htd::index_t> & coarseVertex = coarseVertices[level - 1];
+
+        finePartition.resize(fineGraph.vertexCount());
+
+        for (htd::index_t vertex = 0; vertex < fineGraph.vertexCount(); ++vertex)
+        {
+            finePartition[vertex] = partition[coarseVertex[vertex]];
+        }
+
+        partition.swap(finePartition);
+
+        refine(fineGraph, maxPartWeight, partition);
+
+        coarseGraphs.pop_back();
+        coarseVertices.pop_back();
+    }
+
+    /* Guarantee progress of the recursion even if the partitioning degenerated. */
+    if (std::find(partition.begin(), partition.end(), 0) == partition.end() || std::find(partition.begin(), partition.end(), 1) == partition.end())
+    {
+        for (htd::index_t vertex = 0; vertex < partition.size(); ++vertex)
+        {
+            partition[vertex] = vertex < partition.size() / 2 ? 0 : 1;
+        }
+    }
+}
+
+bool htd::NestedDissectionOrderingAlgorithm::Implementation::coarsen(const WeightedGraph & graph, htd::RandomNumberGenerator & generator, WeightedGraph & coarseGraph, std::vector<htd::index_t> & coarseVertex) const
+{
+    std::size_t size = graph.vertexCount();
+
+    std::vector<htd::index_t> visitingOrder(size);
+
+    std::iota(visitingOrder.begin(), visitingOrder.end(), 0);
+
+    std::shuffle(visitingOrder.begin(), visitingOrder.end(), generator);
+
+    /* Limit the weight of the coarse vertices so that the coarsest graph can still be balanced. */
+    std::size_t maxVertexWeight = std::max(static_cast<std::size_t>(2), (3 * graph.totalWeight) / (2 * COARSENING_LIMIT));
+
+    std::vector<htd::index_t> match(size, static_cast<htd::index_t>(NONE));
+
+    std::vector<htd::index_t> representatives;
+
+    coarseVertex.assign(size, static_cast<htd::index_t>(NONE));
+
+    for (htd::index_t vertex : visitingOrder)
+    {
+        if (match[vertex] == NONE)
+        {
+            htd::index_t partner = vertex;
+
+            std::size_t partnerEdgeWeight = 0;
+
+            for (htd::index_t index = graph.offsets[vertex]; index < graph.offsets[vertex + 1]; ++index)
+            {
+                htd::index_t neighbor = graph.neighbors[index];
+
+                if (match[neighbor] == NONE && neighbor != vertex && graph.edgeWeights[index] > partnerEdgeWeight &&
+                    graph.vertexWeights[vertex] + graph.vertexWeights[neighbor] <= maxVertexWeight)
+                {
+                    partner = neighbor;
+
+                    partnerEdgeWeight = graph.edgeWeights[index];
+                }
+            }
+
+            match[vertex] = partner;
+            match[partner] = vertex;
+
+            coarseVertex[vertex] = representatives.size();
+            coarseVertex[partner] = representatives.size();
+
+            representatives.push_back(vertex);
+        }
+    }
+
+    std::size_t coarseSize = representatives.size();
+
+    if (coarseSize * 20 > size * 19)
+    {
+        return false;
+    }
+
+    coarseGraph.offsets.reserve(coarseSize + 1);
+    coarseGraph.neighbors.reserve(graph.neighbors.size());
+    coarseGraph.edgeWeights.reserve(graph.neighbors.size());
+    coarseGraph.vertexWeights.reserve(coarseSize);
+    coarseGraph.totalWeight = graph.totalWeight;
+
+    /* The position of each coarse neighbor within the adjacency array of the current coarse vertex. */
+    std::vector<htd::index_t> slot(coarseSize, static_cast<htd::index_t>(NONE));
+
+    for (htd::index_t coarseIndex = 0; coarseIndex < coarseSize; ++coarseIndex)
+    {
+        htd::index_t members[2] = { representatives[coarseIndex], match[representatives[coarseIndex]] };
+
+        std::size_t memberCount = members[0] == members[1] ? 1 : 2;
+
+        std::size_t start = coarseGraph.neighbors.size();
+
+        std::size_t weight = 0;
+
+        for (std::size_t member = 0; member < memberCount; ++member)
+        {
+            htd::index_t vertex = members[member];
+
+            weight += graph.vertexWeights[vertex];
+
+            for (htd::index_t index = graph.offsets[vertex]; index < graph.offsets[vertex + 1]; ++index)
+            {
+                htd::index_t target = coarseVertex[graph.neighbors[index]];
+
+                if (target != coarseIndex)
+                {
+                    if (slot[target] == NONE)
+                    {
+                        slot[target] = coarseGraph.neighbors.size();
+
+                        coarseGraph.neighbors.push_back(target);
+                        coarseGraph.edgeWeights.push_back(graph.edgeWeights[index]);
+                    }
+                    else
+                    {
+                        coarseGraph.edgeWeights[slot[target]] += graph.edgeWeights[index];
+                    }
+                }
+            }
+        }
+
+        for (htd::index_t index = start; index < coarseGraph.neighbors.size(); ++index)
+        {
+            slot[coarseGraph.neighbors[index]] = NONE;
+        }
+
+        coarseGraph.offsets.push_back(coarseGraph.neighbors.size());
+        coarseGraph.vertexWeights.push_back(weight);
+    }
+
+    return true;
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::computeInitialPartition(const WeightedGraph & graph, htd::RandomNumberGenerator & generator, std::size_t maxPartWeight, std::vector<std::uint8_t> & partition) const
+{
+    std::size_t size = graph.vertexCount();
+
+    std::vector<std::uint8_t> candidate(size);
+
+    std::vector<bool> queued(size);
+
+    std::vector<htd::index_t> queue;
+
+    queue.reserve(size);
+
+    std::size_t bestOverweight = static_cast<std::size_t>(-1);
+
+    std::size_t bestCut = static_cast<std::size_t>(-1);
+
+    for (std::size_t attempt = 0; attempt < INITIAL_PARTITION_ATTEMPTS; ++attempt)
+    {
+        std::fill(candidate.begin(), candidate.end(), 1);
+        std::fill(queued.begin(), queued.end(), false);
+
+        queue.clear();
+
+        std::size_t head = 0;
+
+        std::size_t start = generator.nextIndex(size);
+
+        std::size_t skipped = 0;
+
+        std::size_t partWeights[2] = { 0, graph.totalWeight };
+
+        /* Grow side 0 via breadth-first search, a new start vertex is chosen whenever a component is exhausted. */
+        while (partWeights[0] < graph.totalWeight / 2)
+        {
+            if (head == queue.size())
+            {
+                while (queued[(start + skipped) % size])
+                {
+                    ++skipped;
+                }
+
+                queued[(start + skipped) % size] = true;
+
+                queue.push_back((start + skipped) % size);
+            }
+
+            htd::index_t vertex = queue[head++];
+
+            candidate[vertex] = 0;
+
+            partWeights[0] += graph.vertexWeights[vertex];
+            partWeights[1] -= graph.vertexWeights[vertex];
+
+            for (htd::index_t index = graph.offsets[vertex]; index < graph.offsets[vertex + 1]; ++index)
+            {
+                htd::index_t neighbor = graph.neighbors[index];
+
+                if (!queued[neighbor])
+                {
+                    queued[neighbor] = true;
+
+                    queue.push_back(neighbor);
+                }
+            }
+        }
+
+        std::size_t cut = refine(graph, maxPartWeight, candidate);
+
+        partWeights[0] = 0;
+        partWeights[1] = 0;
+
+        for (htd::index_t vertex = 0; vertex < size; ++vertex)
+        {
+            partWeights[candidate[vertex]] += graph.vertexWeights[vertex];
+        }
+
+        std::size_t currentOverweight = overweight(partWeights, maxPartWeight);
+
+        if (currentOverweight < bestOverweight || (currentOverweight == bestOverweight && cut < bestCut))
+        {
+            bestOverweight = currentOverweight;
+
+            bestCut = cut;
+
+            partition = candidate;
+        }
+    }
+}
+
+std::size_t htd::NestedDissectionOrderingAlgorithm::Implementation::refine(const WeightedGraph & graph, std::size_t maxPartWeight, std::vector<std::uint8_t> & partition) const
+{
+    typedef std::pair<std::ptrdiff_t, htd::index_t> QueueEntry;
+
+    std::size_t size = graph.vertexCount();
+
+    /* The gain of a vertex is the decrease of the edge cut when moving the vertex to the other side. */
+    std::vector<std::ptrdiff_t> gains(size, 0);
+
+    std::vector<bool> boundary(size, false);
+
+    std::size_t partWeights[2] = { 0, 0 };
+
+    std::ptrdiff_t cut = 0;
+
+    for (htd::index_t vertex = 0; vertex < size; ++vertex)
+    {
+        partWeights[partition[vertex]] += graph.vertexWeights[vertex];
+
+        for (htd::index_t index = graph.offsets[vertex]; index < graph.offsets[vertex + 1]; ++index)
+        {
+            std::ptrdiff_t weight = static_cast<std::ptrdiff_t>(graph.edgeWeights[index]);
+
+            if (partition[graph.neighbors[index]] != partition[vertex])
+            {
+                gains[vertex] += weight;
+
+                cut += weight;
+
+                boundary[vertex] = true;
+            }
+            else
+            {
+                gains[vertex] -= weight;
+            }
+        }
+    }
+
+    cut /= 2;
+
+    std::vector<std::size_t> lockedInPass(size, 0);
+
+    std::vector<htd::index_t> moves;
+
+    std::priority_queue<QueueEntry> queues[2];
+
+    auto moveVertex = [&](htd::index_t vertex, std::size_t pass)
+    {
+        std::uint8_t side = partition[vertex];
+
+        partition[vertex] = 1 - side;
+
+        partWeights[side] -= graph.vertexWeights[vertex];
+        partWeights[1 - side] += graph.vertexWeights[vertex];
+
+        cut -= gains[vertex];
+
+        gains[vertex] = -gains[vertex];
+
+        for (htd::index_t index = graph.offsets[vertex]; index < graph.offsets[vertex + 1]; ++index)
+        {
+            htd::index_t neighbor = graph.neighbors[index];
+
+            std::ptrdiff_t weight = static_cast<std::ptrdiff_t>(graph.edgeWeights[index]);
+
+            gains[neighbor] += partition[neighbor] == side ? 2 * weight : -2 * weight;
+
+            if (pass > 0 && lockedInPass[neighbor] != pass)
+            {
+                queues[partition[neighbor]].emplace(gains[neighbor], neighbor);
+            }
+        }
+    };
+
+    for (std::size_t pass = 1; pass <= REFINEMENT_PASSES; ++pass)
+    {
+        for (std::uint8_t side = 0; side < 2; ++side)
+        {
+            queues[side] = std::priority_queue<QueueEntry>();
+        }
+
+        for (htd::index_t vertex = 0; vertex < size; ++vertex)
+        {
+            if (boundary[vertex])
+            {
+                queues[partition[vertex]].emplace(gains[vertex], vertex);
+            }
+        }
+
+        moves.clear();
+
+        std::ptrdiff_t bestCut = cut;
+
+        std::size_t bestOverweight = overweight(partWeights, maxPartWeight);
+
+        std::size_t bestMoveCount = 0;
+
+        while (moves.size() - bestMoveCount < MAX_NON_IMPROVING_MOVES)
+        {
+            int selectedSide = -1;
+
+            std::size_t currentOverweight = overweight(partWeights, maxPartWeight);
+
+            for (std::uint8_t side = 0; side < 2; ++side)
+            {
+                std::priority_queue<QueueEntry> & queue = queues[side];
+
+                /* Outdated entries are discarded lazily. */
+                while (!queue.empty() && (lockedInPass[queue.top().second] == pass || partition[queue.top().second] != side || gains[queue.top().second] != queue.top().first))
+                {
+                    queue.pop();
+                }
+
+                if (!queue.empty())
+                {
+                    std::size_t weight = graph.vertexWeights[queue.top().second];
+
+                    std::size_t newPartWeights[2] = { partWeights[0], partWeights[1] };
+
+                    newPartWeights[side] -= weight;
+                    newPartWeights[1 - side] += weight;
+
+                    if (overweight(newPartWeights, maxPartWeight) <= currentOverweight &&
+                        (selectedSide < 0 || queue.top().first > queues[selectedSide].top().first ||
+                         (queue.top().first == queues[selectedSide].top().first && partWeights[side] > partWeights[selectedSide])))
+                    {
+                        selectedSide = side;
+                    }
+                }
+            }
+
+            if (selectedSide < 0)
+            {
+                break;
+            }
+
+            htd::index_t vertex = queues[selectedSide].top().second;
+
+            queues[selectedSide].pop();
+
+            lockedInPass[vertex] = pass;
+
+            moveVertex(vertex, pass);
+
+            moves.push_back(vertex);
+
+            currentOverweight = overweight(partWeights, maxPartWeight);
+
+            if (currentOverweight < bestOverweight || (currentOverweight == bestOverweight && cut < bestCut))
+            {
+                bestOverweight = currentOverweight;
+
+                bestCut = cut;
+
+                bestMoveCount = moves.size();
+            }
+        }
+
+        /* Roll back all moves after the best intermediate partition. */
+        while (moves.size() > bestMoveCount)
+        {
+            moveVertex(moves.back(), 0);
+
+            moves.pop_back();
+        }
+
+        if (bestMoveCount == 0)
+        {
+            break;
+        }
+
+        for (htd::index_t vertex : moves)
+        {
+            for (htd::index_t index = graph.offsets[vertex]; index < graph.offsets[vertex + 1]; ++index)
+            {
+                boundary[graph.neighbors[index]] = true;
+            }
+        }
+    }
+
+    return static_cast<std::size_t>(cut);
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::extractSeparator(const WeightedGraph & graph, std::vector<std::uint8_t> & partition) const
+{
+    std::size_t size = graph.vertexCount();
+
+    /* The boundary vertices of side 0 form the left and the boundary vertices of side 1 form the right side of the bipartite graph. */
+    std::vector<htd::index_t> bipartiteIndex(size, static_cast<htd::index_t>(NONE));
+
+    std::vector<htd::index_t> leftVertices;
+
+    std::vector<htd::index_t> rightVertices;
+
+    for (htd::index_t vertex = 0; vertex < size; ++vertex)
+    {
+        for (htd::index_t index = graph.offsets[vertex]; index < graph.offsets[vertex + 1]; ++index)
+        {
+            if (partition[graph.neighbors[index]] != partition[vertex])
+            {
+                std::vector<htd::index_t> & target = partition[vertex] == 0 ? leftVertices : rightVertices;
+
+                bipartiteIndex[vertex] = target.size();
+
+                target.push_back(vertex);
+
+                break;
+            }
+        }
+    }
+
+    std::vector<htd::index_t> offsets(1, 0);
+
+    std::vector<htd::index_t> neighbors;
+
+    offsets.reserve(leftVertices.size() + 1);
+
+    for (htd::index_t vertex : leftVertices)
+    {
+        for (htd::index_t index = graph.offsets[vertex]; index < graph.offsets[vertex + 1]; ++index)
+        {
+            htd::index_t neighbor = graph.neighbors[index];
+
+            if (partition[neighbor] == 1)
+            {
+                neighbors.push_back(bipartiteIndex[neighbor]);
+            }
+        }
+
+        offsets.push_back(neighbors.size());
+    }
+
+    std::vector<htd::index_t> leftMatch(leftVertices.size(), static_cast<htd::index_t>(NONE));
+
+    std::vector<htd::index_t> rightMatch(rightVertices.size(), static_cast<htd::index_t>(NONE));
+
+    std::vector<std::size_t> distance(leftVertices.size());
+
+    std::vector<htd::index_t> nextEdge(leftVertices.size());
+
+    std::vector<htd::index_t> queue;
+
+    std::vector<htd::index_t> stack;
+
+    queue.reserve(leftVertices.size());
+
+    const std::size_t UNREACHABLE = static_cast<std::size_t>(-1);
+
+    /* Hopcroft-Karp: Each phase augments along a maximal set of vertex-disjoint shortest augmenting paths. */
+    bool augmentingPathFound = true;
+
+    while (augmentingPathFound)
+    {
+        augmentingPathFound = false;
+
+        queue.clear();
+
+        for (htd::index_t left = 0; left < leftVertices.size(); ++left)
+        {
+            if (leftMatch[left] == NONE)
+            {
+                distance[left] = 0;
+
+                queue.push_back(left);
+            }
+            else
+            {
+                distance[left] = UNREACHABLE;
+            }
+        }
+
+        for (std::size_t head = 0; head < queue.size(); ++head)
+        {
+            htd::index_t left = queue[head];
+
+            for (htd::index_t index = offsets[left]; index < offsets[left + 1]; ++index)
+            {
+                htd::index_t partner = rightMatch[neighbors[index]];
+
+                if (partner == NONE)
+                {
+                    augmentingPathFound = true;
+                }
+                else if (distance[partner] == UNREACHABLE)
+                {
+                    distance[partner] = distance[left] + 1;
+
+                    queue.push_back(partner);
+                }
+            }
+        }
+
+        if (augmentingPathFound)
+        {
+            std::copy(offsets.begin(), offsets.end() - 1, nextEdge.begin());
+
+            for (htd::index_t root = 0; root < leftVertices.size(); ++root)
+            {
+                if (leftMatch[root] == NONE)
+                {
+                    stack.assign(1, root);
+
+                    while (!stack.empty())
+                    {
+                        htd::index_t left = stack.back();
+
+                        if (nextEdge[left] == offsets[left + 1])
+                        {
+                            distance[left] = UNREACHABLE;
+
+                            stack.pop_back();
+                        }
+                        else
+                        {
+                            htd::index_t partner = rightMatch[neighbors[nextEdge[left]]];
+
+                            if (partner == NONE)
+                            {
+                                /* The stack forms an augmenting path, each vertex on it is matched along its current edge. */
+                                for (htd::index_t vertex : stack)
+                                {
+                                    leftMatch[vertex] = neighbors[nextEdge[vertex]];
+
+                                    rightMatch[neighbors[nextEdge[vertex]]] = vertex;
+                                }
+
+                                stack.clear();
+                            }
+                            else if (distance[partner] == distance[left] + 1)
+                            {
+                                stack.push_back(partner);
+                            }
+                            else
+                            {
+                                ++nextEdge[left];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /* Koenig's theorem: The vertices reachable via alternating paths from unmatched left vertices determine a minimum vertex cover. */
+    std::vector<bool> leftReached(leftVertices.size(), false);
+
+    std::vector<bool> rightReached(rightVertices.size(), false);
+
+    queue.clear();
+
+    for (htd::index_t left = 0; left < leftVertices.size(); ++left)
+    {
+        if (leftMatch[left] == NONE)
+        {
+            leftReached[left] = true;
+
+            queue.push_back(left);
+        }
+    }
+
+    for (std::size_t head = 0; head < queue.size(); ++head)
+    {
+        htd::index_t left = queue[head];
+
+        for (htd::index_t index = offsets[left]; index < offsets[left + 1]; ++index)
+        {
+            htd::index_t right = neighbors[index];
+
+            if (!rightReached[right])
+            {
+                rightReached[right] = true;
+
+                htd::index_t partner = rightMatch[right];
+
+                if (partner != NONE && !leftReached[partner])
+                {
+                    leftReached[partner] = true;
+
+                    queue.push_back(partner);
+                }
+            }
+        }
+    }
+
+    for (htd::index_t left = 0; left < leftVertices.size(); ++left)
+    {
+        if (!leftReached[left])
+        {
+            partition[leftVertices[left]] = SEPARATOR;
+        }
+    }
+
+    for (htd::index_t right = 0; right < rightVertices.size(); ++right)
+    {
+        if (rightReached[right])
+        {
+            partition[rightVertices[right]] = SEPARATOR;
+        }
+    }
+}
+
+const htd::LibraryInstance * htd::NestedDissectionOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::NestedDissectionOrderingAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+std::size_t htd::NestedDissectionOrderingAlgorithm::leafSize(void) const
+{
+    return implementation_->leafSize_;
+}
+
+void htd::NestedDissectionOrderingAlgorithm::setLeafSize(std::size_t leafSize)
+{
+    HTD_ASSERT(leafSize > 0)
+
+    implementation_->leafSize_ = leafSize;
+}
+
+std::size_t htd::NestedDissectionOrderingAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::NestedDissectionOrderingAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
+htd::NestedDissectionOrderingAlgorithm * htd::NestedDissectionOrderingAlgorithm::clone(void) const
+{
+    htd::NestedDissectionOrderingAlgorithm * ret = new htd::NestedDissectionOrderingAlgorithm(implementation_->managementInstance_);
+
+    ret->setLeafSize(implementation_->leafSize_);
+    ret->setThreadCount(implementation_->threadCount_);
+
+    return ret;
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IOrderingAlgorithm * htd::NestedDissectionOrderingAlgorithm::cloneOrderingAlgorithm(void) const
+{
+    return clone();
+}
+#endif
+
+#endif /* HTD_HTD_NESTEDDISSECTIONORDERINGALGORITHM_CPP */
@@ -57,7 +57,7 @@ struct htd::PreprocessedGraph::Implementation
                    std::vector<htd::vertex_t> && remainingVertices,
                    std::size_t inputGraphEdgeCount,
                    std::size_t minTreeWidth)
-        : names_(std::move(vertexNames)), neighborhood_(std::move(neighborhood)), eliminationSequence_(std::move(eliminationSequence)), remainingVertices_(std::move(remainingVertices)), minTreeWidth_(minTreeWidth), edgeCount_(0), inputGraphEdgeCount_(inputGraphEdgeCount)
+        : names_(std::move(vertexNames)), neighborhood_(std::move(neighborhood)), eliminationSequence_(std::move(eliminationSequence)), remainingVertices_(std::move(remainingVertices)), minTreeWidth_(minTreeWidth), prefixWidth_(minTreeWidth), edgeCount_(0), inputGraphEdgeCount_(inputGraphEdgeCount), neighborhoodSnapshot_(neighborhood_)
     {
         updateEdgeCount();
     }
@@ -68,7 +68,7 @@ struct htd::PreprocessedGraph::Implementation
      *  @param[in] original  The original implementation details structure.
      */
     Implementation(const Implementation & original)
-        : names_(original.names_), neighborhood_(original.neighborhood_), eliminationSequence_(original.eliminationSequence_), remainingVertices_(original.remainingVertices_), minTreeWidth_(original.minTreeWidth_), edgeCount_(original.edgeCount_), inputGraphEdgeCount_(original.inputGraphEdgeCount_)
+        : names_(original.names_), neighborhood_(original.neighborhood_), eliminationSequence_(original.eliminationSequence_), remainingVertices_(original.remainingVertices_), minTreeWidth_(original.minTreeWidth_), prefixWidth_(original.prefixWidth_), edgeCount_(original.edgeCount_), inputGraphEdgeCount_(original.inputGraphEdgeCount_), neighborhoodSnapshot_(original.neighborhoodSnapshot_)
     {
 
     }
@@ -103,6 +103,11 @@ struct htd::PreprocessedGraph::Implementation
      */
     std::size_t minTreeWidth_;
 
+    /**
+     *  The width of the partial vertex elimination ordering computed during the preprocessing phase.
+     */
+    std::size_t prefixWidth_;
+
     /**
      *  The number of edges in the preprocessed graph.
      */
@@ -113,6 +118,11 @@ struct htd::PreprocessedGraph::Implementation
      */
     std::size_t inputGraphEdgeCount_;
 
+    /**
+     *  The immutable snapshot of the neighborhoods in compressed sparse row format.
+     */
+    htd::NeighborhoodSnapshot neighborhoodSnapshot_;
+
     /**
      *  Recompute the number of edges in the graph to update the result of the function edgeCount().
      */
@@ -468,6 +478,16 @@ void htd::PreprocessedGraph::updateEdgeCount(void)
     implementation_->updateEdgeCount();
 }
 
+const htd::NeighborhoodSnapshot & htd::PreprocessedGraph::neighborhoodSnapshot(void) const HTD_NOEXCEPT
+{
+    return implementation_->neighborhoodSnapshot_;
+}
+
+void htd::PreprocessedGraph::updateNeighborhoodSnapshot(void)
+{
+    implementation_->neighborhoodSnapshot_.assign(implementation_->neighborhood_);
+}
+
 std::vector<htd::vertex_t> & htd::PreprocessedGraph::eliminationSequence(void) HTD_NOEXCEPT
 {
     return implementation_->eliminationSequence_;
@@ -507,6 +527,16 @@ std::size_t htd::PreprocessedGraph::minTreeWidth(void) const HTD_NOEXCEPT
     return implementation_->minTreeWidth_;
 }
 
+std::size_t & htd::PreprocessedGraph::prefixWidth(void) HTD_NOEXCEPT
+{
+    return implementation_->prefixWidth_;
+}
+
+std::size_t htd::PreprocessedGraph::prefixWidth(void) const HTD_NOEXCEPT
+{
+    return implementation_->prefixWidth_;
+}
+
 htd::PreprocessedGraph * htd::PreprocessedGraph::clone(void) const
 {
     return new htd::PreprocessedGraph(*this);
@@ -29,10 +29,10 @@
 #include <htd/RandomOrderingAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/RandomNumberGenerator.hpp>
 #include <htd/VertexOrdering.hpp>
 
 #include <algorithm>
-#include <random>
 
 /**
  *  Private implementation details of class htd::NaturalOrderingAlgorithm.
@@ -106,11 +106,7 @@ htd::IVertexOrdering * htd::RandomOrderingAlgorithm::computeOrdering(const htd::
         vertex = preprocessedGraph.vertexName(vertex);
     });
 
-    /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-    // coverity[dont_call]
-    std::mt19937 g(static_cast<std::mt19937::result_type>(std::rand()));
-
-    std::shuffle(middle, ordering.end(), g);
+    std::shuffle(middle, ordering.end(), htd::randomNumberGenerator());
 
     return new htd::VertexOrdering(std::move(ordering), 1);
 }
@@ -28,9 +28,9 @@
 #include <htd/Globals.hpp>
 
 #include <htd/RandomVertexSelectionStrategy.hpp>
+#include <htd/RandomNumberGenerator.hpp>
 
 #include <algorithm>
-#include <random>
 
 htd::RandomVertexSelectionStrategy::RandomVertexSelectionStrategy(std::size_t limit) : limit_(limit)
 {
@@ -50,7 +50,7 @@ void htd::RandomVertexSelectionStrategy::selectVertices(const htd::IMultiHypergr
     {
         std::vector<htd::vertex_t> vertices(vertexCollection.begin(), vertexCollection.end());
 
-        std::shuffle(vertices.begin(), vertices.end(), std::default_random_engine());
+        std::shuffle(vertices.begin(), vertices.end(), htd::randomNumberGenerator());
 
         target.insert(target.end(), vertices.begin(), vertices.begin() + limit_);
     }
@@ -30,6 +30,7 @@
 #include <htd/SetCoverAlgorithm.hpp>
 #include <htd/VectorAdapter.hpp>
 
+#include <algorithm>
 #include <deque>
 #include <iterator>
 #include <queue>
@@ -164,15 +165,46 @@ void htd::SetCoverAlgorithm::computeSetCover(const htd::ConstCollection<htd::id_
 
     std::unordered_set<htd::id_t> dominatedContainers;
 
-    for (auto it1 = relevantContainers.begin(); it1 < relevantContainers.end(); it1++)
+    /*
+     *  A container is dominated if it is a subset of a container preceding it in the order by size. Each such container
+     *  contains the element of the dominated container which occurs in the fewest containers, so an index from elements
+     *  to the positions of the containers including them limits the candidates which have to be investigated.
+     */
+    std::unordered_map<htd::id_t, std::vector<htd::index_t>> containerPositions;
+
+    for (htd::index_t position = 0; position < relevantContainers.size(); ++position)
+    {
+        for (htd::id_t element : containers[relevantContainers[position]])
+        {
+            containerPositions[element].push_back(position);
+        }
+    }
+
+    for (htd::index_t position = 0; position < relevantContainers.size(); ++position)
     {
-        htd::id_t container = *it1;
+        const std::vector<htd::id_t> & container = containers[relevantContainers[position]];
+
+        const std::vector<htd::index_t> * candidates = &(containerPositions.at(container[0]));
 
-        for (auto it2 = it1 + 1; it2 < relevantContainers.end(); it2++)
+        for (htd::id_t element : container)
         {
-            if (std::includes(containers[container].begin(), containers[container].end(), containers[*it2].begin(), containers[*it2].end()))
+            const std::vector<htd::index_t> & currentCandidates = containerPositions.at(element);
+
+            if (currentCandidates.size() < candidates->size())
+            {
+                candidates = &currentCandidates;
+            }
+        }
+
+        for (auto it = candidates->begin(); it != candidates->end() && *it < position; ++it)
+        {
+            const std::vector<htd::id_t> & otherContainer = containers[relevantContainers[*it]];
+
+            if (std::includes(otherContainer.begin(), otherContainer.end(), container.begin(), container.end()))
             {
-                dominatedContainers.insert(*it2);
+                dominatedContainers.insert(relevantContainers[position]);
+
+                break;
             }
         }
     }
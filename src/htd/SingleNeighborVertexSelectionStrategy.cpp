@@ -28,9 +28,9 @@
 #include <htd/Globals.hpp>
 
 #include <htd/SingleNeighborVertexSelectionStrategy.hpp>
+#include <htd/RandomNumberGenerator.hpp>
 
 #include <algorithm>
-#include <random>
 
 htd::SingleNeighborVertexSelectionStrategy::SingleNeighborVertexSelectionStrategy(void) : limit_((std::size_t)-1)
 {
@@ -61,7 +61,7 @@ void htd::SingleNeighborVertexSelectionStrategy::selectVertices(const htd::IMult
 
     if (vertices.size() > limit_)
     {
-        std::shuffle(vertices.begin(), vertices.end(), std::default_random_engine());
+        std::shuffle(vertices.begin(), vertices.end(), htd::randomNumberGenerator());
 
         vertices.erase(vertices.begin() + limit_, vertices.end());
     }
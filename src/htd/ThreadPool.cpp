@@ -0,0 +1,201 @@
+/* 
+ * File:   ThreadPool.cpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_THREADPOOL_CPP
+#define HTD_HTD_THREADPOOL_CPP
+
+#include <htd/ThreadPool.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::ThreadPool.
+ */
+struct htd::ThreadPool::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] threadCount  The number of worker threads.
+     */
+    Implementation(std::size_t threadCount) : mutex_(), taskAvailable_(), tasksFinished_(), tasks_(), workers_(), pendingTasks_(0), shutdown_(false)
+    {
+        workers_.reserve(threadCount);
+
+        for (std::size_t index = 0; index < threadCount; ++index)
+        {
+            workers_.emplace_back(&Implementation::run, this);
+        }
+    }
+
+    virtual ~Implementation()
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            tasksFinished_.wait(lock, [&]{ return pendingTasks_ == 0; });
+
+            shutdown_ = true;
+        }
+
+        taskAvailable_.notify_all();
+
+        for (std::thread & worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    /**
+     *  The main loop of a worker thread.
+     */
+    void run(void)
+    {
+        while (true)
+        {
+            std::function<void(void)> task;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                taskAvailable_.wait(lock, [&]{ return shutdown_ || !tasks_.empty(); });
+
+                if (tasks_.empty())
+                {
+                    return;
+                }
+
+                task = std::move(tasks_.front());
+
+                tasks_.pop();
+            }
+
+            task();
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                --pendingTasks_;
+
+                if (pendingTasks_ == 0)
+                {
+                    tasksFinished_.notify_all();
+                }
+            }
+        }
+    }
+
+    /**
+     *  The mutex protecting the task queue and the counter of pending tasks.
+     */
+    std::mutex mutex_;
+
+    /**
+     *  The condition variable signalling that a new task is available or that the pool shuts down.
+     */
+    std::condition_variable taskAvailable_;
+
+    /**
+     *  The condition variable signalling that all submitted tasks are finished.
+     */
+    std::condition_variable tasksFinished_;
+
+    /**
+     *  The tasks which were not yet picked up by a worker thread.
+     */
+    std::queue<std::function<void(void)>> tasks_;
+
+    /**
+     *  The worker threads of the pool.
+     */
+    std::vector<std::thread> workers_;
+
+    /**
+     *  The number of tasks which were submitted but which are not yet finished.
+     */
+    std::size_t pendingTasks_;
+
+    /**
+     *  A boolean flag indicating whether the worker threads shall terminate.
+     */
+    bool shutdown_;
+};
+
+htd::ThreadPool::ThreadPool(std::size_t threadCount) : implementation_(new Implementation(effectiveThreadCount(threadCount)))
+{
+
+}
+
+htd::ThreadPool::~ThreadPool()
+{
+
+}
+
+std::size_t htd::ThreadPool::threadCount(void) const HTD_NOEXCEPT
+{
+    return implementation_->workers_.size();
+}
+
+void htd::ThreadPool::submit(const std::function<void(void)> & task)
+{
+    {
+        std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+        implementation_->tasks_.push(task);
+
+        ++(implementation_->pendingTasks_);
+    }
+
+    implementation_->taskAvailable_.notify_one();
+}
+
+void htd::ThreadPool::wait(void)
+{
+    std::unique_lock<std::mutex> lock(implementation_->mutex_);
+
+    implementation_->tasksFinished_.wait(lock, [&]{ return implementation_->pendingTasks_ == 0; });
+}
+
+std::size_t htd::ThreadPool::effectiveThreadCount(std::size_t threadCount)
+{
+    std::size_t ret = threadCount;
+
+    if (ret == 0)
+    {
+        ret = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    }
+
+    if (ret == 0)
+    {
+        ret = 1;
+    }
+
+    return ret;
+}
+
+#endif /* HTD_HTD_THREADPOOL_CPP */
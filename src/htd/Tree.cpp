@@ -41,7 +41,6 @@
 #include <iterator>
 #include <memory>
 #include <stdexcept>
-#include <unordered_map>
 #include <utility>
 
 /**
@@ -111,18 +110,13 @@ struct htd::Tree::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodes_(), nodePool_(), freeNodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
     {
 
     }
 
     virtual ~Implementation()
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
-
         for (htd::Hyperedge * edge : *edges_)
         {
             delete edge;
@@ -142,14 +136,11 @@ struct htd::Tree::Implementation
           next_vertex_(original.next_vertex_),
           vertices_(original.vertices_),
           nodes_(),
+          nodePool_(),
+          freeNodes_(),
           edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
     {
-        nodes_.reserve(original.nodes_.size());
-
-        for (const auto & node : original.nodes_)
-        {
-            nodes_.emplace(node.first, new Node(*(node.second)));
-        }
+        copyNodes(original);
 
         for (const htd::Hyperedge * edge : *(original.edges_))
         {
@@ -162,12 +153,7 @@ struct htd::Tree::Implementation
      */
     void reset(void)
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
-
-        nodes_.clear();
+        clearNodes();
 
         for (htd::Hyperedge * edge : *edges_)
         {
@@ -218,15 +204,128 @@ struct htd::Tree::Implementation
     std::vector<htd::vertex_t> vertices_;
 
     /**
-     *  The map of pointers to all tree nodes. It maps vertex IDs to the corresponding node information.
+     *  The pointers to all tree nodes, indexed by vertex ID. Slots of vertices which are not part of the tree hold a null pointer.
      */
-    std::unordered_map<htd::id_t, Node *> nodes_;
+    std::vector<Node *> nodes_;
+
+    /**
+     *  The pool providing the storage for all tree nodes. The pool is a deque so that pointers to its nodes remain valid when it grows.
+     */
+    std::deque<Node> nodePool_;
+
+    /**
+     *  The nodes of the pool which are currently unused and which can be recycled when new vertices are added to the tree.
+     */
+    std::vector<Node *> freeNodes_;
 
     /**
      *  The collection of all hyperedges which exist in the tree.
      */
     std::shared_ptr<std::deque<htd::Hyperedge *>> edges_;
 
+    /**
+     *  Access the node representing a given vertex.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return A pointer to the node representing the given vertex.
+     *
+     *  @throws std::out_of_range If the given vertex is not a vertex of the tree, e.g., because it was removed.
+     */
+    Node * node(htd::vertex_t vertex) const
+    {
+        Node * ret = nodes_.at(vertex);
+
+        if (ret == nullptr)
+        {
+            throw std::out_of_range("htd::Tree::Implementation::Node * htd::Tree::Implementation::node(htd::vertex_t) const");
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Create a new tree node, either by recycling an unused node of the pool or by extending the pool.
+     *
+     *  @param[in] vertex   The vertex represented by the new node.
+     *  @param[in] parent   The parent of the new node.
+     *
+     *  @return A pointer to the new node.
+     */
+    Node * createNode(htd::vertex_t vertex, htd::vertex_t parent)
+    {
+        Node * ret = nullptr;
+
+        if (freeNodes_.empty())
+        {
+            nodePool_.emplace_back(vertex, parent);
+
+            ret = &(nodePool_.back());
+        }
+        else
+        {
+            ret = freeNodes_.back();
+
+            freeNodes_.pop_back();
+
+            ret->id = vertex;
+            ret->parent = parent;
+        }
+
+        if (vertex >= nodes_.size())
+        {
+            nodes_.resize(vertex + 1, nullptr);
+        }
+
+        nodes_[vertex] = ret;
+
+        return ret;
+    }
+
+    /**
+     *  Return a node to the pool of unused nodes. The edge and children collections of the node are cleared but they keep their capacity.
+     *
+     *  @param[in] node The node which shall be returned to the pool.
+     */
+    void releaseNode(Node * node)
+    {
+        nodes_[node->id] = nullptr;
+
+        node->edges.clear();
+        node->children.clear();
+
+        freeNodes_.push_back(node);
+    }
+
+    /**
+     *  Remove all nodes of the tree and release the storage of the node pool.
+     */
+    void clearNodes(void)
+    {
+        nodes_.clear();
+        nodePool_.clear();
+        freeNodes_.clear();
+    }
+
+    /**
+     *  Replace the nodes of the tree by copies of the nodes of another tree. The copies are stored contiguously in ascending order of their vertex IDs.
+     *
+     *  @param[in] original The implementation details of the tree whose nodes shall be copied.
+     */
+    void copyNodes(const Implementation & original)
+    {
+        clearNodes();
+
+        nodes_.resize(original.nodes_.size(), nullptr);
+
+        for (htd::vertex_t vertex : original.vertices_)
+        {
+            nodePool_.emplace_back(*(original.nodes_[vertex]));
+
+            nodes_[vertex] = &(nodePool_.back());
+        }
+    }
+
     /**
      *  Delete a node of the tree and perform an update of the internal state.
      *
@@ -303,7 +402,7 @@ std::size_t htd::Tree::edgeCount(htd::vertex_t vertex) const
 
 bool htd::Tree::isVertex(htd::vertex_t vertex) const
 {
-    return vertex < implementation_->next_vertex_ && vertex != htd::Vertex::UNKNOWN && implementation_->nodes_.count(vertex) == 1;
+    return vertex < implementation_->nodes_.size() && implementation_->nodes_[vertex] != nullptr;
 }
 
 bool htd::Tree::isEdge(htd::id_t edgeId) const
@@ -397,7 +496,7 @@ bool htd::Tree::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(neighbor))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = *(implementation_->node(vertex));
 
     const auto & children = node.children;
 
@@ -445,7 +544,7 @@ std::size_t htd::Tree::neighborCount(htd::vertex_t vertex) const
     
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = *(implementation_->node(vertex));
 
     if (node.parent != htd::Vertex::UNKNOWN)
     {
@@ -472,7 +571,7 @@ void htd::Tree::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
 
     std::size_t size = target.size();
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = *(implementation_->node(vertex));
 
     const auto & children = node.children;
 
@@ -665,7 +764,7 @@ htd::vertex_t htd::Tree::parent(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t ret = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t ret = implementation_->node(vertex)->parent;
 
     HTD_ASSERT(ret != htd::Vertex::UNKNOWN)
     
@@ -677,28 +776,28 @@ bool htd::Tree::isParent(htd::vertex_t vertex, htd::vertex_t parent) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(parent))
 
-    return implementation_->nodes_.at(vertex)->parent == parent;
+    return implementation_->node(vertex)->parent == parent;
 }
 
 std::size_t htd::Tree::childCount(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.size();
+    return implementation_->node(vertex)->children.size();
 }
 
 htd::ConstCollection<htd::vertex_t> htd::Tree::children(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->nodes_.at(vertex)->children);
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->node(vertex)->children);
 }
 
 void htd::Tree::copyChildrenTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & childCollection = implementation_->nodes_.at(vertex)->children;
+    const std::vector<htd::vertex_t> & childCollection = implementation_->node(vertex)->children;
 
     target.insert(target.end(), childCollection.begin(), childCollection.end());
 }
@@ -707,7 +806,7 @@ htd::vertex_t htd::Tree::childAtPosition(htd::vertex_t vertex, htd::index_t inde
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->node(vertex)->children;
 
     HTD_ASSERT(index < children.size())
 
@@ -719,7 +818,7 @@ bool htd::Tree::isChild(htd::vertex_t vertex, htd::vertex_t child) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->node(vertex)->children;
 
     return std::find(children.begin(), children.end(), child) != children.end();
 }
@@ -757,13 +856,13 @@ std::size_t htd::Tree::depth(htd::vertex_t vertex) const
 
     std::size_t ret = 0;
 
-    htd::vertex_t currentVertex = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t currentVertex = implementation_->node(vertex)->parent;
 
     while (currentVertex != htd::Vertex::UNKNOWN)
     {
         ++ret;
 
-        currentVertex = implementation_->nodes_.at(currentVertex)->parent;
+        currentVertex = implementation_->node(currentVertex)->parent;
     }
 
     return ret;
@@ -783,7 +882,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    Implementation::Node & node = *(implementation_->node(vertex));
 
     auto end = implementation_->edges_->end();
 
@@ -795,7 +894,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
         {
             if (currentVertex != vertex)
             {
-                std::vector<htd::id_t> & currentEdges = implementation_->nodes_.at(currentVertex)->edges;
+                std::vector<htd::id_t> & currentEdges = implementation_->node(currentVertex)->edges;
 
                 /* Because 'currentVertex' is a neighbor of 'vertex' and 'position' points to the
                  * edge connecting the two vertices, std::lower_bound will always find the edge
@@ -814,7 +913,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 
     if (node.parent != htd::Vertex::UNKNOWN)
     {
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(node.parent));
+        Implementation::Node & parentNode = *(implementation_->node(node.parent));
 
         auto & siblings = parentNode.children;
 
@@ -828,7 +927,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 htd::vertex_t child = children[0];
 
-                Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+                Implementation::Node & childNode = *(implementation_->node(child));
 
                 childNode.parent = node.parent;
 
@@ -860,7 +959,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 for (htd::vertex_t child : children)
                 {
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+                    Implementation::Node & childNode = *(implementation_->node(child));
 
                     childNode.parent = node.parent;
 
@@ -891,7 +990,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             }
         }
 
-        implementation_->deleteNode(implementation_->nodes_.at(vertex));
+        implementation_->deleteNode(implementation_->node(vertex));
     }
     else
     {
@@ -903,7 +1002,13 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 
                 implementation_->size_ = 0;
 
-                implementation_->nodes_.clear();
+                implementation_->clearNodes();
+
+                for (htd::Hyperedge * edge : *(implementation_->edges_))
+                {
+                    delete edge;
+                }
+
                 implementation_->edges_->clear();
 
                 implementation_->vertices_.clear();
@@ -914,9 +1019,9 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 implementation_->root_ = children[0];
 
-                implementation_->nodes_.at(implementation_->root_)->parent = htd::Vertex::UNKNOWN;
+                implementation_->node(implementation_->root_)->parent = htd::Vertex::UNKNOWN;
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
+                implementation_->deleteNode(implementation_->node(vertex));
 
                 break;
             }
@@ -924,7 +1029,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 implementation_->root_ = children[0];
 
-                Implementation::Node & rootNode = *(implementation_->nodes_.at(implementation_->root_));
+                Implementation::Node & rootNode = *(implementation_->node(implementation_->root_));
 
                 rootNode.parent = htd::Vertex::UNKNOWN;
 
@@ -934,7 +1039,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
                 {
                     htd::vertex_t child = *it;
 
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+                    Implementation::Node & childNode = *(implementation_->node(child));
 
                     childNode.parent = implementation_->root_;
 
@@ -961,7 +1066,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
                     implementation_->next_edge_++;
                 }
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
+                implementation_->deleteNode(implementation_->node(vertex));
 
                 break;
             }
@@ -994,8 +1099,8 @@ htd::vertex_t htd::Tree::insertRoot(void)
 
         implementation_->next_vertex_ = implementation_->root_ + 1;
 
-        implementation_->nodes_.clear();
-        implementation_->nodes_.emplace(implementation_->root_, new Implementation::Node(implementation_->root_, htd::Vertex::UNKNOWN));
+        implementation_->clearNodes();
+        implementation_->createNode(implementation_->root_, htd::Vertex::UNKNOWN);
 
         implementation_->vertices_.emplace_back(implementation_->root_);
 
@@ -1049,15 +1154,13 @@ htd::vertex_t htd::Tree::addChild(htd::vertex_t vertex)
 
     htd::vertex_t ret = htd::Vertex::UNKNOWN;
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    Implementation::Node & node = *(implementation_->node(vertex));
 
     ret = implementation_->next_vertex_;
 
     node.children.emplace_back(ret);
 
-    Implementation::Node * newNode = new Implementation::Node(ret, vertex);
-
-    implementation_->nodes_.emplace(ret, newNode);
+    Implementation::Node * newNode = implementation_->createNode(ret, vertex);
 
     implementation_->vertices_.emplace_back(ret);
 
@@ -1081,7 +1184,7 @@ void htd::Tree::removeChild(htd::vertex_t vertex, htd::vertex_t child)
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    auto & node = *(implementation_->node(vertex));
 
     auto & children = node.children;
 
@@ -1112,18 +1215,16 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
     if (isRoot(vertex))
     {
-        auto & node = implementation_->nodes_.at(vertex);
+        Implementation::Node * node = implementation_->node(vertex);
 
         ret = implementation_->next_vertex_;
 
         node->parent = ret;
 
-        Implementation::Node * newRootNode = new Implementation::Node(ret, htd::Vertex::UNKNOWN);
+        Implementation::Node * newRootNode = implementation_->createNode(ret, htd::Vertex::UNKNOWN);
 
         newRootNode->children.emplace_back(vertex);
 
-        implementation_->nodes_.emplace(ret, newRootNode);
-
         implementation_->vertices_.emplace_back(ret);
 
         implementation_->next_vertex_++;
@@ -1136,8 +1237,8 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
     {
         htd::vertex_t parentVertex = parent(vertex);
 
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(parentVertex));
-        Implementation::Node & selectedNode = *(implementation_->nodes_.at(vertex));
+        Implementation::Node & parentNode = *(implementation_->node(parentVertex));
+        Implementation::Node & selectedNode = *(implementation_->node(vertex));
 
         htd::id_t oldHyperedge = htd::Id::UNKNOWN;
 
@@ -1170,7 +1271,7 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
         ret = htd::Tree::addChild(parentVertex);
 
-        auto & intermediateNode = *(implementation_->nodes_.at(ret));
+        auto & intermediateNode = *(implementation_->node(ret));
 
         intermediateNode.parent = parentVertex;
 
@@ -1188,8 +1289,8 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
     implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
 
-    implementation_->nodes_.at(vertex)->edges.push_back(implementation_->next_edge_);
-    implementation_->nodes_.at(ret)->edges.push_back(implementation_->next_edge_);
+    implementation_->node(vertex)->edges.push_back(implementation_->next_edge_);
+    implementation_->node(ret)->edges.push_back(implementation_->next_edge_);
 
     implementation_->next_edge_++;
 
@@ -1202,17 +1303,17 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
     HTD_ASSERT(isVertex(newParent))
     HTD_ASSERT(vertex != newParent)
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    auto & node = *(implementation_->node(vertex));
 
     htd::vertex_t oldParent = node.parent;
 
     if (oldParent != newParent)
     {
-        auto & newParentNode = *(implementation_->nodes_.at(newParent));
+        auto & newParentNode = *(implementation_->node(newParent));
 
         if (oldParent != htd::Vertex::UNKNOWN)
         {
-            auto & oldParentNode = *(implementation_->nodes_.at(oldParent));
+            auto & oldParentNode = *(implementation_->node(oldParent));
 
             oldParentNode.children.erase(std::find(oldParentNode.children.begin(), oldParentNode.children.end(), vertex));
 
@@ -1249,16 +1350,16 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
         {
             htd::vertex_t relevantVertex = newParent;
 
-            while (implementation_->nodes_.at(relevantVertex)->parent != vertex)
+            while (implementation_->node(relevantVertex)->parent != vertex)
             {
-                relevantVertex = implementation_->nodes_.at(relevantVertex)->parent;
+                relevantVertex = implementation_->node(relevantVertex)->parent;
             }
 
             std::cout << "RELEVANT: " << relevantVertex << std::endl;
 
             implementation_->root_ = relevantVertex;
 
-            auto & relevantNode = *(implementation_->nodes_.at(relevantVertex));
+            auto & relevantNode = *(implementation_->node(relevantVertex));
 
             relevantNode.parent = htd::Vertex::UNKNOWN;
 
@@ -1321,9 +1422,9 @@ std::size_t htd::Tree::leafCount(void) const HTD_NOEXCEPT
 {
     std::size_t ret = 0;
 
-    for (const auto & node : implementation_->nodes_)
+    for (const Implementation::Node * node : implementation_->nodes_)
     {
-        if (node.second->children.empty())
+        if (node != nullptr && node->children.empty())
         {
             ret++;
         }
@@ -1343,15 +1444,13 @@ htd::ConstCollection<htd::vertex_t> htd::Tree::leaves(void) const
 
 void htd::Tree::copyLeavesTo(std::vector<htd::vertex_t> & target) const
 {
-    for (const auto & node : implementation_->nodes_)
+    for (const Implementation::Node * node : implementation_->nodes_)
     {
-        if (node.second->children.empty())
+        if (node != nullptr && node->children.empty())
         {
-            target.emplace_back(node.first);
+            target.emplace_back(node->id);
         }
     }
-
-    std::sort(target.begin(), target.end());
 }
 
 htd::vertex_t htd::Tree::leafAtPosition(htd::index_t index) const
@@ -1371,20 +1470,20 @@ bool htd::Tree::isLeaf(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.empty();
+    return implementation_->node(vertex)->children.empty();
 }
 
 void htd::Tree::swapWithParent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    Implementation::Node & node = *(implementation_->node(vertex));
 
     htd::vertex_t parent = node.parent;
 
     HTD_ASSERT(parent != htd::Vertex::UNKNOWN)
 
-    Implementation::Node & parentNode = *(implementation_->nodes_.at(parent));
+    Implementation::Node & parentNode = *(implementation_->node(parent));
 
     node.parent = parentNode.parent;
 
@@ -1402,7 +1501,7 @@ void htd::Tree::swapWithParent(htd::vertex_t vertex)
     {
         htd::vertex_t grandParent = node.parent;
 
-        Implementation::Node & grandParentNode = *(implementation_->nodes_.at(grandParent));
+        Implementation::Node & grandParentNode = *(implementation_->node(grandParent));
 
         implementation_->updateEdgesAfterSwapWithParent(node, parentNode, grandParentNode);
 
@@ -1422,16 +1521,14 @@ void htd::Tree::Implementation::deleteNode(Node * node)
 
     if (parent != htd::Vertex::UNKNOWN)
     {
-        auto & children = nodes_.at(parent)->children;
+        auto & children = this->node(parent)->children;
 
         children.erase(std::lower_bound(children.begin(), children.end(), vertex));
     }
 
     vertices_.erase(std::lower_bound(vertices_.begin(), vertices_.end(), vertex));
 
-    nodes_.erase(vertex);
-
-    delete node;
+    releaseNode(node);
 
     size_--;
 }
@@ -1496,12 +1593,7 @@ htd::Tree & htd::Tree::operator=(const htd::Tree & original)
     {
         implementation_->reset();
 
-        implementation_->nodes_.reserve(original.implementation_->nodes_.size());
-
-        for (const auto & node : original.implementation_->nodes_)
-        {
-            implementation_->nodes_.emplace(node.first, new Implementation::Node(*(node.second)));
-        }
+        implementation_->copyNodes(*(original.implementation_));
 
         implementation_->root_ = original.implementation_->root_;
 
@@ -1555,19 +1647,17 @@ htd::Tree & htd::Tree::operator=(const htd::ITree & original)
 
                 if (original.isRoot(vertex))
                 {
-                    newNode = new Implementation::Node(vertex, htd::Vertex::UNKNOWN);
+                    newNode = implementation_->createNode(vertex, htd::Vertex::UNKNOWN);
                 }
                 else
                 {
-                    newNode = new Implementation::Node(vertex, original.parent(vertex));
+                    newNode = implementation_->createNode(vertex, original.parent(vertex));
                 }
 
                 const htd::ConstCollection<htd::vertex_t> & childCollection = original.children(vertex);
 
                 std::copy(childCollection.begin(), childCollection.end(), std::back_inserter(newNode->children));
 
-                implementation_->nodes_.emplace(vertex, newNode);
-
                 if (vertex > maximumVertex)
                 {
                     maximumVertex = vertex;
@@ -1588,6 +1678,11 @@ htd::Tree & htd::Tree::operator=(const htd::ITree & original)
             for (auto it = originalEdges.begin(); it != originalEdges.end(); ++it)
             {
                 implementation_->edges_->push_back(new htd::Hyperedge(*it));
+
+                for (htd::vertex_t vertex : *it)
+                {
+                    implementation_->node(vertex)->edges.push_back(it->id());
+                }
             }
 
             if (!implementation_->edges_->empty())
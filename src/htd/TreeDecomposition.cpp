@@ -48,26 +48,18 @@ htd::TreeDecomposition::TreeDecomposition(const htd::TreeDecomposition & origina
 
 htd::TreeDecomposition::TreeDecomposition(const htd::ITree & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_()
 {
-    for (htd::vertex_t vertex : original.vertices())
-    {
-        bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
-
-        inducedEdges_.emplace(vertex, htd::FilteredHyperedgeCollection());
-    }
+    reserveNodeInformation(nextVertex() - 1);
 }
 
 htd::TreeDecomposition::TreeDecomposition(const htd::ILabeledTree & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_()
 {
-    for (htd::vertex_t vertex : original.vertices())
-    {
-        bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
-
-        inducedEdges_.emplace(vertex, htd::FilteredHyperedgeCollection());
-    }
+    reserveNodeInformation(nextVertex() - 1);
 }
 
 htd::TreeDecomposition::TreeDecomposition(const htd::ITreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_()
 {
+    reserveNodeInformation(nextVertex() - 1);
+
     for (htd::vertex_t vertex : original.vertices())
     {
         bagContent_[vertex] = original.bagContent(vertex);
@@ -85,9 +77,7 @@ void htd::TreeDecomposition::removeVertex(htd::vertex_t vertex)
 {
     htd::Tree::removeVertex(vertex);
 
-    bagContent_.erase(vertex);
-
-    inducedEdges_.erase(vertex);
+    clearNodeInformation(vertex);
 }
 
 void htd::TreeDecomposition::removeSubtree(htd::vertex_t subtreeRoot)
@@ -101,9 +91,7 @@ void htd::TreeDecomposition::removeSubtree(htd::vertex_t subtreeRoot)
         HTD_UNUSED(parent)
         HTD_UNUSED(distanceToSubtreeRoot)
 
-        bagContent_.erase(vertex);
-
-        inducedEdges_.erase(vertex);
+        clearNodeInformation(vertex);
     }, subtreeRoot);
 
     htd::Tree::removeSubtree(subtreeRoot);
@@ -117,9 +105,7 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(void)
 
     if (inserted)
     {
-        bagContent_.emplace(ret, std::vector<htd::vertex_t>());
-
-        inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
+        reserveNodeInformation(ret);
     }
 
     return ret;
@@ -133,6 +119,8 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(const std::vector<htd::vertex_t
 
     if (inserted)
     {
+        reserveNodeInformation(ret);
+
         bagContent_[ret] = bagContent;
 
         inducedEdges_[ret] = inducedEdges;
@@ -149,9 +137,11 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(std::vector<htd::vertex_t> && b
 
     if (inserted)
     {
-        bagContent_.emplace(ret, std::move(bagContent));
+        reserveNodeInformation(ret);
+
+        bagContent_[ret] = std::move(bagContent);
 
-        inducedEdges_.emplace(ret, std::move(inducedEdges));
+        inducedEdges_[ret] = std::move(inducedEdges);
     }
 
     return ret;
@@ -161,9 +151,7 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex)
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
 
-    bagContent_.emplace(ret, std::vector<htd::vertex_t>());
-
-    inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
+    reserveNodeInformation(ret);
 
     return ret;
 }
@@ -172,6 +160,8 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex, const std::
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
 
+    reserveNodeInformation(ret);
+
     bagContent_[ret] = bagContent;
 
     inducedEdges_[ret] = inducedEdges;
@@ -183,9 +173,11 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex, std::vector
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
 
-    bagContent_.emplace(ret, std::move(bagContent));
+    reserveNodeInformation(ret);
+
+    bagContent_[ret] = std::move(bagContent);
 
-    inducedEdges_.emplace(ret, std::move(inducedEdges));
+    inducedEdges_[ret] = std::move(inducedEdges);
 
     return ret;
 }
@@ -194,9 +186,7 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex)
 {
     htd::vertex_t ret = htd::Tree::addParent(vertex);
 
-    bagContent_.emplace(ret, std::vector<htd::vertex_t>());
-
-    inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
+    reserveNodeInformation(ret);
 
     return ret;
 }
@@ -205,6 +195,8 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex, const std:
 {
     htd::vertex_t ret = htd::Tree::addParent(vertex);
 
+    reserveNodeInformation(ret);
+
     bagContent_[ret] = bagContent;
 
     inducedEdges_[ret] = inducedEdges;
@@ -216,9 +208,11 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex, std::vecto
 {
     htd::vertex_t ret = htd::Tree::addParent(vertex);
 
-    bagContent_.emplace(ret, std::move(bagContent));
+    reserveNodeInformation(ret);
 
-    inducedEdges_.emplace(ret, std::move(inducedEdges));
+    bagContent_[ret] = std::move(bagContent);
+
+    inducedEdges_[ret] = std::move(inducedEdges);
 
     return ret;
 }
@@ -227,9 +221,7 @@ void htd::TreeDecomposition::removeChild(htd::vertex_t vertex, htd::vertex_t chi
 {
     htd::Tree::removeChild(vertex, child);
 
-    bagContent_.erase(child);
-
-    inducedEdges_.erase(child);
+    clearNodeInformation(child);
 }
 
 std::size_t htd::TreeDecomposition::joinNodeCount(void) const
@@ -516,35 +508,60 @@ std::size_t htd::TreeDecomposition::bagSize(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex).size();
+    if (!isVertex(vertex))
+    {
+        throw std::out_of_range("std::size_t htd::TreeDecomposition::bagSize(htd::vertex_t vertex) const");
+    }
+
+    return bagContent_[vertex].size();
 }
 
 std::vector<htd::vertex_t> & htd::TreeDecomposition::mutableBagContent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    if (!isVertex(vertex))
+    {
+        throw std::out_of_range("std::vector<htd::vertex_t> & htd::TreeDecomposition::mutableBagContent(htd::vertex_t vertex)");
+    }
+
+    return bagContent_[vertex];
 }
 
 const std::vector<htd::vertex_t> & htd::TreeDecomposition::bagContent(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    if (!isVertex(vertex))
+    {
+        throw std::out_of_range("const std::vector<htd::vertex_t> & htd::TreeDecomposition::bagContent(htd::vertex_t vertex) const");
+    }
+
+    return bagContent_[vertex];
 }
 
 htd::FilteredHyperedgeCollection & htd::TreeDecomposition::mutableInducedHyperedges(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return inducedEdges_.at(vertex);
+    if (!isVertex(vertex))
+    {
+        throw std::out_of_range("htd::FilteredHyperedgeCollection & htd::TreeDecomposition::mutableInducedHyperedges(htd::vertex_t vertex)");
+    }
+
+    return inducedEdges_[vertex];
 }
 
 const htd::FilteredHyperedgeCollection & htd::TreeDecomposition::inducedHyperedges(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return inducedEdges_.at(vertex);
+    if (!isVertex(vertex))
+    {
+        throw std::out_of_range("const htd::FilteredHyperedgeCollection & htd::TreeDecomposition::inducedHyperedges(htd::vertex_t vertex) const");
+    }
+
+    return inducedEdges_[vertex];
 }
 
 std::size_t htd::TreeDecomposition::minimumBagSize(void) const
@@ -999,6 +1016,40 @@ void htd::TreeDecomposition::getChildBagSetUnion(htd::vertex_t vertex, std::vect
     }
 }
 
+void htd::TreeDecomposition::removeObsoleteNodeInformation(void)
+{
+    std::size_t size = nextVertex();
+
+    bagContent_.resize(size);
+
+    inducedEdges_.resize(size);
+
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        if (!isVertex(vertex) && (!bagContent_[vertex].empty() || inducedEdges_[vertex].size() > 0))
+        {
+            clearNodeInformation(vertex);
+        }
+    }
+}
+
+void htd::TreeDecomposition::reserveNodeInformation(htd::vertex_t vertex)
+{
+    if (vertex >= bagContent_.size())
+    {
+        bagContent_.resize(vertex + 1);
+
+        inducedEdges_.resize(vertex + 1);
+    }
+}
+
+void htd::TreeDecomposition::clearNodeInformation(htd::vertex_t vertex)
+{
+    std::vector<htd::vertex_t>().swap(bagContent_[vertex]);
+
+    inducedEdges_[vertex] = htd::FilteredHyperedgeCollection();
+}
+
 htd::TreeDecomposition * htd::TreeDecomposition::clone(void) const
 {
     return new htd::TreeDecomposition(*this);
@@ -1087,6 +1138,8 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::TreeDecomp
     {
         htd::LabeledTree::operator=(original);
 
+        removeObsoleteNodeInformation();
+
         for (htd::vertex_t vertex : original.vertexVector())
         {
             bagContent_[vertex] = original.bagContent(vertex);
@@ -1104,6 +1157,8 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ITree & or
     {
         htd::LabeledTree::operator=(original);
 
+        removeObsoleteNodeInformation();
+
         for (htd::vertex_t vertex : original.vertices())
         {
             bagContent_[vertex] = std::vector<htd::vertex_t>();
@@ -1121,6 +1176,8 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ILabeledTr
     {
         htd::LabeledTree::operator=(original);
 
+        removeObsoleteNodeInformation();
+
         for (htd::vertex_t vertex : original.vertices())
         {
             bagContent_[vertex] = std::vector<htd::vertex_t>();
@@ -1138,6 +1195,8 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ITreeDecom
     {
         htd::LabeledTree::operator=(original);
 
+        removeObsoleteNodeInformation();
+
         for (htd::vertex_t vertex : original.vertices())
         {
             bagContent_[vertex] = original.bagContent(vertex);
@@ -30,8 +30,11 @@
 #include <htd/TreeDecompositionOptimizationOperation.hpp>
 #include <htd/ExhaustiveVertexSelectionStrategy.hpp>
 #include <htd/CompressionOperation.hpp>
+#include <htd/IRerootableTreeDecompositionFitnessFunction.hpp>
+#include <htd/ThreadPool.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <stack>
 #include <unordered_set>
 
@@ -46,7 +49,7 @@ struct htd::TreeDecompositionOptimizationOperation::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), enforceNaiveOptimization_(false), strategy_(nullptr), fitnessFunction_(nullptr), manipulationOperations_()
+        : managementInstance_(manager), enforceNaiveOptimization_(false), strategy_(nullptr), fitnessFunction_(nullptr), manipulationOperations_(), threadCount_(1)
     {
 
     }
@@ -59,7 +62,7 @@ struct htd::TreeDecompositionOptimizationOperation::Implementation
      *  @param[in] enforceNaiveOptimization A boolean flag to enforce that each iteration of the optimization algorithm starts from scratch with a copy of the given decomposition.
      */
     Implementation(const htd::LibraryInstance * const manager, htd::ITreeDecompositionFitnessFunction * fitnessFunction, bool enforceNaiveOptimization)
-        : managementInstance_(manager), enforceNaiveOptimization_(enforceNaiveOptimization), strategy_(new htd::ExhaustiveVertexSelectionStrategy()), fitnessFunction_(fitnessFunction), manipulationOperations_()
+        : managementInstance_(manager), enforceNaiveOptimization_(enforceNaiveOptimization), strategy_(new htd::ExhaustiveVertexSelectionStrategy()), fitnessFunction_(fitnessFunction), manipulationOperations_(), threadCount_(1)
     {
 
     }
@@ -108,6 +111,11 @@ struct htd::TreeDecompositionOptimizationOperation::Implementation
      */
     std::vector<htd::ITreeDecompositionManipulationOperation *> manipulationOperations_;
 
+    /**
+     *  The number of threads which shall be used to evaluate the candidate roots during naive optimization.
+     */
+    std::size_t threadCount_;
+
     /**
      *  Check whether a manipulation operation does not involve any operations which make it impossible
      *  to undo the operation for the path between the new and the old root by just deleting the added
@@ -127,6 +135,15 @@ struct htd::TreeDecompositionOptimizationOperation::Implementation
      */
     void quickOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition) const;
 
+    /**
+     *  Select the optimal root of the given decomposition when no manipulation operations are involved and the fitness function supports rerooting.
+     *
+     *  @param[in] graph            The graph which was decomposed.
+     *  @param[in] decomposition    The tree decomposition which shall be optimized.
+     *  @param[in] fitnessFunction  The rerootable fitness function which is used to determine the quality of tree decompositions.
+     */
+    void rerootingOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const htd::IRerootableTreeDecompositionFitnessFunction & fitnessFunction) const;
+
     /**
      *  Select the optimal root of the given decomposition when complex manipulation operations are involved.
      *
@@ -216,7 +233,16 @@ void htd::TreeDecompositionOptimizationOperation::apply(const htd::IMultiHypergr
         {
             if (implementation_->manipulationOperations_.empty())
             {
-                implementation_->quickOptimization(graph, decomposition);
+                const htd::IRerootableTreeDecompositionFitnessFunction * rerootableFitnessFunction = dynamic_cast<const htd::IRerootableTreeDecompositionFitnessFunction *>(implementation_->fitnessFunction_);
+
+                if (rerootableFitnessFunction != nullptr)
+                {
+                    implementation_->rerootingOptimization(graph, decomposition, *rerootableFitnessFunction);
+                }
+                else
+                {
+                    implementation_->quickOptimization(graph, decomposition);
+                }
             }
             else
             {
@@ -357,6 +383,16 @@ void htd::TreeDecompositionOptimizationOperation::setVertexSelectionStrategy(htd
     implementation_->strategy_ = strategy;
 }
 
+std::size_t htd::TreeDecompositionOptimizationOperation::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::TreeDecompositionOptimizationOperation::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 void htd::TreeDecompositionOptimizationOperation::Implementation::quickOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition) const
 {
     const htd::ITreeDecompositionFitnessFunction & fitnessFunction = *fitnessFunction_;
@@ -405,6 +441,157 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::quickOptimizat
     delete optimalFitness;
 }
 
+void htd::TreeDecompositionOptimizationOperation::Implementation::rerootingOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const htd::IRerootableTreeDecompositionFitnessFunction & fitnessFunction) const
+{
+    htd::vertex_t initialRoot = decomposition.root();
+
+    std::vector<htd::vertex_t> candidates;
+
+    strategy_->selectVertices(decomposition, candidates);
+
+    /* Enumerate the nodes in breadth-first order from the initial root, so that the children of each node occupy consecutive positions. */
+    std::vector<htd::vertex_t> nodes;
+
+    std::vector<htd::index_t> firstChildren;
+
+    std::vector<std::size_t> childCounts;
+
+    std::vector<htd::vertex_t> children;
+
+    nodes.reserve(decomposition.vertexCount());
+
+    nodes.push_back(initialRoot);
+
+    for (htd::index_t position = 0; position < nodes.size(); ++position)
+    {
+        decomposition.copyChildrenTo(nodes[position], children);
+
+        firstChildren.push_back(nodes.size());
+
+        childCounts.push_back(children.size());
+
+        nodes.insert(nodes.end(), children.begin(), children.end());
+
+        children.clear();
+    }
+
+    std::size_t nodeCount = nodes.size();
+
+    std::vector<htd::index_t> positions(*std::max_element(nodes.begin(), nodes.end()) + 1, 0);
+
+    for (htd::index_t position = 0; position < nodeCount; ++position)
+    {
+        positions[nodes[position]] = position;
+    }
+
+    /* First pass: The summary of the subtree below each node with respect to the initial root. */
+    std::vector<std::vector<double>> downwardSummaries(nodeCount);
+
+    std::vector<double> aggregate;
+
+    for (htd::index_t position = nodeCount; position > 0;)
+    {
+        --position;
+
+        fitnessFunction.initializeAggregate(aggregate);
+
+        for (htd::index_t child = firstChildren[position]; child < firstChildren[position] + childCounts[position]; ++child)
+        {
+            fitnessFunction.combine(aggregate, downwardSummaries[child]);
+        }
+
+        fitnessFunction.computeSubtreeSummary(graph, decomposition, nodes[position], aggregate, downwardSummaries[position]);
+    }
+
+    /* Second pass: The summary of the part of the tree above each node and the summary of the whole tree rooted at each node. */
+    std::vector<std::vector<double>> upwardSummaries(nodeCount);
+
+    std::vector<std::vector<double>> rootSummaries(nodeCount);
+
+    std::vector<std::vector<double>> prefixAggregates;
+
+    std::vector<std::vector<double>> suffixAggregates;
+
+    for (htd::index_t position = 0; position < nodeCount; ++position)
+    {
+        htd::index_t firstChild = firstChildren[position];
+
+        std::size_t childCount = childCounts[position];
+
+        std::size_t neighborCount = position > 0 ? childCount + 1 : childCount;
+
+        const std::vector<double> & upwardSummary = upwardSummaries[position];
+
+        if (prefixAggregates.size() < neighborCount + 1)
+        {
+            prefixAggregates.resize(neighborCount + 1);
+
+            suffixAggregates.resize(neighborCount + 1);
+        }
+
+        fitnessFunction.initializeAggregate(prefixAggregates[0]);
+
+        fitnessFunction.initializeAggregate(suffixAggregates[neighborCount]);
+
+        for (htd::index_t index = 0; index < neighborCount; ++index)
+        {
+            prefixAggregates[index + 1] = prefixAggregates[index];
+
+            fitnessFunction.combine(prefixAggregates[index + 1], index < childCount ? downwardSummaries[firstChild + index] : upwardSummary);
+        }
+
+        for (htd::index_t index = neighborCount; index > 0; --index)
+        {
+            suffixAggregates[index - 1] = suffixAggregates[index];
+
+            fitnessFunction.combine(suffixAggregates[index - 1], index - 1 < childCount ? downwardSummaries[firstChild + index - 1] : upwardSummary);
+        }
+
+        fitnessFunction.computeSubtreeSummary(graph, decomposition, nodes[position], prefixAggregates[neighborCount], rootSummaries[position]);
+
+        for (htd::index_t index = 0; index < childCount; ++index)
+        {
+            aggregate = prefixAggregates[index];
+
+            fitnessFunction.combine(aggregate, suffixAggregates[index + 1]);
+
+            fitnessFunction.computeSubtreeSummary(graph, decomposition, nodes[position], aggregate, upwardSummaries[firstChild + index]);
+        }
+    }
+
+    htd::vertex_t optimalRoot = initialRoot;
+
+    htd::FitnessEvaluation * optimalFitness = fitnessFunction.rootedFitness(graph, decomposition, initialRoot, rootSummaries[0]);
+
+    HTD_ASSERT(optimalFitness != nullptr)
+
+    for (auto it = candidates.begin(); it != candidates.end() && !managementInstance_->isTerminated(); ++it)
+    {
+        htd::vertex_t vertex = *it;
+
+        htd::FitnessEvaluation * currentFitness = fitnessFunction.rootedFitness(graph, decomposition, vertex, rootSummaries[positions[vertex]]);
+
+        HTD_ASSERT(currentFitness != nullptr)
+
+        if (*currentFitness > *optimalFitness)
+        {
+            delete optimalFitness;
+
+            optimalFitness = currentFitness;
+
+            optimalRoot = vertex;
+        }
+        else
+        {
+            delete currentFitness;
+        }
+    }
+
+    decomposition.makeRoot(optimalRoot);
+
+    delete optimalFitness;
+}
+
 void htd::TreeDecompositionOptimizationOperation::Implementation::naiveOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
 {
     const htd::ITreeDecompositionFitnessFunction & fitnessFunction = *fitnessFunction_;
@@ -444,45 +631,117 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::naiveOptimizat
 
     HTD_ASSERT(optimalFitness != nullptr)
 
-    for (auto it = candidates.begin(); it != candidates.end() && !managementInstance_->isTerminated(); ++it)
-    {
-        htd::vertex_t vertex = *it;
+    std::vector<std::unique_ptr<htd::FitnessEvaluation>> candidateFitness(candidates.size());
 
-        if (vertex != initialRoot)
+    std::atomic<std::size_t> nextCandidate(0);
+
+    /* Each worker resets its own decomposition from the original one instead of allocating a fresh clone per candidate. */
+    auto worker = [&](const std::vector<htd::ITreeDecompositionManipulationOperation *> & operations, const htd::ITreeDecompositionFitnessFunction & currentFitnessFunction, htd::IMutableTreeDecomposition & pooledDecomposition)
+    {
+        for (std::size_t index = nextCandidate++; index < candidates.size() && !managementInstance_->isTerminated(); index = nextCandidate++)
         {
-            delete localDecomposition;
+            htd::vertex_t vertex = candidates[index];
 
+            if (vertex != initialRoot)
+            {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-            localDecomposition = decomposition.clone();
+                pooledDecomposition = static_cast<const htd::ITreeDecomposition &>(decomposition);
 #else
-            localDecomposition = decomposition.cloneMutableTreeDecomposition();
+                pooledDecomposition.assign(decomposition);
 #endif
 
-            localDecomposition->makeRoot(vertex);
+                pooledDecomposition.makeRoot(vertex);
 
-            for (const htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
-            {
-                operation->apply(graph, *localDecomposition, labelingFunctions);
+                for (const htd::ITreeDecompositionManipulationOperation * operation : operations)
+                {
+                    operation->apply(graph, pooledDecomposition, labelingFunctions);
+                }
+
+                candidateFitness[index].reset(currentFitnessFunction.fitness(graph, pooledDecomposition));
+
+                HTD_ASSERT(candidateFitness[index] != nullptr)
             }
+        }
+    };
 
-            htd::FitnessEvaluation * currentFitness = fitnessFunction.fitness(graph, *localDecomposition);
+    std::size_t threadCount = std::min(htd::ThreadPool::effectiveThreadCount(threadCount_), candidates.size());
 
-            HTD_ASSERT(currentFitness != nullptr)
+    if (threadCount > 1)
+    {
+        std::vector<std::vector<htd::ITreeDecompositionManipulationOperation *>> workerOperations(threadCount);
 
-            if (*currentFitness > *optimalFitness)
+        std::vector<std::unique_ptr<htd::ITreeDecompositionFitnessFunction>> workerFitnessFunctions;
+
+        std::vector<std::unique_ptr<htd::IMutableTreeDecomposition>> workerDecompositions;
+
+        workerOperations[0] = clonedManipulationOperations;
+
+        for (std::size_t thread = 1; thread < threadCount; ++thread)
+        {
+            for (const htd::ITreeDecompositionManipulationOperation * operation : manipulationOperations_)
             {
-                delete optimalFitness;
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                htd::ITreeDecompositionManipulationOperation * clone = operation->clone();
+#else
+                htd::ITreeDecompositionManipulationOperation * clone = operation->cloneTreeDecompositionManipulationOperation();
+#endif
 
-                optimalFitness = currentFitness;
+                clone->setManagementInstance(managementInstance_);
 
-                optimalRoot = vertex;
+                workerOperations[thread].push_back(clone);
             }
-            else
+
+            workerFitnessFunctions.emplace_back(fitnessFunction.clone());
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            workerDecompositions.emplace_back(decomposition.clone());
+#else
+            workerDecompositions.emplace_back(decomposition.cloneMutableTreeDecomposition());
+#endif
+        }
+
+        htd::ThreadPool threadPool(threadCount);
+
+        threadPool.submit([&]()
+        {
+            worker(workerOperations[0], fitnessFunction, *localDecomposition);
+        });
+
+        for (std::size_t thread = 1; thread < threadCount; ++thread)
+        {
+            threadPool.submit([&, thread]()
             {
-                delete currentFitness;
+                worker(workerOperations[thread], *(workerFitnessFunctions[thread - 1]), *(workerDecompositions[thread - 1]));
+            });
+        }
+
+        threadPool.wait();
+
+        for (std::size_t thread = 1; thread < threadCount; ++thread)
+        {
+            for (const htd::ITreeDecompositionManipulationOperation * operation : workerOperations[thread])
+            {
+                delete operation;
             }
         }
     }
+    else
+    {
+        worker(clonedManipulationOperations, fitnessFunction, *localDecomposition);
+    }
+
+    /* Reduce in candidate order, so that ties are broken exactly as in a sequential evaluation. */
+    for (std::size_t index = 0; index < candidates.size(); ++index)
+    {
+        if (candidateFitness[index] != nullptr && *(candidateFitness[index]) > *optimalFitness)
+        {
+            delete optimalFitness;
+
+            optimalFitness = candidateFitness[index].release();
+
+            optimalRoot = candidates[index];
+        }
+    }
 
     delete localDecomposition;
 
@@ -764,6 +1023,8 @@ htd::TreeDecompositionOptimizationOperation * htd::TreeDecompositionOptimization
 #endif
     }
 
+    ret->setThreadCount(implementation_->threadCount_);
+
     return ret;
 }
 
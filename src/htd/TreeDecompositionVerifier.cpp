@@ -28,15 +28,184 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/TreeDecompositionVerifier.hpp>
-#include <htd/PostOrderTreeTraversal.hpp>
+#include <htd/ThreadPool.hpp>
 #include <htd/VectorAdapter.hpp>
 
-#include <map>
 #include <algorithm>
-#include <unordered_set>
-#include <unordered_map>
+#include <atomic>
+#include <functional>
 
-htd::TreeDecompositionVerifier::TreeDecompositionVerifier(void)
+/**
+ *  Private implementation details of class htd::TreeDecompositionVerifier.
+ */
+struct htd::TreeDecompositionVerifier::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     */
+    Implementation(void) : threadCount_(1)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  Index storing for each vertex the positions of the nodes of a tree decomposition whose bags contain the vertex.
+     */
+    struct OccurrenceIndex
+    {
+        /**
+         *  The bag contents of the nodes of the decomposition, ordered by the positions of the nodes.
+         */
+        std::vector<const std::vector<htd::vertex_t> *> bags_;
+
+        /**
+         *  The positions of the parents of the nodes of the decomposition (NO_PARENT for the root).
+         */
+        std::vector<htd::index_t> parents_;
+
+        /**
+         *  The offsets of the occurrence lists of the vertices within the vector occurrences_.
+         */
+        std::vector<htd::index_t> offsets_;
+
+        /**
+         *  The concatenated occurrence lists of the vertices. Each list is sorted in ascending order.
+         */
+        std::vector<htd::index_t> occurrences_;
+
+        /**
+         *  Getter for the number of nodes whose bags contain the given vertex.
+         *
+         *  @param[in] vertex   The vertex in question.
+         *
+         *  @return The number of nodes whose bags contain the given vertex.
+         */
+        std::size_t occurrenceCount(htd::vertex_t vertex) const
+        {
+            return vertex + 1 < offsets_.size() ? offsets_[vertex + 1] - offsets_[vertex] : 0;
+        }
+    };
+
+    /**
+     *  The number of threads which shall be used to check the hyperedge coverage and the connectedness criterion.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The parent position stored for the root of the decomposition.
+     */
+    static constexpr htd::index_t NO_PARENT = (htd::index_t)-1;
+
+    /**
+     *  Build the occurrence index of the given tree decomposition.
+     *
+     *  @param[in] decomposition    The tree decomposition which shall be indexed.
+     *  @param[out] index           The occurrence index of the tree decomposition.
+     */
+    void buildOccurrenceIndex(const htd::ITreeDecomposition & decomposition, OccurrenceIndex & index) const
+    {
+        const htd::ConstCollection<htd::vertex_t> & nodes = decomposition.vertices();
+
+        htd::vertex_t maximumNode = 0;
+
+        htd::vertex_t maximumVertex = 0;
+
+        for (htd::vertex_t node : nodes)
+        {
+            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+
+            index.bags_.push_back(&bag);
+
+            maximumNode = std::max(maximumNode, node);
+
+            if (!bag.empty())
+            {
+                maximumVertex = std::max(maximumVertex, bag.back());
+            }
+        }
+
+        std::vector<htd::index_t> positions(maximumNode + 1, 0);
+
+        htd::index_t position = 0;
+
+        for (htd::vertex_t node : nodes)
+        {
+            positions[node] = position;
+
+            ++position;
+        }
+
+        index.parents_.reserve(index.bags_.size());
+
+        for (htd::vertex_t node : nodes)
+        {
+            index.parents_.push_back(decomposition.isRoot(node) ? static_cast<htd::index_t>(NO_PARENT) : positions[decomposition.parent(node)]);
+        }
+
+        index.offsets_.assign(maximumVertex + 2, 0);
+
+        for (const std::vector<htd::vertex_t> * bag : index.bags_)
+        {
+            for (htd::vertex_t vertex : *bag)
+            {
+                ++(index.offsets_[vertex + 1]);
+            }
+        }
+
+        for (htd::index_t vertex = 1; vertex < index.offsets_.size(); ++vertex)
+        {
+            index.offsets_[vertex] += index.offsets_[vertex - 1];
+        }
+
+        index.occurrences_.resize(index.offsets_.back());
+
+        std::vector<htd::index_t> nextPositions(index.offsets_.begin(), index.offsets_.end() - 1);
+
+        for (htd::index_t node = 0; node < index.bags_.size(); ++node)
+        {
+            for (htd::vertex_t vertex : *(index.bags_[node]))
+            {
+                index.occurrences_[nextPositions[vertex]] = node;
+
+                ++(nextPositions[vertex]);
+            }
+        }
+    }
+
+    /**
+     *  Execute the given worker function, either directly or concurrently by the configured number of threads.
+     *
+     *  @param[in] taskCount    The number of independent tasks processed by the worker function.
+     *  @param[in] worker       The worker function. It pulls the tasks from a shared counter.
+     */
+    void run(std::size_t taskCount, const std::function<void(void)> & worker) const
+    {
+        std::size_t threadCount = std::min(htd::ThreadPool::effectiveThreadCount(threadCount_), taskCount);
+
+        if (threadCount > 1)
+        {
+            htd::ThreadPool threadPool(threadCount);
+
+            for (std::size_t thread = 0; thread < threadCount; ++thread)
+            {
+                threadPool.submit(worker);
+            }
+
+            threadPool.wait();
+        }
+        else
+        {
+            worker();
+        }
+    }
+};
+
+htd::TreeDecompositionVerifier::TreeDecompositionVerifier(void) : implementation_(new Implementation())
 {
     
 }
@@ -75,23 +244,30 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecompositionVerifier::violationsVe
 
     auto & result = ret.container();
 
-    bool ok = false;
+    std::vector<bool> coveredVertices;
 
-    std::unordered_set<htd::vertex_t> missingVertices(graph.vertices().begin(), graph.vertices().end());
-    
-    for (auto it1 = decomposition.vertices().begin(); !ok && it1 != decomposition.vertices().end(); it1++)
+    for (htd::vertex_t node : decomposition.vertices())
     {
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(*it1);
+        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
 
-        for (auto it2 = bag.begin(); !ok && it2 != bag.end(); it2++)
+        if (!bag.empty() && bag.back() >= coveredVertices.size())
         {
-            missingVertices.erase(*it2);
-            
-            ok = missingVertices.empty();
+            coveredVertices.resize(bag.back() + 1, false);
+        }
+
+        for (htd::vertex_t vertex : bag)
+        {
+            coveredVertices[vertex] = true;
         }
     }
 
-    std::copy(missingVertices.begin(), missingVertices.end(), std::back_inserter(result));
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        if (vertex >= coveredVertices.size() || !coveredVertices[vertex])
+        {
+            result.push_back(vertex);
+        }
+    }
 
     std::sort(result.begin(), result.end());
 
@@ -104,138 +280,146 @@ htd::ConstCollection<htd::Hyperedge> htd::TreeDecompositionVerifier::violationsH
 
     auto & result = ret.container();
 
-    bool ok = false;
+    Implementation::OccurrenceIndex index;
 
-    std::size_t edgeCount = graph.edgeCount();
+    implementation_->buildOccurrenceIndex(decomposition, index);
 
-    std::unordered_set<htd::id_t> missingEdges(edgeCount);
-
-    std::vector<htd::id_t> identifiers(edgeCount);
-
-    std::vector<std::vector<htd::vertex_t>> sortedEdges(edgeCount);
+    const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
 
-    htd::index_t index = 0;
+    std::vector<const htd::Hyperedge *> edges;
 
-    const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
+    edges.reserve(graph.edgeCount());
 
     for (const htd::Hyperedge & hyperedge : hyperedges)
     {
-        std::vector<htd::vertex_t> & elements = sortedEdges[index];
-
-        std::copy(hyperedge.sortedElements().begin(), hyperedge.sortedElements().end(), std::back_inserter(elements));
-
-        identifiers[index] = hyperedge.id();
-
-        missingEdges.insert(hyperedge.id());
-
-        index++;
+        edges.push_back(&hyperedge);
     }
 
-    htd::PostOrderTreeTraversal treeTraversal;
+    std::vector<char> missing(edges.size(), 0);
 
-    treeTraversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
-    {
-        HTD_UNUSED(parent)
-        HTD_UNUSED(distanceToSubtreeRoot)
+    std::atomic<std::size_t> nextEdge(0);
 
-        if (!ok)
+    implementation_->run(edges.size(), [&]()
+    {
+        for (std::size_t position = nextEdge++; position < edges.size(); position = nextEdge++)
         {
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+            const std::vector<htd::vertex_t> & elements = edges[position]->sortedElements();
 
-            index = 0;
-
-            while (!ok && index < edgeCount)
+            if (elements.empty())
             {
-                htd::id_t id = identifiers[index];
+                missing[position] = index.bags_.empty();
+
+                continue;
+            }
 
-                const std::vector<htd::vertex_t> & edge = sortedEdges[index];
+            /* A bag covering the hyperedge contains each of its vertices, so it suffices to inspect the bags of the rarest one. */
+            htd::vertex_t rarestVertex = elements[0];
 
-                if (missingEdges.count(id) > 0 && std::includes(bag.begin(), bag.end(), edge.begin(), edge.end()))
+            for (htd::vertex_t vertex : elements)
+            {
+                if (index.occurrenceCount(vertex) < index.occurrenceCount(rarestVertex))
                 {
-                    missingEdges.erase(id);
+                    rarestVertex = vertex;
                 }
+            }
+
+            bool covered = false;
 
-                ok = missingEdges.empty();
+            std::size_t occurrenceCount = index.occurrenceCount(rarestVertex);
 
-                ++index;
+            for (std::size_t occurrence = 0; !covered && occurrence < occurrenceCount; ++occurrence)
+            {
+                const std::vector<htd::vertex_t> & bag = *(index.bags_[index.occurrences_[index.offsets_[rarestVertex] + occurrence]]);
+
+                covered = std::includes(bag.begin(), bag.end(), elements.begin(), elements.end());
             }
+
+            missing[position] = !covered;
         }
     });
 
-    if (!ok)
+    for (std::size_t position = 0; position < edges.size(); ++position)
     {
-        index = 0;
-
-        for (const htd::Hyperedge & hyperedge : hyperedges)
+        if (missing[position])
         {
-            if (missingEdges.count(static_cast<htd::id_t>(index)) > 0)
-            {
-                result.push_back(hyperedge);
-            }
-
-            ++index;
+            result.push_back(*(edges[position]));
         }
-
-        std::sort(result.begin(), result.end());
     }
 
+    std::sort(result.begin(), result.end());
+
     return htd::ConstCollection<htd::Hyperedge>::getInstance(ret);
 }
 
 htd::ConstCollection<htd::vertex_t> htd::TreeDecompositionVerifier::violationsConnectednessCriterion(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition) const
 {
+    HTD_UNUSED(graph)
+
     htd::VectorAdapter<htd::vertex_t> ret;
 
     auto & result = ret.container();
 
-    std::unordered_set<htd::vertex_t> forgottenVertices(graph.vertexCount());
+    Implementation::OccurrenceIndex index;
 
-    htd::PostOrderTreeTraversal treeTraversal;
+    implementation_->buildOccurrenceIndex(decomposition, index);
 
-    std::vector<htd::vertex_t> forgottenBagContent;
+    std::size_t vertexCount = index.offsets_.empty() ? 0 : index.offsets_.size() - 1;
 
-    treeTraversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
-    {
-        HTD_UNUSED(distanceToSubtreeRoot)
+    std::vector<char> disconnected(vertexCount, 0);
 
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+    std::atomic<std::size_t> nextVertex(0);
 
-        if (parent != htd::Vertex::UNKNOWN)
+    implementation_->run(vertexCount, [&]()
+    {
+        /* marker[node] == vertex + 1 if and only if the bag of the node contains the current vertex. */
+        std::vector<htd::vertex_t> marker(index.bags_.size(), 0);
+
+        for (htd::vertex_t vertex = nextVertex++; vertex < vertexCount; vertex = nextVertex++)
         {
-            decomposition.copyForgottenVerticesTo(parent, forgottenBagContent, vertex);
+            std::vector<htd::index_t>::const_iterator first = index.occurrences_.begin() + index.offsets_[vertex];
+            std::vector<htd::index_t>::const_iterator last = index.occurrences_.begin() + index.offsets_[vertex + 1];
 
-            for (htd::vertex_t bagElement : bag)
+            for (auto it = first; it != last; ++it)
             {
-                if (forgottenVertices.count(bagElement) > 0)
-                {
-                    result.push_back(bagElement);
-                }
+                marker[*it] = vertex + 1;
             }
 
-            for (htd::vertex_t forgottenVertex : forgottenBagContent)
-            {
-                forgottenVertices.insert(forgottenVertex);
-            }
+            /* The nodes containing the vertex form a subtree if and only if exactly one of them has no parent containing the vertex. */
+            std::size_t subtreeRootCount = 0;
 
-            forgottenBagContent.clear();
-        }
-        else
-        {
-            for (htd::vertex_t bagElement : bag)
+            for (auto it = first; subtreeRootCount < 2 && it != last; ++it)
             {
-                if (forgottenVertices.count(bagElement) > 0)
+                htd::index_t parent = index.parents_[*it];
+
+                if (parent == Implementation::NO_PARENT || marker[parent] != vertex + 1)
                 {
-                    result.push_back(bagElement);
+                    ++subtreeRootCount;
                 }
             }
+
+            disconnected[vertex] = subtreeRootCount > 1;
         }
     });
 
-    std::sort(result.begin(), result.end());
-
-    result.erase(std::unique(result.begin(), result.end()), result.end());
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        if (disconnected[vertex])
+        {
+            result.push_back(vertex);
+        }
+    }
 
     return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
 }
 
+std::size_t htd::TreeDecompositionVerifier::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::TreeDecompositionVerifier::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 #endif /* HTD_HTD_TREEDECOMPOSITIONVERIFIER_CPP */
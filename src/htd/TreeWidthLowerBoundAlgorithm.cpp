@@ -0,0 +1,340 @@
+/* 
+ * File:   TreeWidthLowerBoundAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_CPP
+#define HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
+#include <htd/IndexedBucketQueue.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+/**
+ *  Private implementation details of class htd::TreeWidthLowerBoundAlgorithm.
+ */
+struct htd::TreeWidthLowerBoundAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The strategies for selecting the neighbor into which a vertex of minimum degree is contracted.
+     */
+    enum ContractionStrategy
+    {
+        /**
+         *  Contract the vertex into its neighbor of minimum degree.
+         */
+        MIN_DEGREE,
+
+        /**
+         *  Contract the vertex into the neighbor which shares the least common neighbors with it.
+         */
+        LEAST_COMMON_NEIGHBORS
+    };
+
+    /**
+     *  Compute the MMD+ lower bound for the treewidth of the remaining graph of a preprocessed graph.
+     *
+     *  The neighborhoods are updated lazily: A contracted vertex is merged into its target via union-find and the
+     *  neighborhoods which still refer to it are only rewritten when they are inspected the next time. The degrees
+     *  of all vertices are maintained exactly, hence each contraction only costs time proportional to the
+     *  neighborhoods which are inspected.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] strategy             The strategy for selecting the neighbor into which a vertex of minimum degree is contracted.
+     *
+     *  @return The MMD+ lower bound for the treewidth of the remaining graph.
+     */
+    std::size_t computeMinorMinWidth(const htd::IPreprocessedGraph & preprocessedGraph, ContractionStrategy strategy) const;
+};
+
+htd::TreeWidthLowerBoundAlgorithm::TreeWidthLowerBoundAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::TreeWidthLowerBoundAlgorithm::TreeWidthLowerBoundAlgorithm(const htd::TreeWidthLowerBoundAlgorithm & original) : implementation_(new Implementation(original.implementation_->managementInstance_))
+{
+
+}
+
+htd::TreeWidthLowerBoundAlgorithm::~TreeWidthLowerBoundAlgorithm()
+{
+
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::computeLowerBound(const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    std::size_t ret = preprocessedGraph.minTreeWidth();
+
+    ret = std::max(ret, computeMinorMinWidth(preprocessedGraph));
+
+    ret = std::max(ret, computeContractionDegeneracyBound(preprocessedGraph));
+
+    return ret;
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::computeMinorMinWidth(const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    return implementation_->computeMinorMinWidth(preprocessedGraph, Implementation::MIN_DEGREE);
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::computeContractionDegeneracyBound(const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    return implementation_->computeMinorMinWidth(preprocessedGraph, Implementation::LEAST_COMMON_NEIGHBORS);
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::Implementation::computeMinorMinWidth(const htd::IPreprocessedGraph & preprocessedGraph, ContractionStrategy strategy) const
+{
+    const htd::NeighborhoodSnapshot & neighborhood = preprocessedGraph.neighborhoodSnapshot();
+
+    std::size_t size = neighborhood.vertexCount();
+
+    std::vector<std::vector<htd::vertex_t>> neighbors(size);
+
+    std::vector<htd::vertex_t> representative(size);
+
+    std::iota(representative.begin(), representative.end(), 0);
+
+    std::vector<std::size_t> degree(size, 0);
+
+    htd::IndexedBucketQueue<std::greater<std::size_t>> priorityQueue(size);
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        neighborhood.copyNeighborhoodTo(vertex, neighbors[vertex]);
+
+        degree[vertex] = neighbors[vertex].size();
+
+        priorityQueue.push(vertex, degree[vertex]);
+    }
+
+    /* The stamps are used to detect duplicates within a single neighborhood and to mark the members of a neighborhood. */
+    std::vector<std::size_t> duplicateStamps(size, 0);
+
+    std::vector<std::size_t> memberStamps(size, 0);
+
+    std::size_t duplicateStamp = 0;
+
+    std::size_t memberStamp = 0;
+
+    auto findRepresentative = [&](htd::vertex_t vertex)
+    {
+        while (representative[vertex] != vertex)
+        {
+            representative[vertex] = representative[representative[vertex]];
+
+            vertex = representative[vertex];
+        }
+
+        return vertex;
+    };
+
+    /* Replace contracted vertices by their representatives and remove the vertex itself as well as all duplicates. */
+    auto updateNeighborhood = [&](htd::vertex_t vertex)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighbors[vertex];
+
+        ++duplicateStamp;
+
+        duplicateStamps[vertex] = duplicateStamp;
+
+        std::size_t count = 0;
+
+        for (htd::vertex_t neighbor : currentNeighborhood)
+        {
+            neighbor = findRepresentative(neighbor);
+
+            if (duplicateStamps[neighbor] != duplicateStamp)
+            {
+                duplicateStamps[neighbor] = duplicateStamp;
+
+                currentNeighborhood[count] = neighbor;
+
+                ++count;
+            }
+        }
+
+        currentNeighborhood.resize(count);
+
+        HTD_ASSERT(count == degree[vertex])
+    };
+
+    std::size_t ret = 0;
+
+    while (!priorityQueue.empty() && !managementInstance_->isTerminated())
+    {
+        std::size_t minimumDegree = priorityQueue.topPriority();
+
+        ret = std::max(ret, minimumDegree);
+
+        /* The minimum degree of a graph with k vertices is at most k - 1, hence the bound cannot improve any more. */
+        if (ret + 1 >= priorityQueue.size())
+        {
+            break;
+        }
+
+        htd::vertex_t selectedVertex = priorityQueue.topCollection()[0];
+
+        priorityQueue.erase(selectedVertex);
+
+        if (minimumDegree == 0)
+        {
+            continue;
+        }
+
+        updateNeighborhood(selectedVertex);
+
+        const std::vector<htd::vertex_t> & selectedNeighborhood = neighbors[selectedVertex];
+
+        htd::vertex_t target = selectedNeighborhood[0];
+
+        if (strategy == MIN_DEGREE)
+        {
+            for (htd::vertex_t neighbor : selectedNeighborhood)
+            {
+                if (degree[neighbor] < degree[target])
+                {
+                    target = neighbor;
+                }
+            }
+        }
+        else
+        {
+            ++memberStamp;
+
+            for (htd::vertex_t neighbor : selectedNeighborhood)
+            {
+                memberStamps[neighbor] = memberStamp;
+            }
+
+            std::size_t minimumCommonNeighborCount = (std::size_t)-1;
+
+            for (htd::vertex_t neighbor : selectedNeighborhood)
+            {
+                updateNeighborhood(neighbor);
+
+                std::size_t commonNeighborCount = 0;
+
+                for (htd::vertex_t secondNeighbor : neighbors[neighbor])
+                {
+                    if (memberStamps[secondNeighbor] == memberStamp)
+                    {
+                        ++commonNeighborCount;
+                    }
+                }
+
+                if (commonNeighborCount < minimumCommonNeighborCount || (commonNeighborCount == minimumCommonNeighborCount && degree[neighbor] < degree[target]))
+                {
+                    minimumCommonNeighborCount = commonNeighborCount;
+
+                    target = neighbor;
+                }
+            }
+        }
+
+        /* Contract the selected vertex into the target. Common neighbors lose one edge, all others keep their degree. */
+        updateNeighborhood(target);
+
+        ++memberStamp;
+
+        for (htd::vertex_t neighbor : neighbors[target])
+        {
+            memberStamps[neighbor] = memberStamp;
+        }
+
+        std::size_t targetDegree = degree[target] - 1;
+
+        for (htd::vertex_t neighbor : selectedNeighborhood)
+        {
+            if (neighbor != target)
+            {
+                if (memberStamps[neighbor] == memberStamp)
+                {
+                    --degree[neighbor];
+
+                    priorityQueue.updatePriority(neighbor, degree[neighbor]);
+                }
+                else
+                {
+                    neighbors[target].push_back(neighbor);
+
+                    ++targetDegree;
+                }
+            }
+        }
+
+        degree[target] = targetDegree;
+
+        priorityQueue.updatePriority(target, targetDegree);
+
+        representative[selectedVertex] = target;
+
+        std::vector<htd::vertex_t>().swap(neighbors[selectedVertex]);
+    }
+
+    return ret;
+}
+
+const htd::LibraryInstance * htd::TreeWidthLowerBoundAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::TreeWidthLowerBoundAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::TreeWidthLowerBoundAlgorithm * htd::TreeWidthLowerBoundAlgorithm::clone(void) const
+{
+    return new htd::TreeWidthLowerBoundAlgorithm(*this);
+}
+
+#endif /* HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_CPP */
@@ -22,6 +22,7 @@
  * along with htd.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+
 #ifndef HTD_HTD_TRIANGULATIONMINIMIZATIONORDERINGALGORITHM_CPP
 #define HTD_HTD_TRIANGULATIONMINIMIZATIONORDERINGALGORITHM_CPP
 
@@ -30,21 +31,16 @@
 #include <htd/TriangulationMinimizationOrderingAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
-#include <htd/IMutableGraph.hpp>
 #include <htd/IMutableMultiHypergraph.hpp>
-#include <htd/GraphFactory.hpp>
 #include <htd/MultiHypergraphFactory.hpp>
-#include <htd/VertexOrdering.hpp>
-#include <htd/VectorAdapter.hpp>
 #include <htd/OrderingAlgorithmFactory.hpp>
-#include <htd/EnhancedMaximumCardinalitySearchOrderingAlgorithm.hpp>
 #include <htd/MinFillOrderingAlgorithm.hpp>
+#include <htd/ThreadPool.hpp>
 
 #include <algorithm>
-#include <numeric>
-#include <stack>
-#include <unordered_map>
-#include <unordered_set>
+#include <atomic>
+#include <functional>
+#include <memory>
 
 /**
  *  Private implementation details of class htd::TriangulationMinimizationOrderingAlgorithm.
@@ -56,7 +52,7 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), orderingAlgorithm_(manager->orderingAlgorithmFactory().createInstance())
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), orderingAlgorithm_(manager->orderingAlgorithmFactory().createInstance()), threadCount_(1)
     {
 
     }
@@ -67,7 +63,7 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), orderingAlgorithm_(original.orderingAlgorithm_->clone())
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), orderingAlgorithm_(original.orderingAlgorithm_->clone()), threadCount_(original.threadCount_)
     {
 
     }
@@ -77,7 +73,7 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), orderingAlgorithm_(original.orderingAlgorithm_->cloneOrderingAlgorithm())
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), orderingAlgorithm_(original.orderingAlgorithm_->cloneOrderingAlgorithm()), threadCount_(original.threadCount_)
     {
 
     }
@@ -99,9 +95,16 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
     htd::IOrderingAlgorithm * orderingAlgorithm_;
 
     /**
-     *  Internal data structure representing a triangulated graph.
+     *  The number of threads which shall be used to check the fill edges for redundancy.
      */
-    class TriangulatedGraph : public htd::IGraphStructure
+    std::size_t threadCount_;
+
+    /**
+     *  Internal data structure representing the graph obtained by triangulating the input graph with a vertex elimination ordering.
+     *
+     *  The vertices are renamed to the dense indices 0, ..., n-1 in the order in which the input graph reports them.
+     */
+    class TriangulatedGraph
     {
         public:
             /**
@@ -110,287 +113,33 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
              *  @param[in] graph                The graph which shall be triangulated.
              *  @param[in] eliminationSequence  A vertex elimination ordering for the given graph.
              */
-            TriangulatedGraph(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & eliminationSequence) : names_(), internalNames_(), vertices_(graph.vertexCount()), neighborhood_(graph.vertexCount()), edgeCount_(), positions_(graph.vertexCount()), fillEdges_(graph.vertexCount())
+            TriangulatedGraph(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & eliminationSequence) : names_(), internalNames_(), neighborhood_(graph.vertexCount()), positions_(graph.vertexCount()), fillEdges_(graph.vertexCount())
             {
                 initialize(graph);
 
                 triangulate(eliminationSequence);
-
-                std::iota(vertices_.begin(), vertices_.end(), 0);
             }
 
             /**
-             *  Copy constructor for a triangulated graph.
+             *  Getter for the number of vertices of the triangulated graph.
              *
-             *  @param[in] original The original triangulated graph.
+             *  @return The number of vertices of the triangulated graph.
              */
-            TriangulatedGraph(const TriangulatedGraph & original) : names_(original.names_), internalNames_(original.internalNames_), vertices_(original.vertices_), neighborhood_(original.neighborhood_), edgeCount_(original.edgeCount_), positions_(original.positions_), fillEdges_(original.fillEdges_)
-            {
-
-            }
-
-            /**
-             *  Destructor for a triangulated graph.
-             */
-            virtual ~TriangulatedGraph()
-            {
-
-            }
-
-            std::size_t vertexCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
+            std::size_t vertexCount(void) const HTD_NOEXCEPT
             {
                 return neighborhood_.size();
             }
 
-            std::size_t edgeCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return edgeCount_;
-            }
-
-            std::size_t edgeCount(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                return neighborCount(vertex);
-            }
-
-            htd::ConstCollection<htd::vertex_t> vertices(void) const HTD_OVERRIDE
-            {
-                return htd::ConstCollection<htd::vertex_t>::getInstance(vertices_);
-            }
-
-            void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
-            {
-                target.insert(target.end(), vertices_.begin(), vertices_.end());
-            }
-
-            htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(index < vertices_.size())
-
-                return vertices_[index];
-            }
-
-            bool isVertex(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                return vertex < vertexCount();
-            }
-
-            std::size_t isolatedVertexCount(void) const HTD_OVERRIDE
-            {
-                std::size_t ret = 0;
-
-                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood_)
-                {
-                    if (currentNeighborhood.empty())
-                    {
-                        ret++;
-                    }
-                }
-
-                return ret;
-            }
-
-            htd::ConstCollection<htd::vertex_t> isolatedVertices(void) const HTD_OVERRIDE
-            {
-                htd::VectorAdapter<htd::vertex_t> ret;
-
-                auto & result = ret.container();
-
-                for (htd::vertex_t vertex : vertices_)
-                {
-                    if (neighborhood_[vertex].empty())
-                    {
-                        result.push_back(vertex);
-                    }
-                }
-
-                return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
-            }
-
-            htd::vertex_t isolatedVertexAtPosition(htd::index_t index) const HTD_OVERRIDE
-            {
-                const htd::ConstCollection<htd::vertex_t> & isolatedVertexCollection = isolatedVertices();
-
-                HTD_ASSERT(index < isolatedVertexCollection.size())
-
-                htd::ConstIterator<htd::vertex_t> it = isolatedVertexCollection.begin();
-
-                std::advance(it, index);
-
-                return *it;
-            }
-
-            bool isIsolatedVertex(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return neighborhood_[vertex].empty();
-            }
-
-            std::size_t neighborCount(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return neighborhood_[vertex].size();
-            }
-
-            htd::ConstCollection<htd::vertex_t> neighbors(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return htd::ConstCollection<htd::vertex_t>::getInstance(neighborhood_[vertex]);
-            }
-
-            void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
-
-                target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
-            }
-
-            htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
-
-                HTD_ASSERT(index < currentNeighborhood.size())
-
-                return currentNeighborhood[index];
-            }
-
-            bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex) && isVertex(neighbor))
-
-                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
-
-                return std::binary_search(currentNeighborhood.begin(), currentNeighborhood.end(), neighbor);
-            }
-
-            bool isConnected(void) const HTD_OVERRIDE
-            {
-                bool ret = true;
-
-                if (!vertices_.empty())
-                {
-                    std::stack<htd::vertex_t> originStack;
-
-                    std::unordered_set<htd::vertex_t> visitedVertices;
-
-                    htd::vertex_t currentVertex = vertices_[0];
-
-                    originStack.push(currentVertex);
-
-                    while (!originStack.empty())
-                    {
-                        currentVertex = originStack.top();
-
-                        if (visitedVertices.count(currentVertex) == 0)
-                        {
-                            visitedVertices.insert(currentVertex);
-
-                            originStack.pop();
-
-                            for (htd::vertex_t neighbor : neighborhood_[currentVertex])
-                            {
-                                if (visitedVertices.count(neighbor) == 0)
-                                {
-                                    originStack.push(neighbor);
-                                }
-                            }
-                        }
-                        else
-                        {
-                            originStack.pop();
-                        }
-                    }
-
-                    ret = visitedVertices.size() == vertices_.size();
-                }
-                else
-                {
-                    ret = true;
-                }
-
-                return ret;
-            }
-
-            bool isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
-
-                bool ret = false;
-
-                if (vertex1 == vertex2)
-                {
-                    ret = true;
-                }
-                else
-                {
-                    std::vector<htd::vertex_t> newVertices;
-                    std::vector<htd::vertex_t> tmpVertices;
-
-                    std::vector<bool> reachableVertices(vertices_.size());
-
-                    reachableVertices[vertex1] = true;
-
-                    newVertices.push_back(vertex1);
-
-                    while (!ret && !newVertices.empty())
-                    {
-                        std::swap(tmpVertices, newVertices);
-
-                        newVertices.resize(0);
-
-                        for (auto it = tmpVertices.begin(); !ret && it != tmpVertices.end(); it++)
-                        {
-                            const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[*it];
-
-                            for (auto it2 = currentNeighborhood.begin(); !ret && it2 != currentNeighborhood.end(); ++it2)
-                            {
-                                htd::vertex_t neighbor = *it2;
-
-                                if (!reachableVertices[neighbor])
-                                {
-                                    reachableVertices[neighbor] = true;
-
-                                    newVertices.push_back(neighbor);
-
-                                    if (neighbor == vertex2)
-                                    {
-                                        ret = true;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-
-                return ret;
-            }
-
-            /**
-             *  Getter for the actual identifiers of the vertices.
-             *
-             *  @return The actual identifiers of the vertices.
-             */
-            const std::vector<htd::vertex_t> & vertexNames(void) const HTD_NOEXCEPT
-            {
-                return names_;
-            }
-
             /**
              *  Getter for the actual identifier of the given vertex.
              *
-             *  @param[in] vertex   The internal name of the vertex whose position shall be returned.
+             *  @param[in] vertex   The internal name of the vertex whose actual identifier shall be returned.
              *
              *  @return The actual identifier of the given vertex.
              */
             htd::vertex_t vertexName(htd::vertex_t vertex) const
             {
-                HTD_ASSERT(vertex < names_.size());
+                HTD_ASSERT(vertex < names_.size())
 
                 return names_[vertex];
             }
@@ -404,7 +153,9 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
              */
             htd::vertex_t internalVertexName(htd::vertex_t vertex) const
             {
-                return internalNames_.at(vertex);
+                HTD_ASSERT(vertex < internalNames_.size())
+
+                return internalNames_[vertex];
             }
 
             /**
@@ -416,77 +167,53 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
              */
             htd::index_t position(htd::vertex_t vertex) const
             {
-                HTD_ASSERT(vertex < names_.size());
+                HTD_ASSERT(vertex < positions_.size())
 
                 return positions_[vertex];
             }
 
             /**
-             *  Updatable getter for the vector containing the preprocessed neighborhood of each of the vertices.
-             *
-             *  @note The neighborhood of each vertex returned by this data structure does not include the respective vertex itself.
-             *
-             *  @return The updatable vector containing the preprocessed neighborhood of each of the vertices.
-             */
-            std::vector<std::vector<htd::vertex_t>> & neighborhood(void) HTD_NOEXCEPT
-            {
-                return neighborhood_;
-            }
-
-            /**
-             *  Getter for the vector containing the preprocessed neighborhood of each of the vertices.
-             *
-             *  @note The neighborhood of each vertex returned by this data structure does not include the respective vertex itself.
-             *
-             *  @return The vector containing the preprocessed neighborhood of each of the vertices.
-             */
-            const std::vector<std::vector<htd::vertex_t>> & neighborhood(void) const HTD_NOEXCEPT
-            {
-                return neighborhood_;
-            }
-
-            /**
-             *  Updatable getter for the vector containing the preprocessed neighborhood of a vertex.
+             *  Getter for the sorted neighborhood of a vertex.
              *
              *  @note The neighborhood returned by this data structure does not include the vertex itself.
              *
              *  @param[in] vertex   The vertex whose neighborhood shall be returned.
              *
-             *  @return The updatable vector containing the preprocessed neighborhood of the requested vertex.
+             *  @return The sorted neighborhood of the requested vertex.
              */
-            std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex)
+            const std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex) const
             {
-                HTD_ASSERT(vertex < names_.size());
+                HTD_ASSERT(vertex < neighborhood_.size())
 
                 return neighborhood_[vertex];
             }
 
             /**
-             *  Getter for the vector containing the preprocessed neighborhood of a vertex.
-             *
-             *  @note The neighborhood returned by this data structure does not include the vertex itself.
+             *  Check whether two vertices are adjacent in the triangulated graph.
              *
-             *  @param[in] vertex   The vertex whose neighborhood shall be returned.
+             *  @param[in] vertex   The first vertex.
+             *  @param[in] neighbor The second vertex.
              *
-             *  @return The vector containing the preprocessed neighborhood of the requested vertex.
+             *  @return True if the two vertices are adjacent in the triangulated graph, false otherwise.
              */
-            const std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex) const
+            bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
             {
-                HTD_ASSERT(vertex < names_.size());
+                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood(vertex);
 
-                return neighborhood_[vertex];
+                return std::binary_search(currentNeighborhood.begin(), currentNeighborhood.end(), neighbor);
             }
 
             /**
-             *  Remove an edge from the graph.
+             *  Remove a fill edge from the graph.
+             *
+             *  @note The fill edge is only removed from the neighborhoods of its endpoints, the caller is responsible for updating the fill edges of the active vertex.
              *
-             *  @param[in] vertex1      The first endpoint of the edge.
-             *  @param[in] vertex2      The second endpoint of the edge.
-             *  @param[in] activeVertex The currently investigated vertex.
+             *  @param[in] vertex1  The first endpoint of the edge.
+             *  @param[in] vertex2  The second endpoint of the edge.
              */
-            void removeFillEdge(htd::vertex_t vertex1, htd::vertex_t vertex2, htd::vertex_t activeVertex)
+            void removeFillEdge(htd::vertex_t vertex1, htd::vertex_t vertex2)
             {
-                HTD_ASSERT(vertex1 < names_.size() && vertex2 < names_.size());
+                HTD_ASSERT(vertex1 < neighborhood_.size() && vertex2 < neighborhood_.size())
 
                 std::vector<htd::vertex_t> & neighborhood1 = neighborhood_[vertex1];
                 std::vector<htd::vertex_t> & neighborhood2 = neighborhood_[vertex2];
@@ -498,19 +225,6 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
                     neighborhood1.erase(position);
                     neighborhood2.erase(std::lower_bound(neighborhood2.begin(), neighborhood2.end(), vertex1));
                 }
-
-                std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & relevantEdges = fillEdges_[activeVertex];
-
-                auto edgePosition =
-                    std::find_if(relevantEdges.begin(), relevantEdges.end(), [&](const std::pair<htd::vertex_t, htd::vertex_t> & currentFillEdge)
-                    {
-                       return currentFillEdge.first == vertex1 && currentFillEdge.second == vertex2;
-                    });
-
-                if (edgePosition != relevantEdges.end())
-                {
-                    relevantEdges.erase(edgePosition);
-                }
             }
 
             /**
@@ -522,47 +236,24 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
              */
             const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges(htd::vertex_t vertex) const
             {
-                HTD_ASSERT(vertex < names_.size());
+                HTD_ASSERT(vertex < fillEdges_.size())
 
                 return fillEdges_[vertex];
             }
 
             /**
-             *  Recompute the number of edges in the graph to update the result of the function edgeCount().
-             */
-            void updateEdgeCount(void)
-            {
-                edgeCount_ = 0;
-
-                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood_)
-                {
-                    edgeCount_ += currentNeighborhood.size();
-                }
-
-                edgeCount_ = edgeCount_ >> 1;
-            }
-
-#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-            /**
-             *  Create a deep copy of the current graph structure.
+             *  Updatable getter for the fill edges which are introduced by the elimination of the given vertex.
              *
-             *  @return A new TriangulatedGraph object identical to the current graph structure.
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The updatable fill edges which are introduced by the elimination of the given vertex.
              */
-            TriangulatedGraph * clone(void) const
+            std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges(htd::vertex_t vertex)
             {
-                return new TriangulatedGraph(*this);
-            }
+                HTD_ASSERT(vertex < fillEdges_.size())
 
-            htd::IGraphStructure * cloneGraphStructure(void) const HTD_OVERRIDE
-            {
-                return clone();
-            }
-#else
-            TriangulatedGraph * clone(void) const HTD_OVERRIDE
-            {
-                return new TriangulatedGraph(*this);
+                return fillEdges_[vertex];
             }
-#endif
 
         private:
             /**
@@ -571,25 +262,15 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
             std::vector<htd::vertex_t> names_;
 
             /**
-             *  A map which maps to each vertex its internal counterpart.
+             *  A vector which maps to each actual vertex identifier its internal counterpart.
              */
-            std::unordered_map<htd::vertex_t, htd::vertex_t> internalNames_;
+            std::vector<htd::vertex_t> internalNames_;
 
             /**
-             *  The vertices of the triangulated graph.
-             */
-            std::vector<htd::vertex_t> vertices_;
-
-            /**
-             *  A vector containing the neighborhood of each of the vertices.
+             *  A vector containing the sorted neighborhood of each of the vertices.
              */
             std::vector<std::vector<htd::vertex_t>> neighborhood_;
 
-            /**
-             *  The number of edges in the triangulated graph.
-             */
-            std::size_t edgeCount_;
-
             /**
              *  The positions of the vertices within the elimination ordering.
              */
@@ -600,25 +281,6 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
              */
             std::vector<std::vector<std::pair<htd::vertex_t, htd::vertex_t>>> fillEdges_;
 
-            /**
-             *  Register a given vertex and return its index.
-             *
-             *  @param[in] vertex   The vertex which shall be registered.
-             *
-             *  @return The index of the vertex within the (updated) vector vertexNames.
-             */
-            htd::vertex_t registerVertex(htd::vertex_t vertex)
-            {
-                auto result = internalNames_.emplace(vertex, names_.size());
-
-                if (result.second)
-                {
-                    names_.push_back(vertex);
-                }
-
-                return result.first->second;
-            }
-
             /**
              *  Inititialize the data structure.
              *
@@ -626,83 +288,51 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
              */
             void initialize(const htd::IMultiHypergraph & graph)
             {
-                std::size_t size = graph.vertexCount();
+                graph.copyVerticesTo(names_);
 
-                if (size > 0)
+                if (!names_.empty())
                 {
-                    names_.reserve(size);
+                    internalNames_.resize(*std::max_element(names_.begin(), names_.end()) + 1, static_cast<htd::vertex_t>(-1));
 
-                    if (graph.vertexAtPosition(size - 1) == static_cast<htd::vertex_t>(size))
+                    for (htd::index_t index = 0; index < names_.size(); ++index)
                     {
-                        for (htd::index_t index = 0; index < size; ++index)
-                        {
-                            htd::vertex_t vertex = static_cast<htd::vertex_t>(index) + 1;
-
-                            htd::vertex_t mappedVertex = static_cast<htd::vertex_t>(index);
-
-                            names_.push_back(vertex);
+                        internalNames_[names_[index]] = static_cast<htd::vertex_t>(index);
+                    }
+                }
 
-                            internalNames_[vertex] = mappedVertex;
+                std::vector<htd::vertex_t> neighbors;
 
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[mappedVertex];
+                for (htd::index_t index = 0; index < names_.size(); ++index)
+                {
+                    std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[index];
 
-                            graph.copyNeighborsTo(vertex, currentNeighborhood);
+                    neighbors.clear();
 
-                            auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
+                    graph.copyNeighborsTo(names_[index], neighbors);
 
-                            if (position != currentNeighborhood.end() && *position == mappedVertex)
-                            {
-                                currentNeighborhood.erase(position);
-                            }
+                    currentNeighborhood.reserve(neighbors.size());
 
-                            std::for_each(currentNeighborhood.begin(), currentNeighborhood.end(), [](htd::vertex_t & neighbor){ --neighbor; });
-                        }
-                    }
-                    else
+                    for (htd::vertex_t neighbor : neighbors)
                     {
-                        const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
-
-                        auto position = vertexCollection.begin();
-
-                        for (std::size_t remainder = vertexCollection.size(); remainder > 0; --remainder)
+                        if (neighbor != names_[index])
                         {
-                            htd::vertex_t vertex = *position;
-
-                            htd::vertex_t mappedVertex = registerVertex(vertex);
-
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[mappedVertex];
-
-                            const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(vertex);
-
-                            auto position2 = neighborCollection.begin();
-
-                            currentNeighborhood.reserve(neighborCollection.size() + 1);
-
-                            for (std::size_t remainder2 = neighborCollection.size(); remainder2 > 0; --remainder2)
-                            {
-                                currentNeighborhood.push_back(registerVertex(*position2));
-
-                                ++position2;
-                            }
-
-                            std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
-
-                            auto position3 = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), mappedVertex);
-
-                            if (position3 != currentNeighborhood.end() && *position3 == mappedVertex)
-                            {
-                                currentNeighborhood.erase(position3);
-                            }
-
-                            ++position;
+                            currentNeighborhood.push_back(internalNames_[neighbor]);
                         }
                     }
+
+                    std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+
+                    currentNeighborhood.erase(std::unique(currentNeighborhood.begin(), currentNeighborhood.end()), currentNeighborhood.end());
                 }
             }
 
             /**
              *  Triangulate the graph.
              *
+             *  The fill edges are appended to the neighborhoods without keeping them sorted while the elimination
+             *  proceeds, adjacency between the later neighbors of the eliminated vertex is checked by stamping the
+             *  neighborhood of each of them. The neighborhoods are sorted once at the end.
+             *
              *  @param[in] eliminationSequence  A vertex elimination ordering for the given graph.
              */
             void triangulate(const std::vector<htd::vertex_t> & eliminationSequence)
@@ -713,18 +343,23 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
 
                 for (htd::vertex_t vertex : eliminationSequence)
                 {
-                    positions_[internalNames_.at(vertex)] = position;
+                    positions_[internalVertexName(vertex)] = position;
 
                     ++position;
                 }
 
+                /* marks[v] == u states that v is adjacent to u. Edges are never removed during the triangulation, so stale marks stay valid. */
+                std::vector<htd::vertex_t> marks(vertexCount(), static_cast<htd::vertex_t>(-1));
+
+                std::vector<htd::vertex_t> relevantNeighbors;
+
                 for (htd::vertex_t vertex : eliminationSequence)
                 {
-                    htd::vertex_t internalVertex = internalNames_.at(vertex);
+                    htd::vertex_t internalVertex = internalVertexName(vertex);
 
                     htd::index_t currentPosition = positions_[internalVertex];
 
-                    std::vector<htd::vertex_t> relevantNeighbors;
+                    relevantNeighbors.clear();
 
                     for (htd::vertex_t neighbor : neighborhood_[internalVertex])
                     {
@@ -736,33 +371,103 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
 
                     if (relevantNeighbors.size() > 1)
                     {
-                        for (auto it = relevantNeighbors.begin(); it != relevantNeighbors.end(); ++it)
-                        {
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[*it];
+                        std::sort(relevantNeighbors.begin(), relevantNeighbors.end());
 
-                            std::vector<htd::vertex_t> missingNeighbors;
+                        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & currentFillEdges = fillEdges_[internalVertex];
 
-                            std::set_difference(it + 1, relevantNeighbors.end(), currentNeighborhood.begin(), currentNeighborhood.end(), std::back_inserter(missingNeighbors));
+                        for (auto it = relevantNeighbors.begin(); it != relevantNeighbors.end(); ++it)
+                        {
+                            htd::vertex_t neighbor = *it;
 
-                            if (!missingNeighbors.empty())
+                            for (htd::vertex_t neighbor2 : neighborhood_[neighbor])
                             {
-                                htd::inplace_merge(currentNeighborhood, missingNeighbors);
+                                marks[neighbor2] = neighbor;
+                            }
 
-                                for (htd::vertex_t missingNeighbor : missingNeighbors)
+                            for (auto it2 = it + 1; it2 != relevantNeighbors.end(); ++it2)
+                            {
+                                if (marks[*it2] != neighbor)
                                 {
-                                    fillEdges_[internalVertex].emplace_back(*it, missingNeighbor);
-
-                                    std::vector<htd::vertex_t> & currentNeighborhood2 = neighborhood_[missingNeighbor];
+                                    currentFillEdges.emplace_back(neighbor, *it2);
 
-                                    currentNeighborhood2.insert(std::lower_bound(currentNeighborhood2.begin(), currentNeighborhood2.end(), *it), *it);
+                                    neighborhood_[neighbor].push_back(*it2);
+                                    neighborhood_[*it2].push_back(neighbor);
                                 }
                             }
                         }
                     }
                 }
+
+                for (std::vector<htd::vertex_t> & currentNeighborhood : neighborhood_)
+                {
+                    std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+                }
             }
     };
 
+    /**
+     *  Scratch buffers used for checking the fill edges of a single vertex.
+     *
+     *  Each worker thread owns one instance which is reused for all vertices it processes.
+     */
+    struct Workspace
+    {
+        /**
+         *  Constructor for a workspace.
+         *
+         *  @param[in] vertexCount  The number of vertices of the triangulated graph.
+         */
+        Workspace(std::size_t vertexCount) : localIndices(vertexCount, static_cast<htd::index_t>(-1)), relevantVertices(), candidateEdges(), adjacency(), weights(), distances(), numbered(), finalized(), fillEdgeRemoved(false)
+        {
+
+        }
+
+        /**
+         *  The index of each vertex of the triangulated graph in the local graph or (htd::index_t)-1 if it is not part of the local graph.
+         */
+        std::vector<htd::index_t> localIndices;
+
+        /**
+         *  The vertices of the local graph.
+         */
+        std::vector<htd::vertex_t> relevantVertices;
+
+        /**
+         *  The candidate edges of the currently investigated vertex, given as pairs of local indices.
+         */
+        std::vector<std::pair<htd::index_t, htd::index_t>> candidateEdges;
+
+        /**
+         *  The adjacency matrix of the local graph (0=no edge, 1=edge, 2=no edge but required fill edge).
+         */
+        std::vector<unsigned char> adjacency;
+
+        /**
+         *  The weights of the vertices of the local graph during the MCS-M search.
+         */
+        std::vector<std::size_t> weights;
+
+        /**
+         *  The bottleneck distances of the vertices of the local graph during a single MCS-M step.
+         */
+        std::vector<std::size_t> distances;
+
+        /**
+         *  A flag for each vertex of the local graph stating whether it is already numbered by MCS-M.
+         */
+        std::vector<unsigned char> numbered;
+
+        /**
+         *  A flag for each vertex of the local graph stating whether its bottleneck distance is final.
+         */
+        std::vector<unsigned char> finalized;
+
+        /**
+         *  A boolean flag indicating whether at least one fill edge was removed using this workspace.
+         */
+        bool fillEdgeRemoved;
+    };
+
     /**
      *  Check whether the given fill edge is a candidate for removal from the given triangulated graph.
      *
@@ -778,8 +483,12 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
     {
         bool ret = true;
 
-        for (htd::vertex_t neighbor : graph.neighborhood(vertex1))
+        const std::vector<htd::vertex_t> & neighborhood = graph.neighborhood(vertex1);
+
+        for (auto it = neighborhood.begin(); ret && it != neighborhood.end(); ++it)
         {
+            htd::vertex_t neighbor = *it;
+
             if (graph.position(neighbor) > position && graph.isNeighbor(vertex2, neighbor) && !graph.isNeighbor(activeVertex, neighbor))
             {
                 ret = false;
@@ -790,40 +499,200 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
     }
 
     /**
-     *  Compute the set of fill edges which can be safely removed.
+     *  Compute a minimal triangulation of the local graph stored in the given workspace via MCS-M.
+     *
+     *  The local graph is usually almost complete, therefore the algorithm operates on the adjacency matrix and each step
+     *  determines the vertices reachable from the numbered vertex via a bottleneck variant of Dijkstra's algorithm. The
+     *  entries of all required fill edges in the adjacency matrix are set to 2. Ties are broken by the local index, hence
+     *  the result only depends on the local graph.
      *
-     *  @param[in] graph                    The input graph.
-     *  @param[in] candidateFillEdges       The fill edges which shall be checked.
-     *  @param[in] vertices                 The actual identifier (as used for the candidate fill edges) of the vertices of the input graph.
-     *  @param[in,out] redundantFillEdges   The vector of redundant fill edges which shall be updated.
+     *  @param[in,out] workspace    The workspace containing the local graph.
      */
-    void computeRedundantFillEdges(const htd::IGraph & graph, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & candidateFillEdges, const std::vector<htd::vertex_t> & vertices, std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & redundantFillEdges) const
+    void computeRequiredFillEdges(Workspace & workspace) const
     {
-        htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm algorithm(managementInstance_);
+        const std::size_t size = workspace.relevantVertices.size();
 
-        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+        const std::size_t unreachable = static_cast<std::size_t>(-1);
 
-        TriangulatedGraph triangulatedGraph(graph, ordering->sequence());
+        std::vector<unsigned char> & adjacency = workspace.adjacency;
+        std::vector<std::size_t> & weights = workspace.weights;
+        std::vector<std::size_t> & distances = workspace.distances;
+        std::vector<unsigned char> & numbered = workspace.numbered;
+        std::vector<unsigned char> & finalized = workspace.finalized;
 
-        delete ordering;
-
-        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges;
+        weights.assign(size, 0);
+        distances.resize(size);
+        numbered.assign(size, 0);
+        finalized.resize(size);
 
-        for (htd::vertex_t vertex : triangulatedGraph.vertices())
+        for (std::size_t step = 0; step < size; ++step)
         {
-            for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : triangulatedGraph.fillEdges(vertex))
+            std::size_t selectedVertex = unreachable;
+
+            for (std::size_t vertex = 0; vertex < size; ++vertex)
+            {
+                if (!numbered[vertex] && (selectedVertex == unreachable || weights[vertex] > weights[selectedVertex]))
+                {
+                    selectedVertex = vertex;
+                }
+            }
+
+            numbered[selectedVertex] = 1;
+
+            const unsigned char * selectedRow = adjacency.data() + selectedVertex * size;
+
+            /* distances[v] = 1 + the minimal possible maximum weight of the inner vertices of a path from the selected vertex to v, 0 if there are no inner vertices. */
+            for (std::size_t vertex = 0; vertex < size; ++vertex)
+            {
+                distances[vertex] = selectedRow[vertex] == 1 ? 0 : unreachable;
+
+                finalized[vertex] = numbered[vertex];
+            }
+
+            while (true)
+            {
+                std::size_t currentVertex = unreachable;
+
+                for (std::size_t vertex = 0; vertex < size; ++vertex)
+                {
+                    if (!finalized[vertex] && distances[vertex] != unreachable && (currentVertex == unreachable || distances[vertex] < distances[currentVertex]))
+                    {
+                        currentVertex = vertex;
+                    }
+                }
+
+                if (currentVertex == unreachable)
+                {
+                    break;
+                }
+
+                finalized[currentVertex] = 1;
+
+                std::size_t distance = std::max(distances[currentVertex], weights[currentVertex] + 1);
+
+                const unsigned char * currentRow = adjacency.data() + currentVertex * size;
+
+                for (std::size_t vertex = 0; vertex < size; ++vertex)
+                {
+                    if (!finalized[vertex] && currentRow[vertex] == 1 && distance < distances[vertex])
+                    {
+                        distances[vertex] = distance;
+                    }
+                }
+            }
+
+            for (std::size_t vertex = 0; vertex < size; ++vertex)
             {
-                fillEdges.push_back(std::make_pair(vertices[fillEdge.first], vertices[fillEdge.second]));
+                if (!numbered[vertex] && distances[vertex] <= weights[vertex])
+                {
+                    ++(weights[vertex]);
+
+                    if (selectedRow[vertex] != 1)
+                    {
+                        adjacency[selectedVertex * size + vertex] = 2;
+                        adjacency[vertex * size + selectedVertex] = 2;
+                    }
+                }
             }
         }
+    }
+
+    /**
+     *  Remove the redundant fill edges introduced by the elimination of the given vertex.
+     *
+     *  The fill edges of the vertex which are candidates for removal form the non-edges of an otherwise complete local graph
+     *  on their endpoints. Exactly the candidates which are not part of a minimal triangulation of the local graph are redundant.
+     *
+     *  This function reads the neighborhoods of the vertex and of the endpoints of its fill edges and it updates only the
+     *  latter and the fill edges of the vertex itself.
+     *
+     *  @param[in] vertex               The vertex whose fill edges shall be checked.
+     *  @param[in,out] graph            The triangulated graph.
+     *  @param[in,out] workspace        The scratch buffers of the calling thread.
+     */
+    void removeRedundantFillEdges(htd::vertex_t vertex, TriangulatedGraph & graph, Workspace & workspace) const
+    {
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges = graph.fillEdges(vertex);
+
+        htd::index_t position = graph.position(vertex);
+
+        std::vector<htd::index_t> & localIndices = workspace.localIndices;
+
+        std::vector<htd::vertex_t> & relevantVertices = workspace.relevantVertices;
+
+        std::vector<std::pair<htd::index_t, htd::index_t>> & candidateEdges = workspace.candidateEdges;
+
+        relevantVertices.clear();
 
-        std::sort(fillEdges.begin(), fillEdges.end());
+        candidateEdges.clear();
 
-        for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : candidateFillEdges)
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
+        {
+            if (isCandidateEdge(fillEdge.first, fillEdge.second, vertex, position, graph))
+            {
+                for (htd::vertex_t endpoint : { fillEdge.first, fillEdge.second })
+                {
+                    if (localIndices[endpoint] == static_cast<htd::index_t>(-1))
+                    {
+                        localIndices[endpoint] = relevantVertices.size();
+
+                        relevantVertices.push_back(endpoint);
+                    }
+                }
+
+                candidateEdges.emplace_back(localIndices[fillEdge.first], localIndices[fillEdge.second]);
+            }
+        }
+
+        if (!candidateEdges.empty())
         {
-            if (!std::binary_search(fillEdges.begin(), fillEdges.end(), fillEdge))
+            std::size_t size = relevantVertices.size();
+
+            std::vector<unsigned char> & adjacency = workspace.adjacency;
+
+            adjacency.assign(size * size, 1);
+
+            for (std::size_t index = 0; index < size; ++index)
+            {
+                adjacency[index * size + index] = 0;
+            }
+
+            for (const std::pair<htd::index_t, htd::index_t> & candidate : candidateEdges)
+            {
+                adjacency[candidate.first * size + candidate.second] = 0;
+                adjacency[candidate.second * size + candidate.first] = 0;
+            }
+
+            computeRequiredFillEdges(workspace);
+
+            bool fillEdgeRemoved = false;
+
+            for (const std::pair<htd::index_t, htd::index_t> & candidate : candidateEdges)
+            {
+                if (adjacency[candidate.first * size + candidate.second] == 0)
+                {
+                    graph.removeFillEdge(relevantVertices[candidate.first], relevantVertices[candidate.second]);
+
+                    fillEdgeRemoved = true;
+                }
+            }
+
+            if (fillEdgeRemoved)
             {
-                redundantFillEdges.push_back(fillEdge);
+                fillEdges.erase(std::remove_if(fillEdges.begin(), fillEdges.end(), [&](const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge)
+                {
+                    htd::index_t index1 = localIndices[fillEdge.first];
+                    htd::index_t index2 = localIndices[fillEdge.second];
+
+                    return index1 != static_cast<htd::index_t>(-1) && index2 != static_cast<htd::index_t>(-1) && adjacency[index1 * size + index2] == 0;
+                }), fillEdges.end());
+
+                workspace.fillEdgeRemoved = true;
+            }
+
+            for (htd::vertex_t relevantVertex : relevantVertices)
+            {
+                localIndices[relevantVertex] = static_cast<htd::index_t>(-1);
             }
         }
     }
@@ -864,78 +733,116 @@ htd::IVertexOrdering * htd::TriangulationMinimizationOrderingAlgorithm::computeO
 
     htd::TriangulationMinimizationOrderingAlgorithm::Implementation::TriangulatedGraph triangulatedGraph(graph, ordering->sequence());
 
-    htd::index_t position = ordering->sequence().size() - 1;
-
-    bool fillEdgeRemoved = false;
+    /* Only the vertices whose elimination introduces fill edges have to be checked, in reverse elimination order. */
+    std::vector<htd::vertex_t> pendingVertices;
 
     for (auto it = ordering->sequence().rbegin(); it != ordering->sequence().rend(); ++it)
     {
         htd::vertex_t vertex = triangulatedGraph.internalVertexName(*it);
 
-        const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges = triangulatedGraph.fillEdges(vertex);
+        if (!triangulatedGraph.fillEdges(vertex).empty())
+        {
+            pendingVertices.push_back(vertex);
+        }
+    }
 
-        std::unordered_set<htd::vertex_t> candidateVertices;
+    std::size_t threadCount = std::min(htd::ThreadPool::effectiveThreadCount(implementation_->threadCount_), pendingVertices.size());
 
-        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> candidateEdges;
+    std::vector<htd::TriangulationMinimizationOrderingAlgorithm::Implementation::Workspace> workspaces(std::max(threadCount, (std::size_t)1), htd::TriangulationMinimizationOrderingAlgorithm::Implementation::Workspace(triangulatedGraph.vertexCount()));
 
-        for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
-        {
-            if (implementation_->isCandidateEdge(fillEdge.first, fillEdge.second, vertex, position, triangulatedGraph))
-            {
-                candidateEdges.push_back(fillEdge);
+    if (threadCount > 1)
+    {
+        htd::ThreadPool threadPool(threadCount);
 
-                candidateVertices.insert(fillEdge.first);
-                candidateVertices.insert(fillEdge.second);
-            }
-        }
+        /*
+         *  Checking a vertex reads the neighborhoods of the vertex and of the endpoints of its fill edges and it
+         *  modifies only the neighborhoods of the endpoints. The pending vertices are therefore split into maximal
+         *  consecutive batches in which no vertex modifies a neighborhood read by another one. The vertices of a
+         *  batch are checked concurrently and the result is identical to the one of the sequential algorithm.
+         */
+        std::vector<std::size_t> readStamps(triangulatedGraph.vertexCount(), 0);
+        std::vector<std::size_t> writeStamps(triangulatedGraph.vertexCount(), 0);
 
-        if (!candidateEdges.empty())
-        {
-            std::vector<htd::vertex_t> relevantVertices(candidateVertices.begin(), candidateVertices.end());
+        std::size_t stamp = 0;
 
-            std::sort(relevantVertices.begin(), relevantVertices.end());
+        std::vector<htd::vertex_t> batch;
 
-            htd::IMutableGraph * localGraph = implementation_->managementInstance_->graphFactory().createInstance(relevantVertices.size());
+        std::size_t index = 0;
 
-            std::unordered_map<htd::vertex_t, htd::vertex_t> localMapping;
+        while (index < pendingVertices.size())
+        {
+            ++stamp;
 
-            htd::index_t localPosition = 1;
+            batch.clear();
 
-            for (htd::vertex_t relevantVertex : relevantVertices)
+            for (; index < pendingVertices.size(); ++index)
             {
-                localMapping.emplace(relevantVertex, localPosition);
+                htd::vertex_t vertex = pendingVertices[index];
 
-                ++localPosition;
-            }
+                const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges = triangulatedGraph.fillEdges(vertex);
 
-            for (auto it2 = relevantVertices.begin(); it2 != relevantVertices.end(); ++it2)
-            {
-                for (auto it3 = it2 + 1; it3 != relevantVertices.end(); ++it3)
+                bool conflict = writeStamps[vertex] == stamp;
+
+                for (auto it = fillEdges.begin(); !conflict && it != fillEdges.end(); ++it)
                 {
-                    localGraph->addEdge(localMapping.at(*it2), localMapping.at(*it3));
+                    conflict = readStamps[it->first] == stamp || readStamps[it->second] == stamp;
                 }
-            }
 
-            for (const std::pair<htd::vertex_t, htd::vertex_t> & candidate : candidateEdges)
-            {
-                localGraph->removeEdge(localMapping.at(candidate.first), localMapping.at(candidate.second));
-            }
+                if (conflict)
+                {
+                    break;
+                }
 
-            std::vector<std::pair<htd::vertex_t, htd::vertex_t>> redundantFillEdges;
+                readStamps[vertex] = stamp;
 
-            implementation_->computeRedundantFillEdges(*localGraph, candidateEdges, relevantVertices, redundantFillEdges);
+                for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
+                {
+                    readStamps[fillEdge.first] = stamp;
+                    readStamps[fillEdge.second] = stamp;
 
-            for (const std::pair<htd::vertex_t, htd::vertex_t> & candidate : redundantFillEdges)
-            {
-                triangulatedGraph.removeFillEdge(candidate.first, candidate.second, vertex);
+                    writeStamps[fillEdge.first] = stamp;
+                    writeStamps[fillEdge.second] = stamp;
+                }
 
-                fillEdgeRemoved = true;
+                batch.push_back(vertex);
             }
 
-            delete localGraph;
+            if (batch.size() > 1)
+            {
+                std::atomic<std::size_t> nextVertex(0);
+
+                for (std::size_t thread = 0; thread < threadCount; ++thread)
+                {
+                    threadPool.submit([&, thread]()
+                    {
+                        for (std::size_t position = nextVertex++; position < batch.size(); position = nextVertex++)
+                        {
+                            implementation_->removeRedundantFillEdges(batch[position], triangulatedGraph, workspaces[thread]);
+                        }
+                    });
+                }
+
+                threadPool.wait();
+            }
+            else
+            {
+                implementation_->removeRedundantFillEdges(batch[0], triangulatedGraph, workspaces[0]);
+            }
         }
+    }
+    else
+    {
+        for (htd::vertex_t vertex : pendingVertices)
+        {
+            implementation_->removeRedundantFillEdges(vertex, triangulatedGraph, workspaces[0]);
+        }
+    }
 
-        --position;
+    bool fillEdgeRemoved = false;
+
+    for (const htd::TriangulationMinimizationOrderingAlgorithm::Implementation::Workspace & workspace : workspaces)
+    {
+        fillEdgeRemoved = fillEdgeRemoved || workspace.fillEdgeRemoved;
     }
 
     htd::IVertexOrdering * ret = nullptr;
@@ -946,7 +853,7 @@ htd::IVertexOrdering * htd::TriangulationMinimizationOrderingAlgorithm::computeO
 
         htd::IMutableMultiHypergraph * optimizedGraph = implementation_->managementInstance_->multiHypergraphFactory().createInstance(graph);
 
-        for (htd::vertex_t vertex : triangulatedGraph.vertices())
+        for (htd::vertex_t vertex = 0; vertex < triangulatedGraph.vertexCount(); ++vertex)
         {
             for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : triangulatedGraph.fillEdges(vertex))
             {
@@ -992,6 +899,16 @@ void htd::TriangulationMinimizationOrderingAlgorithm::setOrderingAlgorithm(htd::
     implementation_->orderingAlgorithm_ = algorithm;
 }
 
+std::size_t htd::TriangulationMinimizationOrderingAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::TriangulationMinimizationOrderingAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 htd::TriangulationMinimizationOrderingAlgorithm * htd::TriangulationMinimizationOrderingAlgorithm::clone(void) const
 {
     return new htd::TriangulationMinimizationOrderingAlgorithm(*this);
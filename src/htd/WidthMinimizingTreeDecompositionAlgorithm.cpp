@@ -30,9 +30,15 @@
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/RandomNumberGenerator.hpp>
+#include <htd/ThreadPool.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
 
 #include <cstdarg>
 #include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
 
 /**
  *  Private implementation details of class htd::WidthMinimizingTreeDecompositionAlgorithm.
@@ -45,7 +51,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager)), iterationCount_(1), nonImprovementLimit_(-1)
+        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager)), iterationCount_(1), nonImprovementLimit_(-1), threadCount_(1)
     {
 
     }
@@ -57,7 +63,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied globally to each decomposition generated by the algorithm.
      */
     Implementation(const htd::LibraryInstance * const manager, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
-        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager, manipulationOperations)), iterationCount_(1), nonImprovementLimit_(-1)
+        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager, manipulationOperations)), iterationCount_(1), nonImprovementLimit_(-1), threadCount_(1)
     {
 
     }
@@ -67,7 +73,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), threadCount_(original.threadCount_)
     {
 
     }
@@ -96,6 +102,36 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  The maximum number of iterations without improvement after which the algorithm shall terminate.
      */
     std::size_t nonImprovementLimit_;
+
+    /**
+     *  The number of threads which shall be used to perform the iterations.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  Compute a decomposition of the given graph by distributing the iterations over a pool of worker threads.
+     *
+     *  Each worker owns a copy of the base algorithm and repeatedly picks the next iteration which was not yet
+     *  started. The results of the iterations are committed strictly in the order of their iteration index and
+     *  the iterations only use the maximum bag size of the best decomposition committed so far as upper bound.
+     *  Before an iteration starts, the random number generator of the worker is re-seeded with a seed derived
+     *  from the iteration index and a base seed drawn from the random number generator of the calling thread.
+     *  This way, the returned decomposition, the number of performed iterations and the reported improvements do
+     *  not depend on the scheduling of the worker threads.
+     *
+     *  @param[in] graph                    The input graph to decompose.
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+     *  @param[in] manipulationOperations   The manipulation operations which shall be applied to each decomposition.
+     *  @param[in] progressCallback         A callback function which is invoked for each improved decomposition.
+     *  @param[in] maxBagSize               The upper bound for the maximum bag size of the computed decomposition.
+     *  @param[in] lowerBound               The lower bound for the maximum bag size of every decomposition of the given graph.
+     *
+     *  @return The decomposition of lowest width which was found or nullptr if no decomposition within the given bound was found.
+     */
+    htd::ITreeDecomposition * computeImprovedDecompositionInParallel(const htd::IMultiHypergraph & graph,
+                                                                     const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                     const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
+                                                                     const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t lowerBound) const;
 };
 
 htd::WidthMinimizingTreeDecompositionAlgorithm::WidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -271,15 +307,35 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
                                                                                                        const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                        const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
 {
+    /* Once a decomposition reaches the lower bound, no further iteration can improve it. */
+    std::size_t lowerBound = htd::TreeWidthLowerBoundAlgorithm(implementation_->managementInstance_).computeLowerBound(preprocessedGraph) + 1;
+
+    if (maxBagSize < lowerBound && preprocessedGraph.vertexCount() > 0)
+    {
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            delete operation;
+        }
+
+        return nullptr;
+    }
+
+    if (htd::ThreadPool::effectiveThreadCount(implementation_->threadCount_) > 1)
+    {
+        return implementation_->computeImprovedDecompositionInParallel(graph, preprocessedGraph, manipulationOperations, progressCallback, maxBagSize, lowerBound);
+    }
+
     std::size_t bestMaxBagSize = maxBagSize + 1;
 
+    bool optimal = false;
+
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
     htd::ITreeDecomposition * ret = nullptr;
 
     htd::index_t iteration = 0;
 
-    while ((iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && !managementInstance.isTerminated())
+    while ((iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && !optimal && !managementInstance.isTerminated())
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -320,7 +376,7 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
 
                 if (!managementInstance.isTerminated())
                 {
-                    progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(1, -(static_cast<double>(currentMaxBagSize))));
+                    progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(2, -(static_cast<double>(currentMaxBagSize)), -(static_cast<double>(currentMaxBagSize - std::min(currentMaxBagSize, lowerBound)))));
 
                     if ((iteration == 1 && bestMaxBagSize == 0) || currentMaxBagSize < bestMaxBagSize)
                     {
@@ -332,6 +388,8 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
                         ret = currentDecomposition;
 
                         bestMaxBagSize = currentMaxBagSize;
+
+                        optimal = bestMaxBagSize <= lowerBound;
                     }
                     else
                     {
@@ -434,6 +492,16 @@ void htd::WidthMinimizingTreeDecompositionAlgorithm::setNonImprovementLimit(std:
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::size_t htd::WidthMinimizingTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::WidthMinimizingTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 bool htd::WidthMinimizingTreeDecompositionAlgorithm::isCompressionEnabled(void) const
 {
     return implementation_->algorithm_->isCompressionEnabled();
@@ -471,4 +539,137 @@ htd::WidthMinimizingTreeDecompositionAlgorithm * htd::WidthMinimizingTreeDecompo
     return new htd::WidthMinimizingTreeDecompositionAlgorithm(*this);
 }
 
+htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation::computeImprovedDecompositionInParallel(const htd::IMultiHypergraph & graph,
+                                                                                                                               const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                                                               const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
+                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t lowerBound) const
+{
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+    std::size_t iterationLimit = iterationCount_ == 0 ? (std::size_t)-1 : iterationCount_;
+
+    htd::ITreeDecomposition * ret = nullptr;
+
+    std::size_t bestMaxBagSize = (std::size_t)-1;
+
+    std::size_t committedIterations = 0;
+
+    std::size_t nonImprovementCount = 0;
+
+    std::map<htd::index_t, htd::ITreeDecomposition *> pendingResults;
+
+    std::mutex mutex;
+
+    std::atomic<std::size_t> nextIteration(0);
+
+    std::atomic<std::size_t> currentMaxBagSize(maxBagSize);
+
+    std::atomic<bool> finished(false);
+
+    const htd::RandomNumberGenerator::result_type baseSeed = htd::randomNumberGenerator()();
+
+    htd::ThreadPool threadPool(threadCount_);
+
+    for (std::size_t worker = 0; worker < threadPool.threadCount(); ++worker)
+    {
+        threadPool.submit([&]()
+        {
+            htd::BucketEliminationTreeDecompositionAlgorithm * algorithm = algorithm_->clone();
+
+            htd::index_t iteration = nextIteration++;
+
+            while (iteration < iterationLimit && !finished && !managementInstance.isTerminated())
+            {
+                std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
+
+                for (const htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+                {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                    clonedManipulationOperations.push_back(operation->clone());
+#else
+                    clonedManipulationOperations.push_back(operation->cloneDecompositionManipulationOperation());
+#endif
+                }
+
+                htd::randomNumberGenerator().seed(htd::RandomNumberGenerator::deriveSeed(baseSeed, iteration));
+
+                htd::ITreeDecomposition * currentDecomposition =
+                    algorithm->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, currentMaxBagSize.load(), 1).first;
+
+                std::lock_guard<std::mutex> lock(mutex);
+
+                pendingResults.emplace(iteration, currentDecomposition);
+
+                for (auto it = pendingResults.find(committedIterations); it != pendingResults.end(); it = pendingResults.find(committedIterations))
+                {
+                    currentDecomposition = it->second;
+
+                    pendingResults.erase(it);
+
+                    ++committedIterations;
+
+                    std::size_t committedMaxBagSize = (std::size_t)-1;
+
+                    if (currentDecomposition != nullptr && !finished && !managementInstance.isTerminated())
+                    {
+                        committedMaxBagSize = currentDecomposition->maximumBagSize();
+                    }
+
+                    /* Only improvements are reported, the decompositions which are not better depend on the cutoff seen by the worker. */
+                    if (committedMaxBagSize < bestMaxBagSize)
+                    {
+                        progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(2, -(static_cast<double>(committedMaxBagSize)), -(static_cast<double>(committedMaxBagSize - std::min(committedMaxBagSize, lowerBound)))));
+
+                        delete ret;
+
+                        ret = currentDecomposition;
+
+                        bestMaxBagSize = committedMaxBagSize;
+
+                        nonImprovementCount = 0;
+
+                        if (bestMaxBagSize <= lowerBound)
+                        {
+                            finished = true;
+                        }
+                        else
+                        {
+                            currentMaxBagSize = std::min(maxBagSize, bestMaxBagSize - 1);
+                        }
+                    }
+                    else
+                    {
+                        delete currentDecomposition;
+
+                        ++nonImprovementCount;
+                    }
+
+                    if (committedIterations >= iterationLimit || (nonImprovementLimit_ != (std::size_t)-1 && nonImprovementCount >= nonImprovementLimit_))
+                    {
+                        finished = true;
+                    }
+                }
+
+                iteration = nextIteration++;
+            }
+
+            delete algorithm;
+        });
+    }
+
+    threadPool.wait();
+
+    for (auto & result : pendingResults)
+    {
+        delete result.second;
+    }
+
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        delete operation;
+    }
+
+    return ret;
+}
+
 #endif /* HTD_HTD_WIDTHMINIMIZINGTREEDECOMPOSITIONALGORITHM_CPP */
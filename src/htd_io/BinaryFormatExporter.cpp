@@ -0,0 +1,218 @@
+/*
+ * File:   BinaryFormatExporter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINARYFORMATEXPORTER_CPP
+#define HTD_IO_BINARYFORMATEXPORTER_CPP
+
+#include <htd_io/BinaryFormatExporter.hpp>
+#include <htd_io/BinaryFormat.hpp>
+
+#include <htd/PreOrderTreeTraversal.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+htd_io::BinaryFormatExporter::BinaryFormatExporter(void)
+{
+
+}
+
+htd_io::BinaryFormatExporter::~BinaryFormatExporter()
+{
+
+}
+
+/**
+ *  Write a header and the given arrays in the binary format to a given stream.
+ *
+ *  @param[in] magic            The magic number identifying the file type.
+ *  @param[in] counts           The three counts which shall be stored in the header.
+ *  @param[in] offsets          The 64-bit offsets which shall be written after the header.
+ *  @param[in] parents          The 32-bit parent indices which shall be written after the offsets.
+ *  @param[in] contents         The 32-bit vertex identifiers which shall be written at the end of the file.
+ *  @param[out] outputStream    The output stream to which the information shall be written.
+ */
+static void writeBinaryFile(std::uint32_t magic,
+                            const std::uint64_t (&counts)[3],
+                            const std::vector<std::uint64_t> & offsets,
+                            const std::vector<std::uint32_t> & parents,
+                            const std::vector<std::uint32_t> & contents,
+                            std::ostream & outputStream)
+{
+    char header[htd_io::BinaryFormat::HEADER_SIZE];
+
+    std::uint32_t fields[4] = { magic, htd_io::BinaryFormat::VERSION, htd_io::BinaryFormat::BYTE_ORDER_MARK, 0 };
+
+    std::memcpy(header, fields, sizeof(fields));
+    std::memcpy(header + sizeof(fields), counts, sizeof(counts));
+
+    outputStream.write(header, sizeof(header));
+
+    outputStream.write(reinterpret_cast<const char *>(offsets.data()), static_cast<std::streamsize>(offsets.size() * sizeof(std::uint64_t)));
+    outputStream.write(reinterpret_cast<const char *>(parents.data()), static_cast<std::streamsize>(parents.size() * sizeof(std::uint32_t)));
+    outputStream.write(reinterpret_cast<const char *>(contents.data()), static_cast<std::streamsize>(contents.size() * sizeof(std::uint32_t)));
+}
+
+/**
+ *  Write a tree decomposition in the binary format to a given stream.
+ *
+ *  @param[in] decomposition    The tree decomposition which shall be exported.
+ *  @param[in] vertexCount      The number of vertices of the graph from which the given decomposition was constructed.
+ *  @param[out] outputStream    The output stream to which the information shall be written.
+ */
+static void writeBinaryDecomposition(const htd::ITreeDecomposition & decomposition, std::size_t vertexCount, std::ostream & outputStream)
+{
+    std::size_t nodeCount = decomposition.vertexCount();
+
+    std::vector<std::uint64_t> offsets;
+    std::vector<std::uint32_t> parents;
+    std::vector<std::uint32_t> contents;
+
+    offsets.reserve(nodeCount + 1);
+    parents.reserve(nodeCount);
+
+    offsets.push_back(0);
+
+    bool error = false;
+
+    if (nodeCount > 0)
+    {
+        std::unordered_map<htd::vertex_t, std::uint32_t> indices;
+
+        htd::PreOrderTreeTraversal traversal;
+
+        traversal.traverse(decomposition, [&](htd::vertex_t node, htd::vertex_t parent, std::size_t distanceToRoot)
+        {
+            HTD_UNUSED(distanceToRoot)
+
+            indices.emplace(node, static_cast<std::uint32_t>(parents.size()));
+
+            std::uint32_t parentIndex = htd_io::BinaryFormat::NO_PARENT;
+
+            if (parent != htd::Vertex::UNKNOWN)
+            {
+                parentIndex = indices.at(parent);
+            }
+
+            parents.push_back(parentIndex);
+
+            for (htd::vertex_t vertex : decomposition.bagContent(node))
+            {
+                error = error || vertex > 0xFFFFFFFF || vertex >= vertexCount + htd::Vertex::FIRST;
+
+                contents.push_back(static_cast<std::uint32_t>(vertex));
+            }
+
+            offsets.push_back(contents.size());
+        });
+    }
+
+    if (error || nodeCount >= htd_io::BinaryFormat::NO_PARENT || vertexCount > 0xFFFFFFFF)
+    {
+        outputStream.setstate(std::ios::failbit);
+
+        return;
+    }
+
+    const std::uint64_t counts[3] = { nodeCount, vertexCount, contents.size() };
+
+    writeBinaryFile(htd_io::BinaryFormat::TREE_DECOMPOSITION_MAGIC, counts, offsets, parents, contents, outputStream);
+}
+
+void htd_io::BinaryFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+{
+    writeBinaryDecomposition(decomposition, graph.vertexCount(), outputStream);
+}
+
+void htd_io::BinaryFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+{
+    writeBinaryDecomposition(decomposition, graph.vertexCount(), outputStream);
+}
+
+void htd_io::BinaryFormatExporter::write(const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+{
+    std::size_t vertexCount = graph.vertexCount();
+
+    std::size_t edgeCount = graph.edgeCount();
+
+    if (vertexCount > 0xFFFFFFFF)
+    {
+        outputStream.setstate(std::ios::failbit);
+
+        return;
+    }
+
+    const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
+
+    htd::vertex_t lastVertex = vertexCount > 0 ? vertexCollection[vertexCount - 1] : 0;
+
+    /* The identifiers are renumbered only if the vertices of the graph do not form the range from 1 to vertex count. */
+    std::vector<std::uint32_t> identifiers;
+
+    if (lastVertex != vertexCount + htd::Vertex::FIRST - 1)
+    {
+        identifiers.resize(lastVertex + 1, 0);
+
+        std::uint32_t identifier = htd::Vertex::FIRST;
+
+        for (htd::vertex_t vertex : vertexCollection)
+        {
+            identifiers[vertex] = identifier;
+
+            ++identifier;
+        }
+    }
+
+    std::vector<std::uint64_t> offsets;
+    std::vector<std::uint32_t> contents;
+
+    offsets.reserve(edgeCount + 1);
+    contents.reserve(2 * edgeCount);
+
+    offsets.push_back(0);
+
+    const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = graph.hyperedges();
+
+    auto it = hyperedgeCollection.begin();
+
+    for (htd::index_t index = 0; index < edgeCount; ++index)
+    {
+        for (htd::vertex_t vertex : *it)
+        {
+            contents.push_back(identifiers.empty() ? static_cast<std::uint32_t>(vertex) : identifiers[vertex]);
+        }
+
+        offsets.push_back(contents.size());
+
+        ++it;
+    }
+
+    const std::uint64_t counts[3] = { vertexCount, edgeCount, contents.size() };
+
+    writeBinaryFile(htd_io::BinaryFormat::GRAPH_MAGIC, counts, offsets, std::vector<std::uint32_t>(), contents, outputStream);
+}
+
+#endif /* HTD_IO_BINARYFORMATEXPORTER_CPP */
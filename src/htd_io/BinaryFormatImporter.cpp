@@ -0,0 +1,417 @@
+/*
+ * File:   BinaryFormatImporter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINARYFORMATIMPORTER_CPP
+#define HTD_IO_BINARYFORMATIMPORTER_CPP
+
+#include <htd_io/BinaryFormatImporter.hpp>
+#include <htd_io/BinaryFormat.hpp>
+#include <htd_io/InputBuffer.hpp>
+
+#include <htd/MultiGraphFactory.hpp>
+#include <htd/MultiHypergraphFactory.hpp>
+#include <htd/TreeDecompositionFactory.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd_io::BinaryFormatImporter.
+ */
+struct htd_io::BinaryFormatImporter::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  Create a new IMultiHypergraph instance based on the content of the given input buffer.
+     *
+     *  @param[in] buffer   The input buffer holding the content of the graph file.
+     *
+     *  @return A new IMultiHypergraph instance based on the content of the given input buffer or nullptr if the input is malformed.
+     */
+    htd::IMultiHypergraph * importGraph(const htd_io::InputBuffer & buffer) const;
+
+    /**
+     *  Create a new IMultiGraph instance based on the arrays of a graph file in which every hyperedge has exactly two endpoints.
+     *
+     *  @param[in] offsets      The position of the hyperedge offsets in the graph file.
+     *  @param[in] contents     The position of the hyperedge endpoints in the graph file.
+     *  @param[in] vertexCount  The number of vertices stated in the header.
+     *  @param[in] edgeCount    The number of hyperedges stated in the header.
+     *
+     *  @return A new IMultiGraph instance or nullptr if not every hyperedge has exactly two valid endpoints.
+     */
+    htd::IMultiHypergraph * importGraphEdges(const char * offsets, const char * contents, std::uint64_t vertexCount, std::uint64_t edgeCount) const;
+
+    /**
+     *  Create a new ITreeDecomposition instance based on the content of the given input buffer.
+     *
+     *  @param[in] buffer   The input buffer holding the content of the tree decomposition file.
+     *
+     *  @return A new ITreeDecomposition instance based on the content of the given input buffer or nullptr if the input is malformed.
+     */
+    htd::ITreeDecomposition * importDecomposition(const htd_io::InputBuffer & buffer) const;
+
+    /**
+     *  Validate the header of a file and extract the three counts stored in it.
+     *
+     *  @param[in] buffer   The input buffer holding the content of the file.
+     *  @param[in] magic    The expected magic number.
+     *  @param[out] counts  The three counts stored in the header.
+     *
+     *  @return True if the header is valid, false otherwise.
+     */
+    bool readHeader(const htd_io::InputBuffer & buffer, std::uint32_t magic, std::uint64_t (&counts)[3]) const
+    {
+        if (buffer.size() < htd_io::BinaryFormat::HEADER_SIZE)
+        {
+            return false;
+        }
+
+        const char * position = buffer.begin();
+
+        if (read<std::uint32_t>(position) != magic ||
+            read<std::uint32_t>(position + 4) != htd_io::BinaryFormat::VERSION ||
+            read<std::uint32_t>(position + 8) != htd_io::BinaryFormat::BYTE_ORDER_MARK)
+        {
+            return false;
+        }
+
+        for (htd::index_t index = 0; index < 3; ++index)
+        {
+            counts[index] = read<std::uint64_t>(position + 16 + 8 * index);
+        }
+
+        return true;
+    }
+
+    /**
+     *  Read a value of the given type from a possibly unaligned position.
+     *
+     *  @param[in] position The position of the first byte of the value.
+     *
+     *  @return The value stored at the given position.
+     */
+    template <typename T>
+    static T read(const char * position)
+    {
+        T ret;
+
+        std::memcpy(&ret, position, sizeof(T));
+
+        return ret;
+    }
+};
+
+htd_io::BinaryFormatImporter::BinaryFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd_io::BinaryFormatImporter::~BinaryFormatImporter(void)
+{
+
+}
+
+htd::IMultiHypergraph * htd_io::BinaryFormatImporter::import(const std::string & path) const
+{
+    htd_io::InputBuffer buffer;
+
+    if (!buffer.load(path))
+    {
+        return nullptr;
+    }
+
+    return implementation_->importGraph(buffer);
+}
+
+htd::IMultiHypergraph * htd_io::BinaryFormatImporter::import(std::istream & stream) const
+{
+    htd_io::InputBuffer buffer;
+
+    if (!buffer.load(stream))
+    {
+        return nullptr;
+    }
+
+    return implementation_->importGraph(buffer);
+}
+
+htd::ITreeDecomposition * htd_io::BinaryFormatImporter::importDecomposition(const std::string & path) const
+{
+    htd_io::InputBuffer buffer;
+
+    if (!buffer.load(path))
+    {
+        return nullptr;
+    }
+
+    return implementation_->importDecomposition(buffer);
+}
+
+htd::ITreeDecomposition * htd_io::BinaryFormatImporter::importDecomposition(std::istream & stream) const
+{
+    htd_io::InputBuffer buffer;
+
+    if (!buffer.load(stream))
+    {
+        return nullptr;
+    }
+
+    return implementation_->importDecomposition(buffer);
+}
+
+htd::IMultiHypergraph * htd_io::BinaryFormatImporter::Implementation::importGraph(const htd_io::InputBuffer & buffer) const
+{
+    std::uint64_t counts[3];
+
+    if (!readHeader(buffer, htd_io::BinaryFormat::GRAPH_MAGIC, counts))
+    {
+        return nullptr;
+    }
+
+    std::uint64_t vertexCount = counts[0];
+    std::uint64_t edgeCount = counts[1];
+    std::uint64_t entryCount = counts[2];
+
+    std::uint64_t payloadSize = buffer.size() - htd_io::BinaryFormat::HEADER_SIZE;
+
+    /* The first two checks rule out overflows in the computation of the expected payload size. */
+    if (vertexCount > 0xFFFFFFFF || edgeCount > payloadSize / 8 || entryCount > payloadSize / 4 ||
+        payloadSize != 8 * (edgeCount + 1) + 4 * entryCount)
+    {
+        return nullptr;
+    }
+
+    const char * offsets = buffer.begin() + htd_io::BinaryFormat::HEADER_SIZE;
+    const char * contents = offsets + 8 * (edgeCount + 1);
+
+    if (read<std::uint64_t>(offsets) != 0 || read<std::uint64_t>(offsets + 8 * edgeCount) != entryCount)
+    {
+        return nullptr;
+    }
+
+    if (entryCount == 2 * edgeCount)
+    {
+        htd::IMultiHypergraph * ret = importGraphEdges(offsets, contents, vertexCount, edgeCount);
+
+        if (ret != nullptr)
+        {
+            return ret;
+        }
+    }
+
+    std::vector<std::vector<htd::vertex_t>> edges;
+
+    edges.reserve(static_cast<std::size_t>(edgeCount));
+
+    std::uint64_t edgeBegin = 0;
+
+    for (std::uint64_t index = 1; index <= edgeCount; ++index)
+    {
+        std::uint64_t edgeEnd = read<std::uint64_t>(offsets + 8 * index);
+
+        if (edgeEnd < edgeBegin || edgeEnd > entryCount)
+        {
+            return nullptr;
+        }
+
+        std::vector<htd::vertex_t> elements;
+
+        elements.reserve(static_cast<std::size_t>(edgeEnd - edgeBegin));
+
+        for (const char * position = contents + 4 * edgeBegin; position != contents + 4 * edgeEnd; position += 4)
+        {
+            std::uint32_t vertex = read<std::uint32_t>(position);
+
+            if (vertex < htd::Vertex::FIRST || vertex >= vertexCount + htd::Vertex::FIRST)
+            {
+                return nullptr;
+            }
+
+            elements.push_back(vertex);
+        }
+
+        edges.push_back(std::move(elements));
+
+        edgeBegin = edgeEnd;
+    }
+
+    htd::IMutableMultiHypergraph * ret = managementInstance_->multiHypergraphFactory().createInstance();
+
+    ret->addVertices(static_cast<std::size_t>(vertexCount));
+
+    ret->addEdges(std::move(edges));
+
+    return ret;
+}
+
+htd::IMultiHypergraph * htd_io::BinaryFormatImporter::Implementation::importGraphEdges(const char * offsets, const char * contents, std::uint64_t vertexCount, std::uint64_t edgeCount) const
+{
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
+
+    edges.reserve(static_cast<std::size_t>(edgeCount));
+
+    for (std::uint64_t index = 1; index <= edgeCount; ++index)
+    {
+        if (read<std::uint64_t>(offsets + 8 * index) != 2 * index)
+        {
+            return nullptr;
+        }
+
+        std::uint32_t vertex1 = read<std::uint32_t>(contents + 8 * (index - 1));
+        std::uint32_t vertex2 = read<std::uint32_t>(contents + 8 * (index - 1) + 4);
+
+        if (vertex1 < htd::Vertex::FIRST || vertex1 >= vertexCount + htd::Vertex::FIRST ||
+            vertex2 < htd::Vertex::FIRST || vertex2 >= vertexCount + htd::Vertex::FIRST)
+        {
+            return nullptr;
+        }
+
+        edges.emplace_back(vertex1, vertex2);
+    }
+
+    htd::IMutableMultiGraph * ret = managementInstance_->multiGraphFactory().createInstance();
+
+    ret->addVertices(static_cast<std::size_t>(vertexCount));
+
+    ret->addEdges(edges);
+
+    return ret;
+}
+
+htd::ITreeDecomposition * htd_io::BinaryFormatImporter::Implementation::importDecomposition(const htd_io::InputBuffer & buffer) const
+{
+    std::uint64_t counts[3];
+
+    if (!readHeader(buffer, htd_io::BinaryFormat::TREE_DECOMPOSITION_MAGIC, counts))
+    {
+        return nullptr;
+    }
+
+    std::uint64_t nodeCount = counts[0];
+    std::uint64_t vertexCount = counts[1];
+    std::uint64_t entryCount = counts[2];
+
+    std::uint64_t payloadSize = buffer.size() - htd_io::BinaryFormat::HEADER_SIZE;
+
+    /* The second and third check rule out overflows in the computation of the expected payload size. */
+    if (vertexCount > 0xFFFFFFFF || nodeCount > payloadSize / 12 || entryCount > payloadSize / 4 ||
+        payloadSize != 8 * (nodeCount + 1) + 4 * nodeCount + 4 * entryCount)
+    {
+        return nullptr;
+    }
+
+    const char * offsets = buffer.begin() + htd_io::BinaryFormat::HEADER_SIZE;
+    const char * parents = offsets + 8 * (nodeCount + 1);
+    const char * contents = parents + 4 * nodeCount;
+
+    if (read<std::uint64_t>(offsets) != 0 || read<std::uint64_t>(offsets + 8 * nodeCount) != entryCount)
+    {
+        return nullptr;
+    }
+
+    htd::IMutableTreeDecomposition * ret = managementInstance_->treeDecompositionFactory().createInstance();
+
+    std::vector<htd::vertex_t> nodes;
+
+    nodes.reserve(static_cast<std::size_t>(nodeCount));
+
+    std::uint64_t bagBegin = 0;
+
+    bool error = false;
+
+    for (std::uint64_t index = 0; !error && index < nodeCount; ++index)
+    {
+        std::uint64_t bagEnd = read<std::uint64_t>(offsets + 8 * (index + 1));
+
+        std::uint32_t parent = read<std::uint32_t>(parents + 4 * index);
+
+        error = bagEnd < bagBegin || bagEnd > entryCount ||
+                (index == 0 ? parent != htd_io::BinaryFormat::NO_PARENT : parent >= index);
+
+        if (!error)
+        {
+            std::vector<htd::vertex_t> bag;
+
+            bag.reserve(static_cast<std::size_t>(bagEnd - bagBegin));
+
+            for (const char * position = contents + 4 * bagBegin; !error && position != contents + 4 * bagEnd; position += 4)
+            {
+                std::uint32_t vertex = read<std::uint32_t>(position);
+
+                /* Bag contents are sorted and free of duplicates, this is required by the decomposition algorithms. */
+                error = vertex < htd::Vertex::FIRST || vertex >= vertexCount + htd::Vertex::FIRST ||
+                        (!bag.empty() && vertex <= bag.back());
+
+                bag.push_back(vertex);
+            }
+
+            if (!error)
+            {
+                if (index == 0)
+                {
+                    nodes.push_back(ret->insertRoot(std::move(bag), htd::FilteredHyperedgeCollection()));
+                }
+                else
+                {
+                    nodes.push_back(ret->addChild(nodes[parent], std::move(bag), htd::FilteredHyperedgeCollection()));
+                }
+            }
+        }
+
+        bagBegin = bagEnd;
+    }
+
+    if (error)
+    {
+        delete ret;
+
+        return nullptr;
+    }
+
+    return ret;
+}
+
+#endif /* HTD_IO_BINARYFORMATIMPORTER_CPP */
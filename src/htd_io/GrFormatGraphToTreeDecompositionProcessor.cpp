@@ -28,6 +28,7 @@
 #include <htd_io/GrFormatGraphToTreeDecompositionProcessor.hpp>
 
 #include <htd_io/GrFormatImporter.hpp>
+#include <htd_io/WidthExporter.hpp>
 
 #include <htd/main.hpp>
 
@@ -181,6 +182,13 @@ void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & i
 
         htd::ITreeDecomposition * decomposition = nullptr;
 
+        /* The width exporter only needs the maximum bag size, which some algorithms determine without constructing the decomposition. */
+        const htd_io::WidthExporter * widthExporter = dynamic_cast<const htd_io::WidthExporter *>(implementation_->exporter_);
+
+        const htd::IWidthEvaluatingTreeDecompositionAlgorithm * widthEvaluatingAlgorithm = dynamic_cast<const htd::IWidthEvaluatingTreeDecompositionAlgorithm *>(algorithm);
+
+        std::size_t maximumBagSize = (std::size_t)-1;
+
         if (implementation_->preprocessor_ != nullptr)
         {
             htd::IPreprocessedGraph * preprocessedGraph = implementation_->preprocessor_->prepare(*graph);
@@ -203,6 +211,15 @@ void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & i
                     implementation_->invokeDecompositionCallbacks(fitness);
                 });
             }
+            else if (widthExporter != nullptr && widthEvaluatingAlgorithm != nullptr)
+            {
+                maximumBagSize = widthEvaluatingAlgorithm->computeMaximumBagSize(*graph, *preprocessedGraph);
+
+                if (maximumBagSize != (std::size_t)-1)
+                {
+                    implementation_->invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(maximumBagSize))));
+                }
+            }
             else
             {
                 decomposition = algorithm->computeDecomposition(*graph, *preprocessedGraph);
@@ -231,6 +248,15 @@ void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & i
                     implementation_->invokeDecompositionCallbacks(fitness);
                 });
             }
+            else if (widthExporter != nullptr && widthEvaluatingAlgorithm != nullptr)
+            {
+                maximumBagSize = widthEvaluatingAlgorithm->computeMaximumBagSize(*graph);
+
+                if (maximumBagSize != (std::size_t)-1)
+                {
+                    implementation_->invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(maximumBagSize))));
+                }
+            }
             else
             {
                 decomposition = algorithm->computeDecomposition(*graph);
@@ -253,6 +279,10 @@ void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & i
 
             delete decomposition;
         }
+        else if (maximumBagSize != (std::size_t)-1)
+        {
+            widthExporter->write(maximumBagSize, outputStream);
+        }
 
         delete graph;
     }
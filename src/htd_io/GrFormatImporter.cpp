@@ -26,12 +26,15 @@
 #define HTD_IO_GRFORMATIMPORTER_CPP
 
 #include <htd_io/GrFormatImporter.hpp>
+#include <htd_io/InputBuffer.hpp>
 
 #include <htd/MultiGraphFactory.hpp>
+#include <htd/ThreadPool.hpp>
 
-#include <fstream>
+#include <algorithm>
 #include <string>
-#include <stdexcept>
+#include <utility>
+#include <vector>
 
 /**
  *  Private implementation details of class htd_io::GrFormatImporter.
@@ -43,7 +46,7 @@ struct htd_io::GrFormatImporter::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), threadCount_(1)
     {
 
     }
@@ -57,6 +60,44 @@ struct htd_io::GrFormatImporter::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The number of threads which are used to parse the edges.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  Create a new IMultiGraph instance based on the content of the given input buffer.
+     *
+     *  @param[in] buffer   The input buffer holding the content of the instance.
+     *
+     *  @return A new IMultiGraph instance based on the content of the given input buffer or nullptr if the input is malformed.
+     */
+    htd::IMultiGraph * import(const htd_io::InputBuffer & buffer) const;
+
+    /**
+     *  Parse the problem line of an instance.
+     *
+     *  @param[in] position     The first character of the problem line.
+     *  @param[in] end          The end of the problem line (excluding the line break).
+     *  @param[out] vertexCount The number of vertices stated in the problem line.
+     *  @param[out] edgeCount   The number of edges stated in the problem line.
+     *
+     *  @return True if the problem line is valid, false otherwise.
+     */
+    bool parseHeader(const char * position, const char * end, std::size_t & vertexCount, std::size_t & edgeCount) const;
+
+    /**
+     *  Parse the edges stored in the given range of complete lines.
+     *
+     *  @param[in] position     The first character of the range.
+     *  @param[in] end          The position after the last character of the range.
+     *  @param[in] vertexCount  The number of vertices stated in the problem line.
+     *  @param[out] edges       The vector to which the parsed edges shall be appended.
+     *
+     *  @return True if all lines in the given range are valid, false otherwise.
+     */
+    bool parseEdges(const char * position, const char * end, std::size_t vertexCount, std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) const;
 };
 
 htd_io::GrFormatImporter::GrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -71,12 +112,39 @@ htd_io::GrFormatImporter::~GrFormatImporter(void)
 
 htd::IMultiGraph * htd_io::GrFormatImporter::import(const std::string & path) const
 {
-    std::ifstream stream(path);
+    htd_io::InputBuffer buffer;
+
+    if (!buffer.load(path))
+    {
+        return nullptr;
+    }
 
-    return import(stream);
+    return implementation_->import(buffer);
 }
 
 htd::IMultiGraph * htd_io::GrFormatImporter::import(std::istream & stream) const
+{
+    htd_io::InputBuffer buffer;
+
+    if (!buffer.load(stream))
+    {
+        return nullptr;
+    }
+
+    return implementation_->import(buffer);
+}
+
+std::size_t htd_io::GrFormatImporter::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd_io::GrFormatImporter::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
+htd::IMultiGraph * htd_io::GrFormatImporter::Implementation::import(const htd_io::InputBuffer & buffer) const
 {
     std::size_t vertexCount = 0;
     std::size_t edgeCount = 0;
@@ -85,106 +153,191 @@ htd::IMultiGraph * htd_io::GrFormatImporter::import(std::istream & stream) const
 
     bool error = false;
 
-    htd::IMutableMultiGraph * ret = implementation_->managementInstance_->multiGraphFactory().createInstance();
+    const char * position = buffer.begin();
+    const char * end = buffer.end();
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
-
-    if (stream.good())
+    while (firstLine && !error && position != end)
     {
-        std::string line;
-
-        std::size_t pos = 0;
+        const char * lineEnd = htd_io::InputBuffer::lineEnd(position, end);
+        const char * contentEnd = lineEnd;
 
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
+        if (contentEnd != position && *(contentEnd - 1) == '\r')
         {
-            if (line.empty())
-            {
-                error = true;
-            }
-            else
-            {
-                if (line[line.size() - 1] == '\r')
-                {
-                    line.pop_back();
-                }
+            --contentEnd;
+        }
 
-                if (line[0] != 'c')
-                {
-                    if (firstLine)
-                    {
-                        if (line.compare(0, 5, "p tw ") != 0)
-                        {
-                            error = true;
-                        }
+        if (contentEnd == position)
+        {
+            error = true;
+        }
+        else if (*position != 'c')
+        {
+            error = !parseHeader(position, contentEnd, vertexCount, edgeCount);
 
-                        line = line.substr(5);
+            firstLine = false;
+        }
 
-                        vertexCount = std::stol(line, &pos);
+        position = lineEnd != end ? lineEnd + 1 : end;
+    }
 
-                        if (line[pos] != ' ')
-                        {
-                            error = true;
-                        }
+    if (firstLine || error)
+    {
+        return nullptr;
+    }
 
-                        line = line.substr(pos + 1);
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
 
-                        edgeCount = std::stol(line, &pos);
+    std::size_t threadCount = htd::ThreadPool::effectiveThreadCount(threadCount_);
 
-                        if (pos != line.length())
-                        {
-                            error = true;
-                        }
+    std::size_t chunkCount = std::min(threadCount, static_cast<std::size_t>(end - position) / (1 << 22) + 1);
 
-                        ret->addVertices(vertexCount);
+    if (chunkCount <= 1)
+    {
+        /* Every edge occupies at least four characters, this bounds the reservation for malformed problem lines. */
+        edges.reserve(std::min(edgeCount, static_cast<std::size_t>(end - position) / 4 + 1));
 
-                        firstLine = false;
-                    }
-                    else
-                    {
-                        htd::vertex_t vertex1 = std::stoul(line, &pos);
+        error = !parseEdges(position, end, vertexCount, edges);
+    }
+    else
+    {
+        std::vector<std::pair<const char *, const char *>> chunks = htd_io::InputBuffer::split(position, end, chunkCount);
 
-                        if (line[pos] != ' ')
-                        {
-                            error = true;
-                        }
-                        else
-                        {
-                            line = line.substr(pos + 1);
+        std::vector<std::vector<std::pair<htd::vertex_t, htd::vertex_t>>> chunkEdges(chunks.size());
 
-                            htd::vertex_t vertex2 = std::stoul(line, &pos);
+        std::vector<char> chunkValid(chunks.size(), 0);
 
-                            if (pos != line.length())
-                            {
-                                error = true;
-                            }
+        {
+            htd::ThreadPool threadPool(std::min(threadCount, chunks.size()));
 
-                            ret->addEdge(vertex1, vertex2);
+            for (htd::index_t index = 0; index < chunks.size(); ++index)
+            {
+                threadPool.submit([&, index]()
+                {
+                    chunkEdges[index].reserve(static_cast<std::size_t>(chunks[index].second - chunks[index].first) / 4 + 1);
 
-                            edgeCount--;
-                        }
-                    }
-                }
+                    chunkValid[index] = parseEdges(chunks[index].first, chunks[index].second, vertexCount, chunkEdges[index]) ? 1 : 0;
+                });
             }
+
+            threadPool.wait();
+        }
+
+        std::size_t parsedEdgeCount = 0;
+
+        for (htd::index_t index = 0; index < chunks.size(); ++index)
+        {
+            error = error || chunkValid[index] == 0;
+
+            parsedEdgeCount += chunkEdges[index].size();
         }
 
-        if (edgeCount != 0 && !managementInstance.isTerminated())
+        if (!error)
         {
-            error = true;
+            edges.reserve(parsedEdgeCount);
+
+            for (std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & currentEdges : chunkEdges)
+            {
+                edges.insert(edges.end(), currentEdges.begin(), currentEdges.end());
+
+                std::vector<std::pair<htd::vertex_t, htd::vertex_t>>().swap(currentEdges);
+            }
         }
     }
-    else
+
+    if (error || (edges.size() != edgeCount && !managementInstance_->isTerminated()))
     {
-        error = true;
+        return nullptr;
     }
 
-    if (firstLine || error)
+    htd::IMutableMultiGraph * ret = managementInstance_->multiGraphFactory().createInstance();
+
+    ret->addVertices(vertexCount);
+
+    ret->addEdges(edges);
+
+    return ret;
+}
+
+bool htd_io::GrFormatImporter::Implementation::parseHeader(const char * position, const char * end, std::size_t & vertexCount, std::size_t & edgeCount) const
+{
+    static const std::string prefix("p tw ");
+
+    if (static_cast<std::size_t>(end - position) < prefix.length() || !std::equal(prefix.begin(), prefix.end(), position))
     {
-        delete ret;
+        return false;
+    }
 
-        ret = nullptr;
+    position += prefix.length();
+
+    if (!htd_io::InputBuffer::readNumber(position, end, vertexCount) || position == end || *position != ' ')
+    {
+        return false;
     }
-    
-    return ret;
+
+    htd_io::InputBuffer::skipBlanks(position, end);
+
+    if (!htd_io::InputBuffer::readNumber(position, end, edgeCount))
+    {
+        return false;
+    }
+
+    return position == end;
+}
+
+bool htd_io::GrFormatImporter::Implementation::parseEdges(const char * position, const char * end, std::size_t vertexCount, std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) const
+{
+    std::size_t lineCount = 0;
+
+    while (position != end)
+    {
+        const char * lineEnd = htd_io::InputBuffer::lineEnd(position, end);
+        const char * contentEnd = lineEnd;
+
+        if (contentEnd != position && *(contentEnd - 1) == '\r')
+        {
+            --contentEnd;
+        }
+
+        if (contentEnd == position)
+        {
+            return false;
+        }
+
+        if (*position != 'c')
+        {
+            std::size_t vertex1 = 0;
+            std::size_t vertex2 = 0;
+
+            if (!htd_io::InputBuffer::readNumber(position, contentEnd, vertex1) || position == contentEnd || *position != ' ')
+            {
+                return false;
+            }
+
+            htd_io::InputBuffer::skipBlanks(position, contentEnd);
+
+            if (!htd_io::InputBuffer::readNumber(position, contentEnd, vertex2) || position != contentEnd)
+            {
+                return false;
+            }
+
+            if (vertex1 < htd::Vertex::FIRST || vertex1 >= vertexCount + htd::Vertex::FIRST ||
+                vertex2 < htd::Vertex::FIRST || vertex2 >= vertexCount + htd::Vertex::FIRST)
+            {
+                return false;
+            }
+
+            edges.emplace_back(vertex1, vertex2);
+        }
+
+        position = lineEnd != end ? lineEnd + 1 : end;
+
+        if ((++lineCount & 0xFFFF) == 0 && managementInstance_->isTerminated())
+        {
+            return true;
+        }
+    }
+
+    return true;
 }
 
 #endif /* HTD_IO_GRFORMATIMPORTER_CPP */
@@ -26,12 +26,16 @@
 #define HTD_IO_HGRFORMATIMPORTER_CPP
 
 #include <htd_io/HgrFormatImporter.hpp>
+#include <htd_io/InputBuffer.hpp>
 
 #include <htd/MultiHypergraphFactory.hpp>
+#include <htd/ThreadPool.hpp>
 
-#include <fstream>
+#include <algorithm>
+#include <iterator>
 #include <string>
-#include <stdexcept>
+#include <utility>
+#include <vector>
 
 /**
  *  Private implementation details of class htd_io::HgrFormatImporter.
@@ -43,7 +47,7 @@ struct htd_io::HgrFormatImporter::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), threadCount_(1)
     {
 
     }
@@ -57,6 +61,44 @@ struct htd_io::HgrFormatImporter::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The number of threads which are used to parse the hyperedges.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  Create a new IMultiHypergraph instance based on the content of the given input buffer.
+     *
+     *  @param[in] buffer   The input buffer holding the content of the instance.
+     *
+     *  @return A new IMultiHypergraph instance based on the content of the given input buffer or nullptr if the input is malformed.
+     */
+    htd::IMultiHypergraph * import(const htd_io::InputBuffer & buffer) const;
+
+    /**
+     *  Parse the problem line of an instance.
+     *
+     *  @param[in] position     The first character of the problem line.
+     *  @param[in] end          The end of the problem line (excluding the line break).
+     *  @param[out] vertexCount The number of vertices stated in the problem line.
+     *  @param[out] edgeCount   The number of edges stated in the problem line.
+     *
+     *  @return True if the problem line is valid, false otherwise.
+     */
+    bool parseHeader(const char * position, const char * end, std::size_t & vertexCount, std::size_t & edgeCount) const;
+
+    /**
+     *  Parse the hyperedges stored in the given range of complete lines.
+     *
+     *  @param[in] position     The first character of the range.
+     *  @param[in] end          The position after the last character of the range.
+     *  @param[in] vertexCount  The number of vertices stated in the problem line.
+     *  @param[out] edges       The vector to which the parsed hyperedges shall be appended.
+     *
+     *  @return True if all lines in the given range are valid, false otherwise.
+     */
+    bool parseEdges(const char * position, const char * end, std::size_t vertexCount, std::vector<std::vector<htd::vertex_t>> & edges) const;
 };
 
 htd_io::HgrFormatImporter::HgrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -71,12 +113,39 @@ htd_io::HgrFormatImporter::~HgrFormatImporter(void)
 
 htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(const std::string & path) const
 {
-    std::ifstream stream(path);
+    htd_io::InputBuffer buffer;
+
+    if (!buffer.load(path))
+    {
+        return nullptr;
+    }
 
-    return import(stream);
+    return implementation_->import(buffer);
 }
 
 htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream) const
+{
+    htd_io::InputBuffer buffer;
+
+    if (!buffer.load(stream))
+    {
+        return nullptr;
+    }
+
+    return implementation_->import(buffer);
+}
+
+std::size_t htd_io::HgrFormatImporter::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd_io::HgrFormatImporter::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
+htd::IMultiHypergraph * htd_io::HgrFormatImporter::Implementation::import(const htd_io::InputBuffer & buffer) const
 {
     std::size_t vertexCount = 0;
     std::size_t edgeCount = 0;
@@ -85,113 +154,194 @@ htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream)
 
     bool error = false;
 
-    htd::IMutableMultiHypergraph * ret = implementation_->managementInstance_->multiHypergraphFactory().createInstance();
+    const char * position = buffer.begin();
+    const char * end = buffer.end();
+
+    while (firstLine && !error && position != end)
+    {
+        const char * lineEnd = htd_io::InputBuffer::lineEnd(position, end);
+        const char * contentEnd = lineEnd;
+
+        if (contentEnd != position && *(contentEnd - 1) == '\r')
+        {
+            --contentEnd;
+        }
+
+        if (contentEnd == position)
+        {
+            error = true;
+        }
+        else if (*position != 'c')
+        {
+            error = !parseHeader(position, contentEnd, vertexCount, edgeCount);
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+            firstLine = false;
+        }
+
+        position = lineEnd != end ? lineEnd + 1 : end;
+    }
 
-    if (stream.good())
+    if (firstLine || error)
     {
-        std::string line;
+        return nullptr;
+    }
+
+    std::vector<std::vector<htd::vertex_t>> edges;
+
+    std::size_t threadCount = htd::ThreadPool::effectiveThreadCount(threadCount_);
+
+    std::size_t chunkCount = std::min(threadCount, static_cast<std::size_t>(end - position) / (1 << 22) + 1);
+
+    if (chunkCount <= 1)
+    {
+        /* Every hyperedge occupies at least two characters, this bounds the reservation for malformed problem lines. */
+        edges.reserve(std::min(edgeCount, static_cast<std::size_t>(end - position) / 2 + 1));
+
+        error = !parseEdges(position, end, vertexCount, edges);
+    }
+    else
+    {
+        std::vector<std::pair<const char *, const char *>> chunks = htd_io::InputBuffer::split(position, end, chunkCount);
+
+        std::vector<std::vector<std::vector<htd::vertex_t>>> chunkEdges(chunks.size());
+
+        std::vector<char> chunkValid(chunks.size(), 0);
 
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
         {
-            if (line.empty())
+            htd::ThreadPool threadPool(std::min(threadCount, chunks.size()));
+
+            for (htd::index_t index = 0; index < chunks.size(); ++index)
             {
-                error = true;
+                threadPool.submit([&, index]()
+                {
+                    chunkEdges[index].reserve(static_cast<std::size_t>(chunks[index].second - chunks[index].first) / 2 + 1);
+
+                    chunkValid[index] = parseEdges(chunks[index].first, chunks[index].second, vertexCount, chunkEdges[index]) ? 1 : 0;
+                });
             }
-            else
+
+            threadPool.wait();
+        }
+
+        std::size_t parsedEdgeCount = 0;
+
+        for (htd::index_t index = 0; index < chunks.size(); ++index)
+        {
+            error = error || chunkValid[index] == 0;
+
+            parsedEdgeCount += chunkEdges[index].size();
+        }
+
+        if (!error)
+        {
+            edges.reserve(parsedEdgeCount);
+
+            for (std::vector<std::vector<htd::vertex_t>> & currentEdges : chunkEdges)
             {
-                if (line[line.size() - 1] == '\r')
-                {
-                    line.pop_back();
-                }
+                std::move(currentEdges.begin(), currentEdges.end(), std::back_inserter(edges));
 
-                if (line[0] != 'c')
-                {
-                    if (firstLine)
-                    {
-                        if (line.length() < 5 || line.compare(0, 5, "p tw ") != 0)
-                        {
-                            error = true;
-                        }
-                        else
-                        {
-                            line = line.substr(5);
+                std::vector<std::vector<htd::vertex_t>>().swap(currentEdges);
+            }
+        }
+    }
 
-                            std::size_t pos = 0;
+    if (error || (edges.size() != edgeCount && !managementInstance_->isTerminated()))
+    {
+        return nullptr;
+    }
 
-                            vertexCount = std::stol(line, &pos);
+    htd::IMutableMultiHypergraph * ret = managementInstance_->multiHypergraphFactory().createInstance();
 
-                            if (line[pos] != ' ')
-                            {
-                                error = true;
-                            }
+    ret->addVertices(vertexCount);
 
-                            line = line.substr(pos + 1);
+    ret->addEdges(std::move(edges));
 
-                            edgeCount = std::stol(line, &pos);
+    return ret;
+}
 
-                            if (pos != line.length())
-                            {
-                                error = true;
-                            }
+bool htd_io::HgrFormatImporter::Implementation::parseHeader(const char * position, const char * end, std::size_t & vertexCount, std::size_t & edgeCount) const
+{
+    static const std::string prefix("p tw ");
 
-                            ret->addVertices(vertexCount);
+    if (static_cast<std::size_t>(end - position) < prefix.length() || !std::equal(prefix.begin(), prefix.end(), position))
+    {
+        return false;
+    }
 
-                            firstLine = false;
-                        }
-                    }
-                    else
-                    {
-                        std::size_t pos = 0;
+    position += prefix.length();
 
-                        std::vector<htd::vertex_t> vertices;
+    if (!htd_io::InputBuffer::readNumber(position, end, vertexCount) || position == end || *position != ' ')
+    {
+        return false;
+    }
 
-                        while (!error && pos != line.length())
-                        {
-                            vertices.push_back(std::stoul(line, &pos));
+    htd_io::InputBuffer::skipBlanks(position, end);
 
-                            if (pos != line.length())
-                            {
-                                if (line[pos] != ' ')
-                                {
-                                    error = true;
-                                }
-                                else
-                                {
-                                    line = line.substr(pos + 1);
+    if (!htd_io::InputBuffer::readNumber(position, end, edgeCount))
+    {
+        return false;
+    }
 
-                                    pos = 0;
-                                }
-                            }
-                        }
+    return position == end;
+}
 
-                        ret->addEdge(std::move(vertices));
+bool htd_io::HgrFormatImporter::Implementation::parseEdges(const char * position, const char * end, std::size_t vertexCount, std::vector<std::vector<htd::vertex_t>> & edges) const
+{
+    std::size_t lineCount = 0;
 
-                        edgeCount--;
+    while (position != end)
+    {
+        const char * lineEnd = htd_io::InputBuffer::lineEnd(position, end);
+        const char * contentEnd = lineEnd;
+
+        if (contentEnd != position && *(contentEnd - 1) == '\r')
+        {
+            --contentEnd;
+        }
+
+        if (contentEnd == position)
+        {
+            return false;
+        }
+
+        if (*position != 'c')
+        {
+            std::vector<htd::vertex_t> elements;
+
+            while (position != contentEnd)
+            {
+                std::size_t vertex = 0;
+
+                if (!htd_io::InputBuffer::readNumber(position, contentEnd, vertex) || vertex < htd::Vertex::FIRST || vertex >= vertexCount + htd::Vertex::FIRST)
+                {
+                    return false;
+                }
+
+                elements.push_back(vertex);
+
+                if (position != contentEnd)
+                {
+                    if (*position != ' ')
+                    {
+                        return false;
                     }
+
+                    htd_io::InputBuffer::skipBlanks(position, contentEnd);
                 }
             }
-        }
 
-        if (edgeCount != 0 && !managementInstance.isTerminated())
-        {
-            error = true;
+            edges.push_back(std::move(elements));
         }
-    }
-    else
-    {
-        error = true;
-    }
 
-    if (firstLine || error)
-    {
-        delete ret;
+        position = lineEnd != end ? lineEnd + 1 : end;
 
-        ret = nullptr;
+        if ((++lineCount & 0xFFFF) == 0 && managementInstance_->isTerminated())
+        {
+            return true;
+        }
     }
 
-    return ret;
+    return true;
 }
 
 #endif /* HTD_IO_HGRFORMATIMPORTER_CPP */
@@ -27,8 +27,12 @@
 
 #include <htd_io/HumanReadableExporter.hpp>
 
+#include <htd_io/OutputBuffer.hpp>
+
 #include <htd/PreOrderTreeTraversal.hpp>
 
+#include <cstring>
+
 htd_io::HumanReadableExporter::HumanReadableExporter(void)
 {
 
@@ -39,103 +43,91 @@ htd_io::HumanReadableExporter::~HumanReadableExporter()
 
 }
 
-void printBagContent(const std::vector<htd::vertex_t> & bag, std::ostream & outputStream)
+void printBagContent(const std::vector<htd::vertex_t> & bag, htd_io::OutputBuffer & buffer)
 {
-    outputStream << "[ ";
+    buffer.append("[ ", 2);
 
     if (bag.empty())
     {
-        outputStream << "]";
+        buffer.append(']');
     }
     else
     {
         for (htd::index_t index = 0; index < bag.size(); ++index)
         {
-            outputStream << bag.at(index);
+            buffer.appendNumber(bag[index]);
 
             if (index < bag.size() - 1)
             {
-                outputStream << ", ";
+                buffer.append(", ", 2);
             }
         }
 
-        outputStream << " ]";
+        buffer.append(" ]", 2);
     }
 }
 
-void printBagContent(const std::vector<htd::vertex_t> & bag, std::ostream & outputStream, const htd::NamedMultiHypergraph<std::string, std::string> & graph)
+void printBagContent(const std::vector<htd::vertex_t> & bag, htd_io::OutputBuffer & buffer, const htd::NamedMultiHypergraph<std::string, std::string> & graph)
 {
-    outputStream << "[ ";
+    buffer.append("[ ", 2);
 
     if (bag.empty())
     {
-        outputStream << "]";
+        buffer.append(']');
     }
     else
     {
         for (htd::index_t index = 0; index < bag.size(); ++index)
         {
-            outputStream << graph.vertexName(bag.at(index));
+            buffer.append(graph.vertexName(bag[index]));
 
             if (index < bag.size() - 1)
             {
-                outputStream << ", ";
+                buffer.append(", ", 2);
             }
         }
 
-        outputStream << " ]";
+        buffer.append(" ]", 2);
     }
 }
 
-void printHyperedge(const htd::Hyperedge & hyperedge, std::ostream & outputStream)
+void printHyperedge(const htd::Hyperedge & hyperedge, htd_io::OutputBuffer & buffer)
 {
-    outputStream << "HYPEREDGE " << hyperedge.id() << ": [ ";
+    buffer.append("HYPEREDGE ", 10);
+    buffer.appendNumber(hyperedge.id());
+    buffer.append(": ", 2);
 
     const std::vector<htd::vertex_t> & elements = hyperedge.elements();
 
     if (elements.empty())
     {
-        outputStream << "]";
+        buffer.append("<EMPTY>", 7);
     }
     else
     {
+        buffer.append("[ ", 2);
+
         for (htd::index_t index = 0; index < elements.size(); ++index)
         {
-            outputStream << elements.at(index);
+            buffer.appendNumber(elements[index]);
 
             if (index < elements.size() - 1)
             {
-                outputStream << ", ";
+                buffer.append(", ", 2);
             }
         }
 
-        outputStream << " ]";
+        buffer.append(" ]", 2);
     }
 }
 
-void printHyperedge(const htd::Hyperedge & hyperedge, std::ostream & outputStream, const htd::NamedMultiHypergraph<std::string, std::string> & graph)
+void printIndentation(std::size_t depth, const char * indentation, htd_io::OutputBuffer & buffer)
 {
-    outputStream << "HYPEREDGE " << hyperedge.id() << ": [ ";
+    std::size_t length = std::strlen(indentation);
 
-    const std::vector<htd::vertex_t> & elements = hyperedge.elements();
-
-    if (elements.empty())
+    for (htd::index_t index = 0; index < depth; ++index)
     {
-        outputStream << "]";
-    }
-    else
-    {
-        for (htd::index_t index = 0; index < elements.size(); ++index)
-        {
-            outputStream << graph.vertexName(elements.at(index));
-
-            if (index < elements.size() - 1)
-            {
-                outputStream << ", ";
-            }
-        }
-
-        outputStream << " ]";
+        buffer.append(indentation, length);
     }
 }
 
@@ -143,122 +135,126 @@ void htd_io::HumanReadableExporter::write(const htd::ITreeDecomposition & decomp
 {
     htd::PreOrderTreeTraversal traversal;
 
+    htd_io::OutputBuffer buffer(outputStream);
+
     HTD_UNUSED(graph)
 
     traversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToRoot)
     {
         HTD_UNUSED(parent)
 
-        for (htd::index_t index = 0; index < distanceToRoot; ++index)
-        {
-            outputStream << "  ";
-        }
+        printIndentation(distanceToRoot, "  ", buffer);
 
-        outputStream << "NODE " << vertex << ": ";
+        buffer.append("NODE ", 5);
+        buffer.appendNumber(vertex);
+        buffer.append(": ", 2);
 
-        printBagContent(decomposition.bagContent(vertex), outputStream);
+        printBagContent(decomposition.bagContent(vertex), buffer);
 
-        outputStream << std::endl;
+        buffer.append('\n');
     });
+
+    buffer.flush();
 }
 
 void htd_io::HumanReadableExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
 {
     htd::PreOrderTreeTraversal traversal;
 
+    htd_io::OutputBuffer buffer(outputStream);
+
     traversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToRoot)
     {
         HTD_UNUSED(parent)
 
-        for (htd::index_t index = 0; index < distanceToRoot; ++index)
-        {
-            outputStream << "   ";
-        }
+        printIndentation(distanceToRoot, "   ", buffer);
 
-        outputStream << "NODE " << vertex << ": ";
+        buffer.append("NODE ", 5);
+        buffer.appendNumber(vertex);
+        buffer.append(": ", 2);
 
-        printBagContent(decomposition.bagContent(vertex), outputStream, graph);
+        printBagContent(decomposition.bagContent(vertex), buffer, graph);
 
-        outputStream << std::endl;
+        buffer.append('\n');
     });
+
+    buffer.flush();
 }
 
 void htd_io::HumanReadableExporter::write(const htd::IHypertreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
 {
     htd::PreOrderTreeTraversal traversal;
 
+    htd_io::OutputBuffer buffer(outputStream);
+
     HTD_UNUSED(graph)
 
     traversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToRoot)
     {
         HTD_UNUSED(parent)
 
-        for (htd::index_t index = 0; index < distanceToRoot; ++index)
-        {
-            outputStream << "  ";
-        }
+        printIndentation(distanceToRoot, "  ", buffer);
 
-        outputStream << "NODE " << vertex << ": ";
+        buffer.append("NODE ", 5);
+        buffer.appendNumber(vertex);
+        buffer.append(": ", 2);
 
-        printBagContent(decomposition.bagContent(vertex), outputStream);
+        printBagContent(decomposition.bagContent(vertex), buffer);
 
-        outputStream << std::endl;
+        buffer.append('\n');
 
-        for (htd::index_t index = 0; index < distanceToRoot + 1; ++index)
-        {
-            outputStream << "  ";
-        }
+        printIndentation(distanceToRoot + 1, "  ", buffer);
 
-        outputStream << "COVERING EDGES: " << std::endl;
+        buffer.append("COVERING EDGES: \n", 17);
 
         for (const htd::Hyperedge & edge : decomposition.coveringEdges(vertex))
         {
-            for (htd::index_t index = 0; index < distanceToRoot + 2; ++index)
-            {
-                outputStream << "  ";
-            }
+            printIndentation(distanceToRoot + 2, "  ", buffer);
+
+            printHyperedge(edge, buffer);
 
-            outputStream << "HYPEREDGE " << edge.id() << ": " << edge.elements() << std::endl;
+            buffer.append('\n');
         }
     });
+
+    buffer.flush();
 }
 
 void htd_io::HumanReadableExporter::write(const htd::IHypertreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
 {
     htd::PreOrderTreeTraversal traversal;
 
+    htd_io::OutputBuffer buffer(outputStream);
+
     traversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToRoot)
     {
         HTD_UNUSED(parent)
 
-        for (htd::index_t index = 0; index < distanceToRoot; ++index)
-        {
-            outputStream << "   ";
-        }
+        printIndentation(distanceToRoot, "   ", buffer);
 
-        outputStream << "NODE " << vertex << ": ";
+        buffer.append("NODE ", 5);
+        buffer.appendNumber(vertex);
+        buffer.append(": ", 2);
 
-        printBagContent(decomposition.bagContent(vertex), outputStream, graph);
+        printBagContent(decomposition.bagContent(vertex), buffer, graph);
 
-        outputStream << std::endl;
+        buffer.append('\n');
 
-        for (htd::index_t index = 0; index < distanceToRoot + 1; ++index)
-        {
-            outputStream << "  ";
-        }
+        printIndentation(distanceToRoot + 1, "  ", buffer);
 
-        outputStream << "COVERING EDGES: " << std::endl;
+        buffer.append("COVERING EDGES: \n", 17);
 
         for (const htd::Hyperedge & edge : decomposition.coveringEdges(vertex))
         {
-            for (htd::index_t index = 0; index < distanceToRoot + 2; ++index)
-            {
-                outputStream << "  ";
-            }
+            printIndentation(distanceToRoot + 2, "  ", buffer);
 
-            outputStream << "HYPEREDGE " << edge.id() << ": " << edge.elements() << std::endl;
+            printHyperedge(edge, buffer);
+
+            buffer.append('\n');
         }
     });
+
+    buffer.flush();
 }
 
 #endif /* HTD_IO_HUMANREADABLEEXPORTER_CPP */
@@ -0,0 +1,238 @@
+/*
+ * File:   InputBuffer.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_INPUTBUFFER_CPP
+#define HTD_IO_INPUTBUFFER_CPP
+
+#include <htd_io/InputBuffer.hpp>
+
+#include <fstream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ *  Private implementation details of class htd_io::InputBuffer.
+ */
+struct htd_io::InputBuffer::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     */
+    Implementation(void) : data_(nullptr), size_(0), mapped_(false), content_()
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+        reset();
+    }
+
+    /**
+     *  Release the current content of the buffer.
+     */
+    void reset(void)
+    {
+#if !defined(_WIN32)
+        if (mapped_)
+        {
+            munmap(const_cast<char *>(data_), size_);
+        }
+#endif
+
+        data_ = nullptr;
+
+        size_ = 0;
+
+        mapped_ = false;
+
+        content_.clear();
+        content_.shrink_to_fit();
+    }
+
+    /**
+     *  A pointer to the first character of the buffer.
+     */
+    const char * data_;
+
+    /**
+     *  The number of characters stored in the buffer.
+     */
+    std::size_t size_;
+
+    /**
+     *  A boolean flag indicating whether the buffer refers to a memory-mapped file.
+     */
+    bool mapped_;
+
+    /**
+     *  The content of the buffer in case that the input is not memory-mapped.
+     */
+    std::vector<char> content_;
+};
+
+htd_io::InputBuffer::InputBuffer(void) : implementation_(new Implementation())
+{
+
+}
+
+htd_io::InputBuffer::~InputBuffer()
+{
+
+}
+
+bool htd_io::InputBuffer::load(const std::string & path)
+{
+    implementation_->reset();
+
+#if !defined(_WIN32)
+    int fileDescriptor = open(path.c_str(), O_RDONLY);
+
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat fileInformation;
+
+    if (fstat(fileDescriptor, &fileInformation) == 0 && S_ISREG(fileInformation.st_mode))
+    {
+        std::size_t fileSize = static_cast<std::size_t>(fileInformation.st_size);
+
+        if (fileSize == 0)
+        {
+            close(fileDescriptor);
+
+            return true;
+        }
+
+        void * data = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+        if (data != MAP_FAILED)
+        {
+            close(fileDescriptor);
+
+            madvise(data, fileSize, MADV_SEQUENTIAL);
+
+            implementation_->data_ = static_cast<const char *>(data);
+
+            implementation_->size_ = fileSize;
+
+            implementation_->mapped_ = true;
+
+            return true;
+        }
+    }
+
+    close(fileDescriptor);
+#endif
+
+    std::ifstream stream(path, std::ios::in | std::ios::binary);
+
+    return stream.good() && load(stream);
+}
+
+bool htd_io::InputBuffer::load(std::istream & stream)
+{
+    implementation_->reset();
+
+    if (!stream.good())
+    {
+        return false;
+    }
+
+    std::vector<char> & content = implementation_->content_;
+
+    std::size_t size = 0;
+
+    do
+    {
+        content.resize(size + (1 << 20) > 2 * size ? size + (1 << 20) : 2 * size);
+
+        stream.read(content.data() + size, static_cast<std::streamsize>(content.size() - size));
+
+        size += static_cast<std::size_t>(stream.gcount());
+    }
+    while (stream.good());
+
+    if (stream.bad())
+    {
+        content.clear();
+
+        return false;
+    }
+
+    content.resize(size);
+
+    implementation_->data_ = content.data();
+
+    implementation_->size_ = size;
+
+    return true;
+}
+
+const char * htd_io::InputBuffer::begin(void) const HTD_NOEXCEPT
+{
+    return implementation_->data_;
+}
+
+const char * htd_io::InputBuffer::end(void) const HTD_NOEXCEPT
+{
+    return implementation_->data_ + implementation_->size_;
+}
+
+std::size_t htd_io::InputBuffer::size(void) const HTD_NOEXCEPT
+{
+    return implementation_->size_;
+}
+
+std::vector<std::pair<const char *, const char *>> htd_io::InputBuffer::split(const char * begin, const char * end, std::size_t chunkCount)
+{
+    std::vector<std::pair<const char *, const char *>> ret;
+
+    std::size_t chunkSize = (static_cast<std::size_t>(end - begin) + (chunkCount > 0 ? chunkCount : 1) - 1) / (chunkCount > 0 ? chunkCount : 1);
+
+    while (begin != end)
+    {
+        const char * chunkEnd = static_cast<std::size_t>(end - begin) > chunkSize ? lineEnd(begin + chunkSize, end) : end;
+
+        if (chunkEnd != end)
+        {
+            ++chunkEnd;
+        }
+
+        ret.emplace_back(begin, chunkEnd);
+
+        begin = chunkEnd;
+    }
+
+    return ret;
+}
+
+#endif /* HTD_IO_INPUTBUFFER_CPP */
@@ -26,10 +26,11 @@
 #define HTD_IO_LPFORMATIMPORTER_CPP
 
 #include <htd_io/LpFormatImporter.hpp>
+#include <htd_io/InputBuffer.hpp>
 
-#include <fstream>
-#include <iostream>
+#include <algorithm>
 #include <string>
+#include <vector>
 
 /**
  *  Private implementation details of class htd_io::LpFormatImporter.
@@ -57,11 +58,23 @@ struct htd_io::LpFormatImporter::Implementation
     const htd::LibraryInstance * managementInstance_;
 
     /**
-     *  Remove all leading and trailing whitespaces from a given string.
+     *  Create a new NamedMultiHypergraph instance based on the content of the given input buffer.
      *
-     *  @param[in] value    The string which shall be trimmed.
+     *  @param[in] buffer   The input buffer holding the content of the instance.
+     *
+     *  @return A new NamedMultiHypergraph instance based on the content of the given input buffer.
+     */
+    htd::NamedMultiHypergraph<std::string, std::string> * import(const htd_io::InputBuffer & buffer) const;
+
+    /**
+     *  Create a copy of the given character range without leading and trailing whitespaces.
+     *
+     *  @param[in] begin    The first character of the range.
+     *  @param[in] end      The position after the last character of the range.
+     *
+     *  @return A copy of the given character range without leading and trailing whitespaces.
      */
-    void trim(std::string & value);
+    static std::string trim(const char * begin, const char * end);
 };
 
 htd_io::LpFormatImporter::LpFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -76,118 +89,109 @@ htd_io::LpFormatImporter::~LpFormatImporter(void)
 
 htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::import(const std::string & path) const
 {
-    std::ifstream stream(path);
+    htd_io::InputBuffer buffer;
 
-    return import(stream);
+    if (!buffer.load(path))
+    {
+        return nullptr;
+    }
+
+    return implementation_->import(buffer);
 }
 
 htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::import(std::istream & stream) const
 {
-    bool error = false;
+    htd_io::InputBuffer buffer;
+
+    if (!buffer.load(stream))
+    {
+        return nullptr;
+    }
+
+    return implementation_->import(buffer);
+}
+
+htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::Implementation::import(const htd_io::InputBuffer & buffer) const
+{
+    static const std::string edgePrefix("edge(");
+    static const std::string vertexPrefix("vertex(");
+    static const std::string suffix(").");
+
+    htd::NamedMultiHypergraph<std::string, std::string> * ret = new htd::NamedMultiHypergraph<std::string, std::string>(managementInstance_);
 
-    htd::NamedMultiHypergraph<std::string, std::string> * ret = new htd::NamedMultiHypergraph<std::string, std::string>(implementation_->managementInstance_);
+    const char * position = buffer.begin();
+    const char * end = buffer.end();
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+    std::vector<std::string> hyperedge;
 
-    if (stream.good())
+    while (position != end && !managementInstance_->isTerminated())
     {
-        std::string line;
-
-        std::size_t nextPosition = 0;
-        
-        std::size_t startPosition = 0;
-        
-        std::size_t finishPosition = 0;
-        
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
+        const char * lineEnd = htd_io::InputBuffer::lineEnd(position, end);
+        const char * contentEnd = lineEnd;
+
+        if (contentEnd != position && *(contentEnd - 1) == '\r')
         {
-            finishPosition = 0;
-            
-            startPosition = line.find("edge(");
-            
-            if (startPosition == 0)
-            {
-                startPosition = startPosition + std::string("edge(").length();
-                
-                finishPosition = line.find(").", startPosition);
-                
-                if (finishPosition == line.length() - 2)
-                {
-                    line.erase(finishPosition, std::string(").").length());
-                    line.erase(0, startPosition);
-                    
-                    std::vector<std::string> hyperedge;
-                    
-                    nextPosition = line.find(",");
-                    
-                    while (nextPosition != std::string::npos)
-                    {
-                        std::string element = line.substr(0, nextPosition);
-
-                        this->implementation_->trim(element);
-
-                        hyperedge.push_back(element);
-                        
-                        line.erase(0, nextPosition + 1);
-                        
-                        nextPosition = line.find(",");
-                    }
-
-                    this->implementation_->trim(line);
-
-                    if (line.length() > 0)
-                    {
-                        hyperedge.push_back(line);
-                    }
-
-                    if (hyperedge.size() > 0)
-                    {
-                        ret->addEdge(hyperedge);
-                    }
-                }
-            }
-            else
-            {
-                startPosition = line.find("vertex(");
+            --contentEnd;
+        }
 
-                if (startPosition == 0)
-                {
-                    startPosition = startPosition + std::string("vertex(").length();
+        std::size_t length = static_cast<std::size_t>(contentEnd - position);
 
-                    finishPosition = line.find(").", startPosition);
+        if (length >= edgePrefix.length() + suffix.length() &&
+            std::equal(edgePrefix.begin(), edgePrefix.end(), position) &&
+            std::search(position + edgePrefix.length(), contentEnd, suffix.begin(), suffix.end()) == contentEnd - suffix.length())
+        {
+            const char * elementStart = position + edgePrefix.length();
+            const char * elementsEnd = contentEnd - suffix.length();
+
+            hyperedge.clear();
+
+            for (const char * separator = std::find(elementStart, elementsEnd, ','); separator != elementsEnd; separator = std::find(elementStart, elementsEnd, ','))
+            {
+                hyperedge.push_back(trim(elementStart, separator));
 
-                    if (finishPosition == line.length() - 2)
-                    {
-                        line.erase(finishPosition, std::string(").").length());
-                        line.erase(0, startPosition);
+                elementStart = separator + 1;
+            }
 
-                        this->implementation_->trim(line);
+            std::string lastElement = trim(elementStart, elementsEnd);
 
-                        ret->addVertex(line);
-                    }
-                }
+            if (lastElement.length() > 0)
+            {
+                hyperedge.push_back(std::move(lastElement));
             }
+
+            if (hyperedge.size() > 0)
+            {
+                ret->addEdge(hyperedge);
+            }
+        }
+        else if (length >= vertexPrefix.length() + suffix.length() &&
+                 std::equal(vertexPrefix.begin(), vertexPrefix.end(), position) &&
+                 std::search(position + vertexPrefix.length(), contentEnd, suffix.begin(), suffix.end()) == contentEnd - suffix.length())
+        {
+            ret->addVertex(trim(position + vertexPrefix.length(), contentEnd - suffix.length()));
         }
+
+        position = lineEnd != end ? lineEnd + 1 : end;
     }
-    else
+
+    return ret;
+}
+
+std::string htd_io::LpFormatImporter::Implementation::trim(const char * begin, const char * end)
+{
+    static const std::string whitespace(" \t\n\r\f\v");
+
+    while (begin != end && whitespace.find(*begin) != std::string::npos)
     {
-        error = true;
+        ++begin;
     }
 
-    if (error)
+    while (end != begin && whitespace.find(*(end - 1)) != std::string::npos)
     {
-        delete ret;
-
-        ret = nullptr;
+        --end;
     }
-    
-    return ret;
-}
 
-void htd_io::LpFormatImporter::Implementation::trim(std::string & value)
-{
-    value.erase(0, value.find_first_not_of(" \t\n\r\f\v"));
-    value.erase(value.find_last_not_of(" \t\n\r\f\v") + 1);
+    return std::string(begin, end);
 }
 
 #endif /* HTD_IO_LPFORMATIMPORTER_CPP */
@@ -0,0 +1,81 @@
+/*
+ * File:   OutputBuffer.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_OUTPUTBUFFER_CPP
+#define HTD_IO_OUTPUTBUFFER_CPP
+
+#include <htd_io/OutputBuffer.hpp>
+
+htd_io::OutputBuffer::OutputBuffer(std::ostream & stream, std::size_t capacity) : buffer_(capacity > 0 ? capacity : 1), size_(0), stream_(&stream), file_(nullptr)
+{
+
+}
+
+htd_io::OutputBuffer::OutputBuffer(std::FILE * file, std::size_t capacity) : buffer_(capacity > 0 ? capacity : 1), size_(0), stream_(nullptr), file_(file)
+{
+
+}
+
+htd_io::OutputBuffer::~OutputBuffer()
+{
+    drain();
+}
+
+void htd_io::OutputBuffer::flush(void)
+{
+    drain();
+
+    if (stream_ != nullptr)
+    {
+        stream_->flush();
+    }
+    else
+    {
+        std::fflush(file_);
+    }
+}
+
+void htd_io::OutputBuffer::drain(void)
+{
+    if (size_ > 0)
+    {
+        write(buffer_.data(), size_);
+
+        size_ = 0;
+    }
+}
+
+void htd_io::OutputBuffer::write(const char * data, std::size_t length)
+{
+    if (stream_ != nullptr)
+    {
+        stream_->write(data, static_cast<std::streamsize>(length));
+    }
+    else
+    {
+        std::fwrite(data, 1, length, file_);
+    }
+}
+
+#endif /* HTD_IO_OUTPUTBUFFER_CPP */
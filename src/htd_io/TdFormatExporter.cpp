@@ -27,8 +27,10 @@
 
 #include <htd_io/TdFormatExporter.hpp>
 
-#include <sstream>
-#include <unordered_map>
+#include <htd_io/OutputBuffer.hpp>
+
+#include <algorithm>
+#include <vector>
 
 htd_io::TdFormatExporter::TdFormatExporter(void)
 {
@@ -40,84 +42,55 @@ htd_io::TdFormatExporter::~TdFormatExporter()
 
 }
 
-void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+/**
+ *  Write a tree decomposition in the format 'td' to a given stream.
+ *
+ *  @param[in] decomposition    The tree decomposition which shall be exported.
+ *  @param[in] vertexCount      The number of vertices of the graph from which the given decomposition was constructed.
+ *  @param[out] outputStream    The output stream to which the information shall be written.
+ */
+static void writeTdFormat(const htd::ITreeDecomposition & decomposition, std::size_t vertexCount, std::ostream & outputStream)
 {
-    std::unordered_map<htd::vertex_t, std::size_t> indices;
+    htd_io::OutputBuffer buffer(outputStream);
 
-    outputStream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << graph.vertexCount() << "\n";
+    buffer.append("s td ", 5);
+    buffer.appendNumber(decomposition.vertexCount());
+    buffer.append(' ');
+    buffer.appendNumber(decomposition.maximumBagSize());
+    buffer.append(' ');
+    buffer.appendNumber(vertexCount);
+    buffer.append('\n');
 
     if (decomposition.vertexCount() > 0)
     {
-        std::size_t index = 1;
+        const htd::ConstCollection<htd::vertex_t> & nodeCollection = decomposition.vertices();
 
-        std::stringstream tmpStream;
+        htd::vertex_t maximumNode = 0;
 
-        for (htd::vertex_t node : decomposition.vertices())
+        for (htd::vertex_t node : nodeCollection)
         {
-            tmpStream << "b " << index << " ";
-
-            indices.emplace(node, index);
-
-            for (htd::vertex_t vertex : decomposition.bagContent(node))
-            {
-                tmpStream << vertex << " ";
-            }
-
-            tmpStream << "\n" << std::flush;
-
-            outputStream << tmpStream.rdbuf();
-
-            tmpStream.clear();
-
-            ++index;
+            maximumNode = std::max(maximumNode, node);
         }
 
-        const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = decomposition.hyperedges();
-
-        std::size_t edgeCount = decomposition.edgeCount();
-
-        auto it = hyperedgeCollection.begin();
-
-        for (htd::index_t index = 0; index < edgeCount; ++index)
-        {
-            htd::vertex_t vertex1 = indices.at((*it)[0]);
-            htd::vertex_t vertex2 = indices.at((*it)[1]);
-
-            outputStream << vertex1 << " " << vertex2 << "\n";
+        std::vector<std::size_t> indices(maximumNode + 1, 0);
 
-            ++it;
-        }
-    }
-}
-
-void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
-{
-    std::unordered_map<htd::vertex_t, std::size_t> indices;
-
-    outputStream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << graph.vertexCount() << "\n";
-
-    if (decomposition.vertexCount() > 0)
-    {
         std::size_t index = 1;
 
-        std::stringstream tmpStream;
-
-        for (htd::vertex_t node : decomposition.vertices())
+        for (htd::vertex_t node : nodeCollection)
         {
-            tmpStream << "b " << index << " ";
+            buffer.append("b ", 2);
+            buffer.appendNumber(index);
+            buffer.append(' ');
 
-            indices.emplace(node, index);
+            indices[node] = index;
 
             for (htd::vertex_t vertex : decomposition.bagContent(node))
             {
-                tmpStream << vertex << " ";
+                buffer.appendNumber(vertex);
+                buffer.append(' ');
             }
 
-            tmpStream << "\n" << std::flush;
-
-            outputStream << tmpStream.rdbuf();
-
-            tmpStream.clear();
+            buffer.append('\n');
 
             ++index;
         }
@@ -128,16 +101,28 @@ void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decompositi
 
         auto it = hyperedgeCollection.begin();
 
-        for (htd::index_t index = 0; index < edgeCount; ++index)
+        for (htd::index_t edgeIndex = 0; edgeIndex < edgeCount; ++edgeIndex)
         {
-            htd::vertex_t vertex1 = indices.at((*it)[0]);
-            htd::vertex_t vertex2 = indices.at((*it)[1]);
-
-            outputStream << vertex1 << " " << vertex2 << "\n";
+            buffer.appendNumber(indices[(*it)[0]]);
+            buffer.append(' ');
+            buffer.appendNumber(indices[(*it)[1]]);
+            buffer.append('\n');
 
             ++it;
         }
     }
+
+    buffer.flush();
+}
+
+void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+{
+    writeTdFormat(decomposition, graph.vertexCount(), outputStream);
+}
+
+void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+{
+    writeTdFormat(decomposition, graph.vertexCount(), outputStream);
 }
 
 #endif /* HTD_IO_TDFORMATEXPORTER_CPP */
@@ -79,4 +79,9 @@ void htd_io::WidthExporter::write(const htd::IHypertreeDecomposition & decomposi
     outputStream << decomposition.maximumBagSize() << ", " << decomposition.maximumCoveringEdgeAmount() << std::endl;
 }
 
+void htd_io::WidthExporter::write(std::size_t maximumBagSize, std::ostream & outputStream) const
+{
+    outputStream << maximumBagSize << std::endl;
+}
+
 #endif /* HTD_IO_WIDTHEXPORTER_CPP */
@@ -0,0 +1,775 @@
+/*
+ * File:   BatchProcessor.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_MAIN_BATCHPROCESSOR_CPP
+#define HTD_MAIN_BATCHPROCESSOR_CPP
+
+#include <htd_main/BatchProcessor.hpp>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+/**
+ *  Private implementation details of class htd_main::BatchProcessor.
+ */
+struct htd_main::BatchProcessor::Implementation
+{
+    /**
+     *  The outcome of the decomposition of a single instance.
+     */
+    struct Result
+    {
+        /**
+         *  Constructor for a new result.
+         */
+        Result(void) : status("skipped"), parsed(false), written(false), finished(false), vertexCount(0), edgeCount(0), maximumBagSize(0), nodeCount(0), parsingTime(0), decompositionTime(0), totalTime(0)
+        {
+
+        }
+
+        /**
+         *  The status of the instance as reported in the summary.
+         */
+        std::string status;
+
+        /**
+         *  A boolean flag indicating whether the instance was parsed successfully.
+         */
+        bool parsed;
+
+        /**
+         *  A boolean flag indicating whether a decomposition of the instance was exported.
+         */
+        bool written;
+
+        /**
+         *  A boolean flag indicating whether the processing of the instance is finished.
+         */
+        bool finished;
+
+        /**
+         *  The number of vertices of the instance.
+         */
+        std::size_t vertexCount;
+
+        /**
+         *  The number of hyperedges of the instance.
+         */
+        std::size_t edgeCount;
+
+        /**
+         *  The maximum bag size of the exported decomposition.
+         */
+        std::size_t maximumBagSize;
+
+        /**
+         *  The number of bags of the exported decomposition.
+         */
+        std::size_t nodeCount;
+
+        /**
+         *  The time in seconds which was needed to parse the instance.
+         */
+        double parsingTime;
+
+        /**
+         *  The time in seconds between the end of the parsing process and the export of the decomposition.
+         */
+        double decompositionTime;
+
+        /**
+         *  The time in seconds which was needed to process the instance.
+         */
+        double totalTime;
+    };
+
+    /**
+     *  The state of a single worker.
+     */
+    struct Worker
+    {
+        /**
+         *  The management instance of the worker.
+         */
+        htd::LibraryInstance * managementInstance;
+
+        /**
+         *  The graph processor of the worker.
+         */
+        htd_io::IGraphToTreeDecompositionProcessor * processor;
+
+        /**
+         *  The result of the instance which is currently processed by the worker.
+         */
+        Result * result;
+
+        /**
+         *  The point in time at which the worker started to process the current instance.
+         */
+        std::chrono::steady_clock::time_point start;
+
+        /**
+         *  The point in time at which the worker finished to parse the current instance.
+         */
+        std::chrono::steady_clock::time_point parsingFinished;
+    };
+
+    /**
+     *  Exporter which records the key figures of the exported decompositions and forwards them to another exporter.
+     */
+    class RecordingExporter : public htd_io::ITreeDecompositionExporter
+    {
+        public:
+            /**
+             *  Constructor for a new recording exporter.
+             *
+             *  @param[in] worker   The worker whose results shall be recorded.
+             *  @param[in] exporter The exporter to which the decompositions shall be forwarded. The exporter is deleted together with the recording exporter.
+             */
+            RecordingExporter(Worker & worker, htd_io::ITreeDecompositionExporter * exporter) : worker_(worker), exporter_(exporter)
+            {
+
+            }
+
+            virtual ~RecordingExporter()
+            {
+                delete exporter_;
+            }
+
+            void write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const HTD_OVERRIDE
+            {
+                record(decomposition);
+
+                exporter_->write(decomposition, graph, outputStream);
+            }
+
+            void write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const HTD_OVERRIDE
+            {
+                record(decomposition);
+
+                exporter_->write(decomposition, graph, outputStream);
+            }
+
+        private:
+            /**
+             *  The worker whose results are recorded.
+             */
+            Worker & worker_;
+
+            /**
+             *  The exporter to which the decompositions are forwarded.
+             */
+            htd_io::ITreeDecompositionExporter * exporter_;
+
+            /**
+             *  Record the key figures of the given decomposition in the result of the current instance.
+             *
+             *  @param[in] decomposition    The decomposition which is exported.
+             */
+            void record(const htd::ITreeDecomposition & decomposition) const
+            {
+                Result & result = *(worker_.result);
+
+                result.written = true;
+
+                result.maximumBagSize = decomposition.maximumBagSize();
+
+                result.nodeCount = decomposition.vertexCount();
+
+                result.decompositionTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - worker_.parsingFinished).count();
+            }
+    };
+
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] processorFactory A function which configures the given management instance of a worker and which returns a new graph processor for it.
+     *  @param[in] exporterFactory  A function which returns a new exporter which shall be used to write the decompositions.
+     */
+    Implementation(const std::function<htd_io::IGraphToTreeDecompositionProcessor *(htd::LibraryInstance *)> & processorFactory,
+                   const std::function<htd_io::ITreeDecompositionExporter *(void)> & exporterFactory)
+        : processorFactory_(processorFactory), exporterFactory_(exporterFactory), workerCount_(1), outputDirectory_(), outputExtension_("td"),
+          terminated_(false), workerInstances_(nullptr), workerInstanceCount_(0), activeTerminationCount_(0)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  A function which configures the given management instance of a worker and which returns a new graph processor for it.
+     */
+    std::function<htd_io::IGraphToTreeDecompositionProcessor *(htd::LibraryInstance *)> processorFactory_;
+
+    /**
+     *  A function which returns a new exporter which shall be used to write the decompositions.
+     */
+    std::function<htd_io::ITreeDecompositionExporter *(void)> exporterFactory_;
+
+    /**
+     *  The number of workers which decompose instances concurrently.
+     */
+    std::size_t workerCount_;
+
+    /**
+     *  The directory to which the decompositions are written.
+     */
+    std::string outputDirectory_;
+
+    /**
+     *  The extension of the output files.
+     */
+    std::string outputExtension_;
+
+    /**
+     *  A boolean flag indicating whether the batch was terminated.
+     */
+    std::atomic<bool> terminated_;
+
+    /**
+     *  The management instances of the active workers.
+     */
+    std::atomic<htd::LibraryInstance * const *> workerInstances_;
+
+    /**
+     *  The number of management instances of the active workers.
+     */
+    std::atomic<std::size_t> workerInstanceCount_;
+
+    /**
+     *  The number of calls of terminate() which currently access the management instances of the workers.
+     */
+    std::atomic<std::size_t> activeTerminationCount_;
+
+    /**
+     *  Compute the paths of the output files of the given instances.
+     *
+     *  The output file of an instance is named like the instance with the output extension appended. If
+     *  this name is shared by several instances, e.g., because instances with the same file name from
+     *  different directories are written to the same output directory, the index of the instance within
+     *  the batch is inserted before the extension so that no output file is overwritten.
+     *
+     *  @param[in] instances    The paths of the instances.
+     *
+     *  @return The paths of the output files of the given instances.
+     */
+    std::vector<std::string> outputPaths(const std::vector<std::string> & instances) const
+    {
+        std::vector<std::string> ret;
+        ret.reserve(instances.size());
+
+        std::unordered_map<std::string, std::size_t> occurrences;
+
+        for (const std::string & instance : instances)
+        {
+            if (outputDirectory_.empty())
+            {
+                ret.push_back(instance);
+            }
+            else
+            {
+                std::size_t position = instance.find_last_of("/\\");
+
+                ret.push_back(outputDirectory_ + "/" + (position == std::string::npos ? instance : instance.substr(position + 1)));
+            }
+
+            ++occurrences[ret.back()];
+        }
+
+        std::unordered_set<std::string> usedPaths;
+
+        for (htd::index_t index = 0; index < ret.size(); ++index)
+        {
+            std::string path = ret[index] + "." + outputExtension_;
+
+            if (occurrences[ret[index]] > 1 || usedPaths.count(path) > 0)
+            {
+                std::size_t suffix = index;
+
+                do
+                {
+                    path = ret[index] + "." + std::to_string(suffix) + "." + outputExtension_;
+
+                    ++suffix;
+                }
+                while (usedPaths.count(path) > 0);
+            }
+
+            usedPaths.insert(path);
+
+            ret[index] = path;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Decompose the given instance and record the outcome in the current result of the given worker.
+     *
+     *  @param[in] worker       The worker which shall decompose the instance.
+     *  @param[in] instance     The path of the instance.
+     *  @param[in] path         The path of the output file of the instance.
+     */
+    void process(Worker & worker, const std::string & instance, const std::string & path) const
+    {
+        Result & result = *(worker.result);
+
+        worker.start = std::chrono::steady_clock::now();
+
+        worker.parsingFinished = worker.start;
+
+        std::ofstream outputStream(path, std::ios::binary);
+
+        if (outputStream.is_open())
+        {
+            worker.processor->process(instance, outputStream);
+
+            outputStream.close();
+
+            if (!result.parsed)
+            {
+                result.status = worker.managementInstance->isTerminated() ? "terminated" : "invalid-instance";
+            }
+            else if (!result.written)
+            {
+                result.status = worker.managementInstance->isTerminated() ? "terminated" : "no-decomposition";
+            }
+            else if (outputStream.fail())
+            {
+                result.status = "output-error";
+            }
+            else
+            {
+                result.status = worker.managementInstance->isTerminated() ? "terminated" : "ok";
+            }
+
+            if (!result.written)
+            {
+                std::remove(path.c_str());
+            }
+        }
+        else
+        {
+            result.status = "output-error";
+        }
+
+        result.totalTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - worker.start).count();
+    }
+
+    /**
+     *  Check whether a file name ends with the given suffix.
+     *
+     *  @param[in] name     The file name.
+     *  @param[in] suffix   The suffix.
+     *
+     *  @return True if the file name ends with the given suffix, false otherwise.
+     */
+    static bool endsWith(const std::string & name, const std::string & suffix)
+    {
+        return name.size() >= suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+    /**
+     *  Write the summary line of the given instance.
+     *
+     *  @param[in] instance         The path of the instance.
+     *  @param[in] result           The result of the instance.
+     *  @param[out] summaryStream   The output stream to which the summary line shall be written.
+     */
+    static void writeSummary(const std::string & instance, const Result & result, std::ostream & summaryStream)
+    {
+        if (instance.find_first_of(",\"\r\n") != std::string::npos)
+        {
+            summaryStream << '"';
+
+            for (char character : instance)
+            {
+                if (character == '"')
+                {
+                    summaryStream << '"';
+                }
+
+                summaryStream << character;
+            }
+
+            summaryStream << '"';
+        }
+        else
+        {
+            summaryStream << instance;
+        }
+
+        summaryStream << "," << result.status << ",";
+
+        if (result.parsed)
+        {
+            summaryStream << result.vertexCount << "," << result.edgeCount << ",";
+        }
+        else
+        {
+            summaryStream << ",,";
+        }
+
+        if (result.written)
+        {
+            /* The width of a decomposition is one less than its maximum bag size, empty decompositions have width 0. */
+            summaryStream << (result.maximumBagSize > 0 ? result.maximumBagSize - 1 : 0) << "," << result.nodeCount << ",";
+        }
+        else
+        {
+            summaryStream << ",,";
+        }
+
+        summaryStream << std::fixed << std::setprecision(3);
+
+        if (result.parsed)
+        {
+            summaryStream << result.parsingTime;
+        }
+
+        summaryStream << ",";
+
+        if (result.written)
+        {
+            summaryStream << result.decompositionTime;
+        }
+
+        summaryStream << ",";
+
+        if (result.finished)
+        {
+            summaryStream << result.totalTime;
+        }
+
+        summaryStream << "\n";
+    }
+};
+
+htd_main::BatchProcessor::BatchProcessor(const std::function<htd_io::IGraphToTreeDecompositionProcessor *(htd::LibraryInstance * manager)> & processorFactory,
+                                         const std::function<htd_io::ITreeDecompositionExporter *(void)> & exporterFactory)
+    : implementation_(new Implementation(processorFactory, exporterFactory))
+{
+
+}
+
+htd_main::BatchProcessor::~BatchProcessor()
+{
+
+}
+
+std::size_t htd_main::BatchProcessor::workerCount(void) const
+{
+    return implementation_->workerCount_;
+}
+
+void htd_main::BatchProcessor::setWorkerCount(std::size_t workerCount)
+{
+    implementation_->workerCount_ = workerCount;
+}
+
+void htd_main::BatchProcessor::setOutputDirectory(const std::string & directory)
+{
+    implementation_->outputDirectory_ = directory;
+}
+
+void htd_main::BatchProcessor::setOutputExtension(const std::string & extension)
+{
+    implementation_->outputExtension_ = extension;
+}
+
+std::size_t htd_main::BatchProcessor::process(const std::vector<std::string> & instances, std::ostream & summaryStream) const
+{
+    std::size_t workerCount = std::min(htd::ThreadPool::effectiveThreadCount(implementation_->workerCount_), std::max(instances.size(), static_cast<std::size_t>(1)));
+
+    std::vector<Implementation::Result> results(instances.size());
+
+    const std::vector<std::string> outputPaths = implementation_->outputPaths(instances);
+
+    std::vector<Implementation::Worker> workers(workerCount);
+
+    std::vector<htd::LibraryInstance *> workerInstances(workerCount);
+
+    for (htd::index_t index = 0; index < workerCount; ++index)
+    {
+        Implementation::Worker & worker = workers[index];
+
+        worker.managementInstance = htd::createManagementInstance(htd::Id::FIRST + 1 + index);
+
+        worker.processor = implementation_->processorFactory_(worker.managementInstance);
+
+        worker.processor->setExporter(new Implementation::RecordingExporter(worker, implementation_->exporterFactory_()));
+
+        worker.processor->registerParsingCallback([&worker](htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount)
+        {
+            worker.parsingFinished = std::chrono::steady_clock::now();
+
+            if (result == htd_io::ParsingResult::OK)
+            {
+                worker.result->parsed = true;
+
+                worker.result->vertexCount = vertexCount;
+                worker.result->edgeCount = edgeCount;
+
+                worker.result->parsingTime = std::chrono::duration<double>(worker.parsingFinished - worker.start).count();
+            }
+        });
+
+        worker.result = nullptr;
+
+        workerInstances[index] = worker.managementInstance;
+    }
+
+    implementation_->workerInstances_.store(workerInstances.data());
+    implementation_->workerInstanceCount_.store(workerInstances.size());
+
+    /* Every instance is decomposed starting from the same generator state, as if it was decomposed on its own. */
+    const htd::RandomNumberGenerator generator = htd::randomNumberGenerator();
+
+    std::atomic<std::size_t> nextInstance(0);
+
+    std::mutex summaryMutex;
+
+    std::size_t nextSummary = 0;
+
+    summaryStream << "instance,status,vertices,hyperedges,width,bags,parsing_time,decomposition_time,total_time\n";
+
+    {
+        htd::ThreadPool threadPool(workerCount);
+
+        for (htd::index_t index = 0; index < workerCount; ++index)
+        {
+            threadPool.submit([&, index]()
+            {
+                Implementation::Worker & worker = workers[index];
+
+                std::size_t instanceIndex = nextInstance++;
+
+                while (instanceIndex < instances.size() && !implementation_->terminated_.load())
+                {
+                    worker.result = &(results[instanceIndex]);
+
+                    htd::randomNumberGenerator() = generator;
+
+                    implementation_->process(worker, instances[instanceIndex], outputPaths[instanceIndex]);
+
+                    std::lock_guard<std::mutex> lock(summaryMutex);
+
+                    results[instanceIndex].finished = true;
+
+                    while (nextSummary < instances.size() && results[nextSummary].finished)
+                    {
+                        Implementation::writeSummary(instances[nextSummary], results[nextSummary], summaryStream);
+
+                        ++nextSummary;
+                    }
+
+                    summaryStream.flush();
+
+                    instanceIndex = nextInstance++;
+                }
+            });
+        }
+
+        threadPool.wait();
+    }
+
+    implementation_->workerInstanceCount_.store(0);
+    implementation_->workerInstances_.store(nullptr);
+
+    /* A call of terminate() which started before the instances were withdrawn may still access them, hence they are deleted afterwards. */
+    while (implementation_->activeTerminationCount_.load() > 0)
+    {
+        std::this_thread::yield();
+    }
+
+    for (; nextSummary < instances.size(); ++nextSummary)
+    {
+        Implementation::writeSummary(instances[nextSummary], results[nextSummary], summaryStream);
+    }
+
+    summaryStream.flush();
+
+    for (Implementation::Worker & worker : workers)
+    {
+        delete worker.processor;
+
+        delete worker.managementInstance;
+    }
+
+    std::size_t ret = 0;
+
+    for (const Implementation::Result & result : results)
+    {
+        if (!result.written || result.status != "ok")
+        {
+            ++ret;
+        }
+    }
+
+    return ret;
+}
+
+void htd_main::BatchProcessor::terminate(void)
+{
+    implementation_->terminated_.store(true);
+
+    ++(implementation_->activeTerminationCount_);
+
+    std::size_t count = implementation_->workerInstanceCount_.load();
+
+    htd::LibraryInstance * const * instances = implementation_->workerInstances_.load();
+
+    if (instances != nullptr)
+    {
+        for (htd::index_t index = 0; index < count; ++index)
+        {
+            instances[index]->terminate();
+        }
+    }
+
+    --(implementation_->activeTerminationCount_);
+}
+
+bool htd_main::BatchProcessor::collectInstances(const std::string & path, const std::string & outputExtension, std::vector<std::string> & instances)
+{
+    std::vector<std::string> files;
+
+    const std::string outputSuffix = "." + outputExtension;
+
+#if defined(_WIN32)
+    DWORD attributes = GetFileAttributesA(path.c_str());
+
+    if (attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+    {
+        WIN32_FIND_DATAA entry;
+
+        HANDLE handle = FindFirstFileA((path + "\\*").c_str(), &entry);
+
+        if (handle != INVALID_HANDLE_VALUE)
+        {
+            do
+            {
+                if (entry.cFileName[0] != '.' && (entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0 && !htd_main::BatchProcessor::Implementation::endsWith(entry.cFileName, outputSuffix))
+                {
+                    files.push_back(path + "\\" + entry.cFileName);
+                }
+            }
+            while (FindNextFileA(handle, &entry));
+
+            FindClose(handle);
+        }
+
+        std::sort(files.begin(), files.end());
+
+        instances.insert(instances.end(), files.begin(), files.end());
+
+        return true;
+    }
+#else
+    struct stat status;
+
+    if (stat(path.c_str(), &status) == 0 && S_ISDIR(status.st_mode))
+    {
+        DIR * directory = opendir(path.c_str());
+
+        if (directory == nullptr)
+        {
+            return false;
+        }
+
+        for (struct dirent * entry = readdir(directory); entry != nullptr; entry = readdir(directory))
+        {
+            if (entry->d_name[0] != '.' && !htd_main::BatchProcessor::Implementation::endsWith(entry->d_name, outputSuffix))
+            {
+                std::string file = path + (path.back() == '/' ? "" : "/") + entry->d_name;
+
+                if (stat(file.c_str(), &status) == 0 && S_ISREG(status.st_mode))
+                {
+                    files.push_back(file);
+                }
+            }
+        }
+
+        closedir(directory);
+
+        std::sort(files.begin(), files.end());
+
+        instances.insert(instances.end(), files.begin(), files.end());
+
+        return true;
+    }
+#endif
+
+    std::ifstream listStream(path);
+
+    if (!listStream.is_open())
+    {
+        return false;
+    }
+
+    std::string line;
+
+    while (std::getline(listStream, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+
+        if (!line.empty())
+        {
+            instances.push_back(line);
+        }
+    }
+
+    return !listStream.bad();
+}
+
+#endif /* HTD_MAIN_BATCHPROCESSOR_CPP */
@@ -26,8 +26,10 @@
 #include <htd_io/main.hpp>
 #include <htd_cli/main.hpp>
 
+#include <htd_main/BatchProcessor.hpp>
 #include <htd_main/DefaultTreeDecompositionProcessor.hpp>
 
+#include <atomic>
 #include <csignal>
 #include <cstring>
 #include <fstream>
@@ -36,6 +38,8 @@
 
 htd::LibraryInstance * const libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
 
+std::atomic<htd_main::BatchProcessor *> batchProcessor(nullptr);
+
 htd_cli::OptionManager * createOptionManager(void)
 {
     htd_cli::OptionManager * manager = new htd_cli::OptionManager();
@@ -68,6 +72,7 @@ htd_cli::OptionManager * createOptionManager(void)
         inputFormatChoice->addPossibility("gr", "Use the input format 'gr'.");
         inputFormatChoice->addPossibility("lp", "Use the input format 'lp'.");
         inputFormatChoice->addPossibility("hgr", "Use the input format 'hgr'.");
+        inputFormatChoice->addPossibility("binary", "Use the binary input format 'binary'.");
 
         inputFormatChoice->setDefaultValue("gr");
 
@@ -77,11 +82,16 @@ htd_cli::OptionManager * createOptionManager(void)
 
         manager->registerOption(inputFileOption, "Input-Specific Options");
 
+        htd_cli::SingleValueOption * saveInstanceOption = new htd_cli::SingleValueOption("save-instance", "Write the input graph in the binary format 'binary' to file <file> instead of decomposing it.", "file");
+
+        manager->registerOption(saveInstanceOption, "Input-Specific Options");
+
         htd_cli::Choice * outputFormatChoice = new htd_cli::Choice("output", "Set the output format of the decomposition to <format>.\n  (See https://github.com/mabseher/htd/blob/master/FORMATS.md for information about the available output formats.)", "format");
 
         outputFormatChoice->addPossibility("td", "Use the output format 'td'.");
         outputFormatChoice->addPossibility("human", "Provide a human-readable output of the decomposition.");
         outputFormatChoice->addPossibility("width", "Provide only the maximum bag size of the decomposition.");
+        outputFormatChoice->addPossibility("binary", "Use the binary output format 'binary'.");
 
         outputFormatChoice->setDefaultValue("td");
 
@@ -96,6 +106,8 @@ htd_cli::OptionManager * createOptionManager(void)
         strategyChoice->addPossibility("random", "Use a random vertex ordering.");
         strategyChoice->addPossibility("min-fill", "Minimum fill ordering algorithm");
         strategyChoice->addPossibility("min-degree", "Minimum degree ordering algorithm");
+        strategyChoice->addPossibility("amd", "Approximate minimum degree ordering algorithm");
+        strategyChoice->addPossibility("nested-dissection", "Multilevel nested dissection ordering algorithm");
         strategyChoice->addPossibility("min-separator", "Minimum separating vertex set heuristic");
         strategyChoice->addPossibility("max-cardinality", "Maximum cardinality search ordering algorithm");
         strategyChoice->addPossibility("max-cardinality-enhanced", "Enhanced maximum cardinality search ordering algorithm (MCS-M)");
@@ -136,6 +148,26 @@ htd_cli::OptionManager * createOptionManager(void)
         htd_cli::SingleValueOption * patienceOption = new htd_cli::SingleValueOption("patience", "Terminate the algorithm if more than <amount> iterations did not lead to an improvement (-1 = infinite). (Default: -1)", "amount");
 
         manager->registerOption(patienceOption, "Optimization Options");
+
+        htd_cli::SingleValueOption * threadOption = new htd_cli::SingleValueOption("threads", "Set the number of threads used to perform the iterations during optimization, to eliminate the separated parts of the graph during full preprocessing, to dissect independent parts of the graph when using the nested dissection strategy, to minimize the triangulation and to compute the covers of the bags of hypertree decompositions to <count> (0 = number of cores). (Default: 1)", "count");
+
+        manager->registerOption(threadOption, "Optimization Options");
+
+        htd_cli::SingleValueOption * batchOption = new htd_cli::SingleValueOption("batch", "Decompose all instances listed in file <list> (one path per line) or contained in directory <list>.", "list");
+
+        manager->registerOption(batchOption, "Batch Options");
+
+        htd_cli::SingleValueOption * workerOption = new htd_cli::SingleValueOption("workers", "Set the number of instances which are decomposed concurrently in batch mode to <count> (0 = number of cores). (Default: 1)", "count");
+
+        manager->registerOption(workerOption, "Batch Options");
+
+        htd_cli::SingleValueOption * outputDirectoryOption = new htd_cli::SingleValueOption("output-directory", "Write the decompositions of the instances of a batch to directory <directory>. (Default: Directory of the instance)", "directory");
+
+        manager->registerOption(outputDirectoryOption, "Batch Options");
+
+        htd_cli::SingleValueOption * summaryOption = new htd_cli::SingleValueOption("summary", "Write the summary of a batch in CSV format to file <file>. (Default: stdout)", "file");
+
+        manager->registerOption(summaryOption, "Batch Options");
     }
     catch (const std::runtime_error & exception)
     {
@@ -149,7 +181,7 @@ htd_cli::OptionManager * createOptionManager(void)
     return manager;
 }
 
-bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionManager & optionManager, htd::LibraryInstance * const manager)
+bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionManager & optionManager)
 {
     bool ret = true;
 
@@ -180,12 +212,28 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
 
     const htd_cli::Choice & optimizationChoice = optionManager.accessChoice("opt");
 
+    const htd_cli::Choice & preprocessingChoice = optionManager.accessChoice("preprocessing");
+
     const htd_cli::SingleValueOption & iterationOption = optionManager.accessSingleValueOption("iterations");
 
     const htd_cli::SingleValueOption & patienceOption = optionManager.accessSingleValueOption("patience");
 
+    const htd_cli::SingleValueOption & threadOption = optionManager.accessSingleValueOption("threads");
+
     const htd_cli::Option & triangulationMinimizationOption = optionManager.accessOption("triangulation-minimization");
 
+    const htd_cli::Option & printProgressOption = optionManager.accessOption("print-progress");
+
+    const htd_cli::SingleValueOption & saveInstanceOption = optionManager.accessSingleValueOption("save-instance");
+
+    const htd_cli::SingleValueOption & batchOption = optionManager.accessSingleValueOption("batch");
+
+    const htd_cli::SingleValueOption & workerOption = optionManager.accessSingleValueOption("workers");
+
+    const htd_cli::SingleValueOption & outputDirectoryOption = optionManager.accessSingleValueOption("output-directory");
+
+    const htd_cli::SingleValueOption & summaryOption = optionManager.accessSingleValueOption("summary");
+
     if (ret && helpOption.used())
     {
         std::cout << "VERSION: htd_main " << htd_version() << std::endl << std::endl;
@@ -231,13 +279,13 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
                 }
                 else
                 {
-                    srand(seed);
+                    htd::randomNumberGenerator().seed(seed);
                 }
             }
         }
         else
         {
-            srand(static_cast<unsigned int>(time(NULL)));
+            htd::randomNumberGenerator().seed(static_cast<htd::RandomNumberGenerator::result_type>(time(NULL)));
         }
     }
 
@@ -260,15 +308,7 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
     {
         const std::string & value = strategyChoice.value();
 
-        if (value == "min-fill")
-        {
-            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinFillOrderingAlgorithm(manager));
-        }
-        else if (value == "min-degree")
-        {
-            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinDegreeOrderingAlgorithm(manager));
-        }
-        else if (value == "min-separator")
+        if (value == "min-separator")
         {
             if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width")
             {
@@ -284,14 +324,6 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
                 ret = false;
             }
         }
-        else if (value == "max-cardinality")
-        {
-            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MaximumCardinalitySearchOrderingAlgorithm(manager));
-        }
-        else if (value == "max-cardinality-enhanced")
-        {
-            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm(manager));
-        }
         else if (value == "challenge")
         {
             if (!optimizationChoice.used() || std::string(optimizationChoice.value()) != "width")
@@ -301,11 +333,7 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
                 ret = false;
             }
         }
-        else if (value == "random")
-        {
-            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::RandomOrderingAlgorithm(manager));
-        }
-        else
+        else if (value != "min-fill" && value != "min-degree" && value != "amd" && value != "nested-dissection" && value != "max-cardinality" && value != "max-cardinality-enhanced" && value != "random")
         {
             std::cerr << "INVALID DECOMPOSITION STRATEGY: " << strategyChoice.value() << std::endl;
 
@@ -322,6 +350,13 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
             ret = false;
         }
 
+        if (outputFormatChoice.used() && std::string(outputFormatChoice.value()) == "binary")
+        {
+            std::cerr << "INVALID OUTPUT FORMAT: Format 'binary' only supports tree decompositions!" << std::endl;
+
+            ret = false;
+        }
+
         if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width")
         {
             std::cerr << "INVALID PROGRAM CALL: Currently, optimization is supported only for tree decompositions!" << std::endl;
@@ -330,11 +365,76 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         }
     }
 
+    if (ret)
+    {
+        if (batchOption.used())
+        {
+            if (instanceOption.used() || saveInstanceOption.used())
+            {
+                std::cerr << "INVALID PROGRAM CALL: Option --batch cannot be combined with options --instance and --save-instance!" << std::endl;
+
+                ret = false;
+            }
+            else if (decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree")
+            {
+                std::cerr << "INVALID PROGRAM CALL: Currently, batch mode is supported only for tree decompositions!" << std::endl;
+
+                ret = false;
+            }
+            else if (printProgressOption.used())
+            {
+                std::cerr << "INVALID PROGRAM CALL: Option --print-progress cannot be combined with option --batch!" << std::endl;
+
+                ret = false;
+            }
+
+            if (ret && workerOption.used())
+            {
+                std::size_t index = 0;
+
+                const std::string & value = workerOption.value();
+
+                if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+                {
+                    std::cerr << "INVALID NUMBER OF WORKERS: " << workerOption.value() << std::endl;
+
+                    ret = false;
+                }
+
+                if (ret)
+                {
+                    std::stoul(value, &index, 10);
+
+                    if (index != value.length())
+                    {
+                        std::cerr << "INVALID NUMBER OF WORKERS: " << value << std::endl;
+
+                        ret = false;
+                    }
+                }
+            }
+        }
+        else if (workerOption.used() || outputDirectoryOption.used() || summaryOption.used())
+        {
+            std::cerr << "INVALID PROGRAM CALL: Options --workers, --output-directory and --summary may only be used together with option --batch!" << std::endl;
+
+            ret = false;
+        }
+    }
+
+    if (ret && printProgressOption.used() && outputFormatChoice.used() && std::string(outputFormatChoice.value()) == "binary")
+    {
+        std::cerr << "INVALID PROGRAM CALL: Progress information cannot be combined with output format 'binary'!" << std::endl;
+
+        ret = false;
+    }
+
     if (ret)
     {
         if (iterationOption.used())
         {
-            if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width")
+            if ((optimizationChoice.used() && std::string(optimizationChoice.value()) == "width") ||
+                (preprocessingChoice.used() && std::string(preprocessingChoice.value()) == "full"))
             {
                 std::size_t index = 0;
 
@@ -372,7 +472,8 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
     {
         if (patienceOption.used())
         {
-            if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width")
+            if ((optimizationChoice.used() && std::string(optimizationChoice.value()) == "width") ||
+                (preprocessingChoice.used() && std::string(preprocessingChoice.value()) == "full"))
             {
                 std::size_t index = 0;
 
@@ -406,14 +507,46 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         }
     }
 
-    if (ret && triangulationMinimizationOption.used())
+    if (ret)
     {
-        htd::TriangulationMinimizationOrderingAlgorithm * algorithm =
-            new htd::TriangulationMinimizationOrderingAlgorithm(libraryInstance);
+        if (threadOption.used())
+        {
+            if ((optimizationChoice.used() && std::string(optimizationChoice.value()) == "width") ||
+                (preprocessingChoice.used() && std::string(preprocessingChoice.value()) == "full") ||
+                (strategyChoice.used() && std::string(strategyChoice.value()) == "nested-dissection") ||
+                (decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree") ||
+                triangulationMinimizationOption.used())
+            {
+                std::size_t index = 0;
 
-        algorithm->setOrderingAlgorithm(manager->orderingAlgorithmFactory().createInstance());
+                const std::string & value = threadOption.value();
 
-        manager->orderingAlgorithmFactory().setConstructionTemplate(algorithm);
+                if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+                {
+                    std::cerr << "INVALID NUMBER OF THREADS: " << threadOption.value() << std::endl;
+
+                    ret = false;
+                }
+
+                if (ret)
+                {
+                    std::stoul(value, &index, 10);
+
+                    if (index != value.length())
+                    {
+                        std::cerr << "INVALID NUMBER OF THREADS: " << value << std::endl;
+
+                        ret = false;
+                    }
+                }
+            }
+            else
+            {
+                std::cerr << "INVALID PROGRAM CALL: Option --threads may only be used when option --opt is set to \"width\", option --preprocessing is set to \"full\", option --strategy is set to \"nested-dissection\", option --type is set to \"hypertree\" or option --triangulation-minimization is used!" << std::endl;
+
+                ret = false;
+            }
+        }
     }
 
     return ret;
@@ -537,6 +670,12 @@ void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, co
     {
         htd_io::HgrFormatImporter importer(manager);
 
+        decompose(*manager, algorithm, importer.import(std::cin), exporter);
+    }
+    else if (inputFormat == "binary")
+    {
+        htd_io::BinaryFormatImporter importer(manager);
+
         decompose(*manager, algorithm, importer.import(std::cin), exporter);
     }
 }
@@ -560,303 +699,584 @@ void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, co
     {
         htd_io::HgrFormatImporter importer(manager);
 
+        decompose(*manager, algorithm, importer.import(instanceFile), exporter);
+    }
+    else if (inputFormat == "binary")
+    {
+        htd_io::BinaryFormatImporter importer(manager);
+
         decompose(*manager, algorithm, importer.import(instanceFile), exporter);
     }
 }
 
-void handleSignal(int signal)
+htd::IMultiHypergraph * importInstance(const std::string & inputFormat, const htd::LibraryInstance * const manager, const htd_cli::SingleValueOption & instanceOption)
 {
-    switch (signal)
+    htd::IMultiHypergraph * ret = nullptr;
+
+    if (inputFormat == "gr")
     {
-        case SIGINT:
-        {
-            libraryInstance->terminate();
+        htd_io::GrFormatImporter importer(manager);
 
-            break;
-        }
-        case SIGTERM:
-        {
-            libraryInstance->terminate();
+        ret = instanceOption.used() ? importer.import(instanceOption.value()) : importer.import(std::cin);
+    }
+    else if (inputFormat == "lp")
+    {
+        htd_io::LpFormatImporter importer(manager);
 
-            break;
-        }
-        default:
+        htd::NamedMultiHypergraph<std::string, std::string> * graph = instanceOption.used() ? importer.import(instanceOption.value()) : importer.import(std::cin);
+
+        if (graph != nullptr)
         {
-            break;
+            ret = graph->internalGraph().clone();
+
+            delete graph;
         }
     }
+    else if (inputFormat == "hgr")
+    {
+        htd_io::HgrFormatImporter importer(manager);
+
+        ret = instanceOption.used() ? importer.import(instanceOption.value()) : importer.import(std::cin);
+    }
+    else if (inputFormat == "binary")
+    {
+        htd_io::BinaryFormatImporter importer(manager);
+
+        ret = instanceOption.used() ? importer.import(instanceOption.value()) : importer.import(std::cin);
+    }
+
+    return ret;
 }
 
-int main(int argc, const char * const * const argv)
+void configureLibraryInstance(const htd_cli::OptionManager & optionManager, htd::LibraryInstance * const manager)
 {
-    int ret = 0;
+    const htd_cli::Choice & decompositionTypeChoice = optionManager.accessChoice("type");
 
-    bool error = false;
+    const htd_cli::Choice & strategyChoice = optionManager.accessChoice("strategy");
 
-    std::ios_base::sync_with_stdio(false);
+    const htd_cli::Choice & optimizationChoice = optionManager.accessChoice("opt");
 
-    std::signal(SIGINT, handleSignal);
-    std::signal(SIGTERM, handleSignal);
+    const htd_cli::SingleValueOption & iterationOption = optionManager.accessSingleValueOption("iterations");
 
-    htd_cli::OptionManager * optionManager = createOptionManager();
+    const htd_cli::SingleValueOption & patienceOption = optionManager.accessSingleValueOption("patience");
+
+    const htd_cli::SingleValueOption & threadOption = optionManager.accessSingleValueOption("threads");
 
-    if (optionManager != nullptr && handleOptions(argc, argv, *optionManager, libraryInstance))
+    const htd_cli::Option & triangulationMinimizationOption = optionManager.accessOption("triangulation-minimization");
+
+    if (strategyChoice.used())
     {
-        const htd_cli::Choice & inputFormatChoice = optionManager->accessChoice("input");
+        const std::string & value = strategyChoice.value();
 
-        const htd_cli::Choice & outputFormatChoice = optionManager->accessChoice("output");
+        if (value == "min-fill")
+        {
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinFillOrderingAlgorithm(manager));
+        }
+        else if (value == "min-degree")
+        {
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinDegreeOrderingAlgorithm(manager));
+        }
+        else if (value == "amd")
+        {
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::ApproximateMinimumDegreeOrderingAlgorithm(manager));
+        }
+        else if (value == "nested-dissection")
+        {
+            htd::NestedDissectionOrderingAlgorithm * algorithm = new htd::NestedDissectionOrderingAlgorithm(manager);
 
-        const htd_cli::Choice & decompositionTypeChoice = optionManager->accessChoice("type");
+            /* When optimizing the width, the threads are already occupied by the concurrent iterations. */
+            if (threadOption.used() && std::string(optimizationChoice.value()) != "width")
+            {
+                algorithm->setThreadCount(std::stoul(threadOption.value(), nullptr, 10));
+            }
 
-        const htd_cli::Choice & strategyChoice = optionManager->accessChoice("strategy");
+            manager->orderingAlgorithmFactory().setConstructionTemplate(algorithm);
+        }
+        else if (value == "max-cardinality")
+        {
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MaximumCardinalitySearchOrderingAlgorithm(manager));
+        }
+        else if (value == "max-cardinality-enhanced")
+        {
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm(manager));
+        }
+        else if (value == "random")
+        {
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::RandomOrderingAlgorithm(manager));
+        }
+    }
 
-        const htd_cli::Choice & preprocessingChoice = optionManager->accessChoice("preprocessing");
+    if (triangulationMinimizationOption.used())
+    {
+        htd::TriangulationMinimizationOrderingAlgorithm * algorithm =
+            new htd::TriangulationMinimizationOrderingAlgorithm(manager);
 
-        const htd_cli::Choice & optimizationChoice = optionManager->accessChoice("opt");
+        algorithm->setOrderingAlgorithm(manager->orderingAlgorithmFactory().createInstance());
 
-        const htd_cli::SingleValueOption & iterationOption = optionManager->accessSingleValueOption("iterations");
+        /* When optimizing the width, the threads are already occupied by the concurrent iterations. */
+        if (threadOption.used() && std::string(optimizationChoice.value()) != "width")
+        {
+            algorithm->setThreadCount(std::stoul(threadOption.value(), nullptr, 10));
+        }
 
-        const htd_cli::SingleValueOption & instanceOption = optionManager->accessSingleValueOption("instance");
+        manager->orderingAlgorithmFactory().setConstructionTemplate(algorithm);
+    }
 
-        const htd_cli::SingleValueOption & patienceOption = optionManager->accessSingleValueOption("patience");
+    if (std::string(strategyChoice.value()) == "min-separator")
+    {
+        htd::SeparatorBasedTreeDecompositionAlgorithm * treeDecompositionAlgorithm = new htd::SeparatorBasedTreeDecompositionAlgorithm(manager);
 
-        const htd_cli::Option & printProgressOption = optionManager->accessOption("print-progress");
+        treeDecompositionAlgorithm->setComputeInducedEdgesEnabled(false);
 
-        const std::string & outputFormat = outputFormatChoice.value();
+        manager->treeDecompositionAlgorithmFactory().setConstructionTemplate(treeDecompositionAlgorithm);
+    }
+    else
+    {
+        htd::BucketEliminationTreeDecompositionAlgorithm * treeDecompositionAlgorithm = new htd::BucketEliminationTreeDecompositionAlgorithm(manager);
 
-        bool hypertreeDecompositionRequested = decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree";
+        treeDecompositionAlgorithm->setComputeInducedEdgesEnabled(false);
 
-        if (std::string(strategyChoice.value()) == "min-separator")
-        {
-            htd::SeparatorBasedTreeDecompositionAlgorithm * treeDecompositionAlgorithm = new htd::SeparatorBasedTreeDecompositionAlgorithm(libraryInstance);
+        manager->treeDecompositionAlgorithmFactory().setConstructionTemplate(treeDecompositionAlgorithm);
+    }
 
-            treeDecompositionAlgorithm->setComputeInducedEdgesEnabled(false);
+    if (std::string(optimizationChoice.value()) == "width")
+    {
+        htd::CombinedWidthMinimizingTreeDecompositionAlgorithm * algorithm = new htd::CombinedWidthMinimizingTreeDecompositionAlgorithm(manager);
 
-            libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(treeDecompositionAlgorithm);
-        }
-        else
+        if (std::string(strategyChoice.value()) == "challenge")
         {
-            htd::BucketEliminationTreeDecompositionAlgorithm * treeDecompositionAlgorithm = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+            htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm * adaptiveAlgorithm = new htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm(manager);
 
-            treeDecompositionAlgorithm->setComputeInducedEdgesEnabled(false);
+            htd::BucketEliminationTreeDecompositionAlgorithm * algorithm1 = new htd::BucketEliminationTreeDecompositionAlgorithm(manager);
 
-            libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(treeDecompositionAlgorithm);
-        }
+            algorithm1->setOrderingAlgorithm(new htd::MinDegreeOrderingAlgorithm(manager));
 
-        if (hypertreeDecompositionRequested)
-        {
-            htd::IHypertreeDecompositionAlgorithm * algorithm = libraryInstance->hypertreeDecompositionAlgorithmFactory().createInstance();
+            adaptiveAlgorithm->addDecompositionAlgorithm(algorithm1);
 
-            htd_io::IHypertreeDecompositionExporter * exporter = nullptr;
+            htd::BucketEliminationTreeDecompositionAlgorithm * algorithm2 = new htd::BucketEliminationTreeDecompositionAlgorithm(manager);
 
-            if (outputFormat == "human")
-            {
-                exporter = new htd_io::HumanReadableExporter();
-            }
-            else if (outputFormat == "width")
-            {
-                exporter = new htd_io::WidthExporter();
-            }
-            else
-            {
-                std::cerr << "INVALID OUTPUT FORMAT: " << outputFormat << std::endl;
+            algorithm2->setOrderingAlgorithm(new htd::MinFillOrderingAlgorithm(manager));
 
-                error = true;
-            }
+            adaptiveAlgorithm->addDecompositionAlgorithm(algorithm2);
 
-            if (!error)
+            htd::BucketEliminationTreeDecompositionAlgorithm * algorithm3 = new htd::BucketEliminationTreeDecompositionAlgorithm(manager);
+
+            algorithm3->setOrderingAlgorithm(new htd::MaximumCardinalitySearchOrderingAlgorithm(manager));
+
+            adaptiveAlgorithm->addDecompositionAlgorithm(algorithm3,
+                                                         [](const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph)
             {
-                if (instanceOption.used())
+                HTD_UNUSED(graph)
+
+                return preprocessedGraph.vertexCount() <= 10240;
+            });
+
+            if (iterationOption.used())
+            {
+                std::size_t iterations = std::stoul(iterationOption.value(), nullptr, 10);
+
+                if (iterations == 0)
                 {
-                    run(*algorithm, *exporter, inputFormatChoice.value(), libraryInstance, instanceOption.value());
+                    iterations = (std::size_t)-1;
+                }
+
+                adaptiveAlgorithm->setIterationCount(iterations);
+            }
+            else
+            {
+                adaptiveAlgorithm->setIterationCount(10);
+            }
+
+            if (patienceOption.used())
+            {
+                if (std::string(patienceOption.value()) == "-1")
+                {
+                    adaptiveAlgorithm->setNonImprovementLimit((std::size_t)-1);
                 }
                 else
                 {
-                    run(*algorithm, *exporter, inputFormatChoice.value(), libraryInstance);
+                    adaptiveAlgorithm->setNonImprovementLimit(std::stoul(patienceOption.value(), nullptr, 10));
                 }
-
-                delete exporter;
             }
 
-            delete algorithm;
+            adaptiveAlgorithm->setDecisionRounds(5);
+
+            algorithm->addDecompositionAlgorithm(new htd::TrivialTreeDecompositionAlgorithm(manager));
+
+            algorithm->addDecompositionAlgorithm(adaptiveAlgorithm);
         }
         else
         {
-            htd_io::ITreeDecompositionExporter * exporter = nullptr;
+            htd::WidthMinimizingTreeDecompositionAlgorithm * baseAlgorithm = new htd::WidthMinimizingTreeDecompositionAlgorithm(manager);
 
-            if (outputFormat == "td")
+            if (iterationOption.used())
             {
-                exporter = new htd_io::TdFormatExporter();
+                std::size_t iterations = std::stoul(iterationOption.value(), nullptr, 10);
+
+                if (iterations == 0)
+                {
+                    iterations = (std::size_t)-1;
+                }
+
+                baseAlgorithm->setIterationCount(iterations);
             }
-            else if (outputFormat == "human")
+            else
             {
-                exporter = new htd_io::HumanReadableExporter();
+                baseAlgorithm->setIterationCount(10);
             }
-            else if (outputFormat == "width")
+
+            if (patienceOption.used())
             {
-                exporter = new htd_io::WidthExporter();
+                if (std::string(patienceOption.value()) == "-1")
+                {
+                    baseAlgorithm->setNonImprovementLimit((std::size_t)-1);
+                }
+                else
+                {
+                    baseAlgorithm->setNonImprovementLimit(std::stoul(patienceOption.value(), nullptr, 10));
+                }
             }
-            else
-            {
-                std::cerr << "INVALID OUTPUT FORMAT: " << outputFormat << std::endl;
 
-                error = true;
-            }
+            algorithm->addDecompositionAlgorithm(baseAlgorithm);
+        }
 
-            if (!error)
-            {
-                std::size_t optimalMaximumBagSize = (std::size_t)-1;
+        algorithm->setComputeInducedEdgesEnabled(false);
 
-                if (std::string(optimizationChoice.value()) == "width")
-                {
-                    htd::CombinedWidthMinimizingTreeDecompositionAlgorithm * algorithm = new htd::CombinedWidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
+        if (threadOption.used())
+        {
+            algorithm->setThreadCount(std::stoul(threadOption.value(), nullptr, 10));
+        }
 
-                    if (std::string(strategyChoice.value()) == "challenge")
-                    {
-                        htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm * adaptiveAlgorithm = new htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
+        manager->treeDecompositionAlgorithmFactory().setConstructionTemplate(algorithm);
+    }
 
-                        htd::BucketEliminationTreeDecompositionAlgorithm * algorithm1 = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+    if (decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree" && threadOption.used())
+    {
+        htd::HypertreeDecompositionAlgorithm * algorithm = new htd::HypertreeDecompositionAlgorithm(manager);
 
-                        algorithm1->setOrderingAlgorithm(new htd::MinDegreeOrderingAlgorithm(libraryInstance));
+        algorithm->setThreadCount(std::stoul(threadOption.value(), nullptr, 10));
 
-                        adaptiveAlgorithm->addDecompositionAlgorithm(algorithm1);
+        manager->hypertreeDecompositionAlgorithmFactory().setConstructionTemplate(algorithm);
+    }
+}
 
-                        htd::BucketEliminationTreeDecompositionAlgorithm * algorithm2 = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+htd_io::ITreeDecompositionExporter * createTreeDecompositionExporter(const std::string & outputFormat)
+{
+    htd_io::ITreeDecompositionExporter * ret = nullptr;
 
-                        algorithm2->setOrderingAlgorithm(new htd::MinFillOrderingAlgorithm(libraryInstance));
+    if (outputFormat == "td")
+    {
+        ret = new htd_io::TdFormatExporter();
+    }
+    else if (outputFormat == "human")
+    {
+        ret = new htd_io::HumanReadableExporter();
+    }
+    else if (outputFormat == "width")
+    {
+        ret = new htd_io::WidthExporter();
+    }
+    else if (outputFormat == "binary")
+    {
+        ret = new htd_io::BinaryFormatExporter();
+    }
 
-                        adaptiveAlgorithm->addDecompositionAlgorithm(algorithm2);
+    return ret;
+}
 
-                        htd::BucketEliminationTreeDecompositionAlgorithm * algorithm3 = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+htd_io::IGraphToTreeDecompositionProcessor * createProcessor(const htd_cli::OptionManager & optionManager, const htd::LibraryInstance * const manager)
+{
+    const htd_cli::Choice & inputFormatChoice = optionManager.accessChoice("input");
 
-                        algorithm3->setOrderingAlgorithm(new htd::MaximumCardinalitySearchOrderingAlgorithm(libraryInstance));
+    const htd_cli::Choice & preprocessingChoice = optionManager.accessChoice("preprocessing");
 
-                        adaptiveAlgorithm->addDecompositionAlgorithm(algorithm3,
-                                                                     [](const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph)
-                        {
-                            HTD_UNUSED(graph)
+    const htd_cli::SingleValueOption & threadOption = optionManager.accessSingleValueOption("threads");
 
-                            return preprocessedGraph.vertexCount() <= 10240;
-                        });
+    htd::GraphPreprocessor * preprocessor = new htd::GraphPreprocessor(manager);
 
-                        if (iterationOption.used())
-                        {
-                            std::size_t iterations = std::stoul(iterationOption.value(), nullptr, 10);
+    if (std::string(preprocessingChoice.value()) == "none")
+    {
+        preprocessor->setPreprocessingStrategy(0);
+    }
+    else if (std::string(preprocessingChoice.value()) == "simple")
+    {
+        preprocessor->setPreprocessingStrategy(1);
+    }
+    else if (std::string(preprocessingChoice.value()) == "advanced")
+    {
+        preprocessor->setPreprocessingStrategy(2);
+    }
+    else if (std::string(preprocessingChoice.value()) == "full")
+    {
+        preprocessor->setPreprocessingStrategy(3);
 
-                            if (iterations == 0)
-                            {
-                                iterations = (std::size_t)-1;
-                            }
+        preprocessor->setIterationCount(256);
+        preprocessor->setNonImprovementLimit(64);
 
-                            adaptiveAlgorithm->setIterationCount(iterations);
-                        }
-                        else
-                        {
-                            adaptiveAlgorithm->setIterationCount(10);
-                        }
+        if (threadOption.used())
+        {
+            preprocessor->setThreadCount(std::stoul(threadOption.value(), nullptr, 10));
+        }
+    }
 
-                        if (patienceOption.used())
-                        {
-                            if (std::string(patienceOption.value()) == "-1")
-                            {
-                                adaptiveAlgorithm->setNonImprovementLimit((std::size_t)-1);
-                            }
-                            else
-                            {
-                                adaptiveAlgorithm->setNonImprovementLimit(std::stoul(patienceOption.value(), nullptr, 10));
-                            }
-                        }
+    htd_io::IGraphToTreeDecompositionProcessor * processor = nullptr;
 
-                        adaptiveAlgorithm->setDecisionRounds(5);
+    if (std::string(inputFormatChoice.value()) == "gr")
+    {
+        processor = new htd_io::GrFormatGraphToTreeDecompositionProcessor(manager);
+    }
+    else if (std::string(inputFormatChoice.value()) == "hgr")
+    {
+        processor = new htd_io::HgrFormatGraphToTreeDecompositionProcessor(manager);
+    }
+    else if (std::string(inputFormatChoice.value()) == "lp")
+    {
+        processor = new htd_io::LpFormatGraphToTreeDecompositionProcessor(manager);
+    }
+    else if (std::string(inputFormatChoice.value()) == "binary")
+    {
+        processor = new htd_io::BinaryFormatGraphToTreeDecompositionProcessor(manager);
+    }
+    else
+    {
+        processor = new htd_main::DefaultTreeDecompositionProcessor(manager);
+    }
 
-                        algorithm->addDecompositionAlgorithm(new htd::TrivialTreeDecompositionAlgorithm(libraryInstance));
+    processor->setPreprocessor(preprocessor);
 
-                        algorithm->addDecompositionAlgorithm(adaptiveAlgorithm);
-                    }
-                    else
-                    {
-                        htd::WidthMinimizingTreeDecompositionAlgorithm * baseAlgorithm = new htd::WidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
+    return processor;
+}
 
-                        if (iterationOption.used())
-                        {
-                            std::size_t iterations = std::stoul(iterationOption.value(), nullptr, 10);
+int runBatch(const htd_cli::OptionManager & optionManager)
+{
+    const htd_cli::Choice & outputFormatChoice = optionManager.accessChoice("output");
 
-                            if (iterations == 0)
-                            {
-                                iterations = (std::size_t)-1;
-                            }
+    const htd_cli::SingleValueOption & batchOption = optionManager.accessSingleValueOption("batch");
 
-                            baseAlgorithm->setIterationCount(iterations);
-                        }
-                        else
-                        {
-                            baseAlgorithm->setIterationCount(10);
-                        }
+    const htd_cli::SingleValueOption & workerOption = optionManager.accessSingleValueOption("workers");
 
-                        if (patienceOption.used())
-                        {
-                            if (std::string(patienceOption.value()) == "-1")
-                            {
-                                baseAlgorithm->setNonImprovementLimit((std::size_t)-1);
-                            }
-                            else
-                            {
-                                baseAlgorithm->setNonImprovementLimit(std::stoul(patienceOption.value(), nullptr, 10));
-                            }
-                        }
+    const htd_cli::SingleValueOption & outputDirectoryOption = optionManager.accessSingleValueOption("output-directory");
 
-                        algorithm->addDecompositionAlgorithm(baseAlgorithm);
-                    }
+    const htd_cli::SingleValueOption & summaryOption = optionManager.accessSingleValueOption("summary");
 
-                    algorithm->setComputeInducedEdgesEnabled(false);
+    const std::string outputFormat = outputFormatChoice.value();
 
-                    libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(algorithm);
-                }
+    std::vector<std::string> instances;
 
-                htd::GraphPreprocessor * preprocessor = new htd::GraphPreprocessor(libraryInstance);
+    if (!htd_main::BatchProcessor::collectInstances(batchOption.value(), outputFormat, instances))
+    {
+        std::cerr << "INVALID BATCH: " << batchOption.value() << std::endl;
 
-                if (std::string(preprocessingChoice.value()) == "none")
-                {
-                    preprocessor->setPreprocessingStrategy(0);
-                }
-                else if (std::string(preprocessingChoice.value()) == "simple")
-                {
-                    preprocessor->setPreprocessingStrategy(1);
-                }
-                else if (std::string(preprocessingChoice.value()) == "advanced")
-                {
-                    preprocessor->setPreprocessingStrategy(2);
-                }
-                else if (std::string(preprocessingChoice.value()) == "full")
-                {
-                    preprocessor->setPreprocessingStrategy(3);
+        return 1;
+    }
 
-                    preprocessor->setIterationCount(256);
-                    preprocessor->setNonImprovementLimit(64);
-                }
+    htd_main::BatchProcessor processor([&](htd::LibraryInstance * manager)
+                                       {
+                                           configureLibraryInstance(optionManager, manager);
 
-                htd_io::IGraphToTreeDecompositionProcessor * processor = nullptr;
+                                           return createProcessor(optionManager, manager);
+                                       },
+                                       [&](void)
+                                       {
+                                           return createTreeDecompositionExporter(outputFormat);
+                                       });
 
-                if (std::string(inputFormatChoice.value()) == "gr")
-                {
-                    processor = new htd_io::GrFormatGraphToTreeDecompositionProcessor(libraryInstance);
-                }
-                else if (std::string(inputFormatChoice.value()) == "hgr")
+    if (workerOption.used())
+    {
+        processor.setWorkerCount(std::stoul(workerOption.value(), nullptr, 10));
+    }
+
+    if (outputDirectoryOption.used())
+    {
+        processor.setOutputDirectory(outputDirectoryOption.value());
+    }
+
+    processor.setOutputExtension(outputFormat);
+
+    std::ofstream summaryStream;
+
+    if (summaryOption.used())
+    {
+        summaryStream.open(summaryOption.value());
+
+        if (!summaryStream.is_open())
+        {
+            std::cerr << "INVALID SUMMARY FILE: " << summaryOption.value() << std::endl;
+
+            return 1;
+        }
+    }
+
+    batchProcessor.store(&processor);
+
+    std::size_t failureCount = 0;
+
+    if (!libraryInstance->isTerminated())
+    {
+        failureCount = processor.process(instances, summaryOption.used() ? summaryStream : std::cout);
+    }
+
+    batchProcessor.store(nullptr);
+
+    if (libraryInstance->isTerminated())
+    {
+        std::cerr << "Program was terminated successfully!" << std::endl;
+    }
+
+    return failureCount > 0 ? 1 : 0;
+}
+
+void handleSignal(int signal)
+{
+    switch (signal)
+    {
+        case SIGINT:
+        case SIGTERM:
+        {
+            libraryInstance->terminate();
+
+            htd_main::BatchProcessor * processor = batchProcessor.load();
+
+            if (processor != nullptr)
+            {
+                processor->terminate();
+            }
+
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+int main(int argc, const char * const * const argv)
+{
+    int ret = 0;
+
+    bool error = false;
+
+    std::ios_base::sync_with_stdio(false);
+
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+
+    htd_cli::OptionManager * optionManager = createOptionManager();
+
+    if (optionManager != nullptr && handleOptions(argc, argv, *optionManager))
+    {
+        const htd_cli::Choice & inputFormatChoice = optionManager->accessChoice("input");
+
+        const htd_cli::Choice & outputFormatChoice = optionManager->accessChoice("output");
+
+        const htd_cli::Choice & decompositionTypeChoice = optionManager->accessChoice("type");
+
+        const htd_cli::Choice & preprocessingChoice = optionManager->accessChoice("preprocessing");
+
+        const htd_cli::SingleValueOption & instanceOption = optionManager->accessSingleValueOption("instance");
+
+        const htd_cli::SingleValueOption & saveInstanceOption = optionManager->accessSingleValueOption("save-instance");
+
+        const htd_cli::SingleValueOption & batchOption = optionManager->accessSingleValueOption("batch");
+
+        const htd_cli::Option & printProgressOption = optionManager->accessOption("print-progress");
+
+        const std::string & outputFormat = outputFormatChoice.value();
+
+        bool hypertreeDecompositionRequested = decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree";
+
+        configureLibraryInstance(*optionManager, libraryInstance);
+
+        if (batchOption.used())
+        {
+            ret = runBatch(*optionManager);
+        }
+        else if (saveInstanceOption.used())
+        {
+            htd::IMultiHypergraph * graph = importInstance(inputFormatChoice.value(), libraryInstance, instanceOption);
+
+            if (graph != nullptr)
+            {
+                std::ofstream outputStream(saveInstanceOption.value(), std::ios::binary);
+
+                htd_io::BinaryFormatExporter exporter;
+
+                exporter.write(*graph, outputStream);
+
+                outputStream.close();
+
+                if (!outputStream)
                 {
-                    processor = new htd_io::HgrFormatGraphToTreeDecompositionProcessor(libraryInstance);
+                    std::cerr << "FAILED TO WRITE INSTANCE: " << saveInstanceOption.value() << std::endl;
+
+                    ret = 1;
                 }
-                else if (std::string(inputFormatChoice.value()) == "lp")
+
+                delete graph;
+            }
+            else
+            {
+                std::cerr << "NO VALID INSTANCE PROVIDED!" << std::endl;
+
+                ret = 1;
+            }
+        }
+        else if (hypertreeDecompositionRequested)
+        {
+            htd::IHypertreeDecompositionAlgorithm * algorithm = libraryInstance->hypertreeDecompositionAlgorithmFactory().createInstance();
+
+            htd_io::IHypertreeDecompositionExporter * exporter = nullptr;
+
+            if (outputFormat == "human")
+            {
+                exporter = new htd_io::HumanReadableExporter();
+            }
+            else if (outputFormat == "width")
+            {
+                exporter = new htd_io::WidthExporter();
+            }
+            else
+            {
+                std::cerr << "INVALID OUTPUT FORMAT: " << outputFormat << std::endl;
+
+                error = true;
+            }
+
+            if (!error)
+            {
+                if (instanceOption.used())
                 {
-                    processor = new htd_io::LpFormatGraphToTreeDecompositionProcessor(libraryInstance);
+                    run(*algorithm, *exporter, inputFormatChoice.value(), libraryInstance, instanceOption.value());
                 }
                 else
                 {
-                    processor = new htd_main::DefaultTreeDecompositionProcessor(libraryInstance);
+                    run(*algorithm, *exporter, inputFormatChoice.value(), libraryInstance);
                 }
 
-                processor->setExporter(exporter);
+                delete exporter;
+            }
 
-                processor->setPreprocessor(preprocessor);
+            delete algorithm;
+        }
+        else
+        {
+            htd_io::ITreeDecompositionExporter * exporter = createTreeDecompositionExporter(outputFormat);
+
+            if (exporter == nullptr)
+            {
+                std::cerr << "INVALID OUTPUT FORMAT: " << outputFormat << std::endl;
+
+                error = true;
+            }
+
+            if (!error)
+            {
+                std::size_t optimalMaximumBagSize = (std::size_t)-1;
+
+                htd_io::IGraphToTreeDecompositionProcessor * processor = createProcessor(*optionManager, libraryInstance);
+
+                processor->setExporter(exporter);
 
                 std::chrono::milliseconds::rep start =
                     std::chrono::duration_cast<std::chrono::milliseconds>
@@ -976,6 +1396,11 @@ int main(int argc, const char * const * const argv)
 
                                 std::cout << "   Improved Maximum Bag Size: " << std::right << std::setw(8) << optimalMaximumBagSize << std::endl;
 
+                                if (fitness.levelCount() > 1)
+                                {
+                                    std::cout << "   Gap To Lower Bound:        " << std::right << std::setw(8) << static_cast<std::size_t>(-fitness.at(1)) << std::endl;
+                                }
+
                                 std::cout.flags(oldflags);
                             }
                         }
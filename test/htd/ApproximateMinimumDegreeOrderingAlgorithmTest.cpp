@@ -0,0 +1,291 @@
+/*
+ * File:   ApproximateMinimumDegreeOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+class ApproximateMinimumDegreeOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        ApproximateMinimumDegreeOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~ApproximateMinimumDegreeOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Compute the maximum bag size of the decomposition obtained by eliminating the vertices of the graph in the given order.
+ */
+std::size_t eliminationWidth(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::vector<std::set<htd::vertex_t>> neighborhood(graph.vertexCount() > 0 ? graph.vertexAtPosition(graph.vertexCount() - 1) + 1 : 1);
+
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+    {
+        for (htd::vertex_t vertex1 : hyperedge)
+        {
+            for (htd::vertex_t vertex2 : hyperedge)
+            {
+                if (vertex1 != vertex2)
+                {
+                    neighborhood[vertex1].insert(vertex2);
+                }
+            }
+        }
+    }
+
+    std::size_t ret = 0;
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> neighbors(neighborhood[vertex].begin(), neighborhood[vertex].end());
+
+        ret = std::max(ret, neighbors.size() + 1);
+
+        for (htd::vertex_t neighbor1 : neighbors)
+        {
+            neighborhood[neighbor1].erase(vertex);
+
+            for (htd::vertex_t neighbor2 : neighbors)
+            {
+                if (neighbor1 != neighbor2)
+                {
+                    neighborhood[neighbor1].insert(neighbor2);
+                }
+            }
+        }
+
+        neighborhood[vertex].clear();
+    }
+
+    return ret;
+}
+
+/**
+ *  Check whether the given ordering contains each vertex of the graph exactly once.
+ */
+bool isPermutation(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::vector<htd::vertex_t> sortedOrdering(ordering);
+
+    std::sort(sortedOrdering.begin(), sortedOrdering.end());
+
+    std::vector<htd::vertex_t> vertices(graph.vertices().begin(), graph.vertices().end());
+
+    return sortedOrdering == vertices;
+}
+
+TEST(ApproximateMinimumDegreeOrderingAlgorithmTest, CheckCloneMethod)
+{
+    htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST);
+    htd::LibraryInstance * libraryInstance2 = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::ApproximateMinimumDegreeOrderingAlgorithm algorithm(libraryInstance1);
+
+    htd::ApproximateMinimumDegreeOrderingAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ(libraryInstance1, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    algorithm.setManagementInstance(libraryInstance2);
+
+    ASSERT_EQ(libraryInstance2, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    delete libraryInstance1;
+    delete libraryInstance2;
+    delete clonedAlgorithm;
+}
+
+TEST(ApproximateMinimumDegreeOrderingAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::ApproximateMinimumDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(ordering->sequence().empty());
+    ASSERT_EQ((std::size_t)1, ordering->requiredIterations());
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinimumDegreeOrderingAlgorithmTest, CheckSize1Graph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 1);
+
+    htd::ApproximateMinimumDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_EQ((std::size_t)1, ordering->sequence().size());
+    ASSERT_EQ((htd::vertex_t)1, ordering->sequence()[0]);
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinimumDegreeOrderingAlgorithmTest, CheckTree)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator generator(5);
+
+    htd::MultiHypergraph graph(libraryInstance, 200);
+
+    for (htd::vertex_t vertex = 2; vertex <= 200; ++vertex)
+    {
+        graph.addEdge(vertex, 1 + generator.nextIndex(vertex - 1));
+    }
+
+    htd::ApproximateMinimumDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+    ASSERT_TRUE(isPermutation(graph, ordering->sequence()));
+
+    ASSERT_EQ((std::size_t)2, ordering->maximumBagSize());
+    ASSERT_EQ((std::size_t)2, eliminationWidth(graph, ordering->sequence()));
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinimumDegreeOrderingAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator generator(9);
+
+    htd::ApproximateMinimumDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    for (std::size_t iteration = 0; iteration < 50; ++iteration)
+    {
+        std::size_t vertexCount = 5 + generator.nextIndex(100);
+
+        htd::MultiHypergraph graph(libraryInstance, vertexCount + 1);
+
+        graph.removeVertex(1);
+
+        std::size_t edgeCount = generator.nextIndex(4 * vertexCount);
+
+        for (std::size_t edge = 0; edge < edgeCount; ++edge)
+        {
+            htd::vertex_t vertex1 = 2 + generator.nextIndex(vertexCount);
+            htd::vertex_t vertex2 = 2 + generator.nextIndex(vertexCount);
+
+            if (vertex1 != vertex2)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        /* Hyperedges lead to indistinguishable vertices, which are detected as supervariables. */
+        for (std::size_t edge = 0; edge < vertexCount / 10; ++edge)
+        {
+            std::vector<htd::vertex_t> elements;
+
+            for (std::size_t element = 0; element < 4; ++element)
+            {
+                elements.push_back(2 + generator.nextIndex(vertexCount));
+            }
+
+            graph.addEdge(elements);
+        }
+
+        htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+        ASSERT_TRUE(isPermutation(graph, ordering->sequence()));
+
+        ASSERT_EQ(eliminationWidth(graph, ordering->sequence()), ordering->maximumBagSize());
+
+        delete ordering;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(ApproximateMinimumDegreeOrderingAlgorithmTest, CheckWidthLimit)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 6);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 6; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 6; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::ApproximateMinimumDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IWidthLimitedVertexOrdering * ordering1 = algorithm.computeOrdering(graph, 6, 1);
+
+    ASSERT_TRUE(isPermutation(graph, ordering1->sequence()));
+    ASSERT_EQ((std::size_t)6, ordering1->maximumBagSize());
+
+    htd::IWidthLimitedVertexOrdering * ordering2 = algorithm.computeOrdering(graph, 5, 3);
+
+    ASSERT_EQ((std::size_t)3, ordering2->requiredIterations());
+    ASSERT_LT((std::size_t)5, ordering2->maximumBagSize());
+
+    delete ordering1;
+    delete ordering2;
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
 #include <vector>
 
 class BucketEliminationTreeDecompositionAlgorithmTest : public ::testing::Test
@@ -415,6 +416,85 @@ TEST(BucketEliminationTreeDecompositionAlgorithmTest, CheckResultSimpleGraphWith
     delete libraryInstance;
 }
 
+TEST(BucketEliminationTreeDecompositionAlgorithmTest, CheckResultRandomHypergraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator generator(43);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    for (std::size_t iteration = 0; iteration < 100; ++iteration)
+    {
+        std::size_t vertexCount = 2 + generator.nextIndex(40);
+
+        htd::MultiHypergraph graph(libraryInstance, vertexCount + 2);
+
+        graph.removeVertex(1);
+        graph.removeVertex(vertexCount / 2 + 1);
+
+        std::vector<htd::vertex_t> vertices(graph.vertices().begin(), graph.vertices().end());
+
+        std::size_t edgeCount = generator.nextIndex(3 * vertexCount);
+
+        for (std::size_t edge = 0; edge < edgeCount; ++edge)
+        {
+            std::vector<htd::vertex_t> elements;
+
+            std::size_t elementCount = 1 + generator.nextIndex(4);
+
+            for (std::size_t element = 0; element < elementCount; ++element)
+            {
+                elements.push_back(vertices[generator.nextIndex(vertices.size())]);
+            }
+
+            graph.addEdge(elements);
+        }
+
+        algorithm.setCompressionEnabled(iteration % 2 == 0);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+        if (!algorithm.isCompressionEnabled())
+        {
+            ASSERT_EQ(graph.vertexCount(), decomposition->vertexCount());
+        }
+
+        for (htd::vertex_t node : decomposition->vertices())
+        {
+            const std::vector<htd::vertex_t> & bag = decomposition->bagContent(node);
+
+            ASSERT_TRUE(std::is_sorted(bag.begin(), bag.end()));
+
+            ASSERT_TRUE(std::adjacent_find(bag.begin(), bag.end()) == bag.end());
+
+            std::size_t inducedEdgeCount = 0;
+
+            for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+            {
+                const std::vector<htd::vertex_t> & elements = hyperedge.sortedElements();
+
+                if (std::includes(bag.begin(), bag.end(), elements.begin(), elements.end()))
+                {
+                    ++inducedEdgeCount;
+                }
+            }
+
+            ASSERT_EQ(inducedEdgeCount, decomposition->inducedHyperedges(node).size());
+        }
+
+        delete decomposition;
+    }
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,262 @@
+/*
+ * File:   EliminationWidthEvaluatorTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+class EliminationWidthEvaluatorTest : public ::testing::Test
+{
+    public:
+        EliminationWidthEvaluatorTest(void)
+        {
+
+        }
+
+        virtual ~EliminationWidthEvaluatorTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Compute the maximum bag size of the decomposition obtained by eliminating the vertices of the graph in the given order.
+ */
+std::size_t eliminationWidth(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::vector<std::set<htd::vertex_t>> neighbors(graph.vertexCount() == 0 ? 1 : graph.vertexAtPosition(graph.vertexCount() - 1) + 1);
+
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+    {
+        for (htd::vertex_t vertex1 : hyperedge.sortedElements())
+        {
+            for (htd::vertex_t vertex2 : hyperedge.sortedElements())
+            {
+                if (vertex1 != vertex2)
+                {
+                    neighbors[vertex1].insert(vertex2);
+                }
+            }
+        }
+    }
+
+    std::size_t ret = 0;
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        ret = std::max(ret, neighbors[vertex].size() + 1);
+
+        for (htd::vertex_t neighbor1 : neighbors[vertex])
+        {
+            neighbors[neighbor1].erase(vertex);
+
+            for (htd::vertex_t neighbor2 : neighbors[vertex])
+            {
+                if (neighbor1 != neighbor2)
+                {
+                    neighbors[neighbor1].insert(neighbor2);
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Create a random hypergraph with non-contiguous vertex identifiers.
+ */
+htd::MultiHypergraph * createRandomHypergraph(const htd::LibraryInstance * const libraryInstance, htd::RandomNumberGenerator & generator)
+{
+    std::size_t vertexCount = 2 + generator.nextIndex(40);
+
+    htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance, vertexCount + 2);
+
+    ret->removeVertex(1);
+    ret->removeVertex(vertexCount / 2 + 1);
+
+    std::vector<htd::vertex_t> vertices(ret->vertices().begin(), ret->vertices().end());
+
+    std::size_t edgeCount = generator.nextIndex(3 * vertexCount);
+
+    for (std::size_t edge = 0; edge < edgeCount; ++edge)
+    {
+        std::vector<htd::vertex_t> elements;
+
+        std::size_t elementCount = 1 + generator.nextIndex(4);
+
+        for (std::size_t element = 0; element < elementCount; ++element)
+        {
+            elements.push_back(vertices[generator.nextIndex(vertices.size())]);
+        }
+
+        ret->addEdge(elements);
+    }
+
+    return ret;
+}
+
+TEST(EliminationWidthEvaluatorTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::EliminationWidthEvaluator evaluator(libraryInstance);
+
+    ASSERT_EQ((std::size_t)0, evaluator.computeMaximumBagSize(graph, std::vector<htd::vertex_t>()));
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    ASSERT_EQ((std::size_t)0, algorithm.computeMaximumBagSize(graph));
+
+    delete libraryInstance;
+}
+
+TEST(EliminationWidthEvaluatorTest, CheckPathAndStar)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 5);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 3);
+    graph.addEdge(1, 4);
+    graph.addEdge(1, 5);
+
+    htd::EliminationWidthEvaluator evaluator(libraryInstance);
+
+    ASSERT_EQ((std::size_t)2, evaluator.computeMaximumBagSize(graph, std::vector<htd::vertex_t> { 2, 3, 4, 5, 1 }));
+
+    /* Eliminating the center first creates a clique on the leaves. */
+    ASSERT_EQ((std::size_t)5, evaluator.computeMaximumBagSize(graph, std::vector<htd::vertex_t> { 1, 2, 3, 4, 5 }));
+
+    ASSERT_EQ((std::size_t)4, evaluator.computeMaximumBagSize(graph, std::vector<htd::vertex_t> { 1, 2, 3, 4, 5 }, 3));
+
+    ASSERT_EQ((std::size_t)5, evaluator.computeMaximumBagSize(graph, std::vector<htd::vertex_t> { 1, 2, 3, 4, 5 }, 5));
+
+    delete libraryInstance;
+}
+
+TEST(EliminationWidthEvaluatorTest, CheckRandomHypergraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator generator(31);
+
+    htd::EliminationWidthEvaluator evaluator(libraryInstance);
+
+    for (std::size_t iteration = 0; iteration < 200; ++iteration)
+    {
+        htd::MultiHypergraph * graph = createRandomHypergraph(libraryInstance, generator);
+
+        std::vector<htd::vertex_t> ordering(graph->vertices().begin(), graph->vertices().end());
+
+        std::shuffle(ordering.begin(), ordering.end(), generator);
+
+        std::size_t expectedMaximumBagSize = eliminationWidth(*graph, ordering);
+
+        ASSERT_EQ(expectedMaximumBagSize, evaluator.computeMaximumBagSize(*graph, ordering));
+
+        for (std::size_t maxBagSize = 0; maxBagSize <= expectedMaximumBagSize + 1; ++maxBagSize)
+        {
+            std::size_t maximumBagSize = evaluator.computeMaximumBagSize(*graph, ordering, maxBagSize);
+
+            if (expectedMaximumBagSize <= maxBagSize)
+            {
+                ASSERT_EQ(expectedMaximumBagSize, maximumBagSize);
+            }
+            else
+            {
+                ASSERT_EQ(maxBagSize + 1, maximumBagSize);
+            }
+        }
+
+        delete graph;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(EliminationWidthEvaluatorTest, CheckBucketEliminationMaximumBagSize)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator generator(37);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    for (std::size_t iteration = 0; iteration < 50; ++iteration)
+    {
+        htd::MultiHypergraph * graph = createRandomHypergraph(libraryInstance, generator);
+
+        htd::randomNumberGenerator().seed(iteration);
+
+        std::size_t maximumBagSize = algorithm.computeMaximumBagSize(*graph);
+
+        htd::randomNumberGenerator().seed(iteration);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(*graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        ASSERT_EQ(decomposition->maximumBagSize(), maximumBagSize);
+
+        /* Bounded decompositions are only constructed for orderings within the bound. */
+        std::pair<htd::ITreeDecomposition *, std::size_t> boundedDecomposition = algorithm.computeDecomposition(*graph, maximumBagSize - 1, 1);
+
+        if (boundedDecomposition.first != nullptr)
+        {
+            ASSERT_LT(boundedDecomposition.first->maximumBagSize(), maximumBagSize);
+
+            delete boundedDecomposition.first;
+        }
+
+        delete decomposition;
+        delete graph;
+    }
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -26,6 +26,8 @@
 
 #include <htd/main.hpp>
 
+#include <map>
+#include <set>
 #include <vector>
 
 class GraphPreprocessorTest : public ::testing::Test
@@ -1457,6 +1459,311 @@ TEST(GraphPreprocessorTest, CheckSize50Graph2)
     delete preprocessedGraph;
 }
 
+TEST(GraphPreprocessorTest, CheckSelfLoops)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 4);
+
+    graph.addEdge((htd::vertex_t)1, (htd::vertex_t)1);
+    graph.addEdge((htd::vertex_t)1, (htd::vertex_t)2);
+    graph.addEdge((htd::vertex_t)2, (htd::vertex_t)3);
+    graph.addEdge((htd::vertex_t)3, (htd::vertex_t)3);
+    graph.addEdge((htd::vertex_t)3, (htd::vertex_t)4);
+    graph.addEdge((htd::vertex_t)4, (htd::vertex_t)1);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    for (htd::vertex_t vertex = 0; vertex < 4; ++vertex)
+    {
+        const std::vector<htd::vertex_t> & neighborhood = preprocessedGraph->neighborhood(vertex);
+
+        ASSERT_EQ((std::size_t)2, neighborhood.size());
+        ASSERT_FALSE(std::binary_search(neighborhood.begin(), neighborhood.end(), vertex));
+    }
+
+    htd::MinFillOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setDenseNeighborhoodThreshold((std::size_t)-1);
+
+    htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, *preprocessedGraph, (std::size_t)-1, 1);
+
+    ASSERT_EQ((std::size_t)4, ordering->sequence().size());
+    ASSERT_EQ((std::size_t)3, ordering->maximumBagSize());
+
+    delete ordering;
+    delete preprocessedGraph;
+    delete libraryInstance;
+}
+
+TEST(GraphPreprocessorTest, CheckNeighborhoodSnapshot)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator generator(7);
+
+    htd::MultiHypergraph graph(libraryInstance, 100);
+
+    for (std::size_t index = 0; index < 250; ++index)
+    {
+        htd::vertex_t vertex1 = static_cast<htd::vertex_t>(generator.nextIndex(100) + 1);
+        htd::vertex_t vertex2 = static_cast<htd::vertex_t>(generator.nextIndex(100) + 1);
+
+        if (vertex1 != vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    for (std::size_t strategy : { (std::size_t)0, (std::size_t)-1 })
+    {
+        htd::GraphPreprocessor preprocessor(libraryInstance);
+
+        preprocessor.setPreprocessingStrategy(strategy);
+
+        const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+        const htd::NeighborhoodSnapshot & snapshot = preprocessedGraph->neighborhoodSnapshot();
+
+        ASSERT_EQ(preprocessedGraph->neighborhood().size(), snapshot.vertexCount());
+
+        std::size_t entryCount = 0;
+
+        for (htd::vertex_t vertex = 0; vertex < snapshot.vertexCount(); ++vertex)
+        {
+            const std::vector<htd::vertex_t> & expectedNeighborhood = preprocessedGraph->neighborhood(vertex);
+
+            ASSERT_EQ(expectedNeighborhood.size(), snapshot.neighborCount(vertex));
+
+            ASSERT_TRUE(std::equal(expectedNeighborhood.begin(), expectedNeighborhood.end(), snapshot.begin(vertex)));
+
+            entryCount += expectedNeighborhood.size();
+        }
+
+        ASSERT_EQ(entryCount, snapshot.entryCount());
+
+        for (htd::vertex_t vertex : preprocessedGraph->remainingVertices())
+        {
+            std::vector<htd::vertex_t> closedNeighborhood;
+
+            snapshot.copyClosedNeighborhoodTo(vertex, closedNeighborhood);
+
+            std::vector<htd::vertex_t> expectedNeighborhood(preprocessedGraph->neighborhood(vertex));
+
+            expectedNeighborhood.insert(std::lower_bound(expectedNeighborhood.begin(), expectedNeighborhood.end(), vertex), vertex);
+
+            ASSERT_EQ(expectedNeighborhood, closedNeighborhood);
+        }
+
+        htd::PreprocessedGraph copiedGraph(static_cast<const htd::PreprocessedGraph &>(*preprocessedGraph));
+
+        ASSERT_TRUE(copiedGraph.neighborhoodSnapshot() == snapshot);
+
+        delete preprocessedGraph;
+    }
+
+    delete libraryInstance;
+}
+
+std::size_t computeMaximumBagSize(const htd::MultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::size_t ret = 0;
+
+    std::map<htd::vertex_t, std::set<htd::vertex_t>> neighborhood;
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        const htd::ConstCollection<htd::vertex_t> & neighbors = graph.neighbors(vertex);
+
+        neighborhood[vertex].insert(neighbors.begin(), neighbors.end());
+
+        neighborhood[vertex].erase(vertex);
+    }
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::set<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+        ret = std::max(ret, currentNeighborhood.size() + 1);
+
+        for (htd::vertex_t neighbor : currentNeighborhood)
+        {
+            std::set<htd::vertex_t> & otherNeighborhood = neighborhood[neighbor];
+
+            otherNeighborhood.erase(vertex);
+
+            for (htd::vertex_t neighbor2 : currentNeighborhood)
+            {
+                if (neighbor2 != neighbor)
+                {
+                    otherNeighborhood.insert(neighbor2);
+                }
+            }
+        }
+
+        neighborhood.erase(vertex);
+    }
+
+    return ret;
+}
+
+TEST(GraphPreprocessorTest, CheckSeparatorDecomposition)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator generator(11);
+
+    /* A tree of cliques of size 5, connected via articulation points and separators of size 2, plus a separate component. */
+    htd::MultiHypergraph graph(libraryInstance, 0);
+
+    std::vector<std::vector<htd::vertex_t>> cliques;
+
+    for (std::size_t index = 0; index < 40; ++index)
+    {
+        std::vector<htd::vertex_t> clique;
+
+        if (index > 0 && index != 30)
+        {
+            const std::vector<htd::vertex_t> & parentClique = cliques[generator.nextIndex(index)];
+
+            std::size_t sharedVertexCount = 1 + generator.nextIndex(2);
+
+            clique.insert(clique.end(), parentClique.begin(), parentClique.begin() + sharedVertexCount);
+        }
+
+        while (clique.size() < 5)
+        {
+            clique.push_back(graph.addVertex());
+        }
+
+        for (auto it = clique.begin(); it != clique.end(); ++it)
+        {
+            for (auto it2 = it + 1; it2 != clique.end(); ++it2)
+            {
+                if (!graph.isEdge(*it, *it2))
+                {
+                    graph.addEdge(*it, *it2);
+                }
+            }
+        }
+
+        cliques.push_back(clique);
+    }
+
+    std::vector<htd::vertex_t> referenceSequence;
+
+    for (std::size_t threadCount : { 1, 4 })
+    {
+        htd::GraphPreprocessor preprocessor(libraryInstance);
+
+        preprocessor.setPreprocessingStrategy(3);
+
+        preprocessor.setThreadCount(threadCount);
+
+        htd::randomNumberGenerator().seed(3);
+
+        htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+        ASSERT_LE(preprocessedGraph->remainingVertices().size(), 5u);
+
+        ASSERT_EQ(graph.vertexCount(), preprocessedGraph->remainingVertices().size() +
+                                       preprocessedGraph->eliminationSequence().size());
+
+        for (htd::vertex_t vertex : preprocessedGraph->remainingVertices())
+        {
+            ASSERT_LE(preprocessedGraph->neighborhood(vertex).size(), 4u);
+        }
+
+        htd::MinFillOrderingAlgorithm algorithm(libraryInstance);
+
+        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph, *preprocessedGraph);
+
+        ASSERT_TRUE(isValidOrdering(graph, ordering->sequence()));
+
+        ASSERT_EQ(5u, computeMaximumBagSize(graph, ordering->sequence()));
+
+        if (threadCount == 1)
+        {
+            referenceSequence = preprocessedGraph->eliminationSequence();
+        }
+        else
+        {
+            ASSERT_EQ(referenceSequence, preprocessedGraph->eliminationSequence());
+        }
+
+        delete ordering;
+        delete preprocessedGraph;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(GraphPreprocessorTest, CheckLowerBoundOfSeparatedParts)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    /* A 6x6 grid (treewidth 6) which is split off as a part and a 4x60 grid (treewidth 4) which remains. */
+    htd::MultiHypergraph graph(libraryInstance, 0);
+
+    for (std::size_t rowCount : { 6, 4 })
+    {
+        std::size_t columnCount = rowCount == 6 ? 6 : 60;
+
+        std::vector<htd::vertex_t> vertices;
+
+        for (std::size_t index = 0; index < rowCount * columnCount; ++index)
+        {
+            vertices.push_back(graph.addVertex());
+        }
+
+        for (std::size_t row = 0; row < rowCount; ++row)
+        {
+            for (std::size_t column = 0; column < columnCount; ++column)
+            {
+                if (row + 1 < rowCount)
+                {
+                    graph.addEdge(vertices[row * columnCount + column], vertices[(row + 1) * columnCount + column]);
+                }
+
+                if (column + 1 < columnCount)
+                {
+                    graph.addEdge(vertices[row * columnCount + column], vertices[row * columnCount + column + 1]);
+                }
+            }
+        }
+    }
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(3);
+
+    htd::randomNumberGenerator().seed(5);
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    /* Only proven bounds enter the lower bound, the heuristic width of the part only enters the width of the prefix. */
+    ASSERT_LE(preprocessedGraph->minTreeWidth(), 6u);
+
+    ASSERT_GE(preprocessedGraph->prefixWidth(), 6u);
+
+    ASSERT_GE(preprocessedGraph->prefixWidth(), preprocessedGraph->minTreeWidth());
+
+    htd::MinFillOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, *preprocessedGraph, (std::size_t)-1, 1);
+
+    ASSERT_TRUE(isValidOrdering(graph, ordering->sequence()));
+
+    ASSERT_EQ(computeMaximumBagSize(graph, ordering->sequence()), ordering->maximumBagSize());
+
+    delete ordering;
+    delete preprocessedGraph;
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -714,6 +714,68 @@ TEST(HelperTest, CheckSymmetricDifferenceSizes3)
     ASSERT_EQ((std::size_t)3, result.second);
 }
 
+TEST(HelperTest, CheckRandomNumberGeneratorReproducibility)
+{
+    htd::RandomNumberGenerator generator1(42);
+    htd::RandomNumberGenerator generator2(42);
+    htd::RandomNumberGenerator generator3(43);
+
+    bool different = false;
+
+    for (int index = 0; index < 100; ++index)
+    {
+        htd::RandomNumberGenerator::result_type value = generator1();
+
+        ASSERT_EQ(value, generator2());
+
+        if (value != generator3())
+        {
+            different = true;
+        }
+    }
+
+    ASSERT_TRUE(different);
+
+    generator1.seed(7);
+    generator2.seed(7);
+
+    ASSERT_EQ(generator1(), generator2());
+
+    ASSERT_NE(htd::RandomNumberGenerator::deriveSeed(42, 0), htd::RandomNumberGenerator::deriveSeed(42, 1));
+}
+
+TEST(HelperTest, CheckSelectRandomElement)
+{
+    std::vector<htd::vertex_t> input { 1, 2, 3, 4, 5 };
+
+    std::vector<std::size_t> occurrences(input.size() + 1, 0);
+
+    htd::RandomNumberGenerator generator(1234);
+
+    for (int index = 0; index < 1000; ++index)
+    {
+        htd::vertex_t element = htd::selectRandomElement<htd::vertex_t>(input, generator);
+
+        ASSERT_GE(element, (htd::vertex_t)1);
+        ASSERT_LE(element, (htd::vertex_t)5);
+
+        ++occurrences[element];
+    }
+
+    for (htd::vertex_t vertex : input)
+    {
+        ASSERT_GT(occurrences[vertex], (std::size_t)0);
+    }
+
+    htd::randomNumberGenerator().seed(99);
+
+    htd::vertex_t element1 = htd::selectRandomElement<htd::vertex_t>(input);
+
+    htd::randomNumberGenerator().seed(99);
+
+    ASSERT_EQ(element1, htd::selectRandomElement<htd::vertex_t>(input));
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
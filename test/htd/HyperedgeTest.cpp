@@ -942,6 +942,41 @@ TEST(HyperedgeTest, CheckSetElements)
     ASSERT_EQ((htd::vertex_t)1, hyperedge1.sortedElements()[0]);
 }
 
+TEST(HyperedgeTest, CheckReplaceAndEraseUnsortedElements)
+{
+    htd::Hyperedge hyperedge1((htd::id_t)1, std::vector<htd::vertex_t> { 3, 1, 2 });
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), hyperedge1.sortedElements());
+
+    hyperedge1.setElements(std::vector<htd::vertex_t> { 5, 4, 5 });
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 5, 4, 5 }), hyperedge1.elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 4, 5 }), hyperedge1.sortedElements());
+
+    hyperedge1.erase(5);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 4 }), hyperedge1.elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 4 }), hyperedge1.sortedElements());
+
+    ASSERT_TRUE(hyperedge1.contains(4));
+    ASSERT_FALSE(hyperedge1.contains(5));
+
+    hyperedge1.erase(4);
+
+    ASSERT_TRUE(hyperedge1.empty());
+    ASSERT_TRUE(hyperedge1.sortedElements().empty());
+
+    htd::Hyperedge hyperedge2((htd::id_t)2, std::vector<htd::vertex_t> { 7, 6 });
+
+    htd::Hyperedge hyperedge3(hyperedge2);
+
+    hyperedge2.setElements(8, 9);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 8, 9 }), hyperedge2.sortedElements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 7, 6 }), hyperedge3.elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 6, 7 }), hyperedge3.sortedElements());
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -466,6 +466,87 @@ TEST(HypertreeDecompositionAlgorithmTest, CheckResultSimpleGraphWithLabelingFunc
     delete libraryInstance;
 }
 
+TEST(HypertreeDecompositionAlgorithmTest, CheckParallelCoveringEdges)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 40);
+
+    std::unordered_set<htd::id_t> irrelevantEdges;
+
+    for (htd::vertex_t vertex = 1; vertex <= 38; ++vertex)
+    {
+        /* Each hyperedge {i, i + 1} is nested in the hyperedge {i, i + 1, i + 2} added afterwards. */
+        irrelevantEdges.insert(graph.addEdge(vertex, vertex + 1));
+
+        if (vertex % 4 == 0)
+        {
+            /* Of several identical hyperedges, only the last one is relevant. */
+            irrelevantEdges.insert(graph.addEdge(std::vector<htd::vertex_t> { vertex + 2, vertex, vertex + 1 }));
+        }
+
+        graph.addEdge(std::vector<htd::vertex_t> { vertex, vertex + 1, vertex + 2 });
+    }
+
+    irrelevantEdges.insert(graph.addEdge(7, 7));
+
+    graph.addEdge(std::vector<htd::vertex_t> { 3, 17, 31 });
+
+    const htd::RandomNumberGenerator generator = htd::randomNumberGenerator();
+
+    htd::HypertreeDecompositionAlgorithm sequentialAlgorithm(libraryInstance);
+
+    htd::IHypertreeDecomposition * sequentialDecomposition = sequentialAlgorithm.computeDecomposition(graph);
+
+    ASSERT_NE(sequentialDecomposition, nullptr);
+
+    ASSERT_GT(sequentialDecomposition->vertexCount(), (std::size_t)4);
+
+    ASSERT_TRUE(isValidHypertreeDecomposition(graph, *sequentialDecomposition));
+
+    for (std::size_t threadCount : { 2, 4, 0 })
+    {
+        htd::randomNumberGenerator() = generator;
+
+        htd::HypertreeDecompositionAlgorithm parallelAlgorithm(libraryInstance);
+
+        parallelAlgorithm.setThreadCount(threadCount);
+
+        ASSERT_EQ(threadCount, parallelAlgorithm.threadCount());
+
+        htd::IHypertreeDecomposition * parallelDecomposition = parallelAlgorithm.computeDecomposition(graph);
+
+        ASSERT_NE(parallelDecomposition, nullptr);
+
+        ASSERT_EQ(sequentialDecomposition->vertexCount(), parallelDecomposition->vertexCount());
+
+        for (htd::vertex_t vertex : sequentialDecomposition->vertices())
+        {
+            ASSERT_TRUE(parallelDecomposition->isVertex(vertex));
+
+            ASSERT_EQ(sequentialDecomposition->bagContent(vertex), parallelDecomposition->bagContent(vertex));
+
+            const std::vector<htd::Hyperedge> & sequentialCoveringEdges = sequentialDecomposition->coveringEdges(vertex);
+            const std::vector<htd::Hyperedge> & parallelCoveringEdges = parallelDecomposition->coveringEdges(vertex);
+
+            ASSERT_EQ(sequentialCoveringEdges.size(), parallelCoveringEdges.size());
+
+            for (htd::index_t index = 0; index < sequentialCoveringEdges.size(); ++index)
+            {
+                EXPECT_EQ(sequentialCoveringEdges[index].id(), parallelCoveringEdges[index].id());
+
+                EXPECT_EQ(irrelevantEdges.count(parallelCoveringEdges[index].id()), (std::size_t)0);
+            }
+        }
+
+        delete parallelDecomposition;
+    }
+
+    delete sequentialDecomposition;
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
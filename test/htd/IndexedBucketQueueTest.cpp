@@ -0,0 +1,204 @@
+/*
+ * File:   IndexedBucketQueueTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+class IndexedBucketQueueTest : public ::testing::Test
+{
+    public:
+        IndexedBucketQueueTest(void)
+        {
+
+        }
+
+        virtual ~IndexedBucketQueueTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(IndexedBucketQueueTest, CheckBasicOperations)
+{
+    htd::IndexedBucketQueue<std::greater<std::size_t>> queue(10);
+
+    ASSERT_TRUE(queue.empty());
+
+    queue.push(3, 5);
+    queue.push(7, 2);
+    queue.push(1, 2);
+    queue.push(4, 1000);
+
+    ASSERT_FALSE(queue.empty());
+    ASSERT_EQ((std::size_t)4, queue.size());
+
+    ASSERT_TRUE(queue.contains(7));
+    ASSERT_FALSE(queue.contains(8));
+
+    ASSERT_EQ((std::size_t)2, queue.topPriority());
+
+    std::vector<htd::id_t> top(queue.topCollection().begin(), queue.topCollection().end());
+
+    std::sort(top.begin(), top.end());
+
+    ASSERT_EQ(std::vector<htd::id_t>({ 1, 7 }), top);
+
+    queue.updatePriority(4, 0);
+
+    ASSERT_EQ((std::size_t)0, queue.topPriority());
+    ASSERT_EQ(std::vector<htd::id_t>({ 4 }), queue.topCollection());
+
+    queue.updatePriority(4, 2000000);
+
+    ASSERT_EQ((std::size_t)2000000, queue.priority(4));
+    ASSERT_EQ((std::size_t)2, queue.topPriority());
+
+    ASSERT_TRUE(queue.erase(7));
+    ASSERT_FALSE(queue.erase(7));
+
+    ASSERT_EQ(std::vector<htd::id_t>({ 1 }), queue.topCollection());
+
+    ASSERT_TRUE(queue.erase(1));
+
+    ASSERT_EQ((std::size_t)5, queue.topPriority());
+    ASSERT_EQ((std::size_t)2, queue.size());
+
+    queue.updatePriority(3, 2000000);
+
+    ASSERT_EQ((std::size_t)2000000, queue.topPriority());
+    ASSERT_EQ((std::size_t)2, queue.topCollection().size());
+}
+
+TEST(IndexedBucketQueueTest, CheckRandomOperations)
+{
+    const std::size_t capacity = 200;
+
+    htd::IndexedBucketQueue<std::less<std::size_t>> queue(capacity);
+
+    std::vector<std::size_t> priorities(capacity, (std::size_t)-1);
+
+    htd::RandomNumberGenerator generator(5);
+
+    for (std::size_t step = 0; step < 20000; ++step)
+    {
+        htd::id_t value = static_cast<htd::id_t>(generator.nextIndex(capacity));
+
+        std::size_t priority = generator.nextIndex(2) == 0 ? generator.nextIndex(20) : generator.nextIndex(100000);
+
+        switch (generator.nextIndex(3))
+        {
+            case 0:
+            {
+                if (priorities[value] == (std::size_t)-1)
+                {
+                    queue.push(value, priority);
+
+                    priorities[value] = priority;
+                }
+
+                break;
+            }
+            case 1:
+            {
+                if (priorities[value] != (std::size_t)-1)
+                {
+                    queue.updatePriority(value, priority);
+
+                    priorities[value] = priority;
+                }
+
+                break;
+            }
+            default:
+            {
+                ASSERT_EQ(priorities[value] != (std::size_t)-1, queue.erase(value));
+
+                priorities[value] = (std::size_t)-1;
+
+                break;
+            }
+        }
+
+        std::size_t expectedSize = 0;
+
+        std::size_t maximumPriority = 0;
+
+        std::vector<htd::id_t> expectedTop;
+
+        for (htd::id_t vertex = 0; vertex < capacity; ++vertex)
+        {
+            if (priorities[vertex] != (std::size_t)-1)
+            {
+                ++expectedSize;
+
+                if (expectedSize == 1 || priorities[vertex] > maximumPriority)
+                {
+                    maximumPriority = priorities[vertex];
+
+                    expectedTop.clear();
+                }
+
+                if (priorities[vertex] == maximumPriority)
+                {
+                    expectedTop.push_back(vertex);
+                }
+            }
+        }
+
+        ASSERT_EQ(expectedSize, queue.size());
+
+        if (expectedSize > 0)
+        {
+            ASSERT_EQ(maximumPriority, queue.topPriority());
+
+            std::vector<htd::id_t> top(queue.topCollection().begin(), queue.topCollection().end());
+
+            std::sort(top.begin(), top.end());
+
+            ASSERT_EQ(expectedTop, top);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <deque>
 #include <utility>
 #include <vector>
 
@@ -293,6 +294,44 @@ TEST(IteratorTest, CheckConstIteratorCloneMethod2)
     delete it2;
 }
 
+TEST(IteratorTest, CheckContiguousConstCollection)
+{
+    std::vector<int> values { 1, 2, 3 };
+
+    htd::ConstCollection<int> collection1 = htd::ConstCollection<int>::getInstance(values);
+
+    ASSERT_TRUE(collection1.isContiguous());
+    ASSERT_EQ(values.data(), collection1.data());
+    ASSERT_EQ(3, collection1[2]);
+
+    htd::ConstCollection<int> collection2;
+
+    {
+        htd::VectorAdapter<int> adapter(values);
+
+        collection2 = htd::ConstCollection<int>::getInstance(adapter);
+    }
+
+    ASSERT_TRUE(collection2.isContiguous());
+    ASSERT_EQ((std::size_t)3, collection2.size());
+    ASSERT_TRUE(collection1 == collection2);
+
+    auto it1 = collection2.begin();
+
+    auto it2 = it1++;
+
+    ASSERT_EQ(1, *it2);
+    ASSERT_EQ(2, *it1);
+
+    std::deque<int> otherValues { 1, 2, 3 };
+
+    htd::ConstCollection<int> collection3 = htd::ConstCollection<int>::getInstance(otherValues);
+
+    ASSERT_FALSE(collection3.isContiguous());
+    ASSERT_EQ(3, collection3[2]);
+    ASSERT_TRUE(collection1 == collection3);
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
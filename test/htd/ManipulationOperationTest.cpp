@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -151,6 +152,69 @@ class FitnessFunction : public htd::ITreeDecompositionFitnessFunction
         }
 };
 
+class RerootableFitnessFunction : public htd::IRerootableTreeDecompositionFitnessFunction
+{
+    public:
+        RerootableFitnessFunction(void)
+        {
+
+        }
+
+        ~RerootableFitnessFunction()
+        {
+
+        }
+
+        htd::FitnessEvaluation * fitness(const htd::IMultiHypergraph & graph,
+                                         const htd::ITreeDecomposition & decomposition) const
+        {
+            HTD_UNUSED(graph)
+
+            return new htd::FitnessEvaluation(1,
+                                              -(double)(decomposition.height()));
+        }
+
+        void initializeAggregate(std::vector<double> & aggregate) const
+        {
+            aggregate.assign(1, -1.0);
+        }
+
+        void combine(std::vector<double> & aggregate, const std::vector<double> & value) const
+        {
+            aggregate[0] = std::max(aggregate[0], value[0]);
+        }
+
+        void computeSubtreeSummary(const htd::IMultiHypergraph & graph,
+                                   const htd::ITreeDecomposition & decomposition,
+                                   htd::vertex_t vertex,
+                                   const std::vector<double> & childAggregate,
+                                   std::vector<double> & summary) const
+        {
+            HTD_UNUSED(graph)
+            HTD_UNUSED(decomposition)
+            HTD_UNUSED(vertex)
+
+            summary.assign(1, childAggregate[0] + 1);
+        }
+
+        htd::FitnessEvaluation * rootedFitness(const htd::IMultiHypergraph & graph,
+                                               const htd::ITreeDecomposition & decomposition,
+                                               htd::vertex_t root,
+                                               const std::vector<double> & summary) const
+        {
+            HTD_UNUSED(graph)
+            HTD_UNUSED(decomposition)
+            HTD_UNUSED(root)
+
+            return new htd::FitnessEvaluation(1, -summary[0]);
+        }
+
+        RerootableFitnessFunction * clone(void) const
+        {
+            return new RerootableFitnessFunction();
+        }
+};
+
 htd::IMultiHypergraph * createInputGraph(const htd::LibraryInstance * const libraryInstance)
 {
     htd::MultiHypergraph * graph = new htd::MultiHypergraph(libraryInstance, 50);
@@ -1979,6 +2043,104 @@ TEST(ManipulationOperationTest, CheckTreeDecompositionOptimizationOperation4)
     delete libraryInstance2;
 }
 
+TEST(ManipulationOperationTest, CheckTreeDecompositionOptimizationOperationWithRerootableFitnessFunction)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::pair<htd::IMultiHypergraph *, htd::IMutableTreeDecomposition *> input = computeTreeDecomposition(libraryInstance);
+
+    htd::IMultiHypergraph * graph = input.first;
+
+    htd::IMutableTreeDecomposition * decomposition1 = input.second;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+    htd::IMutableTreeDecomposition * decomposition2 = input.second->clone();
+#else
+    htd::IMutableTreeDecomposition * decomposition2 = input.second->cloneMutableTreeDecomposition();
+#endif
+
+    htd::TreeDecompositionVerifier verifier;
+
+    htd::TreeDecompositionOptimizationOperation operation1(libraryInstance, new FitnessFunction());
+
+    htd::TreeDecompositionOptimizationOperation operation2(libraryInstance, new RerootableFitnessFunction());
+
+    operation1.apply(*graph, *decomposition1);
+
+    operation2.apply(*graph, *decomposition2);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition2));
+
+    EXPECT_EQ(decomposition1->root(), decomposition2->root());
+
+    EXPECT_EQ(decomposition1->height(), decomposition2->height());
+
+    for (htd::vertex_t vertex : decomposition1->vertices())
+    {
+        decomposition1->makeRoot(vertex);
+
+        ASSERT_LE(decomposition2->height(), decomposition1->height());
+    }
+
+    delete graph;
+    delete decomposition1;
+    delete decomposition2;
+    delete libraryInstance;
+}
+
+TEST(ManipulationOperationTest, CheckParallelNaiveTreeDecompositionOptimizationOperation)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::pair<htd::IMultiHypergraph *, htd::IMutableTreeDecomposition *> input = computeTreeDecomposition(libraryInstance);
+
+    htd::IMultiHypergraph * graph = input.first;
+
+    htd::IMutableTreeDecomposition * decomposition1 = input.second;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+    htd::IMutableTreeDecomposition * decomposition2 = input.second->clone();
+#else
+    htd::IMutableTreeDecomposition * decomposition2 = input.second->cloneMutableTreeDecomposition();
+#endif
+
+    htd::TreeDecompositionVerifier verifier;
+
+    htd::TreeDecompositionOptimizationOperation operation1(libraryInstance, new FitnessFunction(), true);
+
+    operation1.addManipulationOperation(new htd::NormalizationOperation(libraryInstance));
+
+    ASSERT_EQ((std::size_t)1, operation1.threadCount());
+
+    htd::TreeDecompositionOptimizationOperation operation2(libraryInstance, new FitnessFunction(), true);
+
+    operation2.addManipulationOperation(new htd::NormalizationOperation(libraryInstance));
+
+    operation2.setThreadCount(4);
+
+    ASSERT_EQ((std::size_t)4, operation2.threadCount());
+
+    operation1.apply(*graph, *decomposition1);
+
+    operation2.apply(*graph, *decomposition2);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition2));
+
+    EXPECT_EQ(decomposition1->root(), decomposition2->root());
+    EXPECT_EQ(decomposition1->height(), decomposition2->height());
+    EXPECT_EQ(decomposition1->vertexCount(), decomposition2->vertexCount());
+
+    htd::TreeDecompositionOptimizationOperation * clonedOperation = operation2.clone();
+
+    EXPECT_EQ((std::size_t)4, clonedOperation->threadCount());
+
+    delete graph;
+    delete decomposition1;
+    delete decomposition2;
+    delete clonedOperation;
+    delete libraryInstance;
+}
+
 TEST(ManipulationOperationTest, CheckTreeDecompositionAddEmptyRootOperation1)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
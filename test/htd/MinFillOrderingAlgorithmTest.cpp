@@ -1296,6 +1296,93 @@ TEST(MinFillOrderingAlgorithmTest, CheckSize50Graph2)
     delete libraryInstance;
 }
 
+TEST(MinFillOrderingAlgorithmTest, CheckDenseEngineConsistency)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator graphGenerator(17);
+
+    for (std::size_t vertexCount : { 40, 150, 300 })
+    {
+        for (std::size_t density : { 5, 20, 50 })
+        {
+            htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+            for (htd::vertex_t vertex1 = 1; vertex1 <= vertexCount; ++vertex1)
+            {
+                for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= vertexCount; ++vertex2)
+                {
+                    if (graphGenerator.nextIndex(100) < density)
+                    {
+                        graph.addEdge(vertex1, vertex2);
+                    }
+                }
+            }
+
+            htd::MinFillOrderingAlgorithm sparseAlgorithm(libraryInstance);
+            htd::MinFillOrderingAlgorithm denseAlgorithm(libraryInstance);
+            htd::MinFillOrderingAlgorithm hybridAlgorithm(libraryInstance);
+            htd::MinFillOrderingAlgorithm limitedAlgorithm(libraryInstance);
+
+            sparseAlgorithm.setDenseNeighborhoodThreshold((std::size_t)-1);
+            denseAlgorithm.setDenseNeighborhoodThreshold(0);
+            hybridAlgorithm.setDenseNeighborhoodThreshold(8);
+
+            /* The bitsets of the remaining graph never fit into the memory limit, hence the sparse engine is used. */
+            limitedAlgorithm.setDenseNeighborhoodThreshold(0);
+            limitedAlgorithm.setDenseMemoryLimit(0);
+
+            htd::MinFillOrderingAlgorithm * clonedAlgorithm = limitedAlgorithm.clone();
+
+            ASSERT_EQ((std::size_t)0, clonedAlgorithm->denseNeighborhoodThreshold());
+            ASSERT_EQ((std::size_t)0, clonedAlgorithm->denseMemoryLimit());
+
+            delete clonedAlgorithm;
+
+            for (std::size_t seed = 0; seed < 3; ++seed)
+            {
+                htd::randomNumberGenerator().seed(seed);
+
+                htd::IWidthLimitedVertexOrdering * sparseOrdering = sparseAlgorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+                htd::randomNumberGenerator().seed(seed);
+
+                htd::IWidthLimitedVertexOrdering * denseOrdering = denseAlgorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+                htd::randomNumberGenerator().seed(seed);
+
+                htd::IWidthLimitedVertexOrdering * hybridOrdering = hybridAlgorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+                htd::randomNumberGenerator().seed(seed);
+
+                htd::IWidthLimitedVertexOrdering * limitedOrdering = limitedAlgorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+                ASSERT_EQ(graph.vertexCount(), sparseOrdering->sequence().size());
+
+                ASSERT_EQ(sparseOrdering->sequence(), denseOrdering->sequence());
+                ASSERT_EQ(sparseOrdering->sequence(), hybridOrdering->sequence());
+                ASSERT_EQ(sparseOrdering->sequence(), limitedOrdering->sequence());
+
+                ASSERT_EQ(sparseOrdering->maximumBagSize(), denseOrdering->maximumBagSize());
+                ASSERT_EQ(sparseOrdering->maximumBagSize(), hybridOrdering->maximumBagSize());
+                ASSERT_EQ(sparseOrdering->maximumBagSize(), limitedOrdering->maximumBagSize());
+
+                if (vertexCount <= 40 && seed == 2)
+                {
+                    ASSERT_TRUE(isValidOrdering(graph, denseOrdering->sequence()));
+                }
+
+                delete sparseOrdering;
+                delete denseOrdering;
+                delete hybridOrdering;
+                delete limitedOrdering;
+            }
+        }
+    }
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,355 @@
+/*
+ * File:   MinimumSeparatorAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <vector>
+
+class MinimumSeparatorAlgorithmTest : public ::testing::Test
+{
+    public:
+        MinimumSeparatorAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~MinimumSeparatorAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Count the connected components of the given graph after removing the given vertices.
+ */
+std::size_t countRemainingComponents(const htd::IGraphStructure & graph, const std::vector<htd::vertex_t> & removedVertices)
+{
+    std::size_t ret = 0;
+
+    std::vector<htd::vertex_t> visitedVertices(removedVertices);
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        if (std::find(visitedVertices.begin(), visitedVertices.end(), vertex) == visitedVertices.end())
+        {
+            std::vector<htd::vertex_t> stack { vertex };
+
+            visitedVertices.push_back(vertex);
+
+            while (!stack.empty())
+            {
+                htd::vertex_t current = stack.back();
+
+                stack.pop_back();
+
+                for (htd::vertex_t neighbor : graph.neighbors(current))
+                {
+                    if (std::find(visitedVertices.begin(), visitedVertices.end(), neighbor) == visitedVertices.end())
+                    {
+                        visitedVertices.push_back(neighbor);
+
+                        stack.push_back(neighbor);
+                    }
+                }
+            }
+
+            ++ret;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Determine the size of a minimum separator of the given graph by enumerating all vertex subsets.
+ */
+std::size_t computeMinimumSeparatorSize(const htd::IGraphStructure & graph)
+{
+    std::size_t ret = graph.vertexCount();
+
+    std::vector<htd::vertex_t> vertices;
+
+    graph.copyVerticesTo(vertices);
+
+    for (std::size_t mask = 0; mask < (static_cast<std::size_t>(1) << vertices.size()); ++mask)
+    {
+        std::vector<htd::vertex_t> subset;
+
+        for (htd::index_t index = 0; index < vertices.size(); ++index)
+        {
+            if ((mask & (static_cast<std::size_t>(1) << index)) != 0)
+            {
+                subset.push_back(vertices[index]);
+            }
+        }
+
+        if (subset.size() < ret && countRemainingComponents(graph, subset) > 1)
+        {
+            ret = subset.size();
+        }
+    }
+
+    return ret;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckPath)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Graph graph(libraryInstance);
+
+    graph.addVertices(5);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 5);
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+    ASSERT_EQ((std::size_t)1, separator->size());
+
+    ASSERT_EQ((std::size_t)2, countRemainingComponents(graph, *separator));
+
+    delete separator;
+
+    delete libraryInstance;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckCompleteGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Graph graph(libraryInstance);
+
+    graph.addVertices(4);
+
+    for (htd::vertex_t vertex = 1; vertex <= 4; ++vertex)
+    {
+        for (htd::vertex_t neighbor = vertex + 1; neighbor <= 4; ++neighbor)
+        {
+            graph.addEdge(vertex, neighbor);
+        }
+    }
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4 }), *separator);
+
+    delete separator;
+
+    delete libraryInstance;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckDisconnectedGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Graph graph(libraryInstance);
+
+    graph.addVertices(4);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(3, 4);
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+    ASSERT_TRUE(separator->empty());
+
+    delete separator;
+
+    delete libraryInstance;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator generator(7);
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+    for (std::size_t iteration = 0; iteration < 200; ++iteration)
+    {
+        std::size_t vertexCount = 3 + generator.nextIndex(8);
+
+        htd::Graph graph(libraryInstance);
+
+        graph.addVertices(vertexCount);
+
+        for (htd::vertex_t vertex = 2; vertex <= vertexCount; ++vertex)
+        {
+            graph.addEdge(vertex, 1 + generator.nextIndex(vertex - 1));
+        }
+
+        std::size_t additionalEdgeCount = generator.nextIndex(vertexCount * 2);
+
+        for (std::size_t index = 0; index < additionalEdgeCount; ++index)
+        {
+            htd::vertex_t vertex1 = 1 + generator.nextIndex(vertexCount);
+            htd::vertex_t vertex2 = 1 + generator.nextIndex(vertexCount);
+
+            if (vertex1 != vertex2 && !graph.isNeighbor(vertex1, vertex2))
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+        ASSERT_TRUE(std::is_sorted(separator->begin(), separator->end()));
+
+        if (separator->size() < vertexCount)
+        {
+            ASSERT_GT(countRemainingComponents(graph, *separator), (std::size_t)1);
+        }
+
+        ASSERT_EQ(computeMinimumSeparatorSize(graph), separator->size());
+
+        delete separator;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckGridGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    const std::size_t size = 50;
+
+    htd::Graph graph(libraryInstance);
+
+    graph.addVertices(size * size);
+
+    for (std::size_t row = 0; row < size; ++row)
+    {
+        for (std::size_t column = 0; column < size; ++column)
+        {
+            htd::vertex_t vertex = row * size + column + 1;
+
+            if (column + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + size);
+            }
+        }
+    }
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+    ASSERT_EQ((std::size_t)2, separator->size());
+
+    ASSERT_EQ((std::size_t)2, countRemainingComponents(graph, *separator));
+
+    delete separator;
+
+    delete libraryInstance;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckDinitzMaxFlowAlgorithm)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::FlowNetworkStructure flowNetwork(6);
+
+    flowNetwork.updateCapacity(0, 1, 10);
+    flowNetwork.updateCapacity(0, 2, 10);
+    flowNetwork.updateCapacity(1, 2, 2);
+    flowNetwork.updateCapacity(1, 3, 4);
+    flowNetwork.updateCapacity(1, 4, 8);
+    flowNetwork.updateCapacity(2, 4, 9);
+    flowNetwork.updateCapacity(4, 3, 6);
+    flowNetwork.updateCapacity(3, 5, 10);
+    flowNetwork.updateCapacity(4, 5, 10);
+
+    htd::DinitzMaxFlowAlgorithm algorithm(libraryInstance);
+
+    htd::IFlow * flow = algorithm.determineMaximumFlow(flowNetwork, 0, 5);
+
+    ASSERT_EQ((std::size_t)19, flow->value());
+
+    for (htd::vertex_t vertex = 0; vertex < 6; ++vertex)
+    {
+        long long balance = 0;
+
+        for (htd::vertex_t neighbor = 0; neighbor < 6; ++neighbor)
+        {
+            ASSERT_EQ(flow->flow(vertex, neighbor), -flow->flow(neighbor, vertex));
+
+            ASSERT_LE(flow->flow(vertex, neighbor), static_cast<long long>(flowNetwork.capacity(vertex, neighbor)));
+
+            balance += flow->flow(vertex, neighbor);
+        }
+
+        if (vertex == 0)
+        {
+            ASSERT_EQ(19, balance);
+        }
+        else if (vertex == 5)
+        {
+            ASSERT_EQ(-19, balance);
+        }
+        else
+        {
+            ASSERT_EQ(0, balance);
+        }
+    }
+
+    delete flow;
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
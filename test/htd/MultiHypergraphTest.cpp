@@ -804,6 +804,63 @@ TEST(MultiHypergraphTest, CheckCopyConstructors)
     delete libraryInstance;
 }
 
+TEST(MultiHypergraphTest, CheckBulkEdgeInsertion)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph1(libraryInstance, 6);
+    htd::MultiHypergraph graph2(libraryInstance, 6);
+
+    graph1.addEdge((htd::vertex_t)1, (htd::vertex_t)6);
+    graph2.addEdge((htd::vertex_t)1, (htd::vertex_t)6);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges { { 2, 1 }, { 3, 3 }, { 1, 2 }, { 5, 4 } };
+
+    std::vector<std::vector<htd::vertex_t>> hyperedges { { 4 }, { 6, 2, 6 }, { 1, 5, 3, 2 }, { 2, 2 } };
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        graph1.addEdge(edge.first, edge.second);
+    }
+
+    for (const std::vector<htd::vertex_t> & hyperedge : hyperedges)
+    {
+        graph1.addEdge(hyperedge);
+    }
+
+    ASSERT_EQ((htd::id_t)2, graph2.addEdges(edges));
+    ASSERT_EQ((htd::id_t)6, graph2.addEdges(std::vector<std::vector<htd::vertex_t>>(hyperedges)));
+    ASSERT_EQ((htd::id_t)9, graph2.addEdges(std::vector<std::pair<htd::vertex_t, htd::vertex_t>>()));
+
+    ASSERT_EQ(graph1.edgeCount(), graph2.edgeCount());
+
+    for (htd::index_t index = 0; index < graph1.edgeCount(); ++index)
+    {
+        const htd::Hyperedge & hyperedge1 = graph1.hyperedgeAtPosition(index);
+        const htd::Hyperedge & hyperedge2 = graph2.hyperedgeAtPosition(index);
+
+        ASSERT_EQ(hyperedge1.id(), hyperedge2.id());
+        ASSERT_EQ(hyperedge1.elements(), hyperedge2.elements());
+        ASSERT_EQ(hyperedge1.sortedElements(), hyperedge2.sortedElements());
+    }
+
+    for (htd::vertex_t vertex = 1; vertex <= 6; ++vertex)
+    {
+        ASSERT_EQ(graph1.isNeighbor(vertex, vertex), graph2.isNeighbor(vertex, vertex));
+
+        const htd::ConstCollection<htd::vertex_t> & neighbors1 = graph1.neighbors(vertex);
+        const htd::ConstCollection<htd::vertex_t> & neighbors2 = graph2.neighbors(vertex);
+
+        ASSERT_EQ(std::vector<htd::vertex_t>(neighbors1.begin(), neighbors1.end()), std::vector<htd::vertex_t>(neighbors2.begin(), neighbors2.end()));
+    }
+
+    ASSERT_TRUE(graph2.isNeighbor((htd::vertex_t)3, (htd::vertex_t)3));
+    ASSERT_TRUE(graph2.isNeighbor((htd::vertex_t)6, (htd::vertex_t)6));
+    ASSERT_FALSE(graph2.isNeighbor((htd::vertex_t)4, (htd::vertex_t)4));
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
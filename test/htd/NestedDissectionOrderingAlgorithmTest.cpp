@@ -0,0 +1,304 @@
+/*
+ * File:   NestedDissectionOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+class NestedDissectionOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        NestedDissectionOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~NestedDissectionOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Compute the maximum bag size of the decomposition obtained by eliminating the vertices of the graph in the given order.
+ */
+std::size_t eliminationWidth(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::vector<std::set<htd::vertex_t>> neighborhood(graph.vertexCount() > 0 ? graph.vertexAtPosition(graph.vertexCount() - 1) + 1 : 1);
+
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+    {
+        for (htd::vertex_t vertex1 : hyperedge)
+        {
+            for (htd::vertex_t vertex2 : hyperedge)
+            {
+                if (vertex1 != vertex2)
+                {
+                    neighborhood[vertex1].insert(vertex2);
+                }
+            }
+        }
+    }
+
+    std::size_t ret = 0;
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> neighbors(neighborhood[vertex].begin(), neighborhood[vertex].end());
+
+        ret = std::max(ret, neighbors.size() + 1);
+
+        for (htd::vertex_t neighbor1 : neighbors)
+        {
+            neighborhood[neighbor1].erase(vertex);
+
+            for (htd::vertex_t neighbor2 : neighbors)
+            {
+                if (neighbor1 != neighbor2)
+                {
+                    neighborhood[neighbor1].insert(neighbor2);
+                }
+            }
+        }
+
+        neighborhood[vertex].clear();
+    }
+
+    return ret;
+}
+
+/**
+ *  Check whether the given ordering contains each vertex of the graph exactly once.
+ */
+bool isPermutation(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::vector<htd::vertex_t> sortedOrdering(ordering);
+
+    std::sort(sortedOrdering.begin(), sortedOrdering.end());
+
+    std::vector<htd::vertex_t> vertices(graph.vertices().begin(), graph.vertices().end());
+
+    return sortedOrdering == vertices;
+}
+
+/**
+ *  Create a grid graph with the given number of rows and columns.
+ */
+htd::MultiHypergraph * createGridGraph(const htd::LibraryInstance * const libraryInstance, std::size_t rows, std::size_t columns)
+{
+    htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance, rows * columns);
+
+    for (std::size_t row = 0; row < rows; ++row)
+    {
+        for (std::size_t column = 0; column < columns; ++column)
+        {
+            htd::vertex_t vertex = 1 + row * columns + column;
+
+            if (column + 1 < columns)
+            {
+                ret->addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < rows)
+            {
+                ret->addEdge(vertex, vertex + columns);
+            }
+        }
+    }
+
+    return ret;
+}
+
+TEST(NestedDissectionOrderingAlgorithmTest, CheckCloneMethod)
+{
+    htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST);
+    htd::LibraryInstance * libraryInstance2 = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NestedDissectionOrderingAlgorithm algorithm(libraryInstance1);
+
+    algorithm.setLeafSize(16);
+    algorithm.setThreadCount(3);
+
+    htd::NestedDissectionOrderingAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ(libraryInstance1, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    ASSERT_EQ((std::size_t)16, clonedAlgorithm->leafSize());
+    ASSERT_EQ((std::size_t)3, clonedAlgorithm->threadCount());
+
+    algorithm.setManagementInstance(libraryInstance2);
+
+    ASSERT_EQ(libraryInstance2, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    delete libraryInstance1;
+    delete libraryInstance2;
+    delete clonedAlgorithm;
+}
+
+TEST(NestedDissectionOrderingAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::NestedDissectionOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(ordering->sequence().empty());
+    ASSERT_EQ((std::size_t)1, ordering->requiredIterations());
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(NestedDissectionOrderingAlgorithmTest, CheckSize1Graph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 1);
+
+    htd::NestedDissectionOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_EQ((std::size_t)1, ordering->sequence().size());
+    ASSERT_EQ((htd::vertex_t)1, ordering->sequence()[0]);
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(NestedDissectionOrderingAlgorithmTest, CheckGridGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph * graph = createGridGraph(libraryInstance, 40, 40);
+
+    htd::NestedDissectionOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(*graph);
+
+    ASSERT_TRUE(isPermutation(*graph, ordering->sequence()));
+
+    /* The treewidth of the grid is 40, a random ordering leads to bags containing a large fraction of the vertices. */
+    ASSERT_GE((std::size_t)100, eliminationWidth(*graph, ordering->sequence()));
+
+    delete libraryInstance;
+    delete ordering;
+    delete graph;
+}
+
+TEST(NestedDissectionOrderingAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator generator(11);
+
+    htd::NestedDissectionOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setLeafSize(8);
+
+    for (std::size_t iteration = 0; iteration < 50; ++iteration)
+    {
+        std::size_t vertexCount = 5 + generator.nextIndex(300);
+
+        htd::MultiHypergraph graph(libraryInstance, vertexCount + 1);
+
+        graph.removeVertex(1);
+
+        /* Sparse graphs with many components as well as dense graphs are dissected. */
+        std::size_t edgeCount = generator.nextIndex(6 * vertexCount);
+
+        for (std::size_t edge = 0; edge < edgeCount; ++edge)
+        {
+            htd::vertex_t vertex1 = 2 + generator.nextIndex(vertexCount);
+            htd::vertex_t vertex2 = 2 + generator.nextIndex(vertexCount);
+
+            if (vertex1 != vertex2)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+        ASSERT_TRUE(isPermutation(graph, ordering->sequence()));
+
+        delete ordering;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(NestedDissectionOrderingAlgorithmTest, CheckThreadCountIndependence)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph * graph = createGridGraph(libraryInstance, 60, 80);
+
+    htd::NestedDissectionOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::randomNumberGenerator().seed(17);
+
+    const htd::IVertexOrdering * ordering1 = algorithm.computeOrdering(*graph);
+
+    algorithm.setThreadCount(4);
+
+    htd::randomNumberGenerator().seed(17);
+
+    const htd::IVertexOrdering * ordering2 = algorithm.computeOrdering(*graph);
+
+    ASSERT_TRUE(isPermutation(*graph, ordering1->sequence()));
+
+    ASSERT_EQ(ordering1->sequence(), ordering2->sequence());
+
+    delete libraryInstance;
+    delete ordering1;
+    delete ordering2;
+    delete graph;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -1048,6 +1048,113 @@ TEST(TreeDecompositionOptimizationTest, CheckWidthMinimizationResultComplexGraph
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionOptimizationTest, CheckParallelWidthMinimizationResultComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(25);
+    algorithm.setThreadCount(4);
+
+    ASSERT_EQ((std::size_t)25, algorithm.iterationCount());
+    ASSERT_EQ((std::size_t)4, algorithm.threadCount());
+
+    std::size_t iterationCount = 0;
+    std::size_t minimalWidth = (std::size_t)-1;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_EQ(graph, &currentGraph);
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t currentWidth = currentDecomposition.maximumBagSize();
+
+        ASSERT_EQ(currentWidth, static_cast<std::size_t>(-fitness.at(0)));
+
+        ASSERT_LT(currentWidth, minimalWidth);
+
+        minimalWidth = currentWidth;
+
+        ++iterationCount;
+    });
+
+    ASSERT_LE(iterationCount, (std::size_t)25);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_GE(decomposition->vertexCount(), (std::size_t)1);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    ASSERT_LE(decomposition->minimumBagSize(), decomposition->maximumBagSize());
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalWidth, decomposition->maximumBagSize());
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckWidthMinimizationStopsAtLowerBound)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 8);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 8; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 8; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    /* Without an iteration limit, the algorithm only terminates because the first decomposition meets the lower bound. */
+    algorithm.setIterationCount(0);
+
+    for (std::size_t threadCount = 1; threadCount <= 4; threadCount += 3)
+    {
+        algorithm.setThreadCount(threadCount);
+
+        std::size_t callbackCount = 0;
+
+        htd::ITreeDecomposition * decomposition =
+            algorithm.computeDecomposition(graph,
+                                           [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+            ASSERT_EQ((std::size_t)2, fitness.levelCount());
+
+            ASSERT_EQ(currentDecomposition.maximumBagSize(), static_cast<std::size_t>(-fitness.at(0)));
+
+            ASSERT_EQ(0, fitness.at(1));
+
+            ++callbackCount;
+        });
+
+        ASSERT_NE(decomposition, nullptr);
+
+        ASSERT_EQ((std::size_t)8, decomposition->maximumBagSize());
+
+        ASSERT_GE(callbackCount, (std::size_t)1);
+
+        delete decomposition;
+    }
+
+    ASSERT_EQ(nullptr, algorithm.computeImprovedDecomposition(graph, 7));
+
+    delete libraryInstance;
+}
+
 TEST(TreeDecompositionOptimizationTest, CheckCombinedWidthMinimizationResultComplexGraph)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <stdexcept>
 #include <vector>
 
 class TreeDecompositionTest : public ::testing::Test
@@ -1267,6 +1268,32 @@ TEST(TreeDecompositionTest, TestEdgeLabelModifications)
     delete libraryInstance;
 }
 
+#ifdef NDEBUG
+/* Without NDEBUG the assertions in the accessors already reject vertices which were removed. */
+TEST(TreeDecompositionTest, CheckAccessToRemovedVertex)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::TreeDecomposition td(libraryInstance);
+
+    htd::vertex_t node1 = td.insertRoot(std::vector<htd::vertex_t> { 1, 2 }, htd::FilteredHyperedgeCollection());
+
+    htd::vertex_t node2 = td.addChild(node1, std::vector<htd::vertex_t> { 2, 3 }, htd::FilteredHyperedgeCollection());
+
+    td.removeVertex(node2);
+
+    EXPECT_THROW(td.bagSize(node2), std::out_of_range);
+    EXPECT_THROW(td.bagContent(node2), std::out_of_range);
+    EXPECT_THROW(td.mutableBagContent(node2), std::out_of_range);
+    EXPECT_THROW(td.inducedHyperedges(node2), std::out_of_range);
+    EXPECT_THROW(td.parent(node2), std::out_of_range);
+
+    ASSERT_EQ((std::size_t)2, td.bagSize(node1));
+
+    delete libraryInstance;
+}
+#endif
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
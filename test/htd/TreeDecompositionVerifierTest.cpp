@@ -0,0 +1,199 @@
+/*
+ * File:   TreeDecompositionVerifierTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <vector>
+
+class TreeDecompositionVerifierTest : public ::testing::Test
+{
+    public:
+        TreeDecompositionVerifierTest(void)
+        {
+
+        }
+
+        virtual ~TreeDecompositionVerifierTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(TreeDecompositionVerifierTest, CheckValidDecomposition)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(5);
+
+    graph.addEdge(std::vector<htd::vertex_t> { 1, 2, 3 });
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 5);
+
+    htd::TreeDecomposition decomposition(libraryInstance);
+
+    htd::vertex_t root = decomposition.insertRoot();
+    htd::vertex_t child1 = decomposition.addChild(root);
+    htd::vertex_t child2 = decomposition.addChild(child1);
+
+    decomposition.mutableBagContent(root) = std::vector<htd::vertex_t> { 3, 4 };
+    decomposition.mutableBagContent(child1) = std::vector<htd::vertex_t> { 1, 2, 3 };
+    decomposition.mutableBagContent(child2) = std::vector<htd::vertex_t> { 1 };
+
+    htd::vertex_t child3 = decomposition.addChild(root);
+
+    decomposition.mutableBagContent(child3) = std::vector<htd::vertex_t> { 4, 5 };
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verifyVertexExistence(graph, decomposition));
+    EXPECT_TRUE(verifier.verifyHyperedgeCoverage(graph, decomposition));
+    EXPECT_TRUE(verifier.verifyConnectednessCriterion(graph, decomposition));
+    EXPECT_TRUE(verifier.verify(graph, decomposition));
+
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionVerifierTest, CheckViolations)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(6);
+
+    graph.addEdge(std::vector<htd::vertex_t> { 1, 2, 3 });
+    graph.addEdge(1, 4);
+    graph.addEdge(2, 4);
+    graph.addEdge(4, 5);
+
+    htd::TreeDecomposition decomposition(libraryInstance);
+
+    htd::vertex_t root = decomposition.insertRoot();
+    htd::vertex_t child1 = decomposition.addChild(root);
+    htd::vertex_t child2 = decomposition.addChild(child1);
+    htd::vertex_t child3 = decomposition.addChild(root);
+
+    decomposition.mutableBagContent(root) = std::vector<htd::vertex_t> { 2, 4 };
+    decomposition.mutableBagContent(child1) = std::vector<htd::vertex_t> { 2, 3 };
+    decomposition.mutableBagContent(child2) = std::vector<htd::vertex_t> { 1, 2, 4 };
+    decomposition.mutableBagContent(child3) = std::vector<htd::vertex_t> { 4, 5 };
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_FALSE(verifier.verify(graph, decomposition));
+
+    htd::ConstCollection<htd::vertex_t> missingVertices = verifier.violationsVertexExistence(graph, decomposition);
+
+    ASSERT_EQ((std::size_t)1, missingVertices.size());
+    EXPECT_EQ((htd::vertex_t)6, missingVertices[0]);
+
+    htd::ConstCollection<htd::Hyperedge> missingHyperedges = verifier.violationsHyperedgeCoverage(graph, decomposition);
+
+    ASSERT_EQ((std::size_t)1, missingHyperedges.size());
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), missingHyperedges[0].sortedElements());
+
+    htd::ConstCollection<htd::vertex_t> disconnectedVertices = verifier.violationsConnectednessCriterion(graph, decomposition);
+
+    ASSERT_EQ((std::size_t)1, disconnectedVertices.size());
+    EXPECT_EQ((htd::vertex_t)4, disconnectedVertices[0]);
+
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionVerifierTest, CheckMultipleThreads)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator generator(11);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    std::size_t vertexCount = 200;
+
+    graph.addVertices(vertexCount);
+
+    for (std::size_t index = 0; index < 400; ++index)
+    {
+        htd::vertex_t vertex1 = 1 + generator.nextIndex(vertexCount);
+        htd::vertex_t vertex2 = 1 + generator.nextIndex(vertexCount);
+
+        if (vertex1 != vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::TreeDecompositionVerifier verifier1;
+
+    htd::TreeDecompositionVerifier verifier4;
+
+    verifier4.setThreadCount(4);
+
+    EXPECT_EQ((std::size_t)4, verifier4.threadCount());
+
+    EXPECT_TRUE(verifier1.verify(graph, *decomposition));
+    EXPECT_TRUE(verifier4.verify(graph, *decomposition));
+
+    htd::IMutableTreeDecomposition & mutableDecomposition = libraryInstance->treeDecompositionFactory().accessMutableInstance(*decomposition);
+
+    for (htd::vertex_t node : decomposition->vertices())
+    {
+        std::vector<htd::vertex_t> & bag = mutableDecomposition.mutableBagContent(node);
+
+        if (node % 3 == 0 && !bag.empty())
+        {
+            bag.erase(bag.begin() + generator.nextIndex(bag.size()));
+        }
+    }
+
+    EXPECT_FALSE(verifier1.verify(graph, *decomposition));
+
+    EXPECT_EQ(verifier1.violationsVertexExistence(graph, *decomposition), verifier4.violationsVertexExistence(graph, *decomposition));
+    EXPECT_EQ(verifier1.violationsHyperedgeCoverage(graph, *decomposition), verifier4.violationsHyperedgeCoverage(graph, *decomposition));
+    EXPECT_EQ(verifier1.violationsConnectednessCriterion(graph, *decomposition), verifier4.violationsConnectednessCriterion(graph, *decomposition));
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <stdexcept>
 #include <vector>
 
 class TreeTest : public ::testing::Test
@@ -692,6 +693,85 @@ TEST(TreeTest, CheckMakeRootFunctionality1)
     delete libraryInstance;
 }
 
+TEST(TreeTest, CheckNodeRecycling)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t root = tree.insertRoot();
+
+    htd::vertex_t node2 = tree.addChild(root);
+    htd::vertex_t node3 = tree.addChild(root);
+    htd::vertex_t node4 = tree.addChild(node2);
+
+    tree.removeSubtree(node2);
+
+    ASSERT_EQ((std::size_t)2, tree.vertexCount());
+
+    ASSERT_FALSE(tree.isVertex(node2));
+    ASSERT_FALSE(tree.isVertex(node4));
+
+    htd::vertex_t node5 = tree.addChild(node3);
+    htd::vertex_t node6 = tree.addParent(node3);
+
+    ASSERT_EQ((std::size_t)4, tree.vertexCount());
+
+    ASSERT_FALSE(tree.isVertex(node2));
+    ASSERT_FALSE(tree.isVertex(node4));
+
+    ASSERT_TRUE(tree.isParent(node3, node6));
+    ASSERT_TRUE(tree.isParent(node5, node3));
+    ASSERT_TRUE(tree.isParent(node6, root));
+
+    ASSERT_EQ((std::size_t)0, tree.childCount(node5));
+    ASSERT_EQ((std::size_t)2, tree.neighborCount(node3));
+    ASSERT_EQ((std::size_t)3, tree.edgeCount());
+
+    std::vector<htd::vertex_t> leaves;
+
+    tree.copyLeavesTo(leaves);
+
+    ASSERT_EQ((std::size_t)1, leaves.size());
+    ASSERT_EQ(node5, leaves[0]);
+
+    htd::Tree copy(tree);
+
+    ASSERT_EQ(tree.vertexVector(), copy.vertexVector());
+
+    copy.removeVertex(node6);
+
+    ASSERT_EQ((std::size_t)3, copy.vertexCount());
+    ASSERT_TRUE(copy.isParent(node3, root));
+    ASSERT_EQ((std::size_t)4, tree.vertexCount());
+
+    delete libraryInstance;
+}
+
+#ifdef NDEBUG
+/* Without NDEBUG the assertions in the accessors already reject vertices which were removed. */
+TEST(TreeTest, CheckAccessToRemovedVertex)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t root = tree.insertRoot();
+
+    htd::vertex_t node2 = tree.addChild(root);
+
+    tree.removeVertex(node2);
+
+    EXPECT_THROW(tree.parent(node2), std::out_of_range);
+    EXPECT_THROW(tree.childCount(node2), std::out_of_range);
+    EXPECT_THROW(tree.children(node2), std::out_of_range);
+    EXPECT_THROW(tree.isLeaf(node2), std::out_of_range);
+    EXPECT_THROW(tree.parent(node2 + 1), std::out_of_range);
+
+    delete libraryInstance;
+}
+#endif
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,233 @@
+/*
+ * File:   TreeWidthLowerBoundAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <vector>
+
+class TreeWidthLowerBoundAlgorithmTest : public ::testing::Test
+{
+    public:
+        TreeWidthLowerBoundAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~TreeWidthLowerBoundAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Compute the lower bound for the treewidth of the given graph after applying the given preprocessing strategy.
+ */
+std::size_t computeLowerBound(const htd::LibraryInstance * const libraryInstance, const htd::IMultiHypergraph & graph, std::size_t preprocessingStrategy)
+{
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(preprocessingStrategy);
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    htd::TreeWidthLowerBoundAlgorithm algorithm(libraryInstance);
+
+    std::size_t minorMinWidth = algorithm.computeMinorMinWidth(*preprocessedGraph);
+
+    std::size_t contractionDegeneracyBound = algorithm.computeContractionDegeneracyBound(*preprocessedGraph);
+
+    std::size_t ret = algorithm.computeLowerBound(*preprocessedGraph);
+
+    EXPECT_LE(minorMinWidth, ret);
+    EXPECT_LE(contractionDegeneracyBound, ret);
+    EXPECT_LE(preprocessedGraph->minTreeWidth(), ret);
+
+    delete preprocessedGraph;
+
+    return ret;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    ASSERT_EQ((std::size_t)0, computeLowerBound(libraryInstance, graph, 0));
+
+    graph.addVertices(5);
+
+    ASSERT_EQ((std::size_t)0, computeLowerBound(libraryInstance, graph, 0));
+
+    delete libraryInstance;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckTree)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 20);
+
+    for (htd::vertex_t vertex = 2; vertex <= 20; ++vertex)
+    {
+        graph.addEdge(vertex / 2, vertex);
+    }
+
+    ASSERT_EQ((std::size_t)1, computeLowerBound(libraryInstance, graph, 0));
+
+    delete libraryInstance;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckCycle)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 10);
+
+    for (htd::vertex_t vertex = 1; vertex < 10; ++vertex)
+    {
+        graph.addEdge(vertex, vertex + 1);
+    }
+
+    graph.addEdge(10, 1);
+
+    ASSERT_EQ((std::size_t)2, computeLowerBound(libraryInstance, graph, 0));
+
+    delete libraryInstance;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckClique)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 7);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 7; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 7; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    ASSERT_EQ((std::size_t)6, computeLowerBound(libraryInstance, graph, 0));
+    ASSERT_EQ((std::size_t)6, computeLowerBound(libraryInstance, graph, 2));
+
+    delete libraryInstance;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckGrid)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 100);
+
+    for (htd::vertex_t row = 0; row < 10; ++row)
+    {
+        for (htd::vertex_t column = 0; column < 10; ++column)
+        {
+            htd::vertex_t vertex = row * 10 + column + 1;
+
+            if (column + 1 < 10)
+            {
+                graph.addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < 10)
+            {
+                graph.addEdge(vertex, vertex + 10);
+            }
+        }
+    }
+
+    std::size_t lowerBound = computeLowerBound(libraryInstance, graph, 0);
+
+    /* The treewidth of a 10x10 grid is 10 and every grid containing a cycle has treewidth of at least 2. */
+    ASSERT_GE(lowerBound, (std::size_t)2);
+    ASSERT_LE(lowerBound, (std::size_t)10);
+
+    delete libraryInstance;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator generator(23);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    for (std::size_t iteration = 0; iteration < 50; ++iteration)
+    {
+        std::size_t vertexCount = 2 + generator.nextIndex(60);
+
+        htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+        std::size_t edgeCount = generator.nextIndex(4 * vertexCount);
+
+        for (std::size_t edge = 0; edge < edgeCount; ++edge)
+        {
+            htd::vertex_t vertex1 = 1 + generator.nextIndex(vertexCount);
+            htd::vertex_t vertex2 = 1 + generator.nextIndex(vertexCount);
+
+            if (vertex1 != vertex2)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        /* The bound must hold for the plain graph as well as for every preprocessed variant of it. */
+        for (std::size_t preprocessingStrategy = 0; preprocessingStrategy <= 2; ++preprocessingStrategy)
+        {
+            ASSERT_LT(computeLowerBound(libraryInstance, graph, preprocessingStrategy), decomposition->maximumBagSize());
+        }
+
+        delete decomposition;
+    }
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
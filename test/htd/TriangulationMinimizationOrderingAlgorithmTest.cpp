@@ -0,0 +1,353 @@
+/*
+ * File:   TriangulationMinimizationOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+
+class TriangulationMinimizationOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        TriangulationMinimizationOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~TriangulationMinimizationOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+typedef std::vector<std::set<htd::vertex_t>> AdjacencySets;
+
+AdjacencySets adjacencySets(const htd::IMultiHypergraph & graph)
+{
+    AdjacencySets ret(graph.vertexCount() > 0 ? graph.vertexAtPosition(graph.vertexCount() - 1) + 1 : 1);
+
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+    {
+        for (htd::vertex_t vertex1 : hyperedge)
+        {
+            for (htd::vertex_t vertex2 : hyperedge)
+            {
+                if (vertex1 != vertex2)
+                {
+                    ret[vertex1].insert(vertex2);
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+bool isPerfectEliminationOrdering(const AdjacencySets & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::vector<std::size_t> position(graph.size());
+
+    for (std::size_t index = 0; index < ordering.size(); ++index)
+    {
+        position[ordering[index]] = index;
+    }
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> laterNeighbors;
+
+        for (htd::vertex_t neighbor : graph[vertex])
+        {
+            if (position[neighbor] > position[vertex])
+            {
+                laterNeighbors.push_back(neighbor);
+            }
+        }
+
+        for (htd::vertex_t neighbor1 : laterNeighbors)
+        {
+            for (htd::vertex_t neighbor2 : laterNeighbors)
+            {
+                if (neighbor1 != neighbor2 && graph[neighbor1].count(neighbor2) == 0)
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+bool isChordal(const AdjacencySets & graph)
+{
+    std::vector<std::size_t> weights(graph.size(), 0);
+
+    std::vector<bool> numbered(graph.size(), false);
+
+    std::vector<htd::vertex_t> ordering;
+
+    for (std::size_t step = 1; step < graph.size(); ++step)
+    {
+        htd::vertex_t selectedVertex = htd::Vertex::UNKNOWN;
+
+        for (htd::vertex_t vertex = 1; vertex < graph.size(); ++vertex)
+        {
+            if (!numbered[vertex] && (selectedVertex == htd::Vertex::UNKNOWN || weights[vertex] > weights[selectedVertex]))
+            {
+                selectedVertex = vertex;
+            }
+        }
+
+        numbered[selectedVertex] = true;
+
+        for (htd::vertex_t neighbor : graph[selectedVertex])
+        {
+            ++(weights[neighbor]);
+        }
+
+        ordering.push_back(selectedVertex);
+    }
+
+    std::reverse(ordering.begin(), ordering.end());
+
+    return isPerfectEliminationOrdering(graph, ordering);
+}
+
+/**
+ *  Check that the elimination ordering yields a minimal triangulation, i.e., a chordal supergraph of
+ *  the input graph from which no single fill edge can be removed without losing chordality.
+ */
+bool isMinimalTriangulation(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    AdjacencySets triangulation = adjacencySets(graph);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges;
+
+    std::vector<bool> eliminated(triangulation.size(), false);
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> remainingNeighbors;
+
+        for (htd::vertex_t neighbor : triangulation[vertex])
+        {
+            if (!eliminated[neighbor])
+            {
+                remainingNeighbors.push_back(neighbor);
+            }
+        }
+
+        for (htd::vertex_t neighbor1 : remainingNeighbors)
+        {
+            for (htd::vertex_t neighbor2 : remainingNeighbors)
+            {
+                if (neighbor1 < neighbor2 && triangulation[neighbor1].insert(neighbor2).second)
+                {
+                    triangulation[neighbor2].insert(neighbor1);
+
+                    fillEdges.emplace_back(neighbor1, neighbor2);
+                }
+            }
+        }
+
+        eliminated[vertex] = true;
+    }
+
+    bool ret = isPerfectEliminationOrdering(triangulation, ordering);
+
+    for (auto it = fillEdges.begin(); ret && it != fillEdges.end(); ++it)
+    {
+        triangulation[it->first].erase(it->second);
+        triangulation[it->second].erase(it->first);
+
+        ret = !isChordal(triangulation);
+
+        triangulation[it->first].insert(it->second);
+        triangulation[it->second].insert(it->first);
+    }
+
+    return ret;
+}
+
+/**
+ *  Create a random graph whose vertex identifiers are not consecutive.
+ */
+htd::MultiHypergraph * createRandomGraph(const htd::LibraryInstance * const libraryInstance, std::size_t vertexCount, std::size_t edgeCount, htd::RandomNumberGenerator & generator)
+{
+    htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance, vertexCount + 1);
+
+    ret->removeVertex(1);
+
+    for (std::size_t edge = 0; edge < edgeCount; ++edge)
+    {
+        htd::vertex_t vertex1 = 2 + generator.nextIndex(vertexCount);
+        htd::vertex_t vertex2 = 2 + generator.nextIndex(vertexCount);
+
+        if (vertex1 != vertex2)
+        {
+            ret->addEdge(vertex1, vertex2);
+        }
+    }
+
+    return ret;
+}
+
+TEST(TriangulationMinimizationOrderingAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::TriangulationMinimizationOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(ordering->sequence().empty());
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(TriangulationMinimizationOrderingAlgorithmTest, CheckCycle)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 8);
+
+    for (htd::vertex_t vertex = 1; vertex < 8; ++vertex)
+    {
+        graph.addEdge(vertex, vertex + 1);
+    }
+
+    graph.addEdge(8, 1);
+
+    htd::TriangulationMinimizationOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setOrderingAlgorithm(new htd::RandomOrderingAlgorithm(libraryInstance));
+
+    for (std::size_t iteration = 0; iteration < 10; ++iteration)
+    {
+        const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+        ASSERT_EQ((std::size_t)8, ordering->sequence().size());
+
+        ASSERT_TRUE(isMinimalTriangulation(graph, ordering->sequence()));
+
+        delete ordering;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(TriangulationMinimizationOrderingAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator generator(11);
+
+    htd::TriangulationMinimizationOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setOrderingAlgorithm(new htd::RandomOrderingAlgorithm(libraryInstance));
+
+    for (std::size_t iteration = 0; iteration < 20; ++iteration)
+    {
+        std::size_t vertexCount = 10 + generator.nextIndex(30);
+
+        htd::MultiHypergraph * graph = createRandomGraph(libraryInstance, vertexCount, 2 * vertexCount, generator);
+
+        const htd::IVertexOrdering * ordering = algorithm.computeOrdering(*graph);
+
+        std::vector<htd::vertex_t> sequence(ordering->sequence());
+
+        ASSERT_EQ(vertexCount, sequence.size());
+
+        ASSERT_TRUE(isMinimalTriangulation(*graph, sequence));
+
+        std::sort(sequence.begin(), sequence.end());
+
+        ASSERT_TRUE(std::adjacent_find(sequence.begin(), sequence.end()) == sequence.end());
+        ASSERT_EQ((htd::vertex_t)2, sequence.front());
+
+        delete ordering;
+        delete graph;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(TriangulationMinimizationOrderingAlgorithmTest, CheckThreadCountIndependence)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::RandomNumberGenerator generator(13);
+
+    htd::MultiHypergraph * graph = createRandomGraph(libraryInstance, 300, 900, generator);
+
+    htd::TriangulationMinimizationOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setOrderingAlgorithm(new htd::RandomOrderingAlgorithm(libraryInstance));
+
+    ASSERT_EQ((std::size_t)1, algorithm.threadCount());
+
+    htd::randomNumberGenerator().seed(17);
+
+    const htd::IVertexOrdering * ordering1 = algorithm.computeOrdering(*graph);
+
+    algorithm.setThreadCount(4);
+
+    ASSERT_EQ((std::size_t)4, algorithm.threadCount());
+
+    htd::randomNumberGenerator().seed(17);
+
+    const htd::IVertexOrdering * ordering2 = algorithm.computeOrdering(*graph);
+
+    ASSERT_EQ(ordering1->sequence(), ordering2->sequence());
+
+    delete ordering1;
+    delete ordering2;
+    delete graph;
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
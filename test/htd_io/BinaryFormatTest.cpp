@@ -0,0 +1,388 @@
+/*
+ * File:   BinaryFormatTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class BinaryFormatTest : public ::testing::Test
+{
+    public:
+        BinaryFormatTest(void)
+        {
+
+        }
+
+        virtual ~BinaryFormatTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Write the given graph in the binary format to a string.
+ */
+std::string exportGraph(const htd::IMultiHypergraph & graph)
+{
+    std::ostringstream stream;
+
+    htd_io::BinaryFormatExporter().write(graph, stream);
+
+    return stream.str();
+}
+
+/**
+ *  Write the given decomposition of the given graph in the binary format to a string.
+ */
+std::string exportDecomposition(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph)
+{
+    std::ostringstream stream;
+
+    htd_io::BinaryFormatExporter().write(decomposition, graph, stream);
+
+    return stream.str();
+}
+
+/**
+ *  Import a graph in the binary format from the given string.
+ */
+htd::IMultiHypergraph * importGraph(const htd::LibraryInstance * libraryInstance, const std::string & content)
+{
+    std::istringstream stream(content);
+
+    return htd_io::BinaryFormatImporter(libraryInstance).import(stream);
+}
+
+/**
+ *  Import a decomposition in the binary format from the given string.
+ */
+htd::ITreeDecomposition * importDecomposition(const htd::LibraryInstance * libraryInstance, const std::string & content)
+{
+    std::istringstream stream(content);
+
+    return htd_io::BinaryFormatImporter(libraryInstance).importDecomposition(stream);
+}
+
+/**
+ *  Overwrite the 32-bit value at the given byte offset of the given file content.
+ */
+void patch32(std::string & content, std::size_t offset, std::uint32_t value)
+{
+    std::memcpy(&content[offset], &value, sizeof(value));
+}
+
+/**
+ *  Overwrite the 64-bit value at the given byte offset of the given file content.
+ */
+void patch64(std::string & content, std::size_t offset, std::uint64_t value)
+{
+    std::memcpy(&content[offset], &value, sizeof(value));
+}
+
+/**
+ *  Create the hypergraph used by the tests. It contains a hyperedge, a duplicate edge and a loop.
+ */
+htd::MultiHypergraph * createHypergraph(const htd::LibraryInstance * libraryInstance)
+{
+    htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance, 6);
+
+    ret->addEdge(std::vector<htd::vertex_t> { 1, 2, 3 });
+    ret->addEdge(3, 4);
+    ret->addEdge(4, 3);
+    ret->addEdge(4, 5);
+    ret->addEdge(5, 5);
+    ret->addEdge(std::vector<htd::vertex_t> { 2, 5, 6 });
+
+    return ret;
+}
+
+/**
+ *  Collect the bags of the given decomposition in pre-order, each followed by the bag of its parent.
+ */
+std::vector<std::vector<htd::vertex_t>> preOrderBags(const htd::ITreeDecomposition & decomposition)
+{
+    std::vector<std::vector<htd::vertex_t>> ret;
+
+    htd::PreOrderTreeTraversal traversal;
+
+    traversal.traverse(decomposition, [&](htd::vertex_t node, htd::vertex_t parent, std::size_t distanceToRoot)
+    {
+        HTD_UNUSED(distanceToRoot)
+
+        ret.push_back(decomposition.bagContent(node));
+
+        ret.push_back(parent != htd::Vertex::UNKNOWN ? decomposition.bagContent(parent) : std::vector<htd::vertex_t>());
+    });
+
+    return ret;
+}
+
+TEST(BinaryFormatTest, CheckGraphRoundTrip)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph * graph = createHypergraph(libraryInstance);
+
+    htd::IMultiHypergraph * importedGraph = importGraph(libraryInstance, exportGraph(*graph));
+
+    ASSERT_NE(importedGraph, nullptr);
+
+    ASSERT_EQ(graph->vertexCount(), importedGraph->vertexCount());
+    ASSERT_EQ(graph->edgeCount(), importedGraph->edgeCount());
+
+    for (htd::index_t index = 0; index < graph->edgeCount(); ++index)
+    {
+        EXPECT_EQ(graph->hyperedgeAtPosition(index).elements(), importedGraph->hyperedgeAtPosition(index).elements());
+    }
+
+    delete importedGraph;
+    delete graph;
+
+    htd::MultiGraph multiGraph(libraryInstance, 3);
+
+    multiGraph.addEdge(1, 2);
+    multiGraph.addEdge(2, 1);
+    multiGraph.addEdge(3, 3);
+
+    importedGraph = importGraph(libraryInstance, exportGraph(multiGraph));
+
+    ASSERT_NE(importedGraph, nullptr);
+
+    ASSERT_EQ((std::size_t)3, importedGraph->vertexCount());
+    ASSERT_EQ((std::size_t)3, importedGraph->edgeCount());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 2, 1 }), importedGraph->hyperedgeAtPosition(1).elements());
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 3, 3 }), importedGraph->hyperedgeAtPosition(2).elements());
+
+    delete importedGraph;
+
+    delete libraryInstance;
+}
+
+TEST(BinaryFormatTest, CheckDecompositionRoundTrip)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph * graph = createHypergraph(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(*graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::ITreeDecomposition * importedDecomposition = importDecomposition(libraryInstance, exportDecomposition(*decomposition, *graph));
+
+    ASSERT_NE(importedDecomposition, nullptr);
+
+    ASSERT_EQ(decomposition->vertexCount(), importedDecomposition->vertexCount());
+    ASSERT_EQ(decomposition->maximumBagSize(), importedDecomposition->maximumBagSize());
+
+    EXPECT_EQ(preOrderBags(*decomposition), preOrderBags(*importedDecomposition));
+
+    delete importedDecomposition;
+    delete decomposition;
+    delete graph;
+
+    delete libraryInstance;
+}
+
+TEST(BinaryFormatTest, CheckRejectionOfTruncatedFiles)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph * graph = createHypergraph(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(*graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    std::string graphContent = exportGraph(*graph);
+
+    std::string decompositionContent = exportDecomposition(*decomposition, *graph);
+
+    for (std::size_t length = 0; length < graphContent.size(); ++length)
+    {
+        EXPECT_EQ(importGraph(libraryInstance, graphContent.substr(0, length)), nullptr);
+    }
+
+    for (std::size_t length = 0; length < decompositionContent.size(); ++length)
+    {
+        EXPECT_EQ(importDecomposition(libraryInstance, decompositionContent.substr(0, length)), nullptr);
+    }
+
+    EXPECT_EQ(importGraph(libraryInstance, graphContent + std::string(4, '\0')), nullptr);
+
+    EXPECT_EQ(importDecomposition(libraryInstance, decompositionContent + std::string(4, '\0')), nullptr);
+
+    delete decomposition;
+    delete graph;
+
+    delete libraryInstance;
+}
+
+TEST(BinaryFormatTest, CheckRejectionOfInvalidHeaders)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph * graph = createHypergraph(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(*graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    std::string graphContent = exportGraph(*graph);
+
+    std::string decompositionContent = exportDecomposition(*decomposition, *graph);
+
+    /* Each kind of file is rejected by the importer of the other kind. */
+    EXPECT_EQ(importGraph(libraryInstance, decompositionContent), nullptr);
+    EXPECT_EQ(importDecomposition(libraryInstance, graphContent), nullptr);
+
+    std::string invalidContent = graphContent;
+
+    patch32(invalidContent, 0, 0x12345678);
+
+    EXPECT_EQ(importGraph(libraryInstance, invalidContent), nullptr);
+
+    invalidContent = decompositionContent;
+
+    patch32(invalidContent, 0, 0x12345678);
+
+    EXPECT_EQ(importDecomposition(libraryInstance, invalidContent), nullptr);
+
+    const std::uint32_t unsupportedVersion = htd_io::BinaryFormat::VERSION + 1;
+
+    invalidContent = graphContent;
+
+    patch32(invalidContent, 4, unsupportedVersion);
+
+    EXPECT_EQ(importGraph(libraryInstance, invalidContent), nullptr);
+
+    invalidContent = decompositionContent;
+
+    patch32(invalidContent, 4, unsupportedVersion);
+
+    EXPECT_EQ(importDecomposition(libraryInstance, invalidContent), nullptr);
+
+    /* A byte order mark in reversed byte order identifies a file written on a machine with a different byte order. */
+    invalidContent = graphContent;
+
+    patch32(invalidContent, 8, 0x04030201);
+
+    EXPECT_EQ(importGraph(libraryInstance, invalidContent), nullptr);
+
+    delete decomposition;
+    delete graph;
+
+    delete libraryInstance;
+}
+
+TEST(BinaryFormatTest, CheckRejectionOfVerticesAboveVertexCount)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph * graph = createHypergraph(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(*graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    std::string graphContent = exportGraph(*graph);
+
+    std::string decompositionContent = exportDecomposition(*decomposition, *graph);
+
+    /* Vertex 6 is an endpoint of the last hyperedge and it is contained in at least one bag. */
+    std::string invalidContent = graphContent;
+
+    patch64(invalidContent, 16, 5);
+
+    EXPECT_EQ(importGraph(libraryInstance, invalidContent), nullptr);
+
+    invalidContent = decompositionContent;
+
+    patch64(invalidContent, 24, 5);
+
+    EXPECT_EQ(importDecomposition(libraryInstance, invalidContent), nullptr);
+
+    invalidContent = decompositionContent;
+
+    patch64(invalidContent, 24, 0xFFFFFFFFFFFFFFFFULL);
+
+    EXPECT_EQ(importDecomposition(libraryInstance, invalidContent), nullptr);
+
+    invalidContent = decompositionContent;
+
+    patch64(invalidContent, 24, 6);
+
+    htd::ITreeDecomposition * importedDecomposition = importDecomposition(libraryInstance, invalidContent);
+
+    EXPECT_NE(importedDecomposition, nullptr);
+
+    delete importedDecomposition;
+
+    /* The exporter refuses to write bags which contain vertices that do not belong to the given graph. */
+    htd::MultiHypergraph smallGraph(libraryInstance, 5);
+
+    std::ostringstream stream;
+
+    htd_io::BinaryFormatExporter().write(*decomposition, smallGraph, stream);
+
+    EXPECT_TRUE(stream.fail());
+
+    delete decomposition;
+    delete graph;
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,71 @@
+# Runs PROGRAM in batch mode on BATCH within WORKING_DIRECTORY and checks the
+# exit status against EXPECTED_RESULT and the summary written to stdout
+# against EXPECTED_SUMMARY, a '|'-separated list of lines without the three
+# timing columns.
+#
+# Optional parameters:
+#   OUTPUT_DIRECTORY     Directory to which the decompositions are written.
+#                        It is recreated before the run.
+#   EXPECTED_FILE_COUNT  Number of distinct files expected in OUTPUT_DIRECTORY.
+#   SOURCE_DIRECTORY     Directory which is copied to WORKING_DIRECTORY/BATCH
+#                        before the first run.
+#   RUN_COUNT            Number of times the batch is run (Default: 1).
+
+if(NOT DEFINED RUN_COUNT)
+    set(RUN_COUNT 1)
+endif()
+
+set(ARGUMENTS --batch "${BATCH}")
+
+if(DEFINED OUTPUT_DIRECTORY)
+    file(REMOVE_RECURSE "${OUTPUT_DIRECTORY}")
+    file(MAKE_DIRECTORY "${OUTPUT_DIRECTORY}")
+
+    list(APPEND ARGUMENTS --output-directory "${OUTPUT_DIRECTORY}")
+endif()
+
+if(DEFINED SOURCE_DIRECTORY)
+    file(REMOVE_RECURSE "${WORKING_DIRECTORY}/${BATCH}")
+    file(MAKE_DIRECTORY "${WORKING_DIRECTORY}/${BATCH}")
+    file(GLOB SOURCE_FILES "${SOURCE_DIRECTORY}/*")
+    file(COPY ${SOURCE_FILES} DESTINATION "${WORKING_DIRECTORY}/${BATCH}")
+endif()
+
+string(REPLACE "|" ";" EXPECTED_LINES "${EXPECTED_SUMMARY}")
+
+foreach(RUN RANGE 1 ${RUN_COUNT})
+    execute_process(COMMAND ${PROGRAM} ${ARGUMENTS}
+                    WORKING_DIRECTORY "${WORKING_DIRECTORY}"
+                    RESULT_VARIABLE RESULT
+                    OUTPUT_VARIABLE OUTPUT
+                    ERROR_VARIABLE ERROR)
+
+    if(NOT RESULT EQUAL EXPECTED_RESULT)
+        message(FATAL_ERROR "Run ${RUN}: Program exited with status ${RESULT} instead of ${EXPECTED_RESULT}:\n${OUTPUT}${ERROR}")
+    endif()
+
+    string(REGEX REPLACE "\n$" "" OUTPUT "${OUTPUT}")
+    string(REPLACE "\n" ";" OUTPUT_LINES "${OUTPUT}")
+
+    set(SUMMARY_LINES)
+
+    foreach(LINE IN LISTS OUTPUT_LINES)
+        string(REGEX REPLACE ",[^,]*,[^,]*,[^,]*$" "" LINE "${LINE}")
+
+        list(APPEND SUMMARY_LINES "${LINE}")
+    endforeach()
+
+    if(NOT "${SUMMARY_LINES}" STREQUAL "${EXPECTED_LINES}")
+        message(FATAL_ERROR "Run ${RUN}: Unexpected summary:\n${OUTPUT}\nExpected (without timings):\n${EXPECTED_SUMMARY}")
+    endif()
+endforeach()
+
+if(DEFINED EXPECTED_FILE_COUNT)
+    file(GLOB OUTPUT_FILES "${OUTPUT_DIRECTORY}/*")
+
+    list(LENGTH OUTPUT_FILES OUTPUT_FILE_COUNT)
+
+    if(NOT OUTPUT_FILE_COUNT EQUAL EXPECTED_FILE_COUNT)
+        message(FATAL_ERROR "Expected ${EXPECTED_FILE_COUNT} output files, found ${OUTPUT_FILE_COUNT}: ${OUTPUT_FILES}\n${OUTPUT}")
+    endif()
+endif()
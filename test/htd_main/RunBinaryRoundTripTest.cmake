@@ -0,0 +1,40 @@
+# Converts the instance INPUT_FILE given in format INPUT_FORMAT to the binary
+# format via option --save-instance and checks that PROGRAM computes the same
+# decomposition for the converted instance as for the original one.
+
+set(BINARY_FILE "${WORKING_DIRECTORY}/${TEST_NAME}.bin")
+
+file(REMOVE "${BINARY_FILE}")
+
+execute_process(COMMAND ${PROGRAM} --input ${INPUT_FORMAT} --save-instance "${BINARY_FILE}"
+                INPUT_FILE "${INPUT_FILE}"
+                RESULT_VARIABLE RESULT
+                OUTPUT_VARIABLE OUTPUT
+                ERROR_VARIABLE ERROR)
+
+if(NOT RESULT EQUAL 0 OR NOT EXISTS "${BINARY_FILE}")
+    message(FATAL_ERROR "Conversion failed with status ${RESULT}:\n${OUTPUT}${ERROR}")
+endif()
+
+execute_process(COMMAND ${PROGRAM} --input ${INPUT_FORMAT}
+                INPUT_FILE "${INPUT_FILE}"
+                RESULT_VARIABLE RESULT
+                OUTPUT_VARIABLE EXPECTED_OUTPUT
+                ERROR_VARIABLE ERROR)
+
+if(NOT RESULT EQUAL 0 OR EXPECTED_OUTPUT STREQUAL "")
+    message(FATAL_ERROR "Decomposing the original instance failed with status ${RESULT}:\n${EXPECTED_OUTPUT}${ERROR}")
+endif()
+
+execute_process(COMMAND ${PROGRAM} --input binary --instance "${BINARY_FILE}"
+                RESULT_VARIABLE RESULT
+                OUTPUT_VARIABLE OUTPUT
+                ERROR_VARIABLE ERROR)
+
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "Decomposing the converted instance failed with status ${RESULT}:\n${OUTPUT}${ERROR}")
+endif()
+
+if(NOT OUTPUT STREQUAL EXPECTED_OUTPUT)
+    message(FATAL_ERROR "Decompositions differ:\n${OUTPUT}\nExpected:\n${EXPECTED_OUTPUT}")
+endif()
@@ -0,0 +1,22 @@
+# Runs PROGRAM with the arguments ARGUMENTS on the instance INPUT_FILE and
+# checks that the call succeeds and that its output contains EXPECTED_OUTPUT.
+
+execute_process(COMMAND ${PROGRAM} ${ARGUMENTS}
+                INPUT_FILE "${INPUT_FILE}"
+                RESULT_VARIABLE RESULT
+                OUTPUT_VARIABLE OUTPUT
+                ERROR_VARIABLE ERROR)
+
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "Program exited with status ${RESULT}:\n${OUTPUT}${ERROR}")
+endif()
+
+if(ERROR MATCHES "INVALID")
+    message(FATAL_ERROR "Program rejected the call:\n${ERROR}")
+endif()
+
+string(FIND "${OUTPUT}" "${EXPECTED_OUTPUT}" POSITION)
+
+if(POSITION EQUAL -1)
+    message(FATAL_ERROR "Output does not contain \"${EXPECTED_OUTPUT}\":\n${OUTPUT}")
+endif()
@@ -0,0 +1,13 @@
+# Runs PROGRAM with the arguments ARGUMENTS on the instance INPUT_FILE and
+# checks that the instance is rejected, i.e., that no decomposition is
+# written to stdout.
+
+execute_process(COMMAND ${PROGRAM} ${ARGUMENTS}
+                INPUT_FILE "${INPUT_FILE}"
+                RESULT_VARIABLE RESULT
+                OUTPUT_VARIABLE OUTPUT
+                ERROR_VARIABLE ERROR)
+
+if(NOT OUTPUT STREQUAL "")
+    message(FATAL_ERROR "Program accepted the instance (status ${RESULT}):\n${OUTPUT}${ERROR}")
+endif()